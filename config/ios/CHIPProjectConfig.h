@@ -49,4 +49,8 @@
 // so we need to make sure the pool is big enough for that.
 #define CHIP_CONFIG_SECURE_SESSION_POOL_SIZE 1000
 
+// Likewise, keep the addresses of all of them, so that sessions can be
+// re-established without resolving every accessory first.
+#define CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE 1000
+
 #endif /* CHIPPROJECTCONFIG_H */
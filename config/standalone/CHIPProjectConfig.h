@@ -85,6 +85,12 @@
 //
 #define CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS 150
 
+// Keep the addresses of the nodes host applications (e.g. chip-tool) talk to.
+#define CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE 64
+
+// Likewise, skip re-verifying the certificates of those nodes on every CASE session.
+#define CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE 64
+
 // Safe to enable this flag since standalone is associated with host and not a device.
 #define CONFIG_BUILD_FOR_HOST_UNIT_TEST 1
 
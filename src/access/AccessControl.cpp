@@ -24,6 +24,9 @@
 #include "AccessControl.h"
 
 #include <lib/core/Global.h>
+#include <lib/support/SafeInt.h>
+
+#include <algorithm>
 
 namespace chip {
 namespace Access {
@@ -90,6 +93,13 @@ constexpr bool IsValidGroupNodeId(NodeId aNodeId)
     return IsGroupId(aNodeId) && IsValidGroupId(GroupIdFromNodeId(aNodeId));
 }
 
+#if CHIP_CONFIG_ACCESS_CONTROL_COMPILED_CHECK && CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE > 0
+bool IsSameSubject(const SubjectDescriptor & a, const SubjectDescriptor & b)
+{
+    return a.fabricIndex == b.fabricIndex && a.authMode == b.authMode && a.subject == b.subject && a.cats == b.cats;
+}
+#endif
+
 #if CHIP_PROGRESS_LOGGING && CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 1
 
 char GetAuthModeStringForLogging(AuthMode authMode)
@@ -190,6 +200,10 @@ CHIP_ERROR AccessControl::Init(AccessControl::Delegate * delegate, DeviceTypeRes
     {
         mDelegate           = delegate;
         mDeviceTypeResolver = &deviceTypeResolver;
+#if CHIP_CONFIG_ACCESS_CONTROL_COMPILED_CHECK
+        mCompiledEntries.Invalidate();
+        AddEntryListener(mCompiledEntries);
+#endif
     }
 
     return retval;
@@ -199,6 +213,10 @@ void AccessControl::Finish()
 {
     VerifyOrReturn(IsInitialized());
     ChipLogProgress(DataManagement, "AccessControl: finishing");
+#if CHIP_CONFIG_ACCESS_CONTROL_COMPILED_CHECK
+    RemoveEntryListener(mCompiledEntries);
+    mCompiledEntries.Invalidate();
+#endif
     mDelegate->Finish();
     mDelegate = nullptr;
 }
@@ -355,6 +373,24 @@ CHIP_ERROR AccessControl::Check(const SubjectDescriptor & subjectDescriptor, con
         return CHIP_NO_ERROR;
     }
 
+#if CHIP_CONFIG_ACCESS_CONTROL_COMPILED_CHECK
+    {
+        bool allowed = false;
+        if (mCompiledEntries.Check(*this, subjectDescriptor, requestPath, requestPrivilege, allowed))
+        {
+            if (allowed)
+            {
+#if CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+                ChipLogProgress(DataManagement, "AccessControl: allowed");
+#endif // CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+                return CHIP_NO_ERROR;
+            }
+            ChipLogProgress(DataManagement, "AccessControl: denied");
+            return CHIP_ERROR_ACCESS_DENIED;
+        }
+    }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_COMPILED_CHECK
+
     EntryIterator iterator;
     ReturnErrorOnFailure(Entries(iterator, &subjectDescriptor.fabricIndex));
 
@@ -469,6 +505,270 @@ CHIP_ERROR AccessControl::Check(const SubjectDescriptor & subjectDescriptor, con
     return CHIP_ERROR_ACCESS_DENIED;
 }
 
+#if CHIP_CONFIG_ACCESS_CONTROL_COMPILED_CHECK
+void AccessControl::CompiledEntries::Invalidate()
+{
+    mState = State::kStale;
+    mEntries.Free();
+    mSubjects.Free();
+    mTargets.Free();
+    mEntryCount = 0;
+#if CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE > 0
+    mCachedDecisionCount = 0;
+    mNextCachedDecision  = 0;
+#endif
+}
+
+bool AccessControl::CompiledEntries::Check(AccessControl & accessControl, const SubjectDescriptor & subjectDescriptor,
+                                           const RequestPath & requestPath, Privilege requestPrivilege, bool & allowed)
+{
+    if (FindCachedDecision(subjectDescriptor, requestPath, requestPrivilege, allowed))
+    {
+        return true;
+    }
+
+    if (mState == State::kStale)
+    {
+        CHIP_ERROR err = Compile(accessControl);
+        if (err != CHIP_NO_ERROR)
+        {
+            // Entries which cannot be compiled are walked instead, until the access control list changes.
+            ChipLogError(DataManagement, "AccessControl: cannot compile entries: %" CHIP_ERROR_FORMAT, err.Format());
+            Invalidate();
+            mState = State::kUnavailable;
+        }
+        else
+        {
+            mState = State::kCompiled;
+        }
+    }
+    VerifyOrReturnValue(mState == State::kCompiled, false);
+
+    const CompiledEntry * begin = mEntries.Get();
+    const CompiledEntry * end   = begin + mEntryCount;
+    const CompiledEntry * entry =
+        std::lower_bound(begin, end, subjectDescriptor.fabricIndex,
+                         [](const CompiledEntry & e, FabricIndex fabricIndex) { return e.fabricIndex < fabricIndex; });
+
+    bool usedDeviceTypeResolver = false;
+    allowed                     = false;
+    for (; entry != end && entry->fabricIndex == subjectDescriptor.fabricIndex; ++entry)
+    {
+        if (entry->authMode == subjectDescriptor.authMode &&
+            CheckRequestPrivilegeAgainstEntryPrivilege(requestPrivilege, entry->privilege) &&
+            CheckSubjects(*entry, subjectDescriptor) &&
+            CheckTargets(*entry, requestPath, *accessControl.mDeviceTypeResolver, usedDeviceTypeResolver))
+        {
+            allowed = true;
+            break;
+        }
+    }
+
+    // Device types can be added to or removed from endpoints without the access control list changing.
+    if (!usedDeviceTypeResolver)
+    {
+        CacheDecision(subjectDescriptor, requestPath, requestPrivilege, allowed);
+    }
+    return true;
+}
+
+CHIP_ERROR AccessControl::CompiledEntries::Compile(AccessControl & accessControl)
+{
+    size_t entryCount   = 0;
+    size_t subjectCount = 0;
+    size_t targetCount  = 0;
+    CHIP_ERROR err;
+
+    // Size the arrays in a first walk of the entries of all fabrics, then fill them in a second one.
+    {
+        EntryIterator iterator;
+        Entry entry;
+        ReturnErrorOnFailure(accessControl.Entries(iterator));
+        while ((err = iterator.Next(entry)) == CHIP_NO_ERROR)
+        {
+            size_t count = 0;
+            ReturnErrorOnFailure(entry.GetSubjectCount(count));
+            subjectCount += count;
+            ReturnErrorOnFailure(entry.GetTargetCount(count));
+            targetCount += count;
+            entryCount++;
+        }
+        VerifyOrReturnError(err == CHIP_ERROR_SENTINEL, err);
+    }
+    VerifyOrReturnError(CanCastTo<uint32_t>(subjectCount) && CanCastTo<uint32_t>(targetCount), CHIP_ERROR_NO_MEMORY);
+
+    if (entryCount > 0)
+    {
+        VerifyOrReturnError(mEntries.Calloc(entryCount), CHIP_ERROR_NO_MEMORY);
+    }
+    if (subjectCount > 0)
+    {
+        VerifyOrReturnError(mSubjects.Calloc(subjectCount), CHIP_ERROR_NO_MEMORY);
+    }
+    if (targetCount > 0)
+    {
+        VerifyOrReturnError(mTargets.Calloc(targetCount), CHIP_ERROR_NO_MEMORY);
+    }
+
+    size_t entryIndex     = 0;
+    uint32_t subjectIndex = 0;
+    uint32_t targetIndex  = 0;
+
+    EntryIterator iterator;
+    Entry entry;
+    ReturnErrorOnFailure(accessControl.Entries(iterator));
+    while ((err = iterator.Next(entry)) == CHIP_NO_ERROR)
+    {
+        VerifyOrReturnError(entryIndex < entryCount, CHIP_ERROR_INCORRECT_STATE);
+        CompiledEntry & compiled = mEntries[entryIndex++];
+
+        ReturnErrorOnFailure(entry.GetFabricIndex(compiled.fabricIndex));
+        ReturnErrorOnFailure(entry.GetAuthMode(compiled.authMode));
+        ReturnErrorOnFailure(entry.GetPrivilege(compiled.privilege));
+
+        // Entries which Check would fail on, rather than deny, are left for it to walk.
+        VerifyOrReturnError(compiled.authMode == AuthMode::kCase || compiled.authMode == AuthMode::kGroup,
+                            CHIP_ERROR_INCORRECT_STATE);
+
+        size_t count = 0;
+        ReturnErrorOnFailure(entry.GetSubjectCount(count));
+        VerifyOrReturnError(count <= subjectCount - subjectIndex && CanCastTo<uint16_t>(count), CHIP_ERROR_INCORRECT_STATE);
+        compiled.firstSubject = subjectIndex;
+        compiled.subjectCount = static_cast<uint16_t>(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            NodeId subject = kUndefinedNodeId;
+            ReturnErrorOnFailure(entry.GetSubject(i, subject));
+            if (IsOperationalNodeId(subject) || IsCASEAuthTag(subject))
+            {
+                VerifyOrReturnError(compiled.authMode == AuthMode::kCase, CHIP_ERROR_INCORRECT_STATE);
+            }
+            else
+            {
+                VerifyOrReturnError(IsGroupId(subject) && compiled.authMode == AuthMode::kGroup, CHIP_ERROR_INCORRECT_STATE);
+            }
+            mSubjects[subjectIndex++] = subject;
+        }
+
+        ReturnErrorOnFailure(entry.GetTargetCount(count));
+        VerifyOrReturnError(count <= targetCount - targetIndex && CanCastTo<uint16_t>(count), CHIP_ERROR_INCORRECT_STATE);
+        compiled.firstTarget = targetIndex;
+        compiled.targetCount = static_cast<uint16_t>(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            Entry::Target target;
+            ReturnErrorOnFailure(entry.GetTarget(i, target));
+            CompiledTarget & compiledTarget = mTargets[targetIndex++];
+            compiledTarget.flags            = target.flags;
+            if (target.flags & Entry::Target::kCluster)
+            {
+                compiledTarget.cluster = target.cluster;
+            }
+            if (target.flags & Entry::Target::kEndpoint)
+            {
+                compiledTarget.endpoint = target.endpoint;
+            }
+            if (target.flags & Entry::Target::kDeviceType)
+            {
+                compiledTarget.deviceType = target.deviceType;
+            }
+        }
+    }
+    VerifyOrReturnError(err == CHIP_ERROR_SENTINEL, err);
+
+    // Which entry allows access does not matter, so the order of the entries of a fabric need not be kept.
+    mEntryCount = entryIndex;
+    std::sort(mEntries.Get(), mEntries.Get() + mEntryCount,
+              [](const CompiledEntry & a, const CompiledEntry & b) { return a.fabricIndex < b.fabricIndex; });
+
+    return CHIP_NO_ERROR;
+}
+
+bool AccessControl::CompiledEntries::CheckSubjects(const CompiledEntry & entry, const SubjectDescriptor & subjectDescriptor) const
+{
+    if (entry.subjectCount == 0)
+    {
+        return true;
+    }
+    const NodeId * subject = &mSubjects[entry.firstSubject];
+    for (const NodeId * end = subject + entry.subjectCount; subject != end; ++subject)
+    {
+        if (IsCASEAuthTag(*subject) ? subjectDescriptor.cats.CheckSubjectAgainstCATs(*subject)
+                                    : *subject == subjectDescriptor.subject)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool AccessControl::CompiledEntries::CheckTargets(const CompiledEntry & entry, const RequestPath & requestPath,
+                                                  DeviceTypeResolver & deviceTypeResolver, bool & usedDeviceTypeResolver) const
+{
+    if (entry.targetCount == 0)
+    {
+        return true;
+    }
+    const CompiledTarget * target = &mTargets[entry.firstTarget];
+    for (const CompiledTarget * end = target + entry.targetCount; target != end; ++target)
+    {
+        if ((target->flags & Entry::Target::kCluster) && target->cluster != requestPath.cluster)
+        {
+            continue;
+        }
+        if ((target->flags & Entry::Target::kEndpoint) && target->endpoint != requestPath.endpoint)
+        {
+            continue;
+        }
+        if (target->flags & Entry::Target::kDeviceType)
+        {
+            usedDeviceTypeResolver = true;
+            if (!deviceTypeResolver.IsDeviceTypeOnEndpoint(target->deviceType, requestPath.endpoint))
+            {
+                continue;
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+bool AccessControl::CompiledEntries::FindCachedDecision(const SubjectDescriptor & subjectDescriptor,
+                                                        const RequestPath & requestPath, Privilege requestPrivilege,
+                                                        bool & allowed) const
+{
+#if CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE > 0
+    // Start from the latest decision: consecutive checks are often for the same cluster.
+    constexpr size_t kCacheSize = CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE;
+    for (size_t i = 1; i <= mCachedDecisionCount; ++i)
+    {
+        const CachedDecision & decision = mCachedDecisions[(mNextCachedDecision + kCacheSize - i) % kCacheSize];
+        if (decision.requestPath.cluster == requestPath.cluster && decision.requestPath.endpoint == requestPath.endpoint &&
+            decision.requestPrivilege == requestPrivilege && IsSameSubject(decision.subjectDescriptor, subjectDescriptor))
+        {
+            allowed = decision.allowed;
+            return true;
+        }
+    }
+#endif
+    return false;
+}
+
+void AccessControl::CompiledEntries::CacheDecision(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                                   Privilege requestPrivilege, bool allowed)
+{
+#if CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE > 0
+    CachedDecision & decision  = mCachedDecisions[mNextCachedDecision];
+    decision.subjectDescriptor = subjectDescriptor;
+    decision.requestPath       = requestPath;
+    decision.requestPrivilege  = requestPrivilege;
+    decision.allowed           = allowed;
+    mNextCachedDecision        = (mNextCachedDecision + 1) % CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE;
+    mCachedDecisionCount       = std::min<size_t>(mCachedDecisionCount + 1, CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE);
+#endif
+}
+#endif // CHIP_CONFIG_ACCESS_CONTROL_COMPILED_CHECK
+
 #if CHIP_ACCESS_CONTROL_DUMP_ENABLED
 CHIP_ERROR AccessControl::Dump(const Entry & entry)
 {
@@ -25,6 +25,7 @@
 #include <lib/core/CHIPCore.h>
 #include <lib/core/Global.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedBuffer.h>
 
 // Dump function for use during development only (0 for disabled, non-zero for enabled).
 #define CHIP_ACCESS_CONTROL_DUMP_ENABLED 0
@@ -497,6 +498,7 @@ public:
     {
         ReturnErrorCodeIf(!IsValid(entry), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        EntriesChanged();
         return mDelegate->CreateEntry(index, entry, fabricIndex);
     }
 
@@ -547,6 +549,7 @@ public:
     {
         ReturnErrorCodeIf(!IsValid(entry), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        EntriesChanged();
         return mDelegate->UpdateEntry(index, entry, fabricIndex);
     }
 
@@ -568,6 +571,7 @@ public:
     CHIP_ERROR DeleteEntry(size_t index, const FabricIndex * fabricIndex = nullptr)
     {
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        EntriesChanged();
         return mDelegate->DeleteEntry(index, fabricIndex);
     }
 
@@ -642,6 +646,99 @@ public:
 #endif
 
 private:
+#if CHIP_CONFIG_ACCESS_CONTROL_COMPILED_CHECK
+    /**
+     * Copy of the access control list flattened into plain arrays, which Check walks instead of going through the entry
+     * delegates, along with a cache of the latest decisions. Both are dropped whenever the list changes, and the copy is
+     * compiled again by the next check.
+     *
+     * Costs heap for the copy and static RAM for the cache, see CHIP_CONFIG_ACCESS_CONTROL_COMPILED_CHECK.
+     */
+    class CompiledEntries : public EntryListener
+    {
+    public:
+        void OnEntryChanged(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t index, const Entry * entry,
+                            ChangeType changeType) override
+        {
+            Invalidate();
+        }
+
+        void Invalidate();
+
+        /**
+         * Check access against the compiled entries, compiling them first if needed.
+         *
+         * @param [out] allowed     Whether access is allowed, if the check could be made.
+         *
+         * @retval false if the entries could not be compiled, in which case they must be walked instead.
+         */
+        bool Check(AccessControl & accessControl, const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                   Privilege requestPrivilege, bool & allowed);
+
+    private:
+        enum class State : uint8_t
+        {
+            kStale,       ///< Not compiled since the access control list last changed
+            kCompiled,    ///< Up to date
+            kUnavailable, ///< Could not be compiled, not retried until the access control list changes
+        };
+
+        struct CompiledEntry
+        {
+            uint32_t firstSubject;
+            uint32_t firstTarget;
+            uint16_t subjectCount;
+            uint16_t targetCount;
+            FabricIndex fabricIndex;
+            AuthMode authMode;
+            Privilege privilege;
+        };
+
+        struct CompiledTarget
+        {
+            ClusterId cluster;
+            EndpointId endpoint;
+            DeviceTypeId deviceType;
+            Entry::Target::Flags flags;
+        };
+
+        struct CachedDecision
+        {
+            SubjectDescriptor subjectDescriptor;
+            RequestPath requestPath;
+            Privilege requestPrivilege;
+            bool allowed;
+        };
+
+        CHIP_ERROR Compile(AccessControl & accessControl);
+
+        bool CheckSubjects(const CompiledEntry & entry, const SubjectDescriptor & subjectDescriptor) const;
+
+        bool CheckTargets(const CompiledEntry & entry, const RequestPath & requestPath, DeviceTypeResolver & deviceTypeResolver,
+                          bool & usedDeviceTypeResolver) const;
+
+        bool FindCachedDecision(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                Privilege requestPrivilege, bool & allowed) const;
+
+        void CacheDecision(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                           Privilege requestPrivilege, bool allowed);
+
+        State mState = State::kStale;
+
+        // Entries are sorted by fabric index; the subjects and targets of each are contiguous.
+        Platform::ScopedMemoryBuffer<CompiledEntry> mEntries;
+        Platform::ScopedMemoryBuffer<NodeId> mSubjects;
+        Platform::ScopedMemoryBuffer<CompiledTarget> mTargets;
+        size_t mEntryCount = 0;
+
+#if CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE > 0
+        CachedDecision mCachedDecisions[CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE];
+        size_t mCachedDecisionCount = 0;
+        size_t mNextCachedDecision  = 0; ///< Slot of the next decision, replacing the oldest one when the cache is full
+#endif
+    };
+#endif // CHIP_CONFIG_ACCESS_CONTROL_COMPILED_CHECK
+
     bool IsInitialized() const { return (mDelegate != nullptr); }
 
     bool IsValid(const Entry & entry);
@@ -649,12 +746,24 @@ private:
     void NotifyEntryChanged(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t index, const Entry * entry,
                             EntryListener::ChangeType changeType);
 
+    // Used by the overloads which change entries without notifying listeners.
+    void EntriesChanged()
+    {
+#if CHIP_CONFIG_ACCESS_CONTROL_COMPILED_CHECK
+        mCompiledEntries.Invalidate();
+#endif
+    }
+
 private:
     Delegate * mDelegate = nullptr;
 
     DeviceTypeResolver * mDeviceTypeResolver = nullptr;
 
     EntryListener * mEntryListener = nullptr;
+
+#if CHIP_CONFIG_ACCESS_CONTROL_COMPILED_CHECK
+    CompiledEntries mCompiledEntries;
+#endif
 };
 
 /**
@@ -20,6 +20,7 @@
 #include "access/examples/ExampleAccessControlDelegate.h"
 
 #include <lib/core/CHIPCore.h>
+#include <lib/support/CHIPMem.h>
 
 #include <gtest/gtest.h>
 
@@ -420,7 +421,15 @@ constexpr DeviceTypeId invalidDeviceTypes[] = {
 class DeviceTypeResolver : public AccessControl::DeviceTypeResolver
 {
 public:
-    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override { return false; }
+    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override
+    {
+        return hasDeviceType && deviceType == this->deviceType && endpoint == this->endpoint;
+    }
+
+    // By default, no endpoint has any device type.
+    bool hasDeviceType      = false;
+    DeviceTypeId deviceType = 0;
+    EndpointId endpoint     = 0;
 } testDeviceTypeResolver;
 
 // For testing, supports one subject and target, allows any value (valid or invalid)
@@ -1082,6 +1091,7 @@ public: // protected
     void SetUp() override { ASSERT_EQ(ClearAccessControl(accessControl), CHIP_NO_ERROR); }
     static void SetUpTestSuite()
     {
+        ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR);
         AccessControl::Delegate * delegate = Examples::GetAccessControlDelegate();
         SetAccessControl(accessControl);
         VerifyOrDie(GetAccessControl().Init(delegate, testDeviceTypeResolver) == CHIP_NO_ERROR);
@@ -1090,6 +1100,7 @@ public: // protected
     {
         GetAccessControl().Finish();
         ResetAccessControlToDefault();
+        chip::Platform::MemoryShutdown();
     }
 };
 
@@ -1754,6 +1765,113 @@ TEST_F(TestAccessControl, TestCheck)
     }
 }
 
+TEST_F(TestAccessControl, TestCheckRepeated)
+{
+    LoadAccessControl(accessControl, entryData1, entryData1Count);
+    // Check each request several times in a row, then all of them again, so decisions are both cached and evicted.
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (const auto & checkData : checkData1)
+        {
+            CHIP_ERROR expectedResult = checkData.allow ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+            for (int i = 0; i < 3; ++i)
+            {
+                EXPECT_EQ(accessControl.Check(checkData.subjectDescriptor, checkData.requestPath, checkData.privilege),
+                          expectedResult);
+            }
+        }
+    }
+}
+
+TEST_F(TestAccessControl, TestCheckAfterChange)
+{
+    constexpr FabricIndex fabricIndex = 1;
+    const SubjectDescriptor subjectDescriptor{ .fabricIndex = fabricIndex,
+                                               .authMode    = AuthMode::kCase,
+                                               .subject     = kOperationalNodeId1 };
+    const RequestPath requestPath{ .cluster = kOnOffCluster, .endpoint = 1 };
+
+    EntryData data{ .fabricIndex = fabricIndex, .privilege = Privilege::kView, .authMode = AuthMode::kCase };
+    data.AddSubject(nullptr, kOperationalNodeId1);
+
+    // Entries are released before checking, since the example delegate has few of them to go around.
+    auto prepare = [&](Entry & entry) {
+        EXPECT_EQ(accessControl.PrepareEntry(entry), CHIP_NO_ERROR);
+        EXPECT_EQ(LoadEntry(entry, data), CHIP_NO_ERROR);
+    };
+
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+
+    // Changes notified to listeners
+    {
+        Entry entry;
+        prepare(entry);
+        EXPECT_EQ(accessControl.CreateEntry(nullptr, fabricIndex, nullptr, entry), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kView), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate), CHIP_ERROR_ACCESS_DENIED);
+
+    data.privilege = Privilege::kOperate;
+    {
+        Entry entry;
+        prepare(entry);
+        EXPECT_EQ(accessControl.UpdateEntry(nullptr, fabricIndex, 0, entry), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate), CHIP_NO_ERROR);
+
+    EXPECT_EQ(accessControl.DeleteEntry(nullptr, fabricIndex, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate), CHIP_ERROR_ACCESS_DENIED);
+
+    // Changes not notified to listeners
+    {
+        Entry entry;
+        prepare(entry);
+        EXPECT_EQ(accessControl.CreateEntry(nullptr, entry), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate), CHIP_NO_ERROR);
+
+    data.subjects[0] = kOperationalNodeId2;
+    {
+        Entry entry;
+        prepare(entry);
+        EXPECT_EQ(accessControl.UpdateEntry(0, entry), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate), CHIP_ERROR_ACCESS_DENIED);
+
+    data.subjects[0] = kOperationalNodeId1;
+    {
+        Entry entry;
+        prepare(entry);
+        EXPECT_EQ(accessControl.UpdateEntry(0, entry), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate), CHIP_NO_ERROR);
+
+    EXPECT_EQ(accessControl.DeleteEntry(0), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate), CHIP_ERROR_ACCESS_DENIED);
+}
+
+TEST_F(TestAccessControl, TestCheckDeviceTypeChange)
+{
+    constexpr DeviceTypeId kDeviceType = 0x0000'0100;
+    const SubjectDescriptor subjectDescriptor{ .fabricIndex = 1, .authMode = AuthMode::kCase, .subject = kOperationalNodeId1 };
+    const RequestPath requestPath{ .cluster = kOnOffCluster, .endpoint = 1 };
+
+    EntryData data{ .fabricIndex = 1, .privilege = Privilege::kView, .authMode = AuthMode::kCase };
+    data.AddTarget(nullptr, { .flags = Target::kDeviceType, .deviceType = kDeviceType });
+    EXPECT_EQ(LoadAccessControl(accessControl, &data, 1), CHIP_NO_ERROR);
+
+    // The access control list does not change when device types are added to or removed from endpoints.
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+
+    testDeviceTypeResolver.hasDeviceType = true;
+    testDeviceTypeResolver.deviceType    = kDeviceType;
+    testDeviceTypeResolver.endpoint      = requestPath.endpoint;
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kView), CHIP_NO_ERROR);
+
+    testDeviceTypeResolver.hasDeviceType = false;
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+}
+
 TEST_F(TestAccessControl, TestCreateReadEntry)
 {
     for (size_t i = 0; i < entryData1Count; ++i)
@@ -0,0 +1,351 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements chip-access-control-benchmark, which measures the access checks the
+ *      interaction model makes for a wildcard read or report on a node with many endpoints (e.g. a
+ *      bridge): one check for each attribute of each cluster of each endpoint, all for the same
+ *      subject, against the access control list of the example access control delegate.
+ *
+ *      AccessControl::Check is timed against a walk of the entries through their delegates, which
+ *      is what each check cost before the entries were compiled and the decisions cached.
+ *
+ *      The example delegate holds at most CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_MAX_ENTRIES_PER_FABRIC
+ *      entries for each of CHIP_CONFIG_MAX_FABRICS fabrics; every slot is filled, so that checks
+ *      walk as many entries as the configuration allows.
+ *
+ */
+
+#include <access/AccessControl.h>
+#include <access/examples/ExampleAccessControlDelegate.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/tests/BenchmarkSupport.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Access;
+using namespace chip::Benchmark;
+
+namespace {
+
+#define TOOL_NAME "chip-access-control-benchmark"
+
+using Entry         = AccessControl::Entry;
+using EntryIterator = AccessControl::EntryIterator;
+
+constexpr NodeId kSubjectNodeId = 0x0000'0000'0001'0001;
+constexpr NodeId kOtherNodeId   = 0x0000'0000'0002'0001;
+constexpr FabricIndex kFabric   = 1;
+
+struct BenchmarkOptions
+{
+    uint32_t endpointCount  = 200;
+    uint32_t clusterCount   = 8;
+    uint32_t attributeCount = 10;
+    uint32_t reportCount    = 20;
+} gOptions;
+
+const char * const gCmdOptionHelp =
+    "   --endpoints <count>\n"
+    "       Number of endpoints of the node. Defaults to 200.\n"
+    "\n"
+    "   --clusters <count>\n"
+    "       Number of clusters on each endpoint. Defaults to 8.\n"
+    "\n"
+    "   --attributes <count>\n"
+    "       Number of attributes of each cluster. Defaults to 10.\n"
+    "\n"
+    "   --reports <count>\n"
+    "       Number of wildcard reports timed for each measurement. Defaults to 20.\n"
+    "\n";
+
+class NoDeviceTypeResolver : public AccessControl::DeviceTypeResolver
+{
+public:
+    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override { return false; }
+} gDeviceTypeResolver;
+
+ClusterId ClusterFor(uint32_t index)
+{
+    return static_cast<ClusterId>(0x0000'0006 + index);
+}
+
+bool PrivilegeGrants(Privilege entryPrivilege, Privilege requestPrivilege)
+{
+    switch (entryPrivilege)
+    {
+    case Privilege::kView:
+        return requestPrivilege == Privilege::kView;
+    case Privilege::kProxyView:
+        return requestPrivilege == Privilege::kProxyView || requestPrivilege == Privilege::kView;
+    case Privilege::kOperate:
+        return requestPrivilege == Privilege::kOperate || requestPrivilege == Privilege::kView;
+    case Privilege::kManage:
+        return requestPrivilege == Privilege::kManage || requestPrivilege == Privilege::kOperate ||
+            requestPrivilege == Privilege::kView;
+    case Privilege::kAdminister:
+        return true;
+    }
+    return false;
+}
+
+// The check of AccessControl::Check before compiled entries, through the public API: every entry of the fabric, and each of
+// its subjects and targets, is read through the delegates.
+CHIP_ERROR WalkEntries(AccessControl & accessControl, const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                       Privilege requestPrivilege)
+{
+    EntryIterator iterator;
+    ReturnErrorOnFailure(accessControl.Entries(iterator, &subjectDescriptor.fabricIndex));
+
+    Entry entry;
+    while (iterator.Next(entry) == CHIP_NO_ERROR)
+    {
+        AuthMode authMode   = AuthMode::kNone;
+        Privilege privilege = Privilege::kView;
+        ReturnErrorOnFailure(entry.GetAuthMode(authMode));
+        ReturnErrorOnFailure(entry.GetPrivilege(privilege));
+        if (authMode != subjectDescriptor.authMode || !PrivilegeGrants(privilege, requestPrivilege))
+        {
+            continue;
+        }
+
+        size_t count        = 0;
+        bool subjectMatched = true;
+        ReturnErrorOnFailure(entry.GetSubjectCount(count));
+        for (size_t i = 0; i < count; ++i)
+        {
+            NodeId subject = kUndefinedNodeId;
+            ReturnErrorOnFailure(entry.GetSubject(i, subject));
+            subjectMatched = IsCASEAuthTag(subject) ? subjectDescriptor.cats.CheckSubjectAgainstCATs(subject)
+                                                    : subject == subjectDescriptor.subject;
+            if (subjectMatched)
+            {
+                break;
+            }
+        }
+        if (!subjectMatched)
+        {
+            continue;
+        }
+
+        bool targetMatched = true;
+        ReturnErrorOnFailure(entry.GetTargetCount(count));
+        for (size_t i = 0; i < count; ++i)
+        {
+            Entry::Target target;
+            ReturnErrorOnFailure(entry.GetTarget(i, target));
+            targetMatched = !((target.flags & Entry::Target::kCluster) && target.cluster != requestPath.cluster) &&
+                !((target.flags & Entry::Target::kEndpoint) && target.endpoint != requestPath.endpoint) &&
+                !((target.flags & Entry::Target::kDeviceType) &&
+                  !gDeviceTypeResolver.IsDeviceTypeOnEndpoint(target.deviceType, requestPath.endpoint));
+            if (targetMatched)
+            {
+                break;
+            }
+        }
+        if (targetMatched)
+        {
+            return CHIP_NO_ERROR;
+        }
+    }
+    return CHIP_ERROR_ACCESS_DENIED;
+}
+
+CHIP_ERROR AddEntry(AccessControl & accessControl, FabricIndex fabricIndex, Privilege privilege, const NodeId * subjects,
+                    size_t subjectCount, const Entry::Target * targets, size_t targetCount)
+{
+    Entry entry;
+    ReturnErrorOnFailure(accessControl.PrepareEntry(entry));
+    ReturnErrorOnFailure(entry.SetFabricIndex(fabricIndex));
+    ReturnErrorOnFailure(entry.SetAuthMode(AuthMode::kCase));
+    ReturnErrorOnFailure(entry.SetPrivilege(privilege));
+    for (size_t i = 0; i < subjectCount; ++i)
+    {
+        ReturnErrorOnFailure(entry.AddSubject(nullptr, subjects[i]));
+    }
+    for (size_t i = 0; i < targetCount; ++i)
+    {
+        ReturnErrorOnFailure(entry.AddTarget(nullptr, targets[i]));
+    }
+    return accessControl.CreateEntry(nullptr, fabricIndex, nullptr, entry);
+}
+
+// Fill every entry slot. On the fabric of the subject, the entry granting it view access comes last, after entries for other
+// subjects, and only covers some of the clusters, so that denied checks are measured too.
+CHIP_ERROR LoadEntries(AccessControl & accessControl, size_t & entryCount)
+{
+    size_t entriesPerFabric = 0;
+    size_t maxSubjects      = 0;
+    size_t maxTargets       = 0;
+    ReturnErrorOnFailure(accessControl.GetMaxEntriesPerFabric(entriesPerFabric));
+    ReturnErrorOnFailure(accessControl.GetMaxSubjectsPerEntry(maxSubjects));
+    ReturnErrorOnFailure(accessControl.GetMaxTargetsPerEntry(maxTargets));
+    VerifyOrReturnError(entriesPerFabric > 0 && maxSubjects > 0 && maxTargets > 0, CHIP_ERROR_INCORRECT_STATE);
+
+    std::vector<NodeId> otherSubjects;
+    for (size_t i = 0; i < maxSubjects; ++i)
+    {
+        otherSubjects.push_back(kOtherNodeId + i);
+    }
+    std::vector<Entry::Target> targets;
+    for (size_t i = 0; i < maxTargets; ++i)
+    {
+        Entry::Target target;
+        target.flags   = Entry::Target::kCluster;
+        target.cluster = ClusterFor(static_cast<uint32_t>(i) * 2);
+        targets.push_back(target);
+    }
+
+    entryCount = 0;
+    for (FabricIndex fabricIndex = kFabric; fabricIndex <= CHIP_CONFIG_MAX_FABRICS; ++fabricIndex)
+    {
+        for (size_t i = 0; i < entriesPerFabric; ++i)
+        {
+            bool forSubject         = (fabricIndex == kFabric && i + 1 == entriesPerFabric);
+            const NodeId * subjects = forSubject ? &kSubjectNodeId : otherSubjects.data();
+            size_t subjectCount     = forSubject ? 1 : otherSubjects.size();
+            Privilege privilege     = forSubject ? Privilege::kView : Privilege::kOperate;
+            ReturnErrorOnFailure(
+                AddEntry(accessControl, fabricIndex, privilege, subjects, subjectCount, targets.data(), targets.size()));
+            entryCount++;
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+// Time @a check over the checks of gOptions.reportCount wildcard reports, and print the time per check.
+template <typename Check>
+CHIP_ERROR Measure(const char * label, uint32_t attributeCount, Check && check, uint32_t & allowedCount)
+{
+    const SubjectDescriptor subjectDescriptor{ .fabricIndex = kFabric, .authMode = AuthMode::kCase, .subject = kSubjectNodeId };
+    uint64_t checkCount = 0;
+
+    allowedCount   = 0;
+    uint64_t start = NowMicroseconds();
+    for (uint32_t report = 0; report < gOptions.reportCount; report++)
+    {
+        for (uint32_t endpoint = 0; endpoint < gOptions.endpointCount; endpoint++)
+        {
+            for (uint32_t cluster = 0; cluster < gOptions.clusterCount; cluster++)
+            {
+                const RequestPath requestPath{ .cluster = ClusterFor(cluster), .endpoint = static_cast<EndpointId>(endpoint) };
+                for (uint32_t attribute = 0; attribute < attributeCount; attribute++)
+                {
+                    CHIP_ERROR err = check(subjectDescriptor, requestPath, Privilege::kView);
+                    VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_ERROR_ACCESS_DENIED, err);
+                    allowedCount += (err == CHIP_NO_ERROR) ? 1 : 0;
+                    checkCount++;
+                }
+            }
+        }
+    }
+    uint64_t elapsed = NowMicroseconds() - start;
+
+    printf("  %-28s %8.1f ns/check, %8.2f ms/report\n", label,
+           static_cast<double>(elapsed) * 1000 / static_cast<double>(checkCount),
+           static_cast<double>(elapsed) / 1000 / gOptions.reportCount);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR RunChecks(AccessControl & accessControl, const char * title, uint32_t attributeCount)
+{
+    uint32_t walkAllowed  = 0;
+    uint32_t checkAllowed = 0;
+
+    printf("%s: %u checks/report\n", title,
+           static_cast<unsigned>(gOptions.endpointCount * gOptions.clusterCount * attributeCount));
+
+    ReturnErrorOnFailure(Measure(
+        "walk entries", attributeCount,
+        [&](const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege privilege) {
+            return WalkEntries(accessControl, subjectDescriptor, requestPath, privilege);
+        },
+        walkAllowed));
+    ReturnErrorOnFailure(Measure(
+        "AccessControl::Check", attributeCount,
+        [&](const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege privilege) {
+            return accessControl.Check(subjectDescriptor, requestPath, privilege);
+        },
+        checkAllowed));
+
+    if (walkAllowed != checkAllowed)
+    {
+        fprintf(stderr, "Access allowed %u times by walking the entries, %u times by AccessControl::Check\n",
+                static_cast<unsigned>(walkAllowed), static_cast<unsigned>(checkAllowed));
+        return CHIP_ERROR_INTERNAL;
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR RunAccessControl()
+{
+    AccessControl accessControl;
+    ReturnErrorOnFailure(accessControl.Init(Examples::GetAccessControlDelegate(), gDeviceTypeResolver));
+
+    size_t entryCount = 0;
+    CHIP_ERROR err    = LoadEntries(accessControl, entryCount);
+    if (err == CHIP_NO_ERROR)
+    {
+        printf("Access control entries: %u, endpoints: %u, clusters: %u\n", static_cast<unsigned>(entryCount),
+               static_cast<unsigned>(gOptions.endpointCount), static_cast<unsigned>(gOptions.clusterCount));
+        err = RunChecks(accessControl, "Wildcard read", gOptions.attributeCount);
+    }
+    if (err == CHIP_NO_ERROR)
+    {
+        // Every check is then for another cluster than the previous one, so no decision is reused.
+        err = RunChecks(accessControl, "One check per cluster", 1);
+    }
+
+    accessControl.Finish();
+    return err;
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    CommandLine commandLine(TOOL_NAME, "Measure the access checks of wildcard reads on nodes with many endpoints.\n",
+                            {
+                                Option::Count("endpoints", gOptions.endpointCount, 1, kInvalidEndpointId),
+                                Option::Count("clusters", gOptions.clusterCount),
+                                Option::Count("attributes", gOptions.attributeCount),
+                                Option::Count("reports", gOptions.reportCount),
+                            },
+                            gCmdOptionHelp);
+
+    CHIP_ERROR err = Platform::MemoryInit();
+    SuccessOrExit(err);
+
+    if (!commandLine.Parse(argc, argv))
+    {
+        Platform::MemoryShutdown();
+        return EXIT_FAILURE;
+    }
+
+    err = RunAccessControl();
+    SuccessOrExit(err);
+
+exit:
+    Platform::MemoryShutdown();
+    return commandLine.ExitStatus(err);
+}
@@ -24,8 +24,12 @@
 #include "system/TLVPacketBufferBackingStore.h"
 #include <app/BufferedReadCallback.h>
 #include <app/InteractionModelEngine.h>
+#include <lib/support/SafeInt.h>
 #include <lib/support/ScopedBuffer.h>
 
+#include <algorithm>
+#include <string.h>
+
 namespace chip {
 namespace app {
 
@@ -48,91 +52,116 @@ void BufferedReadCallback::OnReportEnd()
 
 CHIP_ERROR BufferedReadCallback::GenerateListTLV(TLV::ScopedBufferTLVReader & aReader)
 {
-    TLV::TLVType outerType;
-    Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
-
     //
-    // To generate the final reconstituted list, we need to allocate a contiguous
-    // buffer than can hold the entirety of its contents. To do so, we need to figure out
-    // how big a buffer to allocate. This requires walking the buffered list items and computing their TLV sizes,
-    // summing them all up and adding a bit of slop to account for the TLV array the list elements will go into.
+    // The list items have been appended to a single contiguous buffer as they arrived, right after the
+    // start of the TLV array that reconstitutes the list. All that is left to do is to close that array,
+    // and to hand the buffer over to the reader.
     //
-    // The alternative was to use a PacketBufferTLVWriter backed by chained packet buffers to
-    // write out the list - this would have removed the need for this first pass. However,
-    // we cannot actually back a TLVReader with a chained buffer since that violates the ability
-    // for us to create readers off-of readers. Each reader would assume exclusive ownership of the chained
-    // buffer and mutate the state within TLVPacketBufferBackingStore, preventing shared use.
+    // A TLVReader cannot be backed by the chained packet buffers the items were received in (or copied to),
+    // since that violates the ability for us to create readers off-of readers: each reader would assume exclusive
+    // ownership of the chained buffer and mutate the state within TLVPacketBufferBackingStore, preventing shared use.
     //
-    // To avoid that, a single contiguous buffer is the best likely approach for now.
-    //
-    uint32_t totalBufSize = 0;
-    for (const auto & packetBuffer : mBufferedList)
+    if (mBufferedListLength == 0)
     {
-        totalBufSize += packetBuffer->TotalLength();
+        ReturnErrorOnFailure(StartBufferedList());
     }
 
-    //
-    // Size of the start container and end container are just 1 byte each, but, let's just be safe.
-    //
-    totalBufSize += 4;
+    if (mBufferedListLength == mBufferedListCapacity)
+    {
+        ReturnErrorOnFailure(GrowBufferedList());
+    }
 
-    backingBuffer.Calloc(totalBufSize);
-    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    // The end of a container is a single control octet, with no tag.
+    mBufferedList[mBufferedListLength++] = static_cast<uint8_t>(TLV::TLVElementType::EndOfContainer);
 
-    TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), totalBufSize);
-    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, outerType));
+    aReader.Init(std::move(mBufferedList), mBufferedListLength);
+    ClearBufferedList();
 
-    for (auto & bufHandle : mBufferedList)
-    {
-        System::PacketBufferTLVReader reader;
+    return CHIP_NO_ERROR;
+}
 
-        reader.Init(std::move(bufHandle));
+CHIP_ERROR BufferedReadCallback::StartBufferedList()
+{
+    TLV::TLVWriter writer;
+    TLV::TLVType outerType;
 
-        ReturnErrorOnFailure(reader.Next());
-        ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
+    if (mBufferedListCapacity == 0)
+    {
+        ReturnErrorOnFailure(GrowBufferedList());
     }
 
-    ReturnErrorOnFailure(writer.EndContainer(outerType));
+    writer.Init(mBufferedList.Get(), static_cast<uint32_t>(mBufferedListCapacity));
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, outerType));
+    mBufferedListLength = writer.GetLengthWritten();
+
+    return CHIP_NO_ERROR;
+}
 
-    writer.Finalize(backingBuffer);
+CHIP_ERROR BufferedReadCallback::GrowBufferedList()
+{
+    // Most lists are small: start with a buffer that fits a few list items.
+    constexpr size_t kInitialBufferedListCapacity = 256;
 
-    aReader.Init(std::move(backingBuffer), totalBufSize);
+    size_t capacity = std::max(mBufferedListCapacity * 2, kInitialBufferedListCapacity);
+    VerifyOrReturnError(CanCastTo<uint32_t>(capacity), CHIP_ERROR_NO_MEMORY);
+
+    Platform::ScopedMemoryBuffer<uint8_t> bufferedList;
+    VerifyOrReturnError(bufferedList.Alloc(capacity), CHIP_ERROR_NO_MEMORY);
+    if (mBufferedListLength > 0)
+    {
+        memcpy(bufferedList.Get(), mBufferedList.Get(), mBufferedListLength);
+    }
+
+    // Moving into a ScopedMemoryBuffer does not release what it held.
+    mBufferedList.Free();
+    mBufferedList         = std::move(bufferedList);
+    mBufferedListCapacity = capacity;
 
     return CHIP_NO_ERROR;
 }
 
+void BufferedReadCallback::ClearBufferedList()
+{
+    mBufferedList.Free();
+    mBufferedListCapacity = 0;
+    mBufferedListLength   = 0;
+}
+
 CHIP_ERROR BufferedReadCallback::BufferListItem(TLV::TLVReader & reader)
 {
-    System::PacketBufferTLVWriter writer;
-    System::PacketBufferHandle handle;
+    if (mBufferedListLength == 0)
+    {
+        ReturnErrorOnFailure(StartBufferedList());
+    }
 
     //
-    // We conservatively allocate a packet buffer as big as an IPv6 MTU (since we're buffering
-    // data received over the wire, which should always fit within that).
+    // The list item is copied straight to the end of the buffered list. It usually fits in the room left over
+    // by the previous items; if not, the buffer is grown and the copy tried again. Since the item was received
+    // in a single message, it always fits in as much room as the largest message we can receive.
     //
-    // We could have snapshotted the reader at its current position, advanced it past the current element
-    // and computed the delta in its read point to figure out the size of the element before allocating
-    // our target buffer. However, the reader's current position is already set past the control octet
-    // and the tag. Consequently, the computed size is always going to omit the sizes of these two parts of the
-    // TLV element. Since the tag can vary in size, for now, let's just do the safe thing. In the future, if this is a problem,
-    // we can improve this.
+    // Sizing the item beforehand would not be simpler: the reader's current position is already set past the
+    // control octet and the tag, which are not part of what is copied anyway.
     //
-    handle = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
-    VerifyOrReturnError(!handle.IsNull(), CHIP_ERROR_NO_MEMORY);
-
-    writer.Init(std::move(handle), false);
-
-    ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
-    ReturnErrorOnFailure(writer.Finalize(&handle));
+    while (true)
+    {
+        TLV::TLVReader itemReader;
+        TLV::TLVWriter writer;
 
-    // Compact the buffer down to a more reasonably sized packet buffer
-    // if we can.
-    //
-    handle.RightSize();
+        itemReader.Init(reader);
+        writer.Init(mBufferedList.Get() + mBufferedListLength, static_cast<uint32_t>(mBufferedListCapacity - mBufferedListLength));
 
-    mBufferedList.push_back(std::move(handle));
+        CHIP_ERROR err = writer.CopyElement(TLV::AnonymousTag(), itemReader);
+        if (err == CHIP_NO_ERROR)
+        {
+            ReturnErrorOnFailure(writer.Finalize());
+            mBufferedListLength += writer.GetLengthWritten();
+            return CHIP_NO_ERROR;
+        }
 
-    return CHIP_NO_ERROR;
+        VerifyOrReturnError(err == CHIP_ERROR_BUFFER_TOO_SMALL, err);
+        VerifyOrReturnError(mBufferedListCapacity - mBufferedListLength < chip::app::kMaxSecureSduLengthBytes, err);
+        ReturnErrorOnFailure(GrowBufferedList());
+    }
 }
 
 CHIP_ERROR BufferedReadCallback::BufferData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData)
@@ -143,7 +172,11 @@ CHIP_ERROR BufferedReadCallback::BufferData(const ConcreteDataAttributePath & aP
         TLV::TLVType outerContainer;
 
         VerifyOrReturnError(apData->GetType() == TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
-        mBufferedList.clear();
+
+        //
+        // Start over, reusing the buffer of any list items we had buffered.
+        //
+        ReturnErrorOnFailure(StartBufferedList());
 
         ReturnErrorOnFailure(apData->EnterContainer(outerContainer));
 
@@ -220,9 +253,8 @@ CHIP_ERROR BufferedReadCallback::DispatchBufferedData(const ConcreteAttributePat
     mCallback.OnAttributeData(mBufferedPath, &reader, statusIB);
 
     //
-    // Clear out our buffered contents to free up allocated buffers, and reset the buffered path.
+    // Reset the buffered path. The buffered contents were handed over to the reader, which frees them.
     //
-    mBufferedList.clear();
     mBufferedPath = ConcreteDataAttributePath();
     return CHIP_NO_ERROR;
 }
@@ -24,6 +24,7 @@
 #include <app/AppConfig.h>
 #include <app/AttributePathParams.h>
 #include <app/ReadClient.h>
+#include <lib/support/ScopedBuffer.h>
 #include <vector>
 
 #if CHIP_CONFIG_ENABLE_READ_CLIENT
@@ -36,6 +37,9 @@ namespace app {
  * upon completion of delivery of all chunks. This is then delivered to a compliant ReadClient::Callback
  * without any awareness on their part that chunking happened.
  *
+ * List items are appended as they arrive to a single buffer that already holds the encoding of the
+ * reconstituted array, so that each item is copied once and delivering the list only requires closing the array.
+ *
  */
 class BufferedReadCallback : public ReadClient::Callback
 {
@@ -44,7 +48,7 @@ public:
 
 private:
     /*
-     * Generates the reconsistuted TLV array from the stored individual list elements
+     * Completes the reconstituted TLV array from the buffered list items, and hands it over to the reader.
      */
     CHIP_ERROR GenerateListTLV(TLV::ScopedBufferTLVReader & reader);
 
@@ -73,7 +77,7 @@ private:
     void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override;
     void OnError(CHIP_ERROR aError) override
     {
-        mBufferedList.clear();
+        ClearBufferedList();
         return mCallback.OnError(aError);
     }
 
@@ -121,15 +125,34 @@ private:
     }
 
     /*
-     * Given a reader positioned at a list element, allocate a packet buffer, copy the list item where
-     * the reader is positioned into that buffer and add it to our buffered list for tracking.
+     * Given a reader positioned at a list element, copy the list item where the reader is positioned
+     * to the end of our buffered list, growing it if needed. The reader is left positioned on that element.
      *
      * This should be called in list index order starting from the lowest index that needs to be buffered.
      *
      */
     CHIP_ERROR BufferListItem(TLV::TLVReader & reader);
+
+    /*
+     * Starts a new buffered list (i.e. the opening of an empty TLV array), dropping any buffered list items.
+     */
+    CHIP_ERROR StartBufferedList();
+
+    /*
+     * Moves the buffered list to a buffer at least twice as large.
+     */
+    CHIP_ERROR GrowBufferedList();
+
+    void ClearBufferedList();
+
     ConcreteDataAttributePath mBufferedPath;
-    std::vector<System::PacketBufferHandle> mBufferedList;
+
+    // The buffered list is an open TLV array holding the list items received so far. It is empty until
+    // the first list item is buffered.
+    Platform::ScopedMemoryBuffer<uint8_t> mBufferedList;
+    size_t mBufferedListCapacity = 0;
+    size_t mBufferedListLength   = 0;
+
     Callback & mCallback;
 };
 
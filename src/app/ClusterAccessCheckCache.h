@@ -0,0 +1,95 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <access/AccessControl.h>
+#include <access/Privilege.h>
+#include <access/RequestPath.h>
+#include <access/SubjectDescriptor.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+
+#include <type_traits>
+
+namespace chip {
+namespace app {
+
+/**
+ * Remembers access control decisions for the cluster that is currently being processed, so that expanding a wildcard path
+ * does not run a full access control check for every attribute of a cluster.
+ *
+ * Decisions are kept per required privilege, so attributes of the same cluster that require a different privilege than
+ * their neighbours are still checked on their own.  Moving to another cluster forgets all remembered decisions.
+ *
+ * A cache must only be used while the access control entries cannot change, e.g. while building a single report.
+ */
+class ClusterAccessCheckCache
+{
+public:
+    explicit ClusterAccessCheckCache(const Access::SubjectDescriptor & aSubjectDescriptor) : mSubjectDescriptor(aSubjectDescriptor)
+    {}
+
+    const Access::SubjectDescriptor & GetSubjectDescriptor() const { return mSubjectDescriptor; }
+
+    /**
+     * Check access for the subject of this cache, with the same semantics as Access::AccessControl::Check.
+     *
+     * Only CHIP_NO_ERROR and CHIP_ERROR_ACCESS_DENIED results are remembered; any other error is returned as is and the
+     * check will be run again next time.
+     */
+    CHIP_ERROR Check(const Access::RequestPath & aRequestPath, Access::Privilege aRequestPrivilege)
+    {
+        if (aRequestPath.endpoint != mEndpoint || aRequestPath.cluster != mCluster)
+        {
+            mEndpoint          = aRequestPath.endpoint;
+            mCluster           = aRequestPath.cluster;
+            mCheckedPrivileges = 0;
+            mAllowedPrivileges = 0;
+        }
+
+        const auto privilegeBit = static_cast<std::underlying_type_t<Access::Privilege>>(aRequestPrivilege);
+        if (mCheckedPrivileges & privilegeBit)
+        {
+            return (mAllowedPrivileges & privilegeBit) ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+        }
+
+        CHIP_ERROR err = Access::GetAccessControl().Check(mSubjectDescriptor, aRequestPath, aRequestPrivilege);
+        if (err == CHIP_NO_ERROR)
+        {
+            mCheckedPrivileges |= privilegeBit;
+            mAllowedPrivileges |= privilegeBit;
+        }
+        else if (err == CHIP_ERROR_ACCESS_DENIED)
+        {
+            mCheckedPrivileges |= privilegeBit;
+        }
+        return err;
+    }
+
+private:
+    const Access::SubjectDescriptor mSubjectDescriptor;
+    EndpointId mEndpoint = kInvalidEndpointId;
+    ClusterId mCluster   = kInvalidClusterId;
+    // Bit sets of Access::Privilege values for the current cluster.
+    std::underlying_type_t<Access::Privilege> mCheckedPrivileges = 0;
+    std::underlying_type_t<Access::Privilege> mAllowedPrivileges = 0;
+};
+
+} // namespace app
+} // namespace chip
@@ -19,6 +19,9 @@
 #include "system/SystemPacketBuffer.h"
 #include <app/ClusterStateCache.h>
 #include <app/InteractionModelEngine.h>
+#include <lib/support/SafeInt.h>
+
+#include <algorithm>
 #include <tuple>
 
 namespace chip {
@@ -47,6 +50,11 @@ size_t SizeOfStatusIB(const StatusIB & aStatus)
     return size;
 }
 
+bool ClusterPathLess(const ConcreteClusterPath & x, const ConcreteClusterPath & y)
+{
+    return x.mEndpointId < y.mEndpointId || (x.mEndpointId == y.mEndpointId && x.mClusterId < y.mClusterId);
+}
+
 } // anonymous namespace
 
 CHIP_ERROR ClusterStateCache::GetElementTLVSize(TLV::TLVReader * apData, size_t & aSize)
@@ -70,10 +78,11 @@ CHIP_ERROR ClusterStateCache::UpdateCache(const ConcreteDataAttributePath & aPat
     AttributeState state;
     bool endpointIsNew = false;
 
-    if (mCache.find(aPath.mEndpointId) == mCache.end())
+    auto endpointIter = FirstClusterAtOrAfter(ConcreteClusterPath(aPath.mEndpointId, 0));
+    if (endpointIter == mClusters.end() || endpointIter->mPath.mEndpointId != aPath.mEndpointId)
     {
         //
-        // Since we might potentially be creating a new entry at mCache[aPath.mEndpointId][aPath.mClusterId] that
+        // Since we might potentially be creating a new entry for aPath.mEndpointId and aPath.mClusterId that
         // wasn't there before, we need to check if an entry didn't exist there previously and remember that so that
         // we can appropriately notify our clients of the addition of a new endpoint.
         //
@@ -87,14 +96,14 @@ CHIP_ERROR ClusterStateCache::UpdateCache(const ConcreteDataAttributePath & aPat
 
         if (mCacheData)
         {
-            Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
-            backingBuffer.Calloc(elementSize);
-            VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
-            TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), elementSize);
+            uint32_t offset;
+            ReturnErrorOnFailure(AllocateValue(elementSize, offset));
+            TLV::TLVWriter writer;
+            writer.Init(mValueStore.Get() + offset, elementSize);
             ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), *apData));
-            ReturnErrorOnFailure(writer.Finalize(backingBuffer));
+            ReturnErrorOnFailure(writer.Finalize());
 
-            state.Set<AttributeData>(std::move(backingBuffer));
+            state.Set<AttributeData>(AttributeData{ offset, static_cast<uint32_t>(elementSize) });
         }
         else
         {
@@ -104,7 +113,7 @@ CHIP_ERROR ClusterStateCache::UpdateCache(const ConcreteDataAttributePath & aPat
         // Clear out the committed data version and only set it again once we have received all data for this cluster.
         // Otherwise, we may have incomplete data that looks like it's complete since it has a valid data version.
         //
-        mCache[aPath.mEndpointId][aPath.mClusterId].mCommittedDataVersion.ClearValue();
+        GetOrCreateClusterState(aPath).mCommittedDataVersion.ClearValue();
 
         // This commits a pending data version if the last report path is valid and it is different from the current path.
         if (mLastReportDataPath.IsValidConcreteClusterPath() && mLastReportDataPath != aPath)
@@ -125,7 +134,7 @@ CHIP_ERROR ClusterStateCache::UpdateCache(const ConcreteDataAttributePath & aPat
         // if this data item is encompassed by a wildcard path, let's go ahead and update its pending data version.
         if (foundEncompassingWildcardPath)
         {
-            mCache[aPath.mEndpointId][aPath.mClusterId].mPendingDataVersion = aPath.mDataVersion;
+            GetOrCreateClusterState(aPath).mPendingDataVersion = aPath.mDataVersion;
         }
 
         mLastReportDataPath = aPath;
@@ -151,13 +160,79 @@ CHIP_ERROR ClusterStateCache::UpdateCache(const ConcreteDataAttributePath & aPat
         mAddedEndpoints.push_back(aPath.mEndpointId);
     }
 
-    mCache[aPath.mEndpointId][aPath.mClusterId].mAttributes[aPath.mAttributeId] = std::move(state);
+    GetOrCreateClusterState(aPath);
+
+    if (state.Is<AttributeData>())
+    {
+        mValueStoreLiveSize += state.Get<AttributeData>().mSize;
+    }
+
+    const ConcreteAttributePath attributePath(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId);
+    auto attributeIter = mAttributes.begin() + (FirstAttributeAtOrAfter(attributePath) - mAttributes.cbegin());
+    if (attributeIter != mAttributes.end() && attributeIter->mPath == attributePath)
+    {
+        if (attributeIter->mState.Is<AttributeData>())
+        {
+            mValueStoreLiveSize -= attributeIter->mState.Get<AttributeData>().mSize;
+        }
+        attributeIter->mState = std::move(state);
+    }
+    else
+    {
+        mAttributes.insert(attributeIter, AttributeEntry{ attributePath, std::move(state) });
+    }
 
     if (mCacheData)
     {
-        mChangedAttributeSet.insert(aPath);
+        mChangedAttributes.push_back(attributePath);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ClusterStateCache::AllocateValue(size_t aSize, uint32_t & aOffset)
+{
+    if (aSize > mValueStoreCapacity - mValueStoreUsedSize)
+    {
+        ReturnErrorOnFailure(CompactValues(aSize));
+    }
+
+    aOffset = static_cast<uint32_t>(mValueStoreUsedSize);
+    mValueStoreUsedSize += aSize;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ClusterStateCache::CompactValues(size_t aExtraSize)
+{
+    // Leave some headroom, so that a cache being filled does not need to be compacted for every value.
+    size_t capacity = mValueStoreLiveSize + aExtraSize;
+    capacity += capacity / 2;
+    VerifyOrReturnError(CanCastTo<uint32_t>(capacity), CHIP_ERROR_NO_MEMORY);
+
+    Platform::ScopedMemoryBuffer<uint8_t> valueStore;
+    if (capacity > 0)
+    {
+        VerifyOrReturnError(valueStore.Alloc(capacity), CHIP_ERROR_NO_MEMORY);
     }
 
+    size_t usedSize = 0;
+    for (auto & attribute : mAttributes)
+    {
+        if (attribute.mState.Is<AttributeData>())
+        {
+            auto & data = attribute.mState.Get<AttributeData>();
+            memcpy(valueStore.Get() + usedSize, mValueStore.Get() + data.mOffset, data.mSize);
+            data.mOffset = static_cast<uint32_t>(usedSize);
+            usedSize += data.mSize;
+        }
+    }
+    VerifyOrDie(usedSize == mValueStoreLiveSize);
+
+    // Moving into a ScopedMemoryBuffer does not release what it held.
+    mValueStore.Free();
+    mValueStore         = std::move(valueStore);
+    mValueStoreCapacity = capacity;
+    mValueStoreUsedSize = usedSize;
     return CHIP_NO_ERROR;
 }
 
@@ -211,7 +286,7 @@ CHIP_ERROR ClusterStateCache::UpdateEventCache(const EventHeader & aEventHeader,
 void ClusterStateCache::OnReportBegin()
 {
     mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
-    mChangedAttributeSet.clear();
+    mChangedAttributes.clear();
     mAddedEndpoints.clear();
     mCallback.OnReportBegin();
 }
@@ -223,7 +298,7 @@ void ClusterStateCache::CommitPendingDataVersion()
         return;
     }
 
-    auto & lastClusterInfo = mCache[mLastReportDataPath.mEndpointId][mLastReportDataPath.mClusterId];
+    auto & lastClusterInfo = GetOrCreateClusterState(mLastReportDataPath);
     if (lastClusterInfo.mPendingDataVersion.HasValue())
     {
         lastClusterInfo.mCommittedDataVersion = lastClusterInfo.mPendingDataVersion;
@@ -237,11 +312,23 @@ void ClusterStateCache::OnReportEnd()
     mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
     std::set<std::tuple<EndpointId, ClusterId>> changedClusters;
 
+    //
+    // Give back the memory of the values this report replaced if they take up most of the store. This is done
+    // before the callbacks below, which may read values from the cache. Failing to compact is not an issue.
+    //
+    if (mValueStoreUsedSize - mValueStoreLiveSize > mValueStoreLiveSize)
+    {
+        CompactValues(0);
+    }
+
+    std::sort(mChangedAttributes.begin(), mChangedAttributes.end());
+    mChangedAttributes.erase(std::unique(mChangedAttributes.begin(), mChangedAttributes.end()), mChangedAttributes.end());
+
     //
     // Add the EndpointId and ClusterId into a set so that we only
     // convey unique combinations in the subsequent OnClusterChanged callback.
     //
-    for (auto & path : mChangedAttributeSet)
+    for (auto & path : mChangedAttributes)
     {
         mCallback.OnAttributeChanged(this, path);
         changedClusters.insert(std::make_tuple(path.mEndpointId, path.mClusterId));
@@ -275,7 +362,8 @@ CHIP_ERROR ClusterStateCache::Get(const ConcreteAttributePath & path, TLV::TLVRe
         return CHIP_ERROR_KEY_NOT_FOUND;
     }
 
-    reader.Init(attributeState->Get<AttributeData>().Get(), attributeState->Get<AttributeData>().AllocatedSize());
+    const auto & data = attributeState->Get<AttributeData>();
+    reader.Init(mValueStore.Get() + data.mOffset, data.mSize);
     return reader.Next();
 }
 
@@ -295,57 +383,64 @@ CHIP_ERROR ClusterStateCache::Get(EventNumber eventNumber, TLV::TLVReader & read
     return CHIP_NO_ERROR;
 }
 
-const ClusterStateCache::EndpointState * ClusterStateCache::GetEndpointState(EndpointId endpointId, CHIP_ERROR & err) const
+ClusterStateCache::ClusterList::const_iterator ClusterStateCache::FirstClusterAtOrAfter(const ConcreteClusterPath & path) const
 {
-    auto endpointIter = mCache.find(endpointId);
-    if (endpointIter == mCache.end())
-    {
-        err = CHIP_ERROR_KEY_NOT_FOUND;
-        return nullptr;
-    }
+    return std::lower_bound(mClusters.begin(), mClusters.end(), path,
+                            [](const ClusterState & cluster, const ConcreteClusterPath & key) {
+                                return ClusterPathLess(cluster.mPath, key);
+                            });
+}
 
-    err = CHIP_NO_ERROR;
-    return &endpointIter->second;
+ClusterStateCache::AttributeList::const_iterator
+ClusterStateCache::FirstAttributeAtOrAfter(const ConcreteAttributePath & path) const
+{
+    return std::lower_bound(mAttributes.begin(), mAttributes.end(), path,
+                            [](const AttributeEntry & attribute, const ConcreteAttributePath & key) {
+                                return attribute.mPath < key;
+                            });
 }
 
-const ClusterStateCache::ClusterState * ClusterStateCache::GetClusterState(EndpointId endpointId, ClusterId clusterId,
-                                                                           CHIP_ERROR & err) const
+ClusterStateCache::ClusterState & ClusterStateCache::GetOrCreateClusterState(const ConcreteClusterPath & path)
 {
-    auto endpointState = GetEndpointState(endpointId, err);
-    if (err != CHIP_NO_ERROR)
+    const ConcreteClusterPath clusterPath(path.mEndpointId, path.mClusterId);
+    auto clusterIter = mClusters.begin() + (FirstClusterAtOrAfter(clusterPath) - mClusters.cbegin());
+    if (clusterIter == mClusters.end() || clusterIter->mPath != clusterPath)
     {
-        return nullptr;
+        ClusterState clusterState;
+        clusterState.mPath = clusterPath;
+        clusterIter        = mClusters.insert(clusterIter, clusterState);
     }
+    return *clusterIter;
+}
 
-    auto clusterState = endpointState->find(clusterId);
-    if (clusterState == endpointState->end())
+const ClusterStateCache::ClusterState * ClusterStateCache::GetClusterState(EndpointId endpointId, ClusterId clusterId,
+                                                                           CHIP_ERROR & err) const
+{
+    const ConcreteClusterPath clusterPath(endpointId, clusterId);
+    auto clusterIter = FirstClusterAtOrAfter(clusterPath);
+    if (clusterIter == mClusters.end() || clusterIter->mPath != clusterPath)
     {
         err = CHIP_ERROR_KEY_NOT_FOUND;
         return nullptr;
     }
 
     err = CHIP_NO_ERROR;
-    return &clusterState->second;
+    return &*clusterIter;
 }
 
 const ClusterStateCache::AttributeState * ClusterStateCache::GetAttributeState(EndpointId endpointId, ClusterId clusterId,
                                                                                AttributeId attributeId, CHIP_ERROR & err) const
 {
-    auto clusterState = GetClusterState(endpointId, clusterId, err);
-    if (err != CHIP_NO_ERROR)
-    {
-        return nullptr;
-    }
-
-    auto attributeState = clusterState->mAttributes.find(attributeId);
-    if (attributeState == clusterState->mAttributes.end())
+    const ConcreteAttributePath attributePath(endpointId, clusterId, attributeId);
+    auto attributeIter = FirstAttributeAtOrAfter(attributePath);
+    if (attributeIter == mAttributes.end() || attributeIter->mPath != attributePath)
     {
         err = CHIP_ERROR_KEY_NOT_FOUND;
         return nullptr;
     }
 
     err = CHIP_NO_ERROR;
-    return &attributeState->second;
+    return &attributeIter->mState;
 }
 
 const ClusterStateCache::EventData * ClusterStateCache::GetEventData(EventNumber eventNumber, CHIP_ERROR & err) const
@@ -448,55 +543,59 @@ CHIP_ERROR ClusterStateCache::GetStatus(const ConcreteEventPath & path, StatusIB
 
 void ClusterStateCache::GetSortedFilters(std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const
 {
-    for (auto const & endpointIter : mCache)
+    auto attributeIter = mAttributes.cbegin();
+    for (auto const & clusterState : mClusters)
     {
-        EndpointId endpointId = endpointIter.first;
-        for (auto const & clusterIter : endpointIter.second)
+        // Both lists are sorted by path, so the attributes of this cluster come next.
+        auto clusterAttributesBegin = attributeIter;
+        while (attributeIter != mAttributes.cend() && ConcreteClusterPath(attributeIter->mPath) == clusterState.mPath)
+        {
+            ++attributeIter;
+        }
+
+        if (!clusterState.mCommittedDataVersion.HasValue())
+        {
+            continue;
+        }
+        DataVersion dataVersion = clusterState.mCommittedDataVersion.Value();
+        size_t clusterSize      = 0;
+
+        for (auto iter = clusterAttributesBegin; iter != attributeIter; ++iter)
         {
-            if (!clusterIter.second.mCommittedDataVersion.HasValue())
+            const AttributeState & attributeState = iter->mState;
+            if (attributeState.Is<StatusIB>())
             {
-                continue;
+                clusterSize += SizeOfStatusIB(attributeState.Get<StatusIB>());
             }
-            DataVersion dataVersion = clusterIter.second.mCommittedDataVersion.Value();
-            size_t clusterSize      = 0;
-            ClusterId clusterId     = clusterIter.first;
-
-            for (auto const & attributeIter : clusterIter.second.mAttributes)
+            else if (attributeState.Is<size_t>())
             {
-                if (attributeIter.second.Is<StatusIB>())
-                {
-                    clusterSize += SizeOfStatusIB(attributeIter.second.Get<StatusIB>());
-                }
-                else if (attributeIter.second.Is<size_t>())
-                {
-                    clusterSize += attributeIter.second.Get<size_t>();
-                }
-                else
-                {
-                    VerifyOrDie(attributeIter.second.Is<AttributeData>());
-                    TLV::TLVReader bufReader;
-                    bufReader.Init(attributeIter.second.Get<AttributeData>().Get(),
-                                   attributeIter.second.Get<AttributeData>().AllocatedSize());
-                    ReturnOnFailure(bufReader.Next());
-                    // Skip to the end of the element.
-                    ReturnOnFailure(bufReader.Skip());
-
-                    // Compute the amount of value data
-                    clusterSize += bufReader.GetLengthRead();
-                }
+                clusterSize += attributeState.Get<size_t>();
             }
-
-            if (clusterSize == 0)
+            else
             {
-                // No data in this cluster, so no point in sending a dataVersion
-                // along at all.
-                continue;
+                VerifyOrDie(attributeState.Is<AttributeData>());
+                TLV::TLVReader bufReader;
+                bufReader.Init(mValueStore.Get() + attributeState.Get<AttributeData>().mOffset,
+                               attributeState.Get<AttributeData>().mSize);
+                ReturnOnFailure(bufReader.Next());
+                // Skip to the end of the element.
+                ReturnOnFailure(bufReader.Skip());
+
+                // Compute the amount of value data
+                clusterSize += bufReader.GetLengthRead();
             }
+        }
 
-            DataVersionFilter filter(endpointId, clusterId, dataVersion);
-
-            aVector.push_back(std::make_pair(filter, clusterSize));
+        if (clusterSize == 0)
+        {
+            // No data in this cluster, so no point in sending a dataVersion
+            // along at all.
+            continue;
         }
+
+        DataVersionFilter filter(clusterState.mPath.mEndpointId, clusterState.mPath.mClusterId, dataVersion);
+
+        aVector.push_back(std::make_pair(filter, clusterSize));
     }
 
     std::sort(aVector.begin(), aVector.end(),
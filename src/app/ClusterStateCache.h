@@ -57,6 +57,10 @@ namespace app {
  * The data is stored internally in the cache as TLV. This permits re-use of the existing cluster objects
  * to de-serialize the state on-demand.
  *
+ * Attribute state is indexed by flat arrays sorted by path, and the TLV values are packed into a single
+ * arena. Replacing a value abandons its previous bytes in the arena; those are reclaimed by compacting the
+ * arena when it needs to grow, or at the end of a report if they take up most of it.
+ *
  * The cache serves as a callback adapter as well in that it 'forwards' the ReadClient::Callback calls transparently
  * through to a registered callback. In addition, it provides its own enhancements to the base ReadClient::Callback
  * to make it easier to know what has changed in the cache.
@@ -135,7 +139,7 @@ public:
      *
      * For some types of attributes, the value for the attribute is directly backed by the underlying TLV buffer
      * and has pointers into that buffer. (e.g octet strings, char strings and lists).  This buffer only remains
-     * valid until the cached value for that path is updated, so it must not be held
+     * valid until the cache is next updated, so it must not be held
      * across any async call boundaries.
      *
      * The template parameter AttributeObjectTypeT is generally expected to be a
@@ -207,7 +211,7 @@ public:
      *
      * For some types of attributes, the value for the attribute is directly backed by the underlying TLV buffer
      * and has pointers into that buffer. (e.g octet strings, char strings and lists).  This buffer only remains
-     * valid until the cached value for that path is updated, so it must not be held
+     * valid until the cache is next updated, so it must not be held
      * across any async call boundaries.
      *
      * The template parameter ClusterObjectT is generally expected to be a
@@ -254,7 +258,7 @@ public:
      * Retrieve the value of an attribute by updating a in-out TLVReader to be positioned
      * right at the attribute value.
      *
-     * The underlying TLV buffer only remains valid until the cached value for that path is updated, so it must
+     * The underlying TLV buffer only remains valid until the cache is next updated, so it must
      * not be held across any async call boundaries.
      *
      * Notable return values:
@@ -368,16 +372,10 @@ public:
     {
         CHIP_ERROR err;
 
-        auto clusterState = GetClusterState(endpointId, clusterId, err);
+        GetClusterState(endpointId, clusterId, err);
         ReturnErrorOnFailure(err);
 
-        for (auto & attributeIter : clusterState->mAttributes)
-        {
-            const ConcreteAttributePath path(endpointId, clusterId, attributeIter.first);
-            ReturnErrorOnFailure(func(path));
-        }
-
-        return CHIP_NO_ERROR;
+        return ForEachAttributeInCluster(ConcreteClusterPath(endpointId, clusterId), func);
     }
 
     /*
@@ -396,18 +394,11 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachAttribute(ClusterId clusterId, IteratorFunc func) const
     {
-        for (auto & endpointIter : mCache)
+        for (auto & clusterState : mClusters)
         {
-            for (auto & clusterIter : endpointIter.second)
+            if (clusterState.mPath.mClusterId == clusterId)
             {
-                if (clusterIter.first == clusterId)
-                {
-                    for (auto & attributeIter : clusterIter.second.mAttributes)
-                    {
-                        const ConcreteAttributePath path(endpointIter.first, clusterId, attributeIter.first);
-                        ReturnErrorOnFailure(func(path));
-                    }
-                }
+                ReturnErrorOnFailure(ForEachAttributeInCluster(clusterState.mPath, func));
             }
         }
         return CHIP_NO_ERROR;
@@ -429,13 +420,10 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachCluster(EndpointId endpointId, IteratorFunc func) const
     {
-        auto endpointIter = mCache.find(endpointId);
-        if (endpointIter->first == endpointId)
+        for (auto clusterIter = FirstClusterAtOrAfter(ConcreteClusterPath(endpointId, 0));
+             clusterIter != mClusters.end() && clusterIter->mPath.mEndpointId == endpointId; ++clusterIter)
         {
-            for (auto & clusterIter : endpointIter->second)
-            {
-                ReturnErrorOnFailure(func(clusterIter.first));
-            }
+            ReturnErrorOnFailure(func(clusterIter->mPath.mClusterId));
         }
         return CHIP_NO_ERROR;
     }
@@ -534,8 +522,22 @@ private:
     // * If we got data for the attribute and we are not storing data
     //   oureselves, the size of the data, so we can still prioritize sending
     //   DataVersions correctly.
-    using AttributeData  = Platform::ScopedMemoryBufferWithSize<uint8_t>;
+    //
+    // Data we store ourselves lives in mValueStore.
+    struct AttributeData
+    {
+        uint32_t mOffset;
+        uint32_t mSize;
+    };
     using AttributeState = Variant<StatusIB, AttributeData, size_t>;
+
+    struct AttributeEntry
+    {
+        ConcreteAttributePath mPath;
+        AttributeState mState;
+    };
+    using AttributeList = std::vector<AttributeEntry>; // sorted by path
+
     // mPendingDataVersion represents a tentative data version for a cluster that we have gotten some reports for.
     //
     // mCurrentDataVersion represents a known data version for a cluster.  In order for this to have a
@@ -543,12 +545,11 @@ private:
     // and we must not be in the middle of receiving reports for that cluster.
     struct ClusterState
     {
-        std::map<AttributeId, AttributeState> mAttributes;
+        ConcreteClusterPath mPath;
         Optional<DataVersion> mPendingDataVersion;
         Optional<DataVersion> mCommittedDataVersion;
     };
-    using EndpointState = std::map<ClusterId, ClusterState>;
-    using NodeState     = std::map<EndpointId, EndpointState>;
+    using ClusterList = std::vector<ClusterState>; // sorted by path; every cluster has at least one attribute
 
     struct Comparator
     {
@@ -584,11 +585,41 @@ private:
      *        CHIP_ERROR_KEY_NOT_FOUND shall be returned.
      *
      */
-    const EndpointState * GetEndpointState(EndpointId endpointId, CHIP_ERROR & err) const;
     const ClusterState * GetClusterState(EndpointId endpointId, ClusterId clusterId, CHIP_ERROR & err) const;
     const AttributeState * GetAttributeState(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId,
                                              CHIP_ERROR & err) const;
 
+    ClusterState & GetOrCreateClusterState(const ConcreteClusterPath & path);
+
+    // Lower bounds of a path in the sorted cluster and attribute lists.
+    ClusterList::const_iterator FirstClusterAtOrAfter(const ConcreteClusterPath & path) const;
+    AttributeList::const_iterator FirstAttributeAtOrAfter(const ConcreteAttributePath & path) const;
+
+    template <typename IteratorFunc>
+    CHIP_ERROR ForEachAttributeInCluster(const ConcreteClusterPath & clusterPath, IteratorFunc & func) const
+    {
+        const ConcreteAttributePath firstPath(clusterPath.mEndpointId, clusterPath.mClusterId, 0);
+        for (auto attributeIter = FirstAttributeAtOrAfter(firstPath);
+             attributeIter != mAttributes.end() && ConcreteClusterPath(attributeIter->mPath) == clusterPath; ++attributeIter)
+        {
+            const ConcreteAttributePath path(attributeIter->mPath);
+            ReturnErrorOnFailure(func(path));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    /*
+     * Reserves aSize bytes at the end of mValueStore, compacting and growing it if they do not fit.
+     * Compaction moves the stored values, so it invalidates any reader into mValueStore.
+     */
+    CHIP_ERROR AllocateValue(size_t aSize, uint32_t & aOffset);
+
+    /*
+     * Moves the values still referenced by mAttributes to a new store, leaving room for at least
+     * aExtraSize more bytes.
+     */
+    CHIP_ERROR CompactValues(size_t aExtraSize);
+
     const EventData * GetEventData(EventNumber number, CHIP_ERROR & err) const;
 
     /*
@@ -662,8 +693,16 @@ private:
     CHIP_ERROR GetElementTLVSize(TLV::TLVReader * apData, size_t & aSize);
 
     Callback & mCallback;
-    NodeState mCache;
-    std::set<ConcreteAttributePath> mChangedAttributeSet;
+    ClusterList mClusters;
+    AttributeList mAttributes;
+    // Arena of the TLV values in mAttributes. Of the mValueStoreUsedSize bytes allocated so far, those
+    // beyond mValueStoreLiveSize belonged to values that were since replaced.
+    Platform::ScopedMemoryBuffer<uint8_t> mValueStore;
+    size_t mValueStoreCapacity = 0;
+    size_t mValueStoreUsedSize = 0;
+    size_t mValueStoreLiveSize = 0;
+    // Attributes changed by the current report; may contain duplicates until the report ends.
+    std::vector<ConcreteAttributePath> mChangedAttributes;
     std::set<AttributePathParams, Comparator> mRequestPathSet; // wildcard attribute request path only
     std::vector<EndpointId> mAddedEndpoints;
 
@@ -0,0 +1,144 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <lib/core/DataModelTypes.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * @brief Sorted index from endpoint id to the slot holding that endpoint in the endpoint table.
+ *
+ * The endpoint table of the attribute storage is indexed by slot, so finding an endpoint by id
+ * used to be a linear scan over all slots, which gets expensive on bridges exposing hundreds of
+ * dynamic endpoints. This index keeps (endpoint id, slot) pairs sorted so that look-ups are a
+ * binary search. It must be updated every time a slot is assigned or cleared; properties that
+ * can change without that, such as whether the endpoint is enabled, are checked by the caller
+ * through the predicate passed to Find().
+ *
+ * The same endpoint id may be recorded for several slots. Find() then returns the lowest
+ * accepted slot, matching the order of a scan over the table.
+ */
+template <size_t kCapacity>
+class EndpointIndex
+{
+public:
+    static constexpr uint16_t kInvalidSlot = UINT16_MAX;
+
+    /**
+     * @brief Forget all the recorded endpoints.
+     */
+    void Clear() { mCount = 0; }
+
+    /**
+     * @brief Record that `slot` holds `endpointId`.
+     *
+     * @return false if the index is full.
+     */
+    bool Insert(EndpointId endpointId, uint16_t slot)
+    {
+        if (mCount >= kCapacity)
+        {
+            return false;
+        }
+
+        size_t pos = LowerBound(endpointId, slot);
+        memmove(&mEntries[pos + 1], &mEntries[pos], (mCount - pos) * sizeof(Entry));
+        mEntries[pos] = { endpointId, slot };
+        mCount++;
+        return true;
+    }
+
+    /**
+     * @brief Forget that `slot` holds `endpointId`. Does nothing if that was not recorded.
+     */
+    void Remove(EndpointId endpointId, uint16_t slot)
+    {
+        size_t pos = LowerBound(endpointId, slot);
+        if (pos < mCount && mEntries[pos].endpointId == endpointId && mEntries[pos].slot == slot)
+        {
+            memmove(&mEntries[pos], &mEntries[pos + 1], (mCount - pos - 1) * sizeof(Entry));
+            mCount--;
+        }
+    }
+
+    /**
+     * @brief Return the lowest slot holding `endpointId` for which `accept(slot)` returns true, or kInvalidSlot.
+     */
+    template <typename Predicate>
+    uint16_t Find(EndpointId endpointId, Predicate && accept) const
+    {
+        for (size_t pos = LowerBound(endpointId, 0); pos < mCount && mEntries[pos].endpointId == endpointId; pos++)
+        {
+            if (accept(mEntries[pos].slot))
+            {
+                return mEntries[pos].slot;
+            }
+        }
+        return kInvalidSlot;
+    }
+
+    /**
+     * @brief Return the lowest slot holding `endpointId`, or kInvalidSlot.
+     */
+    uint16_t Find(EndpointId endpointId) const
+    {
+        return Find(endpointId, [](uint16_t) { return true; });
+    }
+
+    size_t Count() const { return mCount; }
+
+private:
+    struct Entry
+    {
+        EndpointId endpointId;
+        uint16_t slot;
+    };
+
+    // Position of the first entry that is not ordered before (endpointId, slot).
+    size_t LowerBound(EndpointId endpointId, uint16_t slot) const
+    {
+        size_t low  = 0;
+        size_t high = mCount;
+        while (low < high)
+        {
+            size_t mid          = low + (high - low) / 2;
+            const Entry & entry = mEntries[mid];
+            if (entry.endpointId < endpointId || (entry.endpointId == endpointId && entry.slot < slot))
+            {
+                low = mid + 1;
+            }
+            else
+            {
+                high = mid;
+            }
+        }
+        return low;
+    }
+
+    Entry mEntries[kCapacity > 0 ? kCapacity : 1];
+    size_t mCount = 0;
+};
+
+} // namespace app
+} // namespace chip
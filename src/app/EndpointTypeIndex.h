@@ -0,0 +1,400 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <app/util/af-types.h>
+#include <app/util/att-storage.h>
+#include <lib/core/DataModelTypes.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * @brief Hash index of the clusters and attributes of endpoint types.
+ *
+ * Finding a cluster of an endpoint, or an attribute of a cluster, used to be a linear scan that also summed up the storage
+ * size of everything before the match to find its storage offset. This index records, for every indexed endpoint type,
+ * (cluster id, cluster role) -> cluster, scoped index and storage offset within the endpoint, and for each of its clusters
+ * (attribute id) -> attribute metadata and storage offset within the cluster, so that both look-ups take constant time.
+ *
+ * Endpoint types are indexed as a whole: Add() either records all the clusters and attributes of a type or, when the
+ * index does not have room for them, none. Look-ups report whether they could be answered from the index, and callers
+ * fall back to scanning the endpoint type otherwise. Since bridges usually expose many endpoints of the same few endpoint
+ * types, the capacities needed are those of the distinct endpoint types in use, not of all endpoints.
+ *
+ * An endpoint type takes one cluster entry, plus one for each of its clusters and one for each role (server or client)
+ * of each of its clusters. A cluster takes one attribute entry, plus one for each of its attributes, however many
+ * endpoint types share it.
+ *
+ * Endpoint types and clusters are identified by address, so a type must be removed before its memory is reused.
+ */
+template <size_t kClusterCapacity, size_t kAttributeCapacity>
+class EndpointTypeIndex
+{
+public:
+    /**
+     * @brief Forget all the indexed endpoint types.
+     */
+    void Clear()
+    {
+        mClusters.Clear();
+        mAttributes.Clear();
+    }
+
+    /**
+     * @brief Index all the clusters and attributes of `endpointType`. Does nothing if it already is indexed.
+     *
+     * @return false if the index does not have room for the endpoint type, in which case nothing is recorded.
+     */
+    bool Add(const EmberAfEndpointType * endpointType)
+    {
+        if (Contains(endpointType))
+        {
+            return true;
+        }
+
+        size_t clusterEntries   = 1;
+        size_t attributeEntries = 0;
+        for (uint8_t i = 0; i < endpointType->clusterCount; i++)
+        {
+            const EmberAfCluster * cluster = &endpointType->cluster[i];
+            clusterEntries += 1u + ((cluster->mask & CLUSTER_MASK_SERVER) ? 1u : 0u);
+            clusterEntries += (cluster->mask & CLUSTER_MASK_CLIENT) ? 1u : 0u;
+            if (mAttributes.Find(Key(cluster), 0, kMarker) == nullptr)
+            {
+                attributeEntries += 1u + cluster->attributeCount;
+            }
+        }
+        if (clusterEntries > kClusterCapacity - mClusters.Count() || attributeEntries > kAttributeCapacity - mAttributes.Count())
+        {
+            return false;
+        }
+
+        uint16_t storageOffset = 0;
+        uint8_t serverIndex    = 0;
+        uint8_t clientIndex    = 0;
+        for (uint8_t i = 0; i < endpointType->clusterCount; i++)
+        {
+            const EmberAfCluster * cluster = &endpointType->cluster[i];
+            AddAttributes(cluster);
+
+            AddCluster(endpointType, cluster->clusterId, kAnyRole, i, i, storageOffset);
+            if (cluster->mask & CLUSTER_MASK_SERVER)
+            {
+                AddCluster(endpointType, cluster->clusterId, kServerRole, i, serverIndex++, storageOffset);
+            }
+            if (cluster->mask & CLUSTER_MASK_CLIENT)
+            {
+                AddCluster(endpointType, cluster->clusterId, kClientRole, i, clientIndex++, storageOffset);
+            }
+            storageOffset = static_cast<uint16_t>(storageOffset + cluster->clusterSize);
+        }
+        mClusters.Insert({ Key(endpointType), 0, 0, 0, kMarker, 0 });
+        return true;
+    }
+
+    /**
+     * @brief Forget `endpointType`, and the attributes of its clusters that no other indexed endpoint type uses.
+     */
+    void Remove(const EmberAfEndpointType * endpointType)
+    {
+        if (!Contains(endpointType))
+        {
+            return;
+        }
+
+        for (uint8_t i = 0; i < endpointType->clusterCount; i++)
+        {
+            const EmberAfCluster * cluster = &endpointType->cluster[i];
+            mClusters.Erase(Key(endpointType), cluster->clusterId, kAnyRole);
+            mClusters.Erase(Key(endpointType), cluster->clusterId, kServerRole);
+            mClusters.Erase(Key(endpointType), cluster->clusterId, kClientRole);
+            RemoveAttributes(cluster);
+        }
+        mClusters.Erase(Key(endpointType), 0, kMarker);
+    }
+
+    /**
+     * @brief Whether look-ups in `endpointType` can be answered from the index.
+     */
+    bool Contains(const EmberAfEndpointType * endpointType) const
+    {
+        return mClusters.Find(Key(endpointType), 0, kMarker) != nullptr;
+    }
+
+    /**
+     * @brief Find the first cluster of `endpointType` with id `clusterId` whose mask matches `mask`, like
+     *        emberAfFindClusterInType does. `mask` must be 0, CLUSTER_MASK_SERVER or CLUSTER_MASK_CLIENT.
+     *
+     * @param[out] cluster        The cluster, or nullptr if the endpoint type has no such cluster.
+     * @param[out] index          Index of the cluster among the clusters of the endpoint type matching `mask`.
+     * @param[out] storageOffset  Offset of the storage of the cluster within the storage of the endpoint.
+     *
+     * @return false if the index cannot answer the look-up, in which case the outputs are not set.
+     */
+    bool FindCluster(const EmberAfEndpointType * endpointType, ClusterId clusterId, EmberAfClusterMask mask,
+                     const EmberAfCluster ** cluster, uint8_t * index = nullptr, uint16_t * storageOffset = nullptr) const
+    {
+        uint8_t role;
+        switch (mask)
+        {
+        case 0:
+            role = kAnyRole;
+            break;
+        case CLUSTER_MASK_SERVER:
+            role = kServerRole;
+            break;
+        case CLUSTER_MASK_CLIENT:
+            role = kClientRole;
+            break;
+        default:
+            return false;
+        }
+
+        const Entry * entry = mClusters.Find(Key(endpointType), clusterId, role);
+        if (entry == nullptr)
+        {
+            // Either the endpoint type has no such cluster, or it is not indexed.
+            if (!Contains(endpointType))
+            {
+                return false;
+            }
+            *cluster = nullptr;
+            return true;
+        }
+
+        *cluster = &endpointType->cluster[entry->position];
+        if (index != nullptr)
+        {
+            *index = entry->index;
+        }
+        if (storageOffset != nullptr)
+        {
+            *storageOffset = entry->storageOffset;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Find the first attribute of `cluster` with id `attributeId`.
+     *
+     * @param[out] metadata       The attribute, or nullptr if the cluster has no such attribute.
+     * @param[out] storageOffset  Offset of the storage of the attribute within the storage of the cluster.
+     *
+     * @return false if the index cannot answer the look-up, in which case the outputs are not set.
+     */
+    bool FindAttribute(const EmberAfCluster * cluster, AttributeId attributeId, const EmberAfAttributeMetadata ** metadata,
+                       uint16_t * storageOffset = nullptr) const
+    {
+        const Entry * entry = mAttributes.Find(Key(cluster), attributeId, kAttribute);
+        if (entry == nullptr)
+        {
+            // Either the cluster has no such attribute, or it is not indexed.
+            if (mAttributes.Find(Key(cluster), 0, kMarker) == nullptr)
+            {
+                return false;
+            }
+            *metadata = nullptr;
+            return true;
+        }
+
+        *metadata = &cluster->attributes[entry->position];
+        if (storageOffset != nullptr)
+        {
+            *storageOffset = entry->storageOffset;
+        }
+        return true;
+    }
+
+    size_t ClusterEntryCount() const { return mClusters.Count(); }
+    size_t AttributeEntryCount() const { return mAttributes.Count(); }
+
+private:
+    // Kinds of entries.  Markers record that an endpoint type, or a cluster, is indexed; the
+    // storage offset of a cluster marker counts the indexed endpoint types using the cluster.
+    static constexpr uint8_t kAnyRole    = 0;
+    static constexpr uint8_t kServerRole = 1;
+    static constexpr uint8_t kClientRole = 2;
+    static constexpr uint8_t kAttribute  = 0;
+    static constexpr uint8_t kMarker     = 3;
+
+    struct Entry
+    {
+        uintptr_t owner; // Endpoint type of a cluster, cluster of an attribute.  0 for unused slots.
+        uint32_t id;
+        uint16_t storageOffset;
+        uint16_t position;
+        uint8_t kind;
+        uint8_t index;
+    };
+
+    // Open-addressing hash table with linear probing, kept at most half full.
+    template <size_t kCapacity>
+    class Table
+    {
+    public:
+        void Clear()
+        {
+            for (Entry & entry : mSlots)
+            {
+                entry.owner = 0;
+            }
+            mCount = 0;
+        }
+
+        size_t Count() const { return mCount; }
+
+        const Entry * Find(uintptr_t owner, uint32_t id, uint8_t kind) const
+        {
+            for (size_t slot = Home(owner, id, kind);; slot = (slot + 1) & kMask)
+            {
+                const Entry & entry = mSlots[slot];
+                if (entry.owner == 0)
+                {
+                    return nullptr;
+                }
+                if (entry.owner == owner && entry.id == id && entry.kind == kind)
+                {
+                    return &entry;
+                }
+            }
+        }
+
+        Entry * Find(uintptr_t owner, uint32_t id, uint8_t kind)
+        {
+            return const_cast<Entry *>(static_cast<const Table *>(this)->Find(owner, id, kind));
+        }
+
+        // The caller makes sure that there is room for the entry, and that its key is not in the table yet.
+        void Insert(const Entry & entry)
+        {
+            size_t slot = Home(entry.owner, entry.id, entry.kind);
+            while (mSlots[slot].owner != 0)
+            {
+                slot = (slot + 1) & kMask;
+            }
+            mSlots[slot] = entry;
+            mCount++;
+        }
+
+        void Erase(uintptr_t owner, uint32_t id, uint8_t kind)
+        {
+            Entry * entry = Find(owner, id, kind);
+            if (entry == nullptr)
+            {
+                return;
+            }
+
+            // Move back the entries that follow in the probe sequence, so that none of them is cut off
+            // from its home slot by the hole.
+            size_t hole = static_cast<size_t>(entry - mSlots);
+            for (size_t slot = (hole + 1) & kMask; mSlots[slot].owner != 0; slot = (slot + 1) & kMask)
+            {
+                size_t home = Home(mSlots[slot].owner, mSlots[slot].id, mSlots[slot].kind);
+                if (((slot - home) & kMask) >= ((slot - hole) & kMask))
+                {
+                    mSlots[hole] = mSlots[slot];
+                    hole         = slot;
+                }
+            }
+            mSlots[hole].owner = 0;
+            mCount--;
+        }
+
+    private:
+        static constexpr size_t SlotCount(size_t count) { return (count >= 2 * kCapacity) ? count : SlotCount(count * 2); }
+
+        static constexpr size_t kSlotCount = SlotCount(1);
+        static constexpr size_t kMask      = kSlotCount - 1;
+
+        static size_t Home(uintptr_t owner, uint32_t id, uint8_t kind)
+        {
+            uint64_t hash = static_cast<uint64_t>(owner) * 0x9E3779B97F4A7C15ull;
+            hash ^= ((static_cast<uint64_t>(id) << 2) | kind) * 0xC2B2AE3D27D4EB4Full;
+            return static_cast<size_t>(hash ^ (hash >> 32)) & kMask;
+        }
+
+        Entry mSlots[kSlotCount] = {};
+        size_t mCount            = 0;
+    };
+
+    static uintptr_t Key(const void * object) { return reinterpret_cast<uintptr_t>(object); }
+
+    // Only the first cluster with a given id is recorded for each role, since that is the one a scan finds.
+    void AddCluster(const EmberAfEndpointType * endpointType, ClusterId clusterId, uint8_t role, uint8_t position, uint8_t index,
+                    uint16_t storageOffset)
+    {
+        if (mClusters.Find(Key(endpointType), clusterId, role) == nullptr)
+        {
+            mClusters.Insert({ Key(endpointType), clusterId, storageOffset, position, role, index });
+        }
+    }
+
+    // Clusters may be shared between endpoint types, and their attributes are only recorded once.
+    void AddAttributes(const EmberAfCluster * cluster)
+    {
+        Entry * marker = mAttributes.Find(Key(cluster), 0, kMarker);
+        if (marker != nullptr)
+        {
+            marker->storageOffset++;
+            return;
+        }
+
+        uint16_t storageOffset = 0;
+        for (uint16_t i = 0; i < cluster->attributeCount; i++)
+        {
+            const EmberAfAttributeMetadata * am = &cluster->attributes[i];
+            if (mAttributes.Find(Key(cluster), am->attributeId, kAttribute) == nullptr)
+            {
+                mAttributes.Insert({ Key(cluster), am->attributeId, storageOffset, i, kAttribute, 0 });
+            }
+
+            // Only attributes kept in the attribute storage of the endpoint take up room in it.
+            if (!(am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !(am->mask & ATTRIBUTE_MASK_SINGLETON))
+            {
+                storageOffset = static_cast<uint16_t>(storageOffset + am->size);
+            }
+        }
+        mAttributes.Insert({ Key(cluster), 0, 1, 0, kMarker, 0 });
+    }
+
+    void RemoveAttributes(const EmberAfCluster * cluster)
+    {
+        Entry * marker = mAttributes.Find(Key(cluster), 0, kMarker);
+        if (marker == nullptr || --marker->storageOffset > 0)
+        {
+            return;
+        }
+
+        for (uint16_t i = 0; i < cluster->attributeCount; i++)
+        {
+            mAttributes.Erase(Key(cluster), cluster->attributes[i].attributeId, kAttribute);
+        }
+        mAttributes.Erase(Key(cluster), 0, kMarker);
+    }
+
+    Table<kClusterCapacity> mClusters;
+    Table<kAttributeCapacity> mAttributes;
+};
+
+} // namespace app
+} // namespace chip
@@ -19,6 +19,7 @@
 #include <access/AccessControl.h>
 #include <access/RequestPath.h>
 #include <access/SubjectDescriptor.h>
+#include <algorithm>
 #include <app/EventManagement.h>
 #include <app/InteractionModelEngine.h>
 #include <app/RequiredPrivilege.h>
@@ -26,6 +27,7 @@
 #include <inttypes.h>
 #include <lib/core/TLVUtilities.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
 #include <lib/support/logging/CHIPLogging.h>
 
 using namespace chip::TLV;
@@ -108,7 +110,8 @@ void EventManagement::Init(Messaging::ExchangeManager * apExchangeManager, uint3
 
         current = &apCircularEventBuffer[bufferIndex];
         current->Init(apLogStorageResources[bufferIndex].mpBuffer, apLogStorageResources[bufferIndex].mBufferSize, prev, next,
-                      apLogStorageResources[bufferIndex].mPriority);
+                      apLogStorageResources[bufferIndex].mPriority, apLogStorageResources[bufferIndex].mpIndex,
+                      apLogStorageResources[bufferIndex].mIndexSize);
 
         prev = current;
 
@@ -200,6 +203,10 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
             eventBuffer->mProcessEvictedElement = EvictEvent;
             eventBuffer->mAppData               = &ctx;
             err                                 = eventBuffer->EvictHead();
+            if (err == CHIP_NO_ERROR)
+            {
+                eventBuffer->RemoveIndexHead();
+            }
 
             // one of two things happened: either the element was evicted immediately if the head's priority is same as current
             // buffer(final one), or we figured out how much space we need to evict it into the next buffer, the check happens in
@@ -228,6 +235,7 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
                     // caller know that we could not honor the
                     // request
                     SuccessOrExit(err);
+                    eventBuffer->RemoveIndexHead(eventBuffer->GetNextCircularEventBuffer());
                     continue;
                 }
                 // we cannot copy event outright. We remember the
@@ -470,6 +478,18 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
 
     mBytesWritten += writer.GetLengthWritten();
 
+    if (CanCastTo<uint16_t>(writer.GetLengthWritten()))
+    {
+        mpEventBuffer->AddToIndex({ .mEventNumber = ctxt.mCurrentEventNumber,
+                                    .mClusterId   = opts.mPath.mClusterId,
+                                    .mEndpointId  = opts.mPath.mEndpointId,
+                                    .mSize        = static_cast<uint16_t>(writer.GetLengthWritten()) });
+    }
+    else
+    {
+        mpEventBuffer->InvalidateIndex();
+    }
+
 exit:
     if (err != CHIP_NO_ERROR)
     {
@@ -639,11 +659,110 @@ CHIP_ERROR EventManagement::CopyEventsSince(const TLVReader & aReader, size_t aD
     return err;
 }
 
+static bool IsIndexedEventOfInterest(const EventIndexEntry & aEntry, const SingleLinkedListNode<EventPathParams> * apEventPathList)
+{
+    for (auto * interestedPath = apEventPathList; interestedPath != nullptr; interestedPath = interestedPath->mpNext)
+    {
+        if ((interestedPath->mValue.HasWildcardEndpointId() || interestedPath->mValue.mEndpointId == aEntry.mEndpointId) &&
+            (interestedPath->mValue.HasWildcardClusterId() || interestedPath->mValue.mClusterId == aEntry.mClusterId))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool EventManagement::FindEventsToSkip(const SingleLinkedListNode<EventPathParams> * apEventPathList, EventNumber aEventMin,
+                                       uint32_t & aSkipLength, EventNumber & aLastSkipped)
+{
+    for (auto * buffer = mpEventBuffer; buffer != nullptr; buffer = buffer->GetNextCircularEventBuffer())
+    {
+        VerifyOrReturnValue(buffer->mpIndex != nullptr, false);
+    }
+
+    // Check the least important buffer first: events reach the others through it, so it is the first to lose its index.
+    for (auto * buffer = mpEventBuffer; buffer != nullptr; buffer = buffer->GetNextCircularEventBuffer())
+    {
+        if (!buffer->IsIndexed() && (buffer->mIndexValid || buffer->mIndexRebuildSuggested))
+        {
+            // The buffer changed in a way the index could not follow; walk its events once to catch up.
+            RebuildEventIndex(*buffer);
+        }
+        VerifyOrReturnValue(buffer->IsIndexed(), false);
+    }
+
+    // Same order as the reader of FetchEventsSince: from the critical buffer towards the less important ones.
+    aSkipLength = 0;
+    for (auto * buffer = GetPriorityBuffer(PriorityLevel::Critical); buffer != nullptr;
+         buffer        = buffer->GetPreviousCircularEventBuffer())
+    {
+        for (uint32_t position = 0; position < buffer->GetIndexCount(); position++)
+        {
+            const EventIndexEntry & entry = buffer->GetIndexEntry(position);
+            if (entry.mEventNumber >= aEventMin && IsIndexedEventOfInterest(entry, apEventPathList))
+            {
+                return true;
+            }
+            aSkipLength += entry.mSize;
+            aLastSkipped = entry.mEventNumber;
+        }
+    }
+    return true;
+}
+
+CHIP_ERROR EventManagement::RebuildEventIndex(CircularEventBuffer & aBuffer)
+{
+    CHIP_ERROR err      = CHIP_NO_ERROR;
+    uint32_t eventStart = 0;
+    CircularTLVReader reader;
+
+    aBuffer.ResetIndex();
+    reader.Init(aBuffer);
+    while (aBuffer.mIndexValid)
+    {
+        TLVReader eventReader;
+        TLVType containerType;
+        TLVType containerType1;
+        EventEnvelopeContext event;
+
+        err = reader.Next();
+        if (err == CHIP_END_OF_TLV)
+        {
+            err = CHIP_NO_ERROR;
+            break;
+        }
+        SuccessOrExit(err);
+
+        eventReader.Init(reader);
+        SuccessOrExit(err = eventReader.EnterContainer(containerType));
+        SuccessOrExit(err = eventReader.Next());
+        SuccessOrExit(err = eventReader.EnterContainer(containerType1));
+        err = TLV::Utilities::Iterate(eventReader, FetchEventParameters, &event, false /*recurse*/);
+        VerifyOrExit(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV, /* return err */);
+
+        SuccessOrExit(err = reader.Skip());
+        VerifyOrExit(CanCastTo<uint16_t>(reader.GetLengthRead() - eventStart), err = CHIP_ERROR_BUFFER_TOO_SMALL);
+        aBuffer.AddToIndex({ .mEventNumber = event.mEventNumber,
+                             .mClusterId   = event.mClusterId,
+                             .mEndpointId  = event.mEndpointId,
+                             .mSize        = static_cast<uint16_t>(reader.GetLengthRead() - eventStart) });
+        eventStart = reader.GetLengthRead();
+    }
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        aBuffer.InvalidateIndex();
+    }
+    // Whether or not it succeeded, don't try again until the index gets lost anew.
+    aBuffer.mIndexRebuildSuggested = false;
+    return err;
+}
+
 CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, const SingleLinkedListNode<EventPathParams> * apEventPathList,
                                              EventNumber & aEventMin, size_t & aEventCount,
                                              const Access::SubjectDescriptor & aSubjectDescriptor)
 {
-    // TODO: Add particular set of event Paths in FetchEventsSince so that we can filter the interested paths
     CHIP_ERROR err     = CHIP_NO_ERROR;
     const bool recurse = false;
     TLVReader reader;
@@ -652,7 +771,15 @@ CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, const SingleLi
 
     context.mSubjectDescriptor     = aSubjectDescriptor;
     context.mpInterestedEventPaths = apEventPathList;
-    err                            = GetEventReader(reader, PriorityLevel::Critical, &bufWrapper);
+
+    // When the log is indexed, seek straight to the first event that may be reported.  The skipped events would all have been
+    // filtered out by CheckEventContext; only the event number of the last of them is kept, as the scan would have.
+    if (!FindEventsToSkip(apEventPathList, aEventMin, bufWrapper.mSkipLength, context.mCurrentEventNumber))
+    {
+        bufWrapper.mSkipLength = 0;
+    }
+
+    err = GetEventReader(reader, PriorityLevel::Critical, &bufWrapper);
     SuccessOrExit(err);
 
     err = TLV::Utilities::Iterate(reader, CopyEventsSince, &context, recurse);
@@ -851,12 +978,78 @@ void EventManagement::SetScheduledEventInfo(EventNumber & aEventNumber, uint32_t
 }
 
 void CircularEventBuffer::Init(uint8_t * apBuffer, uint32_t aBufferLength, CircularEventBuffer * apPrev,
-                               CircularEventBuffer * apNext, PriorityLevel aPriorityLevel)
+                               CircularEventBuffer * apNext, PriorityLevel aPriorityLevel, EventIndexEntry * apIndex,
+                               uint32_t aIndexSize)
 {
     TLVCircularBuffer::Init(apBuffer, aBufferLength);
-    mpPrev    = apPrev;
-    mpNext    = apNext;
-    mPriority = aPriorityLevel;
+    mpPrev     = apPrev;
+    mpNext     = apNext;
+    mPriority  = aPriorityLevel;
+    mpIndex    = (aIndexSize > 0) ? apIndex : nullptr;
+    mIndexSize = (mpIndex != nullptr) ? aIndexSize : 0;
+    ResetIndex();
+}
+
+void CircularEventBuffer::AddToIndex(const EventIndexEntry & aEntry)
+{
+    VerifyOrReturn(mpIndex != nullptr && mIndexValid);
+    if (mIndexCount == mIndexSize)
+    {
+        InvalidateIndex();
+        return;
+    }
+
+    mpIndex[(mIndexHead + mIndexCount) % mIndexSize] = aEntry;
+    mIndexCount++;
+    mIndexedLength += aEntry.mSize;
+}
+
+void CircularEventBuffer::RemoveIndexHead(CircularEventBuffer * apDestination)
+{
+    if (mpIndex != nullptr && mIndexValid && mIndexCount > 0)
+    {
+        const EventIndexEntry entry = mpIndex[mIndexHead];
+        mIndexHead                  = (mIndexHead + 1) % mIndexSize;
+        mIndexCount--;
+        mIndexedLength -= entry.mSize;
+        if (apDestination != nullptr)
+        {
+            apDestination->AddToIndex(entry);
+        }
+    }
+    else
+    {
+        // The evicted event is unknown, and so is the place it takes in the destination buffer.
+        InvalidateIndex();
+        if (apDestination != nullptr)
+        {
+            apDestination->InvalidateIndex();
+        }
+    }
+
+    if (DataLength() == 0)
+    {
+        ResetIndex();
+    }
+}
+
+void CircularEventBuffer::ResetIndex()
+{
+    mIndexHead             = 0;
+    mIndexCount            = 0;
+    mIndexedLength         = 0;
+    mIndexValid            = true;
+    mIndexRebuildSuggested = false;
+}
+
+void CircularEventBuffer::InvalidateIndex()
+{
+    // Only an index that was in use is worth rebuilding: a rebuild that ran out of entries would run out again.
+    mIndexRebuildSuggested = mIndexRebuildSuggested || mIndexValid;
+    mIndexHead             = 0;
+    mIndexCount            = 0;
+    mIndexedLength         = 0;
+    mIndexValid            = false;
 }
 
 bool CircularEventBuffer::IsFinalDestinationForPriority(PriorityLevel aPriority) const
@@ -882,15 +1075,20 @@ void CircularEventReader::Init(CircularEventBufferWrapper * apBufWrapper)
     if (apBufWrapper->mpCurrent == nullptr)
         return;
 
-    TLVReader::Init(*apBufWrapper, apBufWrapper->mpCurrent->DataLength());
-    mMaxLen = apBufWrapper->mpCurrent->DataLength();
-    for (prev = apBufWrapper->mpCurrent->GetPreviousCircularEventBuffer(); prev != nullptr;
+    // TLVReader::Init fetches the first data to read, which consumes the bytes to skip and may move the wrapper past the
+    // first buffer.
+    CircularEventBuffer * const first = apBufWrapper->mpCurrent;
+    const uint32_t skipLength         = apBufWrapper->mSkipLength;
+    TLVReader::Init(*apBufWrapper, first->DataLength());
+    mMaxLen = first->DataLength();
+    for (prev = first->GetPreviousCircularEventBuffer(); prev != nullptr;
          prev = prev->GetPreviousCircularEventBuffer())
     {
         CircularEventBufferWrapper bufWrapper;
         bufWrapper.mpCurrent = prev;
         mMaxLen += prev->DataLength();
     }
+    mMaxLen = (skipLength < mMaxLen) ? mMaxLen - skipLength : 0;
 }
 
 CHIP_ERROR CircularEventBufferWrapper::GetNextBuffer(TLVReader & aReader, const uint8_t *& aBufStart, uint32_t & aBufLen)
@@ -899,6 +1097,19 @@ CHIP_ERROR CircularEventBufferWrapper::GetNextBuffer(TLVReader & aReader, const
     mpCurrent->GetNextBuffer(aReader, aBufStart, aBufLen);
     SuccessOrExit(err);
 
+    while ((mSkipLength > 0) && (aBufLen > 0))
+    {
+        const uint32_t skipLength = std::min(mSkipLength, aBufLen);
+        aBufStart += skipLength;
+        aBufLen -= skipLength;
+        mSkipLength -= skipLength;
+        if (aBufLen == 0)
+        {
+            // Continue with the part of the buffer that wraps around, if any.
+            mpCurrent->GetNextBuffer(aReader, aBufStart, aBufLen);
+        }
+    }
+
     if ((aBufLen == 0) && (mpCurrent->GetPreviousCircularEventBuffer() != nullptr))
     {
         mpCurrent = mpCurrent->GetPreviousCircularEventBuffer();
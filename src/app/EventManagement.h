@@ -76,6 +76,19 @@ inline constexpr size_t kMaxEventSizeReserve            = 512;
 constexpr uint16_t kRequiredEventField =
     (1 << to_underlying(EventDataIB::Tag::kPriority)) | (1 << to_underlying(EventDataIB::Tag::kPath));
 
+/**
+ * @brief
+ *   An entry of the optional index kept alongside a CircularEventBuffer.  It records the encoded size of an event and enough
+ *   of its path for a fetch to decide, without decoding the event, whether it can be skipped.
+ */
+struct EventIndexEntry
+{
+    EventNumber mEventNumber = 0;
+    ClusterId mClusterId     = 0;
+    EndpointId mEndpointId   = 0;
+    uint16_t mSize           = 0; ///< Size, in bytes, of the event in the circular buffer.
+};
+
 /**
  * @brief
  *   Internal event buffer, built around the TLV::TLVCircularBuffer
@@ -105,9 +118,13 @@ public:
      *                           events of greater priority.
      *
      * @param[in] aPriorityLevel CircularEventBuffer priority level
+     *
+     * @param[in] apIndex        Optional storage for the index of the events in the buffer, see EventIndexEntry.
+     *
+     * @param[in] aIndexSize     The number of entries in \c apIndex.
      */
     void Init(uint8_t * apBuffer, uint32_t aBufferLength, CircularEventBuffer * apPrev, CircularEventBuffer * apNext,
-              PriorityLevel aPriorityLevel);
+              PriorityLevel aPriorityLevel, EventIndexEntry * apIndex = nullptr, uint32_t aIndexSize = 0);
 
     /**
      * @brief
@@ -128,9 +145,42 @@ public:
     void SetRequiredSpaceforEvicted(size_t aRequiredSpace) { mRequiredSpaceForEvicted = aRequiredSpace; }
     size_t GetRequiredSpaceforEvicted() const { return mRequiredSpaceForEvicted; }
 
+    /**
+     * @brief
+     *   Whether the index holds an entry for every event of the buffer, oldest first.
+     */
+    bool IsIndexed() const { return mpIndex != nullptr && mIndexValid && mIndexedLength == DataLength(); }
+
+    /**
+     * @brief
+     *   Record an event that was just written at the tail of the buffer.  The index is invalidated if it has no room left.
+     */
+    void AddToIndex(const EventIndexEntry & aEntry);
+
+    /**
+     * @brief
+     *   Record that the event at the head of the buffer was evicted.
+     *
+     * @param[in] apDestination The buffer the event was copied to before its eviction, nullptr if it was dropped.
+     */
+    void RemoveIndexHead(CircularEventBuffer * apDestination = nullptr);
+
+    uint32_t GetIndexCount() const { return mIndexCount; }
+
+    /**
+     * @brief
+     *   Get the index entry of the aPosition-th oldest event of the buffer; aPosition must be less than GetIndexCount().
+     */
+    const EventIndexEntry & GetIndexEntry(uint32_t aPosition) const { return mpIndex[(mIndexHead + aPosition) % mIndexSize]; }
+
     ~CircularEventBuffer() override = default;
 
 private:
+    friend class EventManagement;
+
+    void ResetIndex();
+    void InvalidateIndex();
+
     CircularEventBuffer * mpPrev = nullptr; ///< A pointer CircularEventBuffer storing events less important events
     CircularEventBuffer * mpNext = nullptr; ///< A pointer CircularEventBuffer storing events more important events
 
@@ -139,6 +189,14 @@ private:
 
     size_t mRequiredSpaceForEvicted = 0; ///< Required space for previous buffer to evict event to new buffer
 
+    EventIndexEntry * mpIndex   = nullptr; ///< Ring of index entries, one per event, oldest at mIndexHead
+    uint32_t mIndexSize         = 0;
+    uint32_t mIndexHead         = 0;
+    uint32_t mIndexCount        = 0;
+    uint32_t mIndexedLength     = 0;     ///< Sum of the sizes of the indexed events, compared against DataLength()
+    bool mIndexValid            = true;  ///< Cleared when an event could not be indexed
+    bool mIndexRebuildSuggested = false; ///< Set when the index was invalidated since the last rebuild attempt
+
     CHIP_ERROR OnInit(TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override;
 };
 
@@ -155,6 +213,7 @@ class CircularEventBufferWrapper : public TLV::TLVCircularBuffer
 public:
     CircularEventBufferWrapper() : TLVCircularBuffer(nullptr, 0), mpCurrent(nullptr){};
     CircularEventBuffer * mpCurrent;
+    uint32_t mSkipLength = 0; ///< Number of bytes the reader skips before returning its first element
 
 private:
     CHIP_ERROR GetNextBuffer(chip::TLV::TLVReader & aReader, const uint8_t *& aBufStart, uint32_t & aBufLen) override;
@@ -187,6 +246,9 @@ struct LogStorageResources
     uint32_t mBufferSize = 0; ///< The size, in bytes, of the `mBuffer`.
     PriorityLevel mPriority =
         PriorityLevel::Invalid; // Log priority level associated with the resources provided in this structure.
+    EventIndexEntry * mpIndex = nullptr; ///< Optional index storage, one entry per event the buffer may hold.  When every
+                                         ///< buffer has one, FetchEventsSince seeks over the events it would skip.
+    uint32_t mIndexSize = 0;             ///< The number of entries in `mpIndex`.
 };
 
 /**
@@ -466,6 +528,23 @@ private:
      */
     static CHIP_ERROR FabricRemovedCB(const TLV::TLVReader & aReader, size_t, void * apFabricIndex);
 
+    /**
+     * @brief Rebuild the index of aBuffer by walking its events.  Leaves the index invalid if it cannot hold all of them.
+     */
+    CHIP_ERROR RebuildEventIndex(CircularEventBuffer & aBuffer);
+
+    /**
+     * @brief Find, using the event indices, how many bytes at the start of the log FetchEventsSince can skip: the events there
+     * are either older than aEventMin or outside of the endpoints and clusters of apEventPathList.
+     *
+     * @param[out] aSkipLength      Number of bytes to skip.
+     * @param[out] aLastSkipped     Number of the last skipped event, left untouched when nothing is skipped.
+     *
+     * @retval false if a buffer is not indexed, in which case nothing can be skipped.
+     */
+    bool FindEventsToSkip(const SingleLinkedListNode<EventPathParams> * apEventPathList, EventNumber aEventMin,
+                          uint32_t & aSkipLength, EventNumber & aLastSkipped);
+
     /**
      * @brief
      *   Internal API used to implement #FetchEventsSince
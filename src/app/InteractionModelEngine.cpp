@@ -30,6 +30,7 @@
 #include "access/RequestPath.h"
 #include "access/SubjectDescriptor.h"
 #include <app/AppConfig.h>
+#include <app/ClusterAccessCheckCache.h>
 #include <app/RequiredPrivilege.h>
 #include <app/util/af-types.h>
 #include <app/util/ember-compatibility-functions.h>
@@ -39,6 +40,11 @@
 #include <lib/support/CHIPFaultInjection.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/FibonacciUtils.h>
+#include <tracing/metric_event.h>
+
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+#include <crypto/RandUtils.h>
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
 
 namespace chip {
 namespace app {
@@ -94,6 +100,11 @@ CHIP_ERROR InteractionModelEngine::Init(Messaging::ExchangeManager * apExchangeM
 void InteractionModelEngine::Shutdown()
 {
     mpExchangeMgr->GetSessionManager()->SystemLayer()->CancelTimer(ResumeSubscriptionsTimerCallback, this);
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+    mpExchangeMgr->GetSessionManager()->SystemLayer()->CancelTimer(ResumeNextSubscriptionTimerCallback, this);
+    ClearSubscriptionResumptionQueue();
+    mNumSubscriptionResumptionAttempts = 0;
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
 
     CommandHandlerInterface * handlerIter = mCommandHandlerList;
 
@@ -487,14 +498,14 @@ CHIP_ERROR InteractionModelEngine::ParseAttributePaths(const Access::SubjectDesc
         {
             AttributePathExpandIterator pathIterator(&paramsList);
             ConcreteAttributePath readPath;
+            ClusterAccessCheckCache accessCheckCache(aSubjectDescriptor);
 
             // The definition of "valid path" is "path exists and ACL allows access". The "path exists" part is handled by
             // AttributePathExpandIterator. So we just need to check the ACL bits.
             for (; pathIterator.Get(readPath); pathIterator.Next())
             {
                 Access::RequestPath requestPath{ .cluster = readPath.mClusterId, .endpoint = readPath.mEndpointId };
-                err = Access::GetAccessControl().Check(aSubjectDescriptor, requestPath,
-                                                       RequiredPrivilege::ForReadAttribute(readPath));
+                err = accessCheckCache.Check(requestPath, RequiredPrivilege::ForReadAttribute(readPath));
                 if (err == CHIP_NO_ERROR)
                 {
                     aHasValidAttributePath = true;
@@ -1964,56 +1975,269 @@ void InteractionModelEngine::ResumeSubscriptionsTimerCallback(System::Layer * ap
     InteractionModelEngine * imEngine = static_cast<InteractionModelEngine *>(apAppState);
 #if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
     imEngine->mSubscriptionResumptionScheduled = false;
-    bool resumedSubscriptions                  = false;
 #endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+
+    // Rather than resuming every persisted subscription at once, which after a restart makes all subscribers see a burst of
+    // CASE sessions and priming reports at the same time, the subscriptions are queued and resumed a few at a time.
+    CHIP_ERROR err = imEngine->QueueSubscriptionsToResume();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(InteractionModel, "Failed to queue subscriptions to resume: %" CHIP_ERROR_FORMAT, err.Format());
+        return;
+    }
+
+#if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+    // If no persisted subscriptions needed resumption then all resumption retries are done
+    if (imEngine->mNumPendingSubscriptionResumptions == 0)
+    {
+        imEngine->mNumSubscriptionResumptionRetries = 0;
+    }
+#endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+
+    imEngine->ResumeNextSubscription();
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+}
+
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+bool InteractionModelEngine::IsSubscriptionActive(SubscriptionId aSubscriptionId)
+{
+    return Loop::Break == mReadHandlers.ForEachActiveObject([&](ReadHandler * handler) {
+        SubscriptionId subscriptionId;
+        handler->GetSubscriptionId(subscriptionId);
+        if (subscriptionId == aSubscriptionId)
+        {
+            return Loop::Break;
+        }
+        return Loop::Continue;
+    });
+}
+
+bool InteractionModelEngine::IsSubscriptionResumptionInProgress(SubscriptionId aSubscriptionId) const
+{
+    for (size_t i = 0; i < mNumSubscriptionResumptionAttempts; i++)
+    {
+        if (mSubscriptionResumptionAttempts[i].mSubscriptionId == aSubscriptionId)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+CHIP_ERROR InteractionModelEngine::QueueSubscriptionsToResume()
+{
+    VerifyOrReturnError(mpSubscriptionResumptionStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    mpExchangeMgr->GetSessionManager()->SystemLayer()->CancelTimer(ResumeNextSubscriptionTimerCallback, this);
+    ClearSubscriptionResumptionQueue();
+
     SubscriptionResumptionStorage::SubscriptionInfo subscriptionInfo;
-    AutoReleaseSubscriptionInfoIterator iterator(imEngine->mpSubscriptionResumptionStorage->IterateSubscriptions());
-    while (iterator->Next(subscriptionInfo))
+    size_t numSubscriptions = 0;
+    {
+        AutoReleaseSubscriptionInfoIterator iterator(mpSubscriptionResumptionStorage->IterateSubscriptions());
+        while (iterator->Next(subscriptionInfo))
+        {
+            numSubscriptions++;
+        }
+    }
+    VerifyOrReturnError(numSubscriptions > 0, CHIP_NO_ERROR);
+    VerifyOrReturnError(mPendingSubscriptionResumptions.Calloc(numSubscriptions), CHIP_ERROR_NO_MEMORY);
+
+    AutoReleaseSubscriptionInfoIterator iterator(mpSubscriptionResumptionStorage->IterateSubscriptions());
+    while (mNumPendingSubscriptionResumptions < numSubscriptions && iterator->Next(subscriptionInfo))
     {
         // If subscription happens between reboot and this timer callback, it's already live and should skip resumption
-        if (Loop::Break == imEngine->mReadHandlers.ForEachActiveObject([&](ReadHandler * handler) {
-                SubscriptionId subscriptionId;
-                handler->GetSubscriptionId(subscriptionId);
-                if (subscriptionId == subscriptionInfo.mSubscriptionId)
-                {
-                    return Loop::Break;
-                }
-                return Loop::Continue;
-            }))
+        if (IsSubscriptionActive(subscriptionInfo.mSubscriptionId))
         {
             ChipLogProgress(InteractionModel, "Skip resuming live subscriptionId %" PRIu32, subscriptionInfo.mSubscriptionId);
             continue;
         }
+        if (IsSubscriptionResumptionInProgress(subscriptionInfo.mSubscriptionId))
+        {
+            continue;
+        }
+
+        PendingSubscriptionResumption pendingSubscription;
+        pendingSubscription.mNodeId         = subscriptionInfo.mNodeId;
+        pendingSubscription.mFabricIndex    = subscriptionInfo.mFabricIndex;
+        pendingSubscription.mSubscriptionId = subscriptionInfo.mSubscriptionId;
+        pendingSubscription.mMinInterval    = subscriptionInfo.mMinInterval;
+        pendingSubscription.mStorageIndex   = subscriptionInfo.mStorageIndex;
+#if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+        pendingSubscription.mResumptionRetries = subscriptionInfo.mResumptionRetries;
+#else
+        pendingSubscription.mResumptionRetries = 0;
+#endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
 
-        auto subscriptionResumptionSessionEstablisher = Platform::MakeUnique<SubscriptionResumptionSessionEstablisher>();
-        if (subscriptionResumptionSessionEstablisher == nullptr)
+        // Subscribers that failed fewer attempts are the most likely to be reachable, and subscriptions with a shorter min
+        // interval expect reports soonest, so those are resumed first. Subscriptions that compare equal keep their storage
+        // order.
+        size_t position = mNumPendingSubscriptionResumptions;
+        while (position > 0)
         {
-            ChipLogProgress(InteractionModel, "Failed to create SubscriptionResumptionSessionEstablisher");
-            return;
+            const PendingSubscriptionResumption & previous = mPendingSubscriptionResumptions[position - 1];
+            if (previous.mResumptionRetries < pendingSubscription.mResumptionRetries ||
+                (previous.mResumptionRetries == pendingSubscription.mResumptionRetries &&
+                 previous.mMinInterval <= pendingSubscription.mMinInterval))
+            {
+                break;
+            }
+            mPendingSubscriptionResumptions[position] = previous;
+            position--;
         }
+        mPendingSubscriptionResumptions[position] = pendingSubscription;
+        mNumPendingSubscriptionResumptions++;
+    }
 
-        if (subscriptionResumptionSessionEstablisher->ResumeSubscription(*imEngine->mpCASESessionMgr, subscriptionInfo) !=
-            CHIP_NO_ERROR)
+    mSubscriptionResumptionQueueTime = System::SystemClock().GetMonotonicTimestamp();
+    MATTER_LOG_METRIC(Tracing::kMetricSubscriptionResumptionQueued, static_cast<uint32_t>(mNumPendingSubscriptionResumptions));
+    ChipLogProgress(InteractionModel, "Queued %u subscriptions for resumption",
+                    static_cast<unsigned>(mNumPendingSubscriptionResumptions));
+    return CHIP_NO_ERROR;
+}
+
+void InteractionModelEngine::ResumeNextSubscription()
+{
+    while (mNextPendingSubscriptionResumption < mNumPendingSubscriptionResumptions &&
+           mNumSubscriptionResumptionAttempts < CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_CONCURRENT_ATTEMPTS)
+    {
+        const PendingSubscriptionResumption & pendingSubscription =
+            mPendingSubscriptionResumptions[mNextPendingSubscriptionResumption++];
+
+        // The subscriber may have subscribed again while this subscription was queued.
+        if (IsSubscriptionActive(pendingSubscription.mSubscriptionId))
         {
-            ChipLogProgress(InteractionModel, "Failed to ResumeSubscription 0x%" PRIx32, subscriptionInfo.mSubscriptionId);
-            return;
+            ChipLogProgress(InteractionModel, "Skip resuming live subscriptionId %" PRIu32, pendingSubscription.mSubscriptionId);
+            continue;
         }
-        subscriptionResumptionSessionEstablisher.release();
-#if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
-        resumedSubscriptions = true;
-#endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+
+        CHIP_ERROR err = StartSubscriptionResumption(pendingSubscription);
+        if (err == CHIP_NO_ERROR)
+        {
+            break;
+        }
+
+        ChipLogProgress(InteractionModel, "Failed to ResumeSubscription 0x%" PRIx32 ": %" CHIP_ERROR_FORMAT,
+                        pendingSubscription.mSubscriptionId, err.Format());
+        // No resumption attempt will complete for this subscription.
+        DecrementNumSubscriptionsToResume();
     }
 
-#if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
-    // If no persisted subscriptions needed resumption then all resumption retries are done
-    if (!resumedSubscriptions)
+    ScheduleNextSubscriptionResumption();
+}
+
+CHIP_ERROR InteractionModelEngine::StartSubscriptionResumption(const PendingSubscriptionResumption & aPendingSubscription)
+{
+    VerifyOrReturnError(mpSubscriptionResumptionStorage != nullptr && mpCASESessionMgr != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    // Only the resumption order is kept in the queue; the paths are read back from storage when the resumption starts.
+    SubscriptionResumptionStorage::SubscriptionInfo subscriptionInfo;
+    ReturnErrorOnFailure(mpSubscriptionResumptionStorage->Load(aPendingSubscription.mStorageIndex, subscriptionInfo));
+    // The subscription may have been deleted, or saved again elsewhere, while it was queued.
+    VerifyOrReturnError(subscriptionInfo.mSubscriptionId == aPendingSubscription.mSubscriptionId &&
+                            subscriptionInfo.mFabricIndex == aPendingSubscription.mFabricIndex &&
+                            subscriptionInfo.mNodeId == aPendingSubscription.mNodeId,
+                        CHIP_ERROR_KEY_NOT_FOUND);
+
+    auto subscriptionResumptionSessionEstablisher = Platform::MakeUnique<SubscriptionResumptionSessionEstablisher>();
+    VerifyOrReturnError(subscriptionResumptionSessionEstablisher != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    // Track the attempt before starting it, since an already established session completes it synchronously.
+    System::Clock::Timestamp now            = System::SystemClock().GetMonotonicTimestamp();
+    SubscriptionResumptionAttempt & attempt = mSubscriptionResumptionAttempts[mNumSubscriptionResumptionAttempts++];
+    attempt.mSubscriptionId                 = aPendingSubscription.mSubscriptionId;
+    attempt.mStartTime                      = now;
+    MATTER_LOG_METRIC(Tracing::kMetricSubscriptionResumptionStart,
+                      static_cast<uint32_t>((now - mSubscriptionResumptionQueueTime).count()));
+
+#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
+    VerifyOrReturnError(!mSkipSubscriptionResumptionSessionEstablishment, CHIP_NO_ERROR);
+#endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
+
+    CHIP_ERROR err = subscriptionResumptionSessionEstablisher->ResumeSubscription(*mpCASESessionMgr, subscriptionInfo);
+    if (err != CHIP_NO_ERROR)
     {
-        imEngine->mNumSubscriptionResumptionRetries = 0;
+        mNumSubscriptionResumptionAttempts--;
+        return err;
     }
-#endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+    subscriptionResumptionSessionEstablisher.release();
+    return CHIP_NO_ERROR;
+}
 
-#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+void InteractionModelEngine::ScheduleNextSubscriptionResumption()
+{
+    System::Layer * systemLayer = mpExchangeMgr->GetSessionManager()->SystemLayer();
+
+    if (mNextPendingSubscriptionResumption < mNumPendingSubscriptionResumptions)
+    {
+        VerifyOrReturn(mNumSubscriptionResumptionAttempts < CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_CONCURRENT_ATTEMPTS);
+        VerifyOrReturn(!systemLayer->IsTimerActive(ResumeNextSubscriptionTimerCallback, this));
+
+        uint32_t jitterMs = 0;
+        if (CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_JITTER_MS > 0)
+        {
+            jitterMs = Crypto::GetRandU32() % (CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_JITTER_MS + 1);
+        }
+        CHIP_ERROR err =
+            systemLayer->StartTimer(System::Clock::Milliseconds32(jitterMs), ResumeNextSubscriptionTimerCallback, this);
+        if (err != CHIP_NO_ERROR)
+        {
+            // The queue is collected again at the next resumption attempt.
+            ChipLogError(InteractionModel, "Failed to schedule subscription resumption: %" CHIP_ERROR_FORMAT, err.Format());
+            ClearSubscriptionResumptionQueue();
+        }
+        return;
+    }
+
+    VerifyOrReturn(mNumPendingSubscriptionResumptions > 0 && mNumSubscriptionResumptionAttempts == 0);
+    System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    MATTER_LOG_METRIC(Tracing::kMetricSubscriptionResumptionDone,
+                      static_cast<uint32_t>((now - mSubscriptionResumptionQueueTime).count()));
+    ChipLogProgress(InteractionModel, "Done resuming %u queued subscriptions",
+                    static_cast<unsigned>(mNumPendingSubscriptionResumptions));
+    ClearSubscriptionResumptionQueue();
+}
+
+void InteractionModelEngine::ClearSubscriptionResumptionQueue()
+{
+    mPendingSubscriptionResumptions.Free();
+    mNumPendingSubscriptionResumptions = 0;
+    mNextPendingSubscriptionResumption = 0;
+}
+
+void InteractionModelEngine::ResumeNextSubscriptionTimerCallback(System::Layer * apSystemLayer, void * apAppState)
+{
+    VerifyOrReturn(apAppState != nullptr);
+    static_cast<InteractionModelEngine *>(apAppState)->ResumeNextSubscription();
+}
+
+void InteractionModelEngine::OnSubscriptionResumptionAttemptDone(SubscriptionId aSubscriptionId, CHIP_ERROR aError)
+{
+    for (size_t i = 0; i < mNumSubscriptionResumptionAttempts; i++)
+    {
+        if (mSubscriptionResumptionAttempts[i].mSubscriptionId != aSubscriptionId)
+        {
+            continue;
+        }
+
+        uint32_t durationMs = static_cast<uint32_t>(
+            (System::SystemClock().GetMonotonicTimestamp() - mSubscriptionResumptionAttempts[i].mStartTime).count());
+        if (aError == CHIP_NO_ERROR)
+        {
+            MATTER_LOG_METRIC(Tracing::kMetricSubscriptionResumptionConnected, durationMs);
+        }
+        else
+        {
+            MATTER_LOG_METRIC(Tracing::kMetricSubscriptionResumptionFailed, durationMs);
+        }
+
+        mSubscriptionResumptionAttempts[i] = mSubscriptionResumptionAttempts[--mNumSubscriptionResumptionAttempts];
+        break;
+    }
+
+    ScheduleNextSubscriptionResumption();
 }
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
 
 #if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS && CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
 uint32_t InteractionModelEngine::ComputeTimeSecondsTillNextSubscriptionResumption()
@@ -2044,15 +2268,7 @@ bool InteractionModelEngine::HasSubscriptionsToResume()
     bool foundSubscriptionToResume = false;
     while (iterator->Next(subscriptionInfo))
     {
-        if (Loop::Break == mReadHandlers.ForEachActiveObject([&](ReadHandler * handler) {
-                SubscriptionId subscriptionId;
-                handler->GetSubscriptionId(subscriptionId);
-                if (subscriptionId == subscriptionInfo.mSubscriptionId)
-                {
-                    return Loop::Break;
-                }
-                return Loop::Continue;
-            }))
+        if (IsSubscriptionActive(subscriptionInfo.mSubscriptionId))
         {
             continue;
         }
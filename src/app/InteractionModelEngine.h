@@ -60,6 +60,7 @@
 #include <lib/support/DLLUtil.h>
 #include <lib/support/LinkedList.h>
 #include <lib/support/Pool.h>
+#include <lib/support/ScopedBuffer.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeMgr.h>
@@ -336,6 +337,12 @@ public:
      *        was succesful or not.
      */
     void DecrementNumSubscriptionsToResume();
+
+    /**
+     * @brief Called when the session establishment of a subscription resumption attempt has completed, successfully or not,
+     *        so that the next queued subscription can be resumed.
+     */
+    void OnSubscriptionResumptionAttemptDone(SubscriptionId aSubscriptionId, CHIP_ERROR aError);
 #endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
 
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
@@ -420,6 +427,7 @@ public:
 
 private:
     friend class reporting::Engine;
+    friend class reporting::TestReportingEngine;
     friend class TestCommandInteraction;
     friend class TestInteractionModelEngine;
     friend class SubscriptionResumptionSessionEstablisher;
@@ -614,6 +622,55 @@ private:
 
     static void ResumeSubscriptionsTimerCallback(System::Layer * apSystemLayer, void * apAppState);
 
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+    /**
+     * A persisted subscription that is queued for resumption.
+     */
+    struct PendingSubscriptionResumption
+    {
+        NodeId mNodeId;
+        FabricIndex mFabricIndex;
+        SubscriptionId mSubscriptionId;
+        uint16_t mMinInterval;
+        uint32_t mResumptionRetries;
+        // Where the subscription is persisted, to read its paths back when its resumption starts.
+        uint16_t mStorageIndex;
+    };
+
+    /**
+     * A subscription resumption whose session establishment has been started and has not completed yet.
+     */
+    struct SubscriptionResumptionAttempt
+    {
+        SubscriptionId mSubscriptionId;
+        System::Clock::Timestamp mStartTime;
+    };
+
+    bool IsSubscriptionActive(SubscriptionId aSubscriptionId);
+    bool IsSubscriptionResumptionInProgress(SubscriptionId aSubscriptionId) const;
+
+    /**
+     * Queue all persisted subscriptions that are neither active nor being resumed, in the order they will be resumed:
+     * subscriptions that failed fewer resumption attempts first, then subscriptions with a shorter min interval.
+     */
+    CHIP_ERROR QueueSubscriptionsToResume();
+
+    /**
+     * Start resuming the next queued subscription, if the number of ongoing resumption attempts allows it.
+     */
+    void ResumeNextSubscription();
+    CHIP_ERROR StartSubscriptionResumption(const PendingSubscriptionResumption & aPendingSubscription);
+
+    /**
+     * Schedule the next queued subscription to be resumed after a random delay of up to
+     * CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_JITTER_MS, or release the queue once all its subscriptions have been resumed.
+     */
+    void ScheduleNextSubscriptionResumption();
+    void ClearSubscriptionResumptionQueue();
+
+    static void ResumeNextSubscriptionTimerCallback(System::Layer * apSystemLayer, void * apAppState);
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+
     template <typename T, size_t N>
     void ReleasePool(SingleLinkedListNode<T> *& aObjectList, ObjectPool<SingleLinkedListNode<T>, N> & aObjectPool);
     template <typename T, size_t N>
@@ -683,6 +740,11 @@ private:
 #if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS && CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
     int mSubscriptionResumptionRetrySecondsOverride = -1;
 #endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS && CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+    // Leave subscription resumption attempts pending instead of establishing their CASE sessions, so that unit tests can
+    // complete them through OnSubscriptionResumptionAttemptDone.
+    bool mSkipSubscriptionResumptionSessionEstablishment = false;
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
 #endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
 
 #if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
@@ -693,6 +755,18 @@ private:
      * by ComputeTimeSecondsTillNextSubscriptionResumption.
      */
     int8_t mNumOfSubscriptionsToResume = 0;
+
+    static_assert(CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_CONCURRENT_ATTEMPTS > 0,
+                  "CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_CONCURRENT_ATTEMPTS must allow at least one resumption attempt");
+
+    // Subscriptions queued for resumption, sorted by resumption order. Entries before mNextPendingSubscriptionResumption have
+    // already been started.
+    Platform::ScopedMemoryBuffer<PendingSubscriptionResumption> mPendingSubscriptionResumptions;
+    size_t mNumPendingSubscriptionResumptions = 0;
+    size_t mNextPendingSubscriptionResumption = 0;
+    System::Clock::Timestamp mSubscriptionResumptionQueueTime;
+    SubscriptionResumptionAttempt mSubscriptionResumptionAttempts[CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_CONCURRENT_ATTEMPTS];
+    size_t mNumSubscriptionResumptionAttempts = 0;
 #if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
     bool HasSubscriptionsToResume();
     uint32_t ComputeTimeSecondsTillNextSubscriptionResumption();
@@ -451,6 +451,13 @@ void OperationalSessionSetup::OnSessionEstablishmentError(CHIP_ERROR error, Sess
         ReliableMessageProtocolConfig remoteMprConfig = mCASEClient->GetRemoteMRPIntervals();
 #endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
 
+        // The peer did not answer at the address we tried: make sure the next
+        // lookup resolves it again rather than use a cached address.
+        if (CHIP_ERROR_TIMEOUT == error)
+        {
+            Resolver::Instance().InvalidateCachedAddress(mAddressLookupHandle.GetRequest().GetPeerId());
+        }
+
         // Move to the ResolvingAddress state, in case we have more results,
         // since we expect to receive results in that state.
         MoveToState(State::ResolvingAddress);
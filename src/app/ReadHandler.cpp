@@ -76,6 +76,10 @@ ReadHandler::ReadHandler(ManagementCallback & apCallback, Messaging::ExchangeCon
 
     VerifyOrDie(observer != nullptr);
     mObserver = observer;
+
+    // Without any attribute path yet, the handler is trivially indexed.  It stays so if it only
+    // ever gets event paths, and then does not keep SetDirty from using the interest index.
+    mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().AddReadHandlerInterests(this);
 }
 
 #if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
@@ -87,6 +91,8 @@ ReadHandler::ReadHandler(ManagementCallback & apCallback, Observer * observer) :
 
     VerifyOrDie(observer != nullptr);
     mObserver = observer;
+
+    mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().AddReadHandlerInterests(this);
 }
 
 void ReadHandler::OnSubscriptionResumed(const SessionHandle & sessionHandle,
@@ -98,7 +104,9 @@ void ReadHandler::OnSubscriptionResumed(const SessionHandle & sessionHandle,
     SetStateFlag(ReadHandlerFlags::FabricFiltered, resumptionSessionEstablisher.mSubscriptionInfo.mFabricFiltered);
 
     // Move dynamically allocated attributes and events from the SubscriptionInfo struct into
-    // the object pool managed by the IM engine
+    // the object pool managed by the IM engine.  The handler is left out of the interest index
+    // until its attribute path list is complete.
+    mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().RemoveReadHandlerInterests(this);
     for (size_t i = 0; i < resumptionSessionEstablisher.mSubscriptionInfo.mAttributePaths.AllocatedSize(); i++)
     {
         AttributePathParams params = resumptionSessionEstablisher.mSubscriptionInfo.mAttributePaths[i].GetParams();
@@ -109,6 +117,7 @@ void ReadHandler::OnSubscriptionResumed(const SessionHandle & sessionHandle,
             return;
         }
     }
+    mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().AddReadHandlerInterests(this);
     for (size_t i = 0; i < resumptionSessionEstablisher.mSubscriptionInfo.mEventPaths.AllocatedSize(); i++)
     {
         EventPathParams params = resumptionSessionEstablisher.mSubscriptionInfo.mEventPaths[i].GetParams();
@@ -158,6 +167,7 @@ ReadHandler::~ReadHandler()
     {
         mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().OnReportConfirm();
     }
+    mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().RemoveReadHandlerInterests(this);
     mManagementCallback.GetInteractionModelEngine()->ReleaseAttributePathList(mpAttributePathList);
     mManagementCallback.GetInteractionModelEngine()->ReleaseEventPathList(mpEventPathList);
     mManagementCallback.GetInteractionModelEngine()->ReleaseDataVersionFilterList(mpDataVersionFilterList);
@@ -485,6 +495,8 @@ CHIP_ERROR ReadHandler::ProcessAttributePaths(AttributePathIBs::Parser & aAttrib
     CHIP_ERROR err = CHIP_NO_ERROR;
     TLV::TLVReader reader;
     aAttributePathListParser.GetReader(&reader);
+    // The handler is left out of the interest index until its attribute path list is complete.
+    mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().RemoveReadHandlerInterests(this);
     while (CHIP_NO_ERROR == (err = reader.Next()))
     {
         VerifyOrReturnError(TLV::AnonymousTag() == reader.GetTag(), CHIP_ERROR_INVALID_TLV_TAG);
@@ -499,6 +511,7 @@ CHIP_ERROR ReadHandler::ProcessAttributePaths(AttributePathIBs::Parser & aAttrib
     if (CHIP_END_OF_TLV == err)
     {
         mManagementCallback.GetInteractionModelEngine()->RemoveDuplicateConcreteAttributePath(mpAttributePathList);
+        mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().AddReadHandlerInterests(this);
         mAttributePathExpandIterator = AttributePathExpandIterator(mpAttributePathList);
         err                          = CHIP_NO_ERROR;
     }
@@ -306,6 +306,9 @@ private:
 
         // Don't need the response for report data if true
         SuppressResponse = (1 << 5),
+
+        // The attribute paths of this handler are recorded in the interest index of the reporting engine.
+        InterestsIndexed = (1 << 6),
     };
 
     /**
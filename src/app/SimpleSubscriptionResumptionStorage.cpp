@@ -93,6 +93,7 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Init(PersistentStorageDelegate *
     VerifyOrReturnError(storage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     mStorage = storage;
 
+    PersistentStorageTransaction transaction(*mStorage);
     uint16_t countMax;
     uint16_t len = sizeof(countMax);
     CHIP_ERROR err =
@@ -112,7 +113,7 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Init(PersistentStorageDelegate *
     ReturnErrorOnFailure(mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::SubscriptionResumptionMaxCount().KeyName(),
                                                    &countMaxToSave, sizeof(uint16_t)));
 
-    return CHIP_NO_ERROR;
+    return transaction.Commit();
 }
 
 SubscriptionResumptionStorage::SubscriptionInfoIterator * SimpleSubscriptionResumptionStorage::IterateSubscriptions()
@@ -141,6 +142,8 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Delete(uint16_t subscriptionInde
 
 CHIP_ERROR SimpleSubscriptionResumptionStorage::Load(uint16_t subscriptionIndex, SubscriptionInfo & subscriptionInfo)
 {
+    ReturnErrorCodeIf(subscriptionIndex >= CHIP_IM_MAX_NUM_SUBSCRIPTIONS, CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
     Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
     backingBuffer.Calloc(MaxSubscriptionSize());
     ReturnErrorCodeIf(backingBuffer.Get() == nullptr, CHIP_ERROR_NO_MEMORY);
@@ -267,6 +270,8 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Load(uint16_t subscriptionIndex,
 
     ReturnErrorOnFailure(reader.ExitContainer(subscriptionContainerType));
 
+    subscriptionInfo.mStorageIndex = subscriptionIndex;
+
     return CHIP_NO_ERROR;
 }
 
@@ -331,6 +336,9 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Save(TLV::TLVWriter & writer, Su
 
 CHIP_ERROR SimpleSubscriptionResumptionStorage::Save(SubscriptionInfo & subscriptionInfo)
 {
+    // Removing a duplicate and storing the new entry are flushed together, so that a failure keeps the old entry
+    PersistentStorageTransaction transaction(*mStorage);
+
     // Find empty index or duplicate if exists
     uint16_t subscriptionIndex;
     uint16_t firstEmptySubscriptionIndex = CHIP_IM_MAX_NUM_SUBSCRIPTIONS; // initialize to out of bounds as "not set"
@@ -386,7 +394,7 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Save(SubscriptionInfo & subscrip
         mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::SubscriptionResumption(firstEmptySubscriptionIndex).KeyName(),
                                   backingBuffer.Get(), static_cast<uint16_t>(len)));
 
-    return CHIP_NO_ERROR;
+    return transaction.Commit();
 }
 
 CHIP_ERROR SimpleSubscriptionResumptionStorage::Delete(NodeId nodeId, FabricIndex fabricIndex, SubscriptionId subscriptionId)
@@ -394,6 +402,9 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Delete(NodeId nodeId, FabricInde
     bool subscriptionFound   = false;
     CHIP_ERROR lastDeleteErr = CHIP_NO_ERROR;
 
+    // Deletion is best effort, so whatever was deleted is committed even if some entries failed
+    PersistentStorageTransaction transaction(*mStorage);
+
     uint16_t remainingSubscriptionsCount = 0;
     for (uint16_t subscriptionIndex = 0; subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; subscriptionIndex++)
     {
@@ -426,10 +437,13 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Delete(NodeId nodeId, FabricInde
         DeleteMaxCount();
     }
 
+    CHIP_ERROR commitErr = transaction.Commit();
+
     if (lastDeleteErr != CHIP_NO_ERROR)
     {
         return lastDeleteErr;
     }
+    ReturnErrorOnFailure(commitErr);
 
     return subscriptionFound ? CHIP_NO_ERROR : CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND;
 }
@@ -443,6 +457,9 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::DeleteAll(FabricIndex fabricInde
 {
     CHIP_ERROR deleteErr = CHIP_NO_ERROR;
 
+    // Deletion is best effort, so whatever was deleted is committed even if some entries failed
+    PersistentStorageTransaction transaction(*mStorage);
+
     uint16_t count = 0;
     for (uint16_t subscriptionIndex = 0; subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; subscriptionIndex++)
     {
@@ -477,7 +494,8 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::DeleteAll(FabricIndex fabricInde
         }
     }
 
-    return deleteErr;
+    CHIP_ERROR commitErr = transaction.Commit();
+    return (deleteErr != CHIP_NO_ERROR) ? deleteErr : commitErr;
 }
 
 } // namespace app
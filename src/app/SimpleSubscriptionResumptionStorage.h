@@ -44,6 +44,8 @@ public:
 
     SubscriptionInfoIterator * IterateSubscriptions() override;
 
+    CHIP_ERROR Load(uint16_t subscriptionIndex, SubscriptionInfo & subscriptionInfo) override;
+
     CHIP_ERROR Save(SubscriptionInfo & subscriptionInfo) override;
 
     CHIP_ERROR Delete(NodeId nodeId, FabricIndex fabricIndex, SubscriptionId subscriptionId) override;
@@ -52,7 +54,6 @@ public:
 
 protected:
     CHIP_ERROR Save(TLV::TLVWriter & writer, SubscriptionInfo & subscriptionInfo);
-    CHIP_ERROR Load(uint16_t subscriptionIndex, SubscriptionInfo & subscriptionInfo);
     CHIP_ERROR Delete(uint16_t subscriptionIndex);
     uint16_t Count();
     CHIP_ERROR DeleteMaxCount();
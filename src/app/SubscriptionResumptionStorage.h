@@ -81,6 +81,8 @@ public:
         bool mFabricFiltered;
         Platform::ScopedMemoryBufferWithSize<AttributePathParamsValues> mAttributePaths;
         Platform::ScopedMemoryBufferWithSize<EventPathParamsValues> mEventPaths;
+        // Where the subscription is persisted, set when it is read from storage
+        uint16_t mStorageIndex;
         CHIP_ERROR SetAttributePaths(const SingleLinkedListNode<AttributePathParams> * pAttributePathList)
         {
             mAttributePaths.Free();
@@ -144,6 +146,16 @@ public:
      */
     virtual SubscriptionInfoIterator * IterateSubscriptions() = 0;
 
+    /**
+     * Read back a single persisted subscription, without iterating through the others
+     *
+     * @param storageIndex the mStorageIndex that the subscription was read with earlier. The subscription at that index may
+     *                     since have been deleted or replaced, which the caller must check.
+     *
+     * @retval CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND if no subscription is persisted at that index
+     */
+    virtual CHIP_ERROR Load(uint16_t storageIndex, SubscriptionInfo & subscriptionInfo) = 0;
+
     /**
      * Save subscription resumption information to storage.
      *
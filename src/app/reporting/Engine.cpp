@@ -56,7 +56,7 @@ void Engine::Shutdown()
 
     mNumReportsInFlight = 0;
     mCurReadHandlerIdx  = 0;
-    mGlobalDirtySet.ReleaseAll();
+    ClearDirtySet();
 }
 
 bool Engine::IsClusterDataVersionMatch(const SingleLinkedListNode<DataVersionFilter> * aDataVersionFilterList,
@@ -82,7 +82,8 @@ bool Engine::IsClusterDataVersionMatch(const SingleLinkedListNode<DataVersionFil
 CHIP_ERROR
 Engine::RetrieveClusterData(const SubjectDescriptor & aSubjectDescriptor, bool aIsFabricFiltered,
                             AttributeReportIBs::Builder & aAttributeReportIBs, const ConcreteReadAttributePath & aPath,
-                            AttributeValueEncoder::AttributeEncodeState * aEncoderState)
+                            AttributeValueEncoder::AttributeEncodeState * aEncoderState,
+                            ClusterAccessCheckCache * apAccessCheckCache)
 {
     ChipLogDetail(DataManagement, "<RE:Run> Cluster %" PRIx32 ", Attribute %" PRIx32 " is dirty", aPath.mClusterId,
                   aPath.mAttributeId);
@@ -90,7 +91,8 @@ Engine::RetrieveClusterData(const SubjectDescriptor & aSubjectDescriptor, bool a
     DataModelCallbacks::GetInstance()->AttributeOperation(DataModelCallbacks::OperationType::Read,
                                                           DataModelCallbacks::OperationOrder::Pre, aPath);
 
-    ReturnErrorOnFailure(ReadSingleClusterData(aSubjectDescriptor, aIsFabricFiltered, aPath, aAttributeReportIBs, aEncoderState));
+    ReturnErrorOnFailure(ReadSingleClusterData(aSubjectDescriptor, aIsFabricFiltered, aPath, aAttributeReportIBs, aEncoderState,
+                                               apAccessCheckCache));
 
     DataModelCallbacks::GetInstance()->AttributeOperation(DataModelCallbacks::OperationType::Read,
                                                           DataModelCallbacks::OperationOrder::Post, aPath);
@@ -132,6 +134,8 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
         // TODO: Figure out how AttributePathExpandIterator should handle read
         // vs write paths.
         ConcreteAttributePath readPath;
+        // The ACL cannot change while this report is built, so access decisions can be shared by the attributes of a cluster.
+        ClusterAccessCheckCache accessCheckCache(apReadHandler->GetSubjectDescriptor());
 
         ChipLogDetail(DataManagement,
                       "Building Reports for ReadHandler with LastReportGeneration = 0x" ChipLogFormatX64
@@ -157,7 +161,7 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
             {
                 bool concretePathDirty = false;
                 // TODO: Optimize this implementation by making the iterator only emit intersected paths.
-                mGlobalDirtySet.ForEachActiveObject([&](auto * dirtyPath) {
+                ForEachDirtyPathUnder(readPath.mEndpointId, readPath.mClusterId, [&](auto * dirtyPath) {
                     if (dirtyPath->IsAttributePathSupersetOf(readPath))
                     {
                         // We don't need to worry about paths that were already marked dirty before the last time this read handler
@@ -200,8 +204,8 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
             ConcreteReadAttributePath pathForRetrieval(readPath);
             // Load the saved state from previous encoding session for chunking of one single attribute (list chunking).
             AttributeValueEncoder::AttributeEncodeState encodeState = apReadHandler->GetAttributeEncodeState();
-            err = RetrieveClusterData(apReadHandler->GetSubjectDescriptor(), apReadHandler->IsFabricFiltered(), attributeReportIBs,
-                                      pathForRetrieval, &encodeState);
+            err = RetrieveClusterData(accessCheckCache.GetSubjectDescriptor(), apReadHandler->IsFabricFiltered(),
+                                      attributeReportIBs, pathForRetrieval, &encodeState, &accessCheckCache);
             if (err != CHIP_NO_ERROR)
             {
                 // If error is not an "out of writer space" error, rollback and encode status.
@@ -717,13 +721,70 @@ void Engine::Run()
     {
         ChipLogDetail(DataManagement, "All ReadHandler-s are clean, clear GlobalDirtySet");
 
-        mGlobalDirtySet.ReleaseAll();
+        ClearDirtySet();
     }
 }
 
+size_t Engine::PathIndexBucket(EndpointId aEndpointId, ClusterId aClusterId)
+{
+    // Mix the endpoint into the high bits so that the same cluster on consecutive endpoints lands in different buckets.
+    uint32_t hash = (static_cast<uint32_t>(aEndpointId) * 0x9E3779B1u) ^ aClusterId;
+    return (hash ^ (hash >> 16)) % kPathIndexBuckets;
+}
+
+void Engine::IndexDirtyPath(AttributePathParamsWithGeneration * apPath)
+{
+    auto *& head          = IsIndexable(*apPath) ? mDirtyPathBuckets[PathIndexBucket(apPath->mEndpointId, apPath->mClusterId)]
+                                                 : mWildcardDirtyPaths;
+    apPath->mpNextIndexed = head;
+    head                  = apPath;
+}
+
+void Engine::RebuildDirtySetIndex()
+{
+    for (auto & bucket : mDirtyPathBuckets)
+    {
+        bucket = nullptr;
+    }
+    mWildcardDirtyPaths = nullptr;
+
+    mGlobalDirtySet.ForEachActiveObject([this](auto * path) {
+        IndexDirtyPath(path);
+        return Loop::Continue;
+    });
+}
+
+void Engine::ClearDirtySet()
+{
+    mGlobalDirtySet.ReleaseAll();
+    RebuildDirtySetIndex();
+}
+
 bool Engine::MergeOverlappedAttributePath(const AttributePathParams & aAttributePath)
 {
-    return Loop::Break == mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
+    if (IsIndexable(aAttributePath))
+    {
+        // Only the paths of the same bucket and the wildcard ones can be a superset or a subset of a concrete cluster path.
+        // Widening a subset to aAttributePath keeps its endpoint and cluster, so it stays in the same bucket.
+        return Loop::Break == ForEachDirtyPathUnder(aAttributePath.mEndpointId, aAttributePath.mClusterId, [&](auto * path) {
+                   if (path->IsAttributePathSupersetOf(aAttributePath))
+                   {
+                       path->mGeneration = GetDirtySetGeneration();
+                       return Loop::Break;
+                   }
+                   if (aAttributePath.IsAttributePathSupersetOf(*path))
+                   {
+                       path->mGeneration  = GetDirtySetGeneration();
+                       path->mListIndex   = aAttributePath.mListIndex;
+                       path->mAttributeId = aAttributePath.mAttributeId;
+                       return Loop::Break;
+                   }
+                   return Loop::Continue;
+               });
+    }
+
+    bool widened = false;
+    bool merged  = Loop::Break == mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
         if (path->IsAttributePathSupersetOf(aAttributePath))
         {
             path->mGeneration = GetDirtySetGeneration();
@@ -740,10 +801,17 @@ bool Engine::MergeOverlappedAttributePath(const AttributePathParams & aAttribute
             path->mClusterId   = aAttributePath.mClusterId;
             path->mListIndex   = aAttributePath.mListIndex;
             path->mAttributeId = aAttributePath.mAttributeId;
+            widened            = true;
             return Loop::Break;
         }
         return Loop::Continue;
     });
+
+    if (widened)
+    {
+        RebuildDirtySetIndex();
+    }
+    return merged;
 }
 
 bool Engine::ClearTombPaths()
@@ -792,7 +860,9 @@ bool Engine::MergeDirtyPathsUnderSameCluster()
         return Loop::Continue;
     });
 
-    return ClearTombPaths();
+    bool pathReleased = ClearTombPaths();
+    RebuildDirtySetIndex();
+    return pathReleased;
 }
 
 bool Engine::MergeDirtyPathsUnderSameEndpoint()
@@ -825,7 +895,10 @@ bool Engine::MergeDirtyPathsUnderSameEndpoint()
         });
         return Loop::Continue;
     });
-    return ClearTombPaths();
+
+    bool pathReleased = ClearTombPaths();
+    RebuildDirtySetIndex();
+    return pathReleased;
 }
 
 CHIP_ERROR Engine::InsertPathIntoDirtySet(const AttributePathParams & aAttributePath)
@@ -835,9 +908,10 @@ CHIP_ERROR Engine::InsertPathIntoDirtySet(const AttributePathParams & aAttribute
     if (mGlobalDirtySet.Exhausted() && !MergeDirtyPathsUnderSameCluster() && !MergeDirtyPathsUnderSameEndpoint())
     {
         ChipLogDetail(DataManagement, "Global dirty set pool exhausted, merge all paths.");
-        mGlobalDirtySet.ReleaseAll();
+        ClearDirtySet();
         auto object         = mGlobalDirtySet.CreateObject();
         object->mGeneration = GetDirtySetGeneration();
+        IndexDirtyPath(object);
     }
 
     ReturnErrorCodeIf(MergeOverlappedAttributePath(aAttributePath), CHIP_NO_ERROR);
@@ -852,6 +926,7 @@ CHIP_ERROR Engine::InsertPathIntoDirtySet(const AttributePathParams & aAttribute
     }
     *object             = aAttributePath;
     object->mGeneration = GetDirtySetGeneration();
+    IndexDirtyPath(object);
 
     return CHIP_NO_ERROR;
 }
@@ -861,25 +936,52 @@ CHIP_ERROR Engine::SetDirty(AttributePathParams & aAttributePath)
     BumpDirtySetGeneration();
 
     bool intersectsInterestPath = false;
-    mpImEngine->mReadHandlers.ForEachActiveObject([&aAttributePath, &intersectsInterestPath](ReadHandler * handler) {
-        // We call AttributePathIsDirty for both read interactions and subscribe interactions, since we may send inconsistent
-        // attribute data between two chunks. AttributePathIsDirty will not schedule a new run for read handlers which are
-        // waiting for a response to the last message chunk for read interactions.
-        if (handler->CanStartReporting() || handler->IsAwaitingReportResponse())
+    if (IsIndexable(aAttributePath) && mIndexedReadHandlerCount == mpImEngine->mReadHandlers.Allocated())
+    {
+        // Only the read handlers with a path under the dirty cluster, or a wildcard path, can be interested in this change.
+        auto markHandlerDirty = [&](ReadHandlerInterest * interest) {
+            ReadHandler * handler = interest->mpReadHandler;
+            // A handler with several paths under the cluster is only marked dirty once, AttributePathIsDirty records the
+            // generation we just bumped.
+            if ((handler->CanStartReporting() || handler->IsAwaitingReportResponse()) &&
+                handler->mDirtyGeneration != GetDirtySetGeneration() && interest->mpPath->Intersects(aAttributePath))
+            {
+                handler->AttributePathIsDirty(aAttributePath);
+                intersectsInterestPath = true;
+            }
+        };
+        for (auto * interest = mInterestBuckets[PathIndexBucket(aAttributePath.mEndpointId, aAttributePath.mClusterId)];
+             interest != nullptr; interest = interest->mpNext)
+        {
+            markHandlerDirty(interest);
+        }
+        for (auto * interest = mWildcardInterests; interest != nullptr; interest = interest->mpNext)
         {
-            for (auto object = handler->GetAttributePathList(); object != nullptr; object = object->mpNext)
+            markHandlerDirty(interest);
+        }
+    }
+    else
+    {
+        mpImEngine->mReadHandlers.ForEachActiveObject([&aAttributePath, &intersectsInterestPath](ReadHandler * handler) {
+            // We call AttributePathIsDirty for both read interactions and subscribe interactions, since we may send inconsistent
+            // attribute data between two chunks. AttributePathIsDirty will not schedule a new run for read handlers which are
+            // waiting for a response to the last message chunk for read interactions.
+            if (handler->CanStartReporting() || handler->IsAwaitingReportResponse())
             {
-                if (object->mValue.Intersects(aAttributePath))
+                for (auto object = handler->GetAttributePathList(); object != nullptr; object = object->mpNext)
                 {
-                    handler->AttributePathIsDirty(aAttributePath);
-                    intersectsInterestPath = true;
-                    break;
+                    if (object->mValue.Intersects(aAttributePath))
+                    {
+                        handler->AttributePathIsDirty(aAttributePath);
+                        intersectsInterestPath = true;
+                        break;
+                    }
                 }
             }
-        }
 
-        return Loop::Continue;
-    });
+            return Loop::Continue;
+        });
+    }
 
     if (!intersectsInterestPath)
     {
@@ -890,6 +992,63 @@ CHIP_ERROR Engine::SetDirty(AttributePathParams & aAttributePath)
     return CHIP_NO_ERROR;
 }
 
+void Engine::AddReadHandlerInterests(ReadHandler * apReadHandler)
+{
+    RemoveReadHandlerInterests(apReadHandler);
+
+    // Count the handler in first, so that bailing out below through RemoveReadHandlerInterests unlinks what was added so far.
+    apReadHandler->mFlags.Set(ReadHandler::ReadHandlerFlags::InterestsIndexed);
+    mIndexedReadHandlerCount++;
+
+    for (auto * path = apReadHandler->GetAttributePathList(); path != nullptr; path = path->mpNext)
+    {
+        ReadHandlerInterest * interest = mReadHandlerInterests.CreateObject();
+        if (interest == nullptr)
+        {
+            ChipLogError(DataManagement, "Read handler interest index is full, dirty paths will be matched against every handler");
+            RemoveReadHandlerInterests(apReadHandler);
+            return;
+        }
+
+        auto *& head            = IsIndexable(path->mValue) ? mInterestBuckets[PathIndexBucket(path->mValue.mEndpointId,
+                                                                                               path->mValue.mClusterId)]
+                                                            : mWildcardInterests;
+        interest->mpReadHandler = apReadHandler;
+        interest->mpPath        = &path->mValue;
+        interest->mpNext        = head;
+        head                    = interest;
+    }
+}
+
+void Engine::RemoveReadHandlerInterests(ReadHandler * apReadHandler)
+{
+    VerifyOrReturn(apReadHandler->mFlags.Has(ReadHandler::ReadHandlerFlags::InterestsIndexed));
+
+    auto unlink = [this, apReadHandler](ReadHandlerInterest *& head) {
+        for (ReadHandlerInterest ** link = &head; *link != nullptr;)
+        {
+            ReadHandlerInterest * interest = *link;
+            if (interest->mpReadHandler == apReadHandler)
+            {
+                *link = interest->mpNext;
+                mReadHandlerInterests.ReleaseObject(interest);
+            }
+            else
+            {
+                link = &interest->mpNext;
+            }
+        }
+    };
+    for (auto & bucket : mInterestBuckets)
+    {
+        unlink(bucket);
+    }
+    unlink(mWildcardInterests);
+
+    apReadHandler->mFlags.Clear(ReadHandler::ReadHandlerFlags::InterestsIndexed);
+    mIndexedReadHandlerCount--;
+}
+
 CHIP_ERROR Engine::SendReport(ReadHandler * apReadHandler, System::PacketBufferHandle && aPayload, bool aHasMoreChunks)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -25,6 +25,7 @@
 #pragma once
 
 #include <access/AccessControl.h>
+#include <app/ClusterAccessCheckCache.h>
 #include <app/MessageDef/ReportDataMessage.h>
 #include <app/ReadHandler.h>
 #include <app/util/basic-types.h>
@@ -95,6 +96,21 @@ public:
      */
     CHIP_ERROR SetDirty(AttributePathParams & aAttributePathParams);
 
+    /**
+     * Record the attribute paths apReadHandler is interested in, so that SetDirty only visits the read handlers whose paths
+     * may intersect the dirty path. Should be called when the read handler is created, so that handlers without attribute
+     * paths are accounted for, and again once its attribute path list has been built.
+     *
+     * If the index runs out of entries, the read handler is left out of it and SetDirty falls back to checking every handler.
+     */
+    void AddReadHandlerInterests(ReadHandler * apReadHandler);
+
+    /**
+     * Forget the attribute paths recorded for apReadHandler. Must be called before its attribute path list is changed or
+     * released.
+     */
+    void RemoveReadHandlerInterests(ReadHandler * apReadHandler);
+
     /**
      * @brief
      *  Schedule the event delivery
@@ -156,8 +172,30 @@ private:
         AttributePathParamsWithGeneration() {}
         AttributePathParamsWithGeneration(const AttributePathParams aPath) : AttributePathParams(aPath) {}
         uint64_t mGeneration = 0;
+        // Next path in the same bucket of the dirty set index.
+        AttributePathParamsWithGeneration * mpNextIndexed = nullptr;
+    };
+
+    struct ReadHandlerInterest
+    {
+        ReadHandler * mpReadHandler        = nullptr;
+        const AttributePathParams * mpPath = nullptr;
+        ReadHandlerInterest * mpNext       = nullptr;
     };
 
+    static constexpr size_t kPathIndexBuckets = CHIP_IM_SERVER_PATH_INDEX_BUCKETS;
+    static_assert(kPathIndexBuckets > 0, "The path index needs at least one bucket");
+
+    /**
+     * Paths with a concrete endpoint and cluster are indexed in the bucket of that endpoint and cluster, paths with a
+     * wildcard endpoint or cluster may intersect anything and are kept in a separate list.
+     */
+    static bool IsIndexable(const AttributePathParams & aPath)
+    {
+        return !aPath.HasWildcardEndpointId() && !aPath.HasWildcardClusterId();
+    }
+    static size_t PathIndexBucket(EndpointId aEndpointId, ClusterId aClusterId);
+
     /**
      * Build Single Report Data including attribute changes and event data stream, and send out
      *
@@ -171,7 +209,8 @@ private:
     CHIP_ERROR RetrieveClusterData(const Access::SubjectDescriptor & aSubjectDescriptor, bool aIsFabricFiltered,
                                    AttributeReportIBs::Builder & aAttributeReportIBs,
                                    const ConcreteReadAttributePath & aClusterInfo,
-                                   AttributeValueEncoder::AttributeEncodeState * apEncoderState);
+                                   AttributeValueEncoder::AttributeEncodeState * apEncoderState,
+                                   ClusterAccessCheckCache * apAccessCheckCache);
     CHIP_ERROR CheckAccessDeniedEventPaths(TLV::TLVWriter & aWriter, bool & aHasEncodedData, ReadHandler * apReadHandler);
 
     // If version match, it means don't send, if version mismatch, it means send.
@@ -230,6 +269,39 @@ private:
 
     CHIP_ERROR InsertPathIntoDirtySet(const AttributePathParams & aAttributePath);
 
+    /**
+     * Call aFunction on the dirty paths that may intersect paths under aEndpointId / aClusterId, i.e. the dirty paths of that
+     * bucket and the dirty paths with wildcards, until it returns Loop::Break.
+     */
+    template <typename Function>
+    Loop ForEachDirtyPathUnder(EndpointId aEndpointId, ClusterId aClusterId, Function && aFunction)
+    {
+        for (auto * path = mDirtyPathBuckets[PathIndexBucket(aEndpointId, aClusterId)]; path != nullptr; path = path->mpNextIndexed)
+        {
+            if (aFunction(path) == Loop::Break)
+            {
+                return Loop::Break;
+            }
+        }
+        for (auto * path = mWildcardDirtyPaths; path != nullptr; path = path->mpNextIndexed)
+        {
+            if (aFunction(path) == Loop::Break)
+            {
+                return Loop::Break;
+            }
+        }
+        return Loop::Finish;
+    }
+
+    void IndexDirtyPath(AttributePathParamsWithGeneration * apPath);
+
+    /**
+     * Rebuild the dirty set index after paths have been released or had their endpoint or cluster widened.
+     */
+    void RebuildDirtySetIndex();
+
+    void ClearDirtySet();
+
     inline void BumpDirtySetGeneration() { mDirtyGeneration++; }
 
     /**
@@ -281,6 +353,31 @@ private:
      */
     uint64_t mDirtyGeneration = 1;
 
+    AttributePathParamsWithGeneration * mDirtyPathBuckets[kPathIndexBuckets] = {};
+    AttributePathParamsWithGeneration * mWildcardDirtyPaths                  = nullptr;
+
+    /**
+     * Interest index from endpoint and cluster to the read handlers with attribute paths under them.
+     *
+     * mIndexedReadHandlerCount is the number of read handlers recorded in it. Read handlers are recorded from their creation
+     * on, with no interest until they have attribute paths, and are only left out while their attribute path list is being
+     * built or when the interest pool runs out. If the count does not match the number of active read handlers, some handler
+     * is missing from the index and SetDirty checks every handler.
+     */
+#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
+    ObjectPool<ReadHandlerInterest,
+               CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS + CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS,
+               ObjectPoolMem::kInline>
+        mReadHandlerInterests;
+#else
+    ObjectPool<ReadHandlerInterest,
+               CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS + CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS>
+        mReadHandlerInterests;
+#endif
+    ReadHandlerInterest * mInterestBuckets[kPathIndexBuckets] = {};
+    ReadHandlerInterest * mWildcardInterests                  = nullptr;
+    size_t mIndexedReadHandlerCount                           = 0;
+
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     uint32_t mReservedSize          = 0;
     uint32_t mMaxAttributesPerChunk = UINT32_MAX;
@@ -96,6 +96,12 @@ static uint8_t sDebugEventBuffer[CHIP_DEVICE_CONFIG_EVENT_LOGGING_DEBUG_BUFFER_S
 static uint8_t sCritEventBuffer[CHIP_DEVICE_CONFIG_EVENT_LOGGING_CRIT_BUFFER_SIZE];
 static ::chip::PersistedCounter<chip::EventNumber> sGlobalEventIdCounter;
 static ::chip::app::CircularEventBuffer sLoggingBuffer[CHIP_NUM_EVENT_LOGGING_BUFFERS];
+#if CHIP_DEVICE_CONFIG_EVENT_LOGGING_INDEX_BYTES_PER_EVENT > 0
+#define CHIP_EVENT_INDEX_SIZE(bufferSize) ((bufferSize) / CHIP_DEVICE_CONFIG_EVENT_LOGGING_INDEX_BYTES_PER_EVENT + 1)
+static ::chip::app::EventIndexEntry sInfoEventIndex[CHIP_EVENT_INDEX_SIZE(CHIP_DEVICE_CONFIG_EVENT_LOGGING_INFO_BUFFER_SIZE)];
+static ::chip::app::EventIndexEntry sDebugEventIndex[CHIP_EVENT_INDEX_SIZE(CHIP_DEVICE_CONFIG_EVENT_LOGGING_DEBUG_BUFFER_SIZE)];
+static ::chip::app::EventIndexEntry sCritEventIndex[CHIP_EVENT_INDEX_SIZE(CHIP_DEVICE_CONFIG_EVENT_LOGGING_CRIT_BUFFER_SIZE)];
+#endif // CHIP_DEVICE_CONFIG_EVENT_LOGGING_INDEX_BYTES_PER_EVENT > 0
 #endif // CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
 
 CHIP_ERROR Server::Init(const ServerInitParams & initParams)
@@ -246,9 +252,18 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
 
     {
         ::chip::app::LogStorageResources logStorageResources[] = {
+#if CHIP_DEVICE_CONFIG_EVENT_LOGGING_INDEX_BYTES_PER_EVENT > 0
+            { &sDebugEventBuffer[0], sizeof(sDebugEventBuffer), ::chip::app::PriorityLevel::Debug, &sDebugEventIndex[0],
+              ArraySize(sDebugEventIndex) },
+            { &sInfoEventBuffer[0], sizeof(sInfoEventBuffer), ::chip::app::PriorityLevel::Info, &sInfoEventIndex[0],
+              ArraySize(sInfoEventIndex) },
+            { &sCritEventBuffer[0], sizeof(sCritEventBuffer), ::chip::app::PriorityLevel::Critical, &sCritEventIndex[0],
+              ArraySize(sCritEventIndex) }
+#else
             { &sDebugEventBuffer[0], sizeof(sDebugEventBuffer), ::chip::app::PriorityLevel::Debug },
             { &sInfoEventBuffer[0], sizeof(sInfoEventBuffer), ::chip::app::PriorityLevel::Info },
             { &sCritEventBuffer[0], sizeof(sCritEventBuffer), ::chip::app::PriorityLevel::Critical }
+#endif // CHIP_DEVICE_CONFIG_EVENT_LOGGING_INDEX_BYTES_PER_EVENT > 0
         };
 
         chip::app::EventManagement::GetInstance().Init(&mExchangeMgr, CHIP_NUM_EVENT_LOGGING_BUFFERS, &sLoggingBuffer[0],
@@ -599,10 +599,101 @@ void TestBufferedSequences(nlTestSuite * apSuite, void * apContext)
     });
 }
 
+//
+// Receives the lists delivered by BufferedReadCallback and checks that item i has member1 == i and a member2
+// of kItemSize octets set to i.
+//
+class LargeListItemValidator : public ReadClient::Callback
+{
+public:
+    static constexpr size_t kItemSize = 700;
+
+    void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override
+    {
+        Clusters::UnitTesting::Attributes::ListStructOctetString::TypeInfo::DecodableType value;
+
+        mListCount++;
+        NL_TEST_ASSERT(gSuite, aPath.mListOp == ConcreteDataAttributePath::ListOperation::ReplaceAll);
+        NL_TEST_ASSERT(gSuite, DataModel::Decode(*apData, value) == CHIP_NO_ERROR);
+
+        mItemCount = 0;
+        auto iter  = value.begin();
+        while (iter.Next())
+        {
+            auto & item = iter.GetValue();
+            NL_TEST_ASSERT(gSuite, item.member1 == mItemCount);
+            NL_TEST_ASSERT(gSuite, item.member2.size() == kItemSize);
+            for (auto octet : item.member2)
+            {
+                NL_TEST_ASSERT(gSuite, octet == static_cast<uint8_t>(mItemCount));
+            }
+            mItemCount++;
+        }
+        NL_TEST_ASSERT(gSuite, iter.GetStatus() == CHIP_NO_ERROR);
+    }
+
+    void OnDone(ReadClient *) override {}
+
+    uint32_t mListCount = 0;
+    uint32_t mItemCount = 0;
+};
+
+void TestBufferedLargeListItems(nlTestSuite * apSuite, void * apContext)
+{
+    constexpr uint32_t kItemCount = 12;
+
+    LargeListItemValidator validator;
+    BufferedReadCallback bufferedCallback(validator);
+    ReadClient::Callback * callback = &bufferedCallback;
+    ConcreteDataAttributePath path(0, Clusters::UnitTesting::Id, Clusters::UnitTesting::Attributes::ListStructOctetString::Id);
+    System::PacketBufferTLVWriter writer;
+    System::PacketBufferTLVReader reader;
+    System::PacketBufferHandle handle;
+    uint8_t octets[LargeListItemValidator::kItemSize];
+
+    callback->OnReportBegin();
+
+    //
+    // Each item is larger than what the buffered list starts with, so buffering them grows it several times.
+    //
+    for (uint32_t i = 0; i <= kItemCount; i++)
+    {
+        handle = System::PacketBufferHandle::New(1000);
+        writer.Init(std::move(handle), true);
+
+        if (i == 0)
+        {
+            Clusters::UnitTesting::Attributes::ListStructOctetString::TypeInfo::Type value;
+            path.mListOp = ConcreteDataAttributePath::ListOperation::ReplaceAll;
+            NL_TEST_ASSERT(apSuite, DataModel::Encode(writer, TLV::AnonymousTag(), value) == CHIP_NO_ERROR);
+        }
+        else
+        {
+            Clusters::UnitTesting::Structs::TestListStructOctet::Type listItem;
+            memset(octets, static_cast<uint8_t>(i - 1), sizeof(octets));
+            listItem.member1 = i - 1;
+            listItem.member2 = ByteSpan(octets);
+            path.mListOp     = ConcreteDataAttributePath::ListOperation::AppendItem;
+            NL_TEST_ASSERT(apSuite, DataModel::Encode(writer, TLV::AnonymousTag(), listItem) == CHIP_NO_ERROR);
+        }
+
+        writer.Finalize(&handle);
+        reader.Init(std::move(handle));
+        NL_TEST_ASSERT(apSuite, reader.Next() == CHIP_NO_ERROR);
+        callback->OnAttributeData(path, &reader, StatusIB());
+    }
+
+    callback->OnReportEnd();
+
+    NL_TEST_ASSERT(apSuite, validator.mListCount == 1);
+    NL_TEST_ASSERT(apSuite, validator.mItemCount == kItemCount);
+}
+
 // clang-format off
 const nlTest sTests[] =
 {
     NL_TEST_DEF("TestBufferedSequences", TestBufferedSequences),
+    NL_TEST_DEF("TestBufferedLargeListItems", TestBufferedLargeListItems),
     NL_TEST_SENTINEL()
 };
 
@@ -0,0 +1,176 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <access/AccessControl.h>
+#include <app/ClusterAccessCheckCache.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+
+using namespace chip;
+using namespace chip::Access;
+using namespace chip::app;
+
+namespace {
+
+constexpr EndpointId kTestEndpointId      = 1;
+constexpr EndpointId kOtherTestEndpointId = 2;
+constexpr ClusterId kAllowedClusterId     = 6;
+constexpr ClusterId kDeniedClusterId      = 8;
+constexpr ClusterId kViewOnlyClusterId    = 0x1F;
+constexpr ClusterId kFailingClusterId     = 0x28;
+constexpr FabricIndex kTestFabricIndex    = 1;
+constexpr NodeId kTestSubjectNodeId       = 0x0123456789ABCDEF;
+
+// Allows everything on kAllowedClusterId, only kView on kViewOnlyClusterId, and counts how often it is asked.
+class CountingAccessControlDelegate : public AccessControl::Delegate
+{
+public:
+    CHIP_ERROR Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                     Privilege requestPrivilege) override
+    {
+        mCheckCount++;
+        switch (requestPath.cluster)
+        {
+        case kAllowedClusterId:
+            return CHIP_NO_ERROR;
+        case kViewOnlyClusterId:
+            return (requestPrivilege == Privilege::kView) ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+        case kFailingClusterId:
+            return CHIP_ERROR_INCORRECT_STATE;
+        default:
+            return CHIP_ERROR_ACCESS_DENIED;
+        }
+    }
+
+    size_t mCheckCount = 0;
+};
+
+class TestDeviceTypeResolver : public AccessControl::DeviceTypeResolver
+{
+public:
+    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override { return false; }
+};
+
+SubjectDescriptor MakeSubjectDescriptor()
+{
+    SubjectDescriptor subjectDescriptor;
+    subjectDescriptor.fabricIndex = kTestFabricIndex;
+    subjectDescriptor.authMode    = AuthMode::kCase;
+    subjectDescriptor.subject     = kTestSubjectNodeId;
+    return subjectDescriptor;
+}
+
+void TestRepeatedChecks(nlTestSuite * inSuite, void * inContext)
+{
+    CountingAccessControlDelegate delegate;
+    TestDeviceTypeResolver deviceTypeResolver;
+    AccessControl accessControl;
+    NL_TEST_ASSERT(inSuite, accessControl.Init(&delegate, deviceTypeResolver) == CHIP_NO_ERROR);
+    SetAccessControl(accessControl);
+
+    ClusterAccessCheckCache cache(MakeSubjectDescriptor());
+    NL_TEST_ASSERT(inSuite, cache.GetSubjectDescriptor().subject == kTestSubjectNodeId);
+
+    // Attributes of one cluster that need the same privilege share a single check.
+    RequestPath allowedPath{ .cluster = kAllowedClusterId, .endpoint = kTestEndpointId };
+    for (int i = 0; i < 5; i++)
+    {
+        NL_TEST_ASSERT(inSuite, cache.Check(allowedPath, Privilege::kView) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, delegate.mCheckCount == 1);
+
+    // Denied decisions are remembered as well.
+    RequestPath deniedPath{ .cluster = kDeniedClusterId, .endpoint = kTestEndpointId };
+    for (int i = 0; i < 5; i++)
+    {
+        NL_TEST_ASSERT(inSuite, cache.Check(deniedPath, Privilege::kView) == CHIP_ERROR_ACCESS_DENIED);
+    }
+    NL_TEST_ASSERT(inSuite, delegate.mCheckCount == 2);
+
+    // The same cluster on another endpoint is checked on its own.
+    RequestPath otherEndpointPath{ .cluster = kDeniedClusterId, .endpoint = kOtherTestEndpointId };
+    NL_TEST_ASSERT(inSuite, cache.Check(otherEndpointPath, Privilege::kView) == CHIP_ERROR_ACCESS_DENIED);
+    NL_TEST_ASSERT(inSuite, delegate.mCheckCount == 3);
+
+    // Going back to a cluster that was checked before checks it again.
+    NL_TEST_ASSERT(inSuite, cache.Check(allowedPath, Privilege::kView) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, delegate.mCheckCount == 4);
+
+    accessControl.Finish();
+    ResetAccessControlToDefault();
+}
+
+void TestPrivilegeFallback(nlTestSuite * inSuite, void * inContext)
+{
+    CountingAccessControlDelegate delegate;
+    TestDeviceTypeResolver deviceTypeResolver;
+    AccessControl accessControl;
+    NL_TEST_ASSERT(inSuite, accessControl.Init(&delegate, deviceTypeResolver) == CHIP_NO_ERROR);
+    SetAccessControl(accessControl);
+
+    ClusterAccessCheckCache cache(MakeSubjectDescriptor());
+
+    // An attribute that needs a higher privilege than its neighbours gets its own decision, and does not
+    // affect the decision remembered for the other attributes of the cluster.
+    RequestPath path{ .cluster = kViewOnlyClusterId, .endpoint = kTestEndpointId };
+    NL_TEST_ASSERT(inSuite, cache.Check(path, Privilege::kView) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cache.Check(path, Privilege::kAdminister) == CHIP_ERROR_ACCESS_DENIED);
+    NL_TEST_ASSERT(inSuite, cache.Check(path, Privilege::kView) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cache.Check(path, Privilege::kAdminister) == CHIP_ERROR_ACCESS_DENIED);
+    NL_TEST_ASSERT(inSuite, cache.Check(path, Privilege::kOperate) == CHIP_ERROR_ACCESS_DENIED);
+    NL_TEST_ASSERT(inSuite, delegate.mCheckCount == 3);
+
+    // Errors other than access denied are not remembered.
+    RequestPath failingPath{ .cluster = kFailingClusterId, .endpoint = kTestEndpointId };
+    NL_TEST_ASSERT(inSuite, cache.Check(failingPath, Privilege::kView) == CHIP_ERROR_INCORRECT_STATE);
+    NL_TEST_ASSERT(inSuite, cache.Check(failingPath, Privilege::kView) == CHIP_ERROR_INCORRECT_STATE);
+    NL_TEST_ASSERT(inSuite, delegate.mCheckCount == 5);
+
+    accessControl.Finish();
+    ResetAccessControlToDefault();
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("Repeated checks for a cluster are answered once", TestRepeatedChecks),
+    NL_TEST_DEF("Attributes needing another privilege are checked on their own", TestPrivilegeFallback),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+} // namespace
+
+int TestClusterAccessCheckCache()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "Test for cluster access check cache",
+        &sTests[0],
+        nullptr,
+        nullptr
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestClusterAccessCheckCache)
@@ -33,6 +33,7 @@
 #include <lib/support/UnitTestContext.h>
 #include <lib/support/UnitTestRegistration.h>
 #include <nlunit-test.h>
+#include <algorithm>
 #include <string.h>
 #include <vector>
 
@@ -684,10 +685,139 @@ void TestCache(nlTestSuite * apSuite, void * apContext)
                              AttributeInstruction(AttributeInstruction::kAttributeB, 0, AttributeInstruction::kData) });
 }
 
+class NoopCacheCallback : public ClusterStateCache::Callback
+{
+    void OnDone(ReadClient *) override {}
+};
+
+// The value of attribute aPath in report aReport: a byte string whose length varies from report to report.
+size_t ExpectedValue(const ConcreteAttributePath & aPath, uint8_t aReport, uint8_t (&aValue)[64])
+{
+    size_t length = (aReport * 7u + aPath.mEndpointId * 5u + aPath.mAttributeId) % sizeof(aValue) + 1;
+    memset(aValue, aReport, length);
+    return length;
+}
+
+void ReportValue(ReadClient::Callback & aCallback, const ConcreteAttributePath & aPath, uint8_t aReport)
+{
+    uint8_t value[64];
+    uint8_t buf[128];
+    TLV::TLVWriter writer;
+    writer.Init(buf);
+    NL_TEST_ASSERT(gSuite, writer.Put(TLV::AnonymousTag(), ByteSpan(value, ExpectedValue(aPath, aReport, value))) == CHIP_NO_ERROR);
+
+    TLV::TLVReader reader;
+    reader.Init(buf, writer.GetLengthWritten());
+    NL_TEST_ASSERT(gSuite, reader.Next() == CHIP_NO_ERROR);
+    aCallback.OnAttributeData(ConcreteDataAttributePath(aPath), &reader, StatusIB());
+}
+
+/*
+ * This validates that values survive being replaced many times over, which compacts the store holding them,
+ * and that the cache iterates its paths in order whatever the order they were reported in.
+ */
+void TestCacheValueStore(nlTestSuite * apSuite, void * apContext)
+{
+    NoopCacheCallback callback;
+    ClusterStateCache cache(callback);
+    ReadClient::Callback & readCallback = cache.GetBufferedCallback();
+
+    const EndpointId endpoints[]   = { 3, 1, 2 };
+    const ClusterId clusters[]     = { 0x101, 6 };
+    const AttributeId attributes[] = { 5, 1, 3 };
+    const ConcreteAttributePath statusPath(2, 6, 3);
+    constexpr uint8_t kReportCount = 20;
+
+    for (uint8_t report = 0; report < kReportCount; report++)
+    {
+        readCallback.OnReportBegin();
+        for (auto endpoint : endpoints)
+        {
+            for (auto cluster : clusters)
+            {
+                for (auto attribute : attributes)
+                {
+                    const ConcreteAttributePath path(endpoint, cluster, attribute);
+                    if (path == statusPath && report == kReportCount - 1)
+                    {
+                        StatusIB status;
+                        status.mStatus = Protocols::InteractionModel::Status::UnsupportedAttribute;
+                        readCallback.OnAttributeData(ConcreteDataAttributePath(path), nullptr, status);
+                        continue;
+                    }
+                    ReportValue(readCallback, path, report);
+                }
+            }
+        }
+        readCallback.OnReportEnd();
+
+        for (auto endpoint : endpoints)
+        {
+            for (auto cluster : clusters)
+            {
+                for (auto attribute : attributes)
+                {
+                    const ConcreteAttributePath path(endpoint, cluster, attribute);
+                    TLV::TLVReader reader;
+                    CHIP_ERROR err = cache.Get(path, reader);
+                    if (path == statusPath && report == kReportCount - 1)
+                    {
+                        NL_TEST_ASSERT(apSuite, err == CHIP_ERROR_IM_STATUS_CODE_RECEIVED);
+                        continue;
+                    }
+
+                    uint8_t expected[64];
+                    size_t expectedLength = ExpectedValue(path, report, expected);
+                    ByteSpan value;
+                    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+                    NL_TEST_ASSERT(apSuite, reader.Get(value) == CHIP_NO_ERROR);
+                    NL_TEST_ASSERT(apSuite, value.data_equal(ByteSpan(expected, expectedLength)));
+                }
+            }
+        }
+    }
+
+    StatusIB status;
+    NL_TEST_ASSERT(apSuite, cache.GetStatus(statusPath, status) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, status.mStatus == Protocols::InteractionModel::Status::UnsupportedAttribute);
+
+    std::vector<ClusterId> endpointClusters;
+    NL_TEST_ASSERT(apSuite, cache.ForEachCluster(1, [&](ClusterId clusterId) {
+        endpointClusters.push_back(clusterId);
+        return CHIP_NO_ERROR;
+    }) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, (endpointClusters == std::vector<ClusterId>{ 6, 0x101 }));
+
+    endpointClusters.clear();
+    NL_TEST_ASSERT(apSuite, cache.ForEachCluster(4, [&](ClusterId clusterId) {
+        endpointClusters.push_back(clusterId);
+        return CHIP_NO_ERROR;
+    }) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, endpointClusters.empty());
+
+    std::vector<ConcreteAttributePath> paths;
+    auto collectPath = [&](const ConcreteAttributePath & path) {
+        paths.push_back(path);
+        return CHIP_NO_ERROR;
+    };
+    NL_TEST_ASSERT(apSuite, cache.ForEachAttribute(1, 6, collectPath) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite,
+                   (paths ==
+                    std::vector<ConcreteAttributePath>{ ConcreteAttributePath(1, 6, 1), ConcreteAttributePath(1, 6, 3),
+                                                        ConcreteAttributePath(1, 6, 5) }));
+    NL_TEST_ASSERT(apSuite, cache.ForEachAttribute(4, 6, collectPath) == CHIP_ERROR_KEY_NOT_FOUND);
+
+    paths.clear();
+    NL_TEST_ASSERT(apSuite, cache.ForEachAttribute(0x101, collectPath) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, paths.size() == 9);
+    NL_TEST_ASSERT(apSuite, std::is_sorted(paths.begin(), paths.end()));
+}
+
 // clang-format off
 const nlTest sTests[] =
 {
     NL_TEST_DEF("TestCache", TestCache),
+    NL_TEST_DEF("TestCacheValueStore", TestCacheValueStore),
     NL_TEST_SENTINEL()
 };
 
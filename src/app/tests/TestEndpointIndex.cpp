@@ -0,0 +1,171 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/EndpointIndex.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+// Large enough to model a bridge exposing hundreds of dynamic endpoints.
+constexpr uint16_t kBenchmarkEndpointCount = 600;
+constexpr size_t kBenchmarkLookupRounds    = 20;
+
+void TestInsertFindRemove(nlTestSuite * inSuite, void * inContext)
+{
+    EndpointIndex<4> index;
+
+    NL_TEST_ASSERT(inSuite, index.Find(1) == index.kInvalidSlot);
+
+    NL_TEST_ASSERT(inSuite, index.Insert(5, 0));
+    NL_TEST_ASSERT(inSuite, index.Insert(1, 1));
+    NL_TEST_ASSERT(inSuite, index.Insert(3, 2));
+    NL_TEST_ASSERT(inSuite, index.Count() == 3);
+
+    NL_TEST_ASSERT(inSuite, index.Find(5) == 0);
+    NL_TEST_ASSERT(inSuite, index.Find(1) == 1);
+    NL_TEST_ASSERT(inSuite, index.Find(3) == 2);
+    NL_TEST_ASSERT(inSuite, index.Find(2) == index.kInvalidSlot);
+
+    // Removing an entry that was never recorded does nothing.
+    index.Remove(3, 0);
+    NL_TEST_ASSERT(inSuite, index.Count() == 3);
+
+    index.Remove(3, 2);
+    NL_TEST_ASSERT(inSuite, index.Count() == 2);
+    NL_TEST_ASSERT(inSuite, index.Find(3) == index.kInvalidSlot);
+    NL_TEST_ASSERT(inSuite, index.Find(5) == 0);
+    NL_TEST_ASSERT(inSuite, index.Find(1) == 1);
+
+    NL_TEST_ASSERT(inSuite, index.Insert(7, 2));
+    NL_TEST_ASSERT(inSuite, index.Insert(8, 3));
+    NL_TEST_ASSERT(inSuite, !index.Insert(9, 4));
+
+    index.Clear();
+    NL_TEST_ASSERT(inSuite, index.Count() == 0);
+    NL_TEST_ASSERT(inSuite, index.Find(5) == index.kInvalidSlot);
+}
+
+void TestDuplicateEndpointIds(nlTestSuite * inSuite, void * inContext)
+{
+    EndpointIndex<4> index;
+
+    NL_TEST_ASSERT(inSuite, index.Insert(2, 3));
+    NL_TEST_ASSERT(inSuite, index.Insert(2, 1));
+    NL_TEST_ASSERT(inSuite, index.Insert(1, 2));
+
+    // The lowest slot wins, like a scan over the endpoint table would.
+    NL_TEST_ASSERT(inSuite, index.Find(2) == 1);
+
+    // The predicate can skip slots, e.g. disabled endpoints.
+    NL_TEST_ASSERT(inSuite, index.Find(2, [](uint16_t slot) { return slot != 1; }) == 3);
+    NL_TEST_ASSERT(inSuite, index.Find(2, [](uint16_t slot) { return false; }) == index.kInvalidSlot);
+
+    index.Remove(2, 1);
+    NL_TEST_ASSERT(inSuite, index.Find(2) == 3);
+}
+
+void TestLookupBenchmark(nlTestSuite * inSuite, void * inContext)
+{
+    static EndpointId sEndpoints[kBenchmarkEndpointCount];
+    static EndpointIndex<kBenchmarkEndpointCount> sIndex;
+
+    // Bridges usually hand out endpoint ids in order, but not necessarily in slot order.
+    for (uint16_t slot = 0; slot < kBenchmarkEndpointCount; slot++)
+    {
+        sEndpoints[slot] = static_cast<EndpointId>((slot * 7u) % kBenchmarkEndpointCount + 1);
+        NL_TEST_ASSERT(inSuite, sIndex.Insert(sEndpoints[slot], slot));
+    }
+
+    auto & clock     = System::SystemClock();
+    size_t linearSum = 0;
+    size_t indexSum  = 0;
+
+    System::Clock::Microseconds64 start = clock.GetMonotonicMicroseconds64();
+    for (size_t round = 0; round < kBenchmarkLookupRounds; round++)
+    {
+        for (EndpointId endpoint = 1; endpoint <= kBenchmarkEndpointCount; endpoint++)
+        {
+            // This is what findIndexFromEndpoint used to do.
+            for (uint16_t slot = 0; slot < kBenchmarkEndpointCount; slot++)
+            {
+                if (sEndpoints[slot] == endpoint)
+                {
+                    linearSum += slot;
+                    break;
+                }
+            }
+        }
+    }
+    System::Clock::Microseconds64 linear = clock.GetMonotonicMicroseconds64() - start;
+
+    start = clock.GetMonotonicMicroseconds64();
+    for (size_t round = 0; round < kBenchmarkLookupRounds; round++)
+    {
+        for (EndpointId endpoint = 1; endpoint <= kBenchmarkEndpointCount; endpoint++)
+        {
+            indexSum += sIndex.Find(endpoint);
+        }
+    }
+    System::Clock::Microseconds64 indexed = clock.GetMonotonicMicroseconds64() - start;
+
+    NL_TEST_ASSERT(inSuite, linearSum == indexSum);
+
+    // Timings are reported rather than asserted on, since they depend on the host.
+    constexpr size_t kLookups = kBenchmarkLookupRounds * kBenchmarkEndpointCount;
+    ChipLogProgress(DataManagement, "Endpoint lookup over %u endpoints: linear scan %u ns, index %u ns",
+                    static_cast<unsigned>(kBenchmarkEndpointCount), static_cast<unsigned>(linear.count() * 1000 / kLookups),
+                    static_cast<unsigned>(indexed.count() * 1000 / kLookups));
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("Insert, find and remove endpoints", TestInsertFindRemove),
+    NL_TEST_DEF("Duplicate endpoint ids", TestDuplicateEndpointIds),
+    NL_TEST_DEF("Endpoint lookup benchmark", TestLookupBenchmark),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+} // namespace
+
+int TestEndpointIndex()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "Test for the endpoint index of the attribute storage",
+        &sTests[0],
+        nullptr,
+        nullptr
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestEndpointIndex)
@@ -0,0 +1,439 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/EndpointIndex.h>
+#include <app/EndpointTypeIndex.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+
+#include <nlunit-test.h>
+
+#include <array>
+#include <utility>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+// Models a bridge exposing hundreds of endpoints of a few device types with many clusters and attributes.
+constexpr uint16_t kBenchmarkEndpointCount  = 600;
+constexpr uint8_t kBenchmarkTypeCount       = 4;
+constexpr uint8_t kBenchmarkClusterCount    = 16;
+constexpr uint16_t kBenchmarkAttributeCount = 24;
+constexpr size_t kBenchmarkLookupRounds     = 5;
+
+constexpr EmberAfAttributeMetadata MakeAttribute(AttributeId id, uint16_t size, EmberAfAttributeMask mask = 0)
+{
+    return EmberAfAttributeMetadata{ EmberAfDefaultOrMinMaxAttributeValue(static_cast<uint32_t>(0)), id, size, 0, mask };
+}
+
+EmberAfCluster MakeCluster(ClusterId id, const EmberAfAttributeMetadata * attributes, uint16_t attributeCount,
+                           EmberAfClusterMask mask)
+{
+    EmberAfCluster cluster = {};
+    cluster.clusterId      = id;
+    cluster.attributes     = attributes;
+    cluster.attributeCount = attributeCount;
+    cluster.mask           = mask;
+    for (uint16_t i = 0; i < attributeCount; i++)
+    {
+        cluster.clusterSize = static_cast<uint16_t>(cluster.clusterSize + attributes[i].size);
+    }
+    return cluster;
+}
+
+// This is what emberAfFindClusterInType does without the index.
+const EmberAfCluster * ScanCluster(const EmberAfEndpointType * type, ClusterId id, EmberAfClusterMask mask, uint8_t * index,
+                                   uint16_t * offset)
+{
+    uint8_t scopedIndex = 0;
+    *offset             = 0;
+    for (uint8_t i = 0; i < type->clusterCount; i++)
+    {
+        const EmberAfCluster * cluster = &type->cluster[i];
+        if (mask == 0 || (cluster->mask & mask) != 0)
+        {
+            if (cluster->clusterId == id)
+            {
+                *index = scopedIndex;
+                return cluster;
+            }
+            scopedIndex++;
+        }
+        *offset = static_cast<uint16_t>(*offset + cluster->clusterSize);
+    }
+    return nullptr;
+}
+
+// This is what emAfReadOrWriteAttribute does without the index.
+const EmberAfAttributeMetadata * ScanAttribute(const EmberAfCluster * cluster, AttributeId id, uint16_t * offset)
+{
+    *offset = 0;
+    for (uint16_t i = 0; i < cluster->attributeCount; i++)
+    {
+        const EmberAfAttributeMetadata * am = &cluster->attributes[i];
+        if (am->attributeId == id)
+        {
+            return am;
+        }
+        if (!(am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !(am->mask & ATTRIBUTE_MASK_SINGLETON))
+        {
+            *offset = static_cast<uint16_t>(*offset + am->size);
+        }
+    }
+    return nullptr;
+}
+
+template <typename Index>
+void CheckMatchesScan(nlTestSuite * inSuite, const Index & index, const EmberAfEndpointType * type)
+{
+    const EmberAfClusterMask masks[] = { 0, CLUSTER_MASK_SERVER, CLUSTER_MASK_CLIENT };
+    for (ClusterId clusterId = 0; clusterId < 8; clusterId++)
+    {
+        for (EmberAfClusterMask mask : masks)
+        {
+            uint8_t expectedIndex           = 0xFF;
+            uint16_t expectedOffset         = 0;
+            const EmberAfCluster * expected = ScanCluster(type, clusterId, mask, &expectedIndex, &expectedOffset);
+
+            const EmberAfCluster * cluster = nullptr;
+            uint8_t clusterIndex           = 0xFF;
+            uint16_t clusterOffset         = 0;
+            NL_TEST_ASSERT(inSuite, index.FindCluster(type, clusterId, mask, &cluster, &clusterIndex, &clusterOffset));
+            NL_TEST_ASSERT(inSuite, cluster == expected);
+            if (expected != nullptr)
+            {
+                NL_TEST_ASSERT(inSuite, clusterIndex == expectedIndex);
+                NL_TEST_ASSERT(inSuite, clusterOffset == expectedOffset);
+            }
+        }
+    }
+
+    for (uint8_t i = 0; i < type->clusterCount; i++)
+    {
+        const EmberAfCluster * cluster = &type->cluster[i];
+        for (AttributeId attributeId = 0; attributeId < 8; attributeId++)
+        {
+            uint16_t expectedOffset                   = 0;
+            const EmberAfAttributeMetadata * expected = ScanAttribute(cluster, attributeId, &expectedOffset);
+
+            const EmberAfAttributeMetadata * am = nullptr;
+            uint16_t offset                     = 0;
+            NL_TEST_ASSERT(inSuite, index.FindAttribute(cluster, attributeId, &am, &offset));
+            NL_TEST_ASSERT(inSuite, am == expected);
+            if (expected != nullptr)
+            {
+                NL_TEST_ASSERT(inSuite, offset == expectedOffset);
+            }
+        }
+    }
+}
+
+constexpr EmberAfAttributeMetadata kAttributesA[] = {
+    MakeAttribute(3, 4),
+    MakeAttribute(1, 2, ATTRIBUTE_MASK_EXTERNAL_STORAGE),
+    MakeAttribute(5, 1),
+    MakeAttribute(2, 8, ATTRIBUTE_MASK_SINGLETON),
+    MakeAttribute(5, 2),
+    MakeAttribute(0, 4),
+};
+constexpr EmberAfAttributeMetadata kAttributesB[] = {
+    MakeAttribute(7, 2),
+    MakeAttribute(1, 4),
+};
+
+void TestMatchesScan(nlTestSuite * inSuite, void * inContext)
+{
+    // Duplicate cluster ids with different masks, like a cluster that is both client and server.
+    const EmberAfCluster clusters[] = {
+        MakeCluster(4, kAttributesA, 6, CLUSTER_MASK_SERVER),
+        MakeCluster(2, kAttributesB, 2, CLUSTER_MASK_CLIENT),
+        MakeCluster(2, kAttributesA, 6, CLUSTER_MASK_SERVER),
+        MakeCluster(6, nullptr, 0, CLUSTER_MASK_SERVER),
+        MakeCluster(1, kAttributesB, 2, CLUSTER_MASK_CLIENT),
+        MakeCluster(4, kAttributesB, 2, CLUSTER_MASK_CLIENT),
+        MakeCluster(3, kAttributesB, 2, CLUSTER_MASK_SERVER | CLUSTER_MASK_CLIENT),
+    };
+    const EmberAfEndpointType type = { clusters, 7, 0 };
+
+    EndpointTypeIndex<16, 32> index;
+    NL_TEST_ASSERT(inSuite, !index.Contains(&type));
+    NL_TEST_ASSERT(inSuite, index.Add(&type));
+    NL_TEST_ASSERT(inSuite, index.Contains(&type));
+
+    // Adding the same endpoint type again does nothing.
+    size_t clusterEntries   = index.ClusterEntryCount();
+    size_t attributeEntries = index.AttributeEntryCount();
+    NL_TEST_ASSERT(inSuite, index.Add(&type));
+    NL_TEST_ASSERT(inSuite, index.ClusterEntryCount() == clusterEntries);
+    NL_TEST_ASSERT(inSuite, index.AttributeEntryCount() == attributeEntries);
+
+    CheckMatchesScan(inSuite, index, &type);
+
+    // Masks the index was not built for are left to the caller.
+    const EmberAfCluster * cluster;
+    NL_TEST_ASSERT(inSuite, !index.FindCluster(&type, 2, CLUSTER_MASK_SERVER | CLUSTER_MASK_CLIENT, &cluster));
+}
+
+void TestSharedClusters(nlTestSuite * inSuite, void * inContext)
+{
+    const EmberAfCluster shared[] = {
+        MakeCluster(1, kAttributesA, 6, CLUSTER_MASK_SERVER),
+        MakeCluster(2, kAttributesB, 2, CLUSTER_MASK_SERVER),
+    };
+    const EmberAfCluster other[] = {
+        MakeCluster(2, kAttributesB, 2, CLUSTER_MASK_SERVER),
+    };
+    const EmberAfEndpointType first  = { shared, 2, 0 };
+    const EmberAfEndpointType second = { shared, 2, 0 };
+    const EmberAfEndpointType third  = { other, 1, 0 };
+
+    // Each endpoint type takes one entry, plus two per server cluster, and each cluster one entry, plus one per attribute
+    // id (kAttributesA repeats one).
+    EndpointTypeIndex<13, 13> index;
+    NL_TEST_ASSERT(inSuite, index.Add(&first));
+    NL_TEST_ASSERT(inSuite, index.ClusterEntryCount() == 5);
+    NL_TEST_ASSERT(inSuite, index.AttributeEntryCount() == 9);
+
+    // The attributes of clusters shared between endpoint types are only recorded once.
+    NL_TEST_ASSERT(inSuite, index.Add(&second));
+    NL_TEST_ASSERT(inSuite, index.ClusterEntryCount() == 10);
+    NL_TEST_ASSERT(inSuite, index.AttributeEntryCount() == 9);
+    NL_TEST_ASSERT(inSuite, index.Add(&third));
+    NL_TEST_ASSERT(inSuite, index.AttributeEntryCount() == 12);
+
+    index.Remove(&first);
+    NL_TEST_ASSERT(inSuite, !index.Contains(&first));
+    NL_TEST_ASSERT(inSuite, index.AttributeEntryCount() == 12);
+    CheckMatchesScan(inSuite, index, &second);
+    CheckMatchesScan(inSuite, index, &third);
+
+    index.Remove(&second);
+    NL_TEST_ASSERT(inSuite, index.ClusterEntryCount() == 3);
+    NL_TEST_ASSERT(inSuite, index.AttributeEntryCount() == 3);
+
+    const EmberAfAttributeMetadata * am;
+    NL_TEST_ASSERT(inSuite, !index.FindAttribute(&shared[0], 1, &am));
+    CheckMatchesScan(inSuite, index, &third);
+}
+
+void TestCapacity(nlTestSuite * inSuite, void * inContext)
+{
+    const EmberAfCluster clusters[] = {
+        MakeCluster(1, kAttributesA, 6, CLUSTER_MASK_SERVER),
+        MakeCluster(2, kAttributesB, 2, CLUSTER_MASK_SERVER),
+    };
+    const EmberAfEndpointType type = { clusters, 2, 0 };
+
+    // An endpoint type that does not fit is not recorded at all, and look-ups in it are left to the caller.
+    EndpointTypeIndex<8, 9> index;
+    NL_TEST_ASSERT(inSuite, !index.Add(&type));
+    NL_TEST_ASSERT(inSuite, index.ClusterEntryCount() == 0);
+    NL_TEST_ASSERT(inSuite, index.AttributeEntryCount() == 0);
+
+    const EmberAfCluster * cluster;
+    const EmberAfAttributeMetadata * am;
+    NL_TEST_ASSERT(inSuite, !index.FindCluster(&type, 1, CLUSTER_MASK_SERVER, &cluster));
+    NL_TEST_ASSERT(inSuite, !index.FindAttribute(&clusters[0], 3, &am));
+
+    // A disabled index never records anything.
+    EndpointTypeIndex<0, 0> disabled;
+    NL_TEST_ASSERT(inSuite, !disabled.Add(&type));
+    NL_TEST_ASSERT(inSuite, !disabled.FindCluster(&type, 1, CLUSTER_MASK_SERVER, &cluster));
+}
+
+void TestAddRemoveMany(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr size_t kTypeCount     = 24;
+    const EmberAfCluster clusters[] = {
+        MakeCluster(1, kAttributesA, 6, CLUSTER_MASK_SERVER),
+        MakeCluster(2, kAttributesB, 2, CLUSTER_MASK_CLIENT),
+        MakeCluster(3, kAttributesB, 2, CLUSTER_MASK_SERVER | CLUSTER_MASK_CLIENT),
+    };
+    EmberAfEndpointType types[kTypeCount];
+    for (size_t i = 0; i < kTypeCount; i++)
+    {
+        // Endpoint types using different subsets of the clusters.
+        types[i] = { &clusters[i % 2], static_cast<uint8_t>(1 + i % 2), 0 };
+    }
+
+    // Removing entries from a table this full moves many of the entries that collided with them.
+    EndpointTypeIndex<kTypeCount * 6, 16> index;
+    for (size_t round = 0; round < 3; round++)
+    {
+        for (size_t i = 0; i < kTypeCount; i++)
+        {
+            NL_TEST_ASSERT(inSuite, index.Add(&types[i]));
+        }
+        for (size_t i = round % 2; i < kTypeCount; i += 2)
+        {
+            index.Remove(&types[i]);
+        }
+        for (size_t i = 0; i < kTypeCount; i++)
+        {
+            NL_TEST_ASSERT(inSuite, index.Contains(&types[i]) == ((i % 2) != (round % 2)));
+            if (index.Contains(&types[i]))
+            {
+                CheckMatchesScan(inSuite, index, &types[i]);
+            }
+        }
+    }
+
+    for (auto & type : types)
+    {
+        index.Remove(&type);
+    }
+    NL_TEST_ASSERT(inSuite, index.ClusterEntryCount() == 0);
+    NL_TEST_ASSERT(inSuite, index.AttributeEntryCount() == 0);
+}
+
+template <size_t... kIndices>
+constexpr std::array<EmberAfAttributeMetadata, sizeof...(kIndices)> MakeBenchmarkAttributes(std::index_sequence<kIndices...>)
+{
+    return { { MakeAttribute(static_cast<AttributeId>(kIndices * 3 + 1), 4)... } };
+}
+
+constexpr auto kBenchmarkAttributes = MakeBenchmarkAttributes(std::make_index_sequence<kBenchmarkAttributeCount>());
+
+void TestLookupBenchmark(nlTestSuite * inSuite, void * inContext)
+{
+    static EmberAfCluster sClusters[kBenchmarkTypeCount][kBenchmarkClusterCount];
+    static EmberAfEndpointType sTypes[kBenchmarkTypeCount];
+    static EndpointId sEndpoints[kBenchmarkEndpointCount];
+    static const EmberAfEndpointType * sEndpointTypes[kBenchmarkEndpointCount];
+    static EndpointIndex<kBenchmarkEndpointCount> sEndpointIndex;
+    static EndpointTypeIndex<kBenchmarkTypeCount * (2 * kBenchmarkClusterCount + 1),
+                             kBenchmarkTypeCount * kBenchmarkClusterCount * (kBenchmarkAttributeCount + 1)>
+        sIndex;
+
+    for (uint8_t t = 0; t < kBenchmarkTypeCount; t++)
+    {
+        for (uint8_t i = 0; i < kBenchmarkClusterCount; i++)
+        {
+            sClusters[t][i] = MakeCluster(static_cast<ClusterId>(0x1000 - i * 5), kBenchmarkAttributes.data(),
+                                          kBenchmarkAttributeCount, CLUSTER_MASK_SERVER);
+        }
+        sTypes[t] = { sClusters[t], kBenchmarkClusterCount, 0 };
+        NL_TEST_ASSERT(inSuite, sIndex.Add(&sTypes[t]));
+    }
+
+    // A bridge exposing hundreds of endpoints of a few device types.
+    for (uint16_t slot = 0; slot < kBenchmarkEndpointCount; slot++)
+    {
+        sEndpoints[slot]     = static_cast<EndpointId>((slot * 7u) % kBenchmarkEndpointCount + 1);
+        sEndpointTypes[slot] = &sTypes[slot % kBenchmarkTypeCount];
+        NL_TEST_ASSERT(inSuite, sEndpointIndex.Insert(sEndpoints[slot], slot));
+    }
+
+    auto & clock     = System::SystemClock();
+    size_t linearSum = 0;
+    size_t indexSum  = 0;
+
+    System::Clock::Microseconds64 start = clock.GetMonotonicMicroseconds64();
+    for (size_t round = 0; round < kBenchmarkLookupRounds; round++)
+    {
+        for (EndpointId endpoint = 1; endpoint <= kBenchmarkEndpointCount; endpoint++)
+        {
+            for (uint8_t i = 0; i < kBenchmarkClusterCount; i++)
+            {
+                // This is what emAfReadOrWriteAttribute used to do.
+                uint16_t slot = 0;
+                while (sEndpoints[slot] != endpoint)
+                {
+                    slot++;
+                }
+                uint8_t clusterIndex           = 0;
+                uint16_t clusterOffset         = 0;
+                uint16_t attributeOffset       = 0;
+                const EmberAfCluster * cluster = ScanCluster(sEndpointTypes[slot], sClusters[0][i].clusterId, CLUSTER_MASK_SERVER,
+                                                             &clusterIndex, &clusterOffset);
+                ScanAttribute(cluster, kBenchmarkAttributes[(endpoint + i) % kBenchmarkAttributeCount].attributeId,
+                              &attributeOffset);
+                linearSum += static_cast<size_t>(slot + clusterOffset + attributeOffset);
+            }
+        }
+    }
+    System::Clock::Microseconds64 linear = clock.GetMonotonicMicroseconds64() - start;
+
+    start = clock.GetMonotonicMicroseconds64();
+    for (size_t round = 0; round < kBenchmarkLookupRounds; round++)
+    {
+        for (EndpointId endpoint = 1; endpoint <= kBenchmarkEndpointCount; endpoint++)
+        {
+            for (uint8_t i = 0; i < kBenchmarkClusterCount; i++)
+            {
+                uint16_t slot                       = sEndpointIndex.Find(endpoint);
+                const EmberAfCluster * cluster      = nullptr;
+                const EmberAfAttributeMetadata * am = nullptr;
+                uint16_t clusterOffset              = 0;
+                uint16_t attributeOffset            = 0;
+                sIndex.FindCluster(sEndpointTypes[slot], sClusters[0][i].clusterId, CLUSTER_MASK_SERVER, &cluster, nullptr,
+                                   &clusterOffset);
+                sIndex.FindAttribute(cluster, kBenchmarkAttributes[(endpoint + i) % kBenchmarkAttributeCount].attributeId, &am,
+                                     &attributeOffset);
+                indexSum += static_cast<size_t>(slot + clusterOffset + attributeOffset);
+            }
+        }
+    }
+    System::Clock::Microseconds64 indexed = clock.GetMonotonicMicroseconds64() - start;
+
+    NL_TEST_ASSERT(inSuite, linearSum == indexSum);
+
+    // Timings are reported rather than asserted on, since they depend on the host.
+    constexpr size_t kLookups = kBenchmarkLookupRounds * kBenchmarkEndpointCount * kBenchmarkClusterCount;
+    ChipLogProgress(DataManagement,
+                    "Attribute lookup over %u endpoints of %u clusters of %u attributes: linear scan %u ns, index %u ns",
+                    static_cast<unsigned>(kBenchmarkEndpointCount), static_cast<unsigned>(kBenchmarkClusterCount),
+                    static_cast<unsigned>(kBenchmarkAttributeCount), static_cast<unsigned>(linear.count() * 1000 / kLookups),
+                    static_cast<unsigned>(indexed.count() * 1000 / kLookups));
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("Look-ups match a scan of the endpoint type", TestMatchesScan),
+    NL_TEST_DEF("Clusters shared between endpoint types", TestSharedClusters),
+    NL_TEST_DEF("Endpoint types that do not fit", TestCapacity),
+    NL_TEST_DEF("Add and remove many endpoint types", TestAddRemoveMany),
+    NL_TEST_DEF("Attribute lookup benchmark", TestLookupBenchmark),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+} // namespace
+
+int TestEndpointTypeIndex()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "Test for the cluster and attribute index of the attribute storage",
+        &sTests[0],
+        nullptr,
+        nullptr
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestEndpointTypeIndex)
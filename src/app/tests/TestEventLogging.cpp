@@ -47,9 +47,12 @@
 
 #include <nlunit-test.h>
 
+#include <vector>
+
 namespace {
 
 static const chip::ClusterId kLivenessClusterId   = 0x00000022;
+static const chip::ClusterId kOtherClusterId      = 0x00000028;
 static const uint32_t kLivenessChangeEvent        = 1;
 static const chip::EndpointId kTestEndpointId1    = 2;
 static const chip::EndpointId kTestEndpointId2    = 3;
@@ -59,6 +62,9 @@ static uint8_t gDebugEventBuffer[120];
 static uint8_t gInfoEventBuffer[120];
 static uint8_t gCritEventBuffer[120];
 static chip::app::CircularEventBuffer gCircularEventBuffer[3];
+static chip::app::EventIndexEntry gDebugEventIndex[8];
+static chip::app::EventIndexEntry gInfoEventIndex[8];
+static chip::app::EventIndexEntry gCritEventIndex[8];
 
 class TestContext : public chip::Test::AppContext
 {
@@ -311,9 +317,119 @@ static void CheckLogEventWithDiscardLowEvent(nlTestSuite * apSuite, void * apCon
     CheckLogState(apSuite, logMgmt, 3, chip::app::PriorityLevel::Debug);
 }
 
+/**
+ * Log a mix of events that get evicted to the next buffers or dropped, and after each of them record what fetches with a few
+ * path filters and starting event numbers return: the event numbers fetched, then the next event number to fetch.
+ */
+static void LogAndFetchEvents(nlTestSuite * apSuite, TestContext & aContext, const chip::app::LogStorageResources * apResources,
+                              std::vector<chip::EventNumber> & aFetched)
+{
+    chip::MonotonicallyIncreasingCounter<chip::EventNumber> eventCounter;
+    NL_TEST_ASSERT(apSuite, eventCounter.Init(0) == CHIP_NO_ERROR);
+    chip::app::EventManagement::DestroyEventManagement();
+    chip::app::EventManagement::CreateEventManagement(&aContext.GetExchangeManager(), ArraySize(gCircularEventBuffer),
+                                                      gCircularEventBuffer, apResources, &eventCounter);
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+
+    chip::SingleLinkedListNode<chip::app::EventPathParams> endpointPath;
+    endpointPath.mValue.mEndpointId = kTestEndpointId1;
+    endpointPath.mValue.mClusterId  = kLivenessClusterId;
+    chip::SingleLinkedListNode<chip::app::EventPathParams> clusterPath;
+    clusterPath.mValue.mClusterId = kOtherClusterId;
+    chip::SingleLinkedListNode<chip::app::EventPathParams> wildcardPath;
+    const chip::SingleLinkedListNode<chip::app::EventPathParams> * pathLists[] = { &endpointPath, &clusterPath, &wildcardPath };
+
+    const chip::app::PriorityLevel priorities[] = { chip::app::PriorityLevel::Debug, chip::app::PriorityLevel::Info,
+                                                    chip::app::PriorityLevel::Debug, chip::app::PriorityLevel::Critical };
+    TestEventGenerator testEventGenerator;
+    for (uint32_t i = 0; i < 64; i++)
+    {
+        const chip::EndpointId endpointId = (i % 3 == 0) ? kTestEndpointId1 : kTestEndpointId2;
+        const chip::ClusterId clusterId   = (i % 5 == 0) ? kOtherClusterId : kLivenessClusterId;
+        chip::EventNumber eventNumber;
+        chip::app::EventOptions options;
+        options.mPath     = { endpointId, clusterId, kLivenessChangeEvent };
+        options.mPriority = priorities[(i * 7) % ArraySize(priorities)];
+        // Vary the encoded size of the events.
+        testEventGenerator.SetStatus(static_cast<int32_t>((i % 4) * 1000 * i));
+        NL_TEST_ASSERT(apSuite, logMgmt.LogEvent(&testEventGenerator, options, eventNumber) == CHIP_NO_ERROR);
+
+        for (auto * paths : pathLists)
+        {
+            for (chip::EventNumber eventMin : { chip::EventNumber(0), eventNumber / 2, eventNumber + 1 })
+            {
+                uint8_t backingStore[100]; // Not enough for all the events, to exercise running out of space.
+                chip::TLV::TLVWriter writer;
+                chip::TLV::TLVReader reader;
+                size_t eventCount = 0;
+
+                writer.Init(backingStore);
+                CHIP_ERROR err = logMgmt.FetchEventsSince(writer, paths, eventMin, eventCount, chip::Access::SubjectDescriptor{});
+                NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV || err == CHIP_ERROR_BUFFER_TOO_SMALL);
+
+                reader.Init(backingStore, writer.GetLengthWritten());
+                while (reader.Next() == CHIP_NO_ERROR)
+                {
+                    chip::app::EventReportIB::Parser report;
+                    chip::app::EventDataIB::Parser data;
+                    chip::EventNumber fetchedEventNumber = 0;
+                    NL_TEST_ASSERT(apSuite, report.Init(reader) == CHIP_NO_ERROR);
+                    NL_TEST_ASSERT(apSuite, report.GetEventData(&data) == CHIP_NO_ERROR);
+                    NL_TEST_ASSERT(apSuite, data.GetEventNumber(&fetchedEventNumber) == CHIP_NO_ERROR);
+                    aFetched.push_back(fetchedEventNumber);
+                }
+                aFetched.push_back(eventMin);
+            }
+        }
+    }
+    chip::app::EventManagement::DestroyEventManagement();
+}
+
+static void CheckIndexedLogReadOut(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+
+    const chip::app::LogStorageResources unindexedResources[] = {
+        { &gDebugEventBuffer[0], sizeof(gDebugEventBuffer), chip::app::PriorityLevel::Debug },
+        { &gInfoEventBuffer[0], sizeof(gInfoEventBuffer), chip::app::PriorityLevel::Info },
+        { &gCritEventBuffer[0], sizeof(gCritEventBuffer), chip::app::PriorityLevel::Critical },
+    };
+    const chip::app::LogStorageResources indexedResources[] = {
+        { &gDebugEventBuffer[0], sizeof(gDebugEventBuffer), chip::app::PriorityLevel::Debug, gDebugEventIndex,
+          ArraySize(gDebugEventIndex) },
+        { &gInfoEventBuffer[0], sizeof(gInfoEventBuffer), chip::app::PriorityLevel::Info, gInfoEventIndex,
+          ArraySize(gInfoEventIndex) },
+        { &gCritEventBuffer[0], sizeof(gCritEventBuffer), chip::app::PriorityLevel::Critical, gCritEventIndex,
+          ArraySize(gCritEventIndex) },
+    };
+    // Indices too small for the buffers: they get lost and rebuilt, and fetches fall back to walking the whole log.
+    const chip::app::LogStorageResources smallIndexResources[] = {
+        { &gDebugEventBuffer[0], sizeof(gDebugEventBuffer), chip::app::PriorityLevel::Debug, gDebugEventIndex, 2 },
+        { &gInfoEventBuffer[0], sizeof(gInfoEventBuffer), chip::app::PriorityLevel::Info, gInfoEventIndex, 2 },
+        { &gCritEventBuffer[0], sizeof(gCritEventBuffer), chip::app::PriorityLevel::Critical, gCritEventIndex, 2 },
+    };
+
+    std::vector<chip::EventNumber> expected;
+    std::vector<chip::EventNumber> fetched;
+    LogAndFetchEvents(apSuite, ctx, unindexedResources, expected);
+    NL_TEST_ASSERT(apSuite, !expected.empty());
+
+    LogAndFetchEvents(apSuite, ctx, indexedResources, fetched);
+    NL_TEST_ASSERT(apSuite, fetched == expected);
+    for (auto & buffer : gCircularEventBuffer)
+    {
+        NL_TEST_ASSERT(apSuite, buffer.IsIndexed());
+    }
+
+    fetched.clear();
+    LogAndFetchEvents(apSuite, ctx, smallIndexResources, fetched);
+    NL_TEST_ASSERT(apSuite, fetched == expected);
+}
+
 const nlTest sTests[] = {
     NL_TEST_DEF("CheckLogEventWithEvictToNextBuffer", CheckLogEventWithEvictToNextBuffer),
     NL_TEST_DEF("CheckLogEventWithDiscardLowEvent", CheckLogEventWithDiscardLowEvent),
+    NL_TEST_DEF("CheckIndexedLogReadOut", CheckIndexedLogReadOut),
     NL_TEST_SENTINEL(),
 };
 
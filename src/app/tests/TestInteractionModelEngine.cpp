@@ -48,6 +48,8 @@
 
 #include <nlunit-test.h>
 
+#include <algorithm>
+
 namespace {
 
 using TestContext = chip::Test::AppContext;
@@ -74,6 +76,7 @@ public:
     static void TestRemoveDuplicateConcreteAttribute(nlTestSuite * apSuite, void * apContext);
 #if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
     static void TestSubjectHasPersistedSubscription(nlTestSuite * apSuite, void * apContext);
+    static void TestSubscriptionResumptionQueueOrder(nlTestSuite * apSuite, void * apContext);
 #if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
     static void TestSubscriptionResumptionTimer(nlTestSuite * apSuite, void * apContext);
 #endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
@@ -650,6 +653,128 @@ void TestInteractionModelEngine::TestSubjectHasPersistedSubscription(nlTestSuite
     subscriptionStorage.DeleteAll(fabric2);
 }
 
+/**
+ * @brief Test verifies the order in which persisted subscriptions are queued for resumption, and that subscriptions whose
+ *        resumption is already in progress are not queued again.
+ */
+void TestInteractionModelEngine::TestSubscriptionResumptionQueueOrder(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx               = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err                  = CHIP_NO_ERROR;
+    InteractionModelEngine * engine = InteractionModelEngine::GetInstance();
+
+    chip::TestPersistentStorageDelegate storage;
+    chip::app::SimpleSubscriptionResumptionStorage subscriptionStorage;
+
+    err = subscriptionStorage.Init(&storage);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    err = engine->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable(), app::reporting::GetDefaultReportScheduler(), nullptr,
+                       &subscriptionStorage);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // Nothing to queue without persisted subscriptions.
+    NL_TEST_ASSERT(apSuite, engine->QueueSubscriptionsToResume() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT_EQUALS(apSuite, engine->mNumPendingSubscriptionResumptions, 0u);
+
+    constexpr FabricIndex kFabricIndex = 1;
+    struct
+    {
+        SubscriptionId subscriptionId;
+        uint16_t minInterval;
+        uint32_t resumptionRetries;
+    } subscriptions[] = { { 1, 30, 0 }, { 2, 10, 0 }, { 3, 10, 2 }, { 4, 30, 0 }, { 5, 5, 1 } };
+    for (const auto & subscription : subscriptions)
+    {
+        SubscriptionResumptionStorage::SubscriptionInfo info = { .mNodeId         = subscription.subscriptionId,
+                                                                 .mFabricIndex    = kFabricIndex,
+                                                                 .mSubscriptionId = subscription.subscriptionId,
+                                                                 .mMinInterval    = subscription.minInterval };
+#if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+        info.mResumptionRetries = subscription.resumptionRetries;
+#endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+        NL_TEST_ASSERT(apSuite, subscriptionStorage.Save(info) == CHIP_NO_ERROR);
+    }
+
+    // Subscriptions with fewer failed attempts and a shorter min interval come first; ties keep their storage order.
+#if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+    const SubscriptionId expectedOrder[] = { 2, 1, 4, 5, 3 };
+#else
+    const SubscriptionId expectedOrder[] = { 5, 2, 3, 1, 4 };
+#endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+    NL_TEST_ASSERT(apSuite, engine->QueueSubscriptionsToResume() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT_EQUALS(apSuite, engine->mNumPendingSubscriptionResumptions, ArraySize(expectedOrder));
+    for (size_t i = 0; i < engine->mNumPendingSubscriptionResumptions && i < ArraySize(expectedOrder); i++)
+    {
+        NL_TEST_ASSERT_EQUALS(apSuite, engine->mPendingSubscriptionResumptions[i].mSubscriptionId, expectedOrder[i]);
+    }
+
+    // A subscription whose session is still being established is not queued again.
+    engine->mSubscriptionResumptionAttempts[0].mSubscriptionId = 2;
+    engine->mNumSubscriptionResumptionAttempts                 = 1;
+    NL_TEST_ASSERT(apSuite, engine->QueueSubscriptionsToResume() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT_EQUALS(apSuite, engine->mNumPendingSubscriptionResumptions, ArraySize(expectedOrder) - 1);
+    for (size_t i = 0; i < engine->mNumPendingSubscriptionResumptions; i++)
+    {
+        NL_TEST_ASSERT(apSuite, engine->mPendingSubscriptionResumptions[i].mSubscriptionId != 2);
+    }
+
+    // Completing the attempt with nothing left to start releases the queue.
+    engine->mNextPendingSubscriptionResumption = engine->mNumPendingSubscriptionResumptions;
+    engine->OnSubscriptionResumptionAttemptDone(2, CHIP_NO_ERROR);
+    NL_TEST_ASSERT_EQUALS(apSuite, engine->mNumSubscriptionResumptionAttempts, 0u);
+    NL_TEST_ASSERT_EQUALS(apSuite, engine->mNumPendingSubscriptionResumptions, 0u);
+
+    // At most CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_CONCURRENT_ATTEMPTS resumptions run at once, and the next queued one
+    // only starts once an attempt is done. The attempts are left pending rather than establishing CASE sessions.
+    CASESessionManager caseSessionManager;
+    engine->mpCASESessionMgr                                = &caseSessionManager;
+    engine->mSkipSubscriptionResumptionSessionEstablishment = true;
+
+    NL_TEST_ASSERT(apSuite, engine->QueueSubscriptionsToResume() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT_EQUALS(apSuite, engine->mNumPendingSubscriptionResumptions, ArraySize(expectedOrder));
+    const size_t maxAttempts =
+        std::min<size_t>(CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_CONCURRENT_ATTEMPTS, ArraySize(expectedOrder));
+    for (size_t i = 0; i < ArraySize(expectedOrder); i++)
+    {
+        engine->ResumeNextSubscription();
+    }
+    NL_TEST_ASSERT_EQUALS(apSuite, engine->mNumSubscriptionResumptionAttempts, maxAttempts);
+    NL_TEST_ASSERT_EQUALS(apSuite, engine->mNextPendingSubscriptionResumption, maxAttempts);
+    for (size_t i = 0; i < maxAttempts; i++)
+    {
+        NL_TEST_ASSERT(apSuite, engine->IsSubscriptionResumptionInProgress(expectedOrder[i]));
+    }
+
+    for (size_t started = maxAttempts; started < ArraySize(expectedOrder); started++)
+    {
+        engine->ResumeNextSubscription();
+        NL_TEST_ASSERT_EQUALS(apSuite, engine->mNextPendingSubscriptionResumption, started);
+
+        engine->OnSubscriptionResumptionAttemptDone(expectedOrder[started - maxAttempts], CHIP_NO_ERROR);
+        NL_TEST_ASSERT_EQUALS(apSuite, engine->mNumSubscriptionResumptionAttempts, maxAttempts - 1);
+        engine->ResumeNextSubscription();
+        NL_TEST_ASSERT_EQUALS(apSuite, engine->mNumSubscriptionResumptionAttempts, maxAttempts);
+        NL_TEST_ASSERT_EQUALS(apSuite, engine->mNextPendingSubscriptionResumption, started + 1);
+        NL_TEST_ASSERT(apSuite, engine->IsSubscriptionResumptionInProgress(expectedOrder[started]));
+    }
+
+    // The queue is released once the last attempt is done.
+    for (size_t i = ArraySize(expectedOrder) - maxAttempts; i < ArraySize(expectedOrder); i++)
+    {
+        engine->OnSubscriptionResumptionAttemptDone(expectedOrder[i], CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT_EQUALS(apSuite, engine->mNumSubscriptionResumptionAttempts, 0u);
+    NL_TEST_ASSERT_EQUALS(apSuite, engine->mNumPendingSubscriptionResumptions, 0u);
+
+    ctx.GetSystemLayer().CancelTimer(InteractionModelEngine::ResumeNextSubscriptionTimerCallback, engine);
+    engine->mSkipSubscriptionResumptionSessionEstablishment = false;
+    engine->mpCASESessionMgr                                = nullptr;
+
+    // Clean Up entries
+    subscriptionStorage.DeleteAll(kFabricIndex);
+}
+
 #if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
 
 void TestInteractionModelEngine::TestSubscriptionResumptionTimer(nlTestSuite * apSuite, void * apContext)
@@ -754,6 +879,7 @@ const nlTest sTests[] =
                 NL_TEST_DEF("TestRemoveDuplicateConcreteAttribute", chip::app::TestInteractionModelEngine::TestRemoveDuplicateConcreteAttribute),
 #if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
                 NL_TEST_DEF("TestSubjectHasPersistedSubscription", chip::app::TestInteractionModelEngine::TestSubjectHasPersistedSubscription),
+                NL_TEST_DEF("TestSubscriptionResumptionQueueOrder", chip::app::TestInteractionModelEngine::TestSubscriptionResumptionQueueOrder),
                 NL_TEST_DEF("TestDecrementNumSubscriptionsToResume", chip::app::TestInteractionModelEngine::TestDecrementNumSubscriptionsToResume),
 #if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
                 NL_TEST_DEF("TestSubscriptionResumptionTimer", chip::app::TestInteractionModelEngine::TestSubscriptionResumptionTimer),
@@ -303,7 +303,8 @@ namespace app {
 
 CHIP_ERROR ReadSingleClusterData(const Access::SubjectDescriptor & aSubjectDescriptor, bool aIsFabricFiltered,
                                  const ConcreteReadAttributePath & aPath, AttributeReportIBs::Builder & aAttributeReports,
-                                 AttributeValueEncoder::AttributeEncodeState * apEncoderState)
+                                 AttributeValueEncoder::AttributeEncodeState * apEncoderState,
+                                 ClusterAccessCheckCache * apAccessCheckCache)
 {
     if (aPath.mClusterId >= Test::kMockEndpointMin)
     {
@@ -57,6 +57,8 @@ public:
     static void TestBuildAndSendSingleReportData(nlTestSuite * apSuite, void * apContext);
     static void TestMergeOverlappedAttributePath(nlTestSuite * apSuite, void * apContext);
     static void TestMergeAttributePathWhenDirtySetPoolExhausted(nlTestSuite * apSuite, void * apContext);
+    static void TestDirtySetIndex(nlTestSuite * apSuite, void * apContext);
+    static void TestSetDirtyWithEventOnlyHandler(nlTestSuite * apSuite, void * apContext);
 
 private:
     static bool InsertToDirtySet(const AttributePathParams & aPath);
@@ -180,10 +182,11 @@ void TestReportingEngine::TestMergeOverlappedAttributePath(nlTestSuite * apSuite
                                                                     app::reporting::GetDefaultReportScheduler());
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
 
-    AttributePathParams * clusterInfo = InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.CreateObject();
-    clusterInfo->mEndpointId          = 1;
-    clusterInfo->mClusterId           = 1;
-    clusterInfo->mAttributeId         = 1;
+    auto * clusterInfo        = InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.CreateObject();
+    clusterInfo->mEndpointId  = 1;
+    clusterInfo->mClusterId   = 1;
+    clusterInfo->mAttributeId = 1;
+    InteractionModelEngine::GetInstance()->GetReportingEngine().IndexDirtyPath(clusterInfo);
 
     {
         AttributePathParams testClusterInfo;
@@ -241,6 +244,7 @@ bool TestReportingEngine::InsertToDirtySet(const AttributePathParams & aPath)
     VerifyOrReturnError(path != nullptr, false);
     *path             = aPath;
     path->mGeneration = InteractionModelEngine::GetInstance()->GetReportingEngine().GetDirtySetGeneration();
+    InteractionModelEngine::GetInstance()->GetReportingEngine().IndexDirtyPath(path);
     return true;
 }
 
@@ -252,7 +256,7 @@ void TestReportingEngine::TestMergeAttributePathWhenDirtySetPoolExhausted(nlTest
                                                                     app::reporting::GetDefaultReportScheduler());
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
 
-    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ReleaseAll();
+    InteractionModelEngine::GetInstance()->GetReportingEngine().ClearDirtySet();
     InteractionModelEngine::GetInstance()->GetReportingEngine().BumpDirtySetGeneration();
 
     // Case 1: All dirty paths including the new one are under the same cluster.
@@ -267,7 +271,7 @@ void TestReportingEngine::TestMergeAttributePathWhenDirtySetPoolExhausted(nlTest
                            AttributePathParams(kTestEndpointId, kTestClusterId, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1)));
     NL_TEST_ASSERT(apSuite, VerifyDirtySetContent(AttributePathParams(kTestEndpointId, kTestClusterId)));
 
-    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ReleaseAll();
+    InteractionModelEngine::GetInstance()->GetReportingEngine().ClearDirtySet();
 
     // Case 2: All dirty paths including the new one are under the same endpoint.
     // -> Expected behavior: The dirty set is replaced by a wildcard cluster path under the same endpoint.
@@ -281,7 +285,7 @@ void TestReportingEngine::TestMergeAttributePathWhenDirtySetPoolExhausted(nlTest
                            AttributePathParams(kTestEndpointId, ClusterId(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1), 1)));
     NL_TEST_ASSERT(apSuite, VerifyDirtySetContent(AttributePathParams(kTestEndpointId, kInvalidClusterId)));
 
-    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ReleaseAll();
+    InteractionModelEngine::GetInstance()->GetReportingEngine().ClearDirtySet();
 
     // Case 3: All dirty paths including the new one are under the different endpoints.
     // -> Expected behavior: The dirty set is replaced by a wildcard endpoint.
@@ -295,7 +299,7 @@ void TestReportingEngine::TestMergeAttributePathWhenDirtySetPoolExhausted(nlTest
                            AttributePathParams(EndpointId(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1), 1, 1)));
     NL_TEST_ASSERT(apSuite, VerifyDirtySetContent(AttributePathParams()));
 
-    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ReleaseAll();
+    InteractionModelEngine::GetInstance()->GetReportingEngine().ClearDirtySet();
 
     // Case 4: All existing dirty paths are under the same cluster, the new path comes from another cluster.
     // -> Expected behavior: The existing paths are merged into one single wildcard attribute path. New path is inserted as-is.
@@ -311,7 +315,7 @@ void TestReportingEngine::TestMergeAttributePathWhenDirtySetPoolExhausted(nlTest
                    VerifyDirtySetContent(AttributePathParams(kTestEndpointId, kTestClusterId),
                                          AttributePathParams(kTestEndpointId + 1, kTestClusterId + 1, 1)));
 
-    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ReleaseAll();
+    InteractionModelEngine::GetInstance()->GetReportingEngine().ClearDirtySet();
 
     // Case 5: All existing dirty paths are under the same endpoint, the new path comes from another endpoint.
     // -> Expected behavior: The existing paths are merged into one single wildcard cluster path. New path is inserted as-is.
@@ -330,6 +334,115 @@ void TestReportingEngine::TestMergeAttributePathWhenDirtySetPoolExhausted(nlTest
     InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
 }
 
+void TestReportingEngine::TestDirtySetIndex(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+    err               = InteractionModelEngine::GetInstance()->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable(),
+                                                                    app::reporting::GetDefaultReportScheduler());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    Engine & engine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    engine.ClearDirtySet();
+    engine.BumpDirtySetGeneration();
+
+    auto countDirtyPathsUnder = [&engine](EndpointId endpoint, ClusterId cluster, const AttributePathParams & aReadPath) {
+        size_t count = 0;
+        engine.ForEachDirtyPathUnder(endpoint, cluster, [&](auto * path) {
+            count += path->IsAttributePathSupersetOf(aReadPath) ? 1 : 0;
+            return Loop::Continue;
+        });
+        return count;
+    };
+
+    NL_TEST_ASSERT(apSuite, engine.InsertPathIntoDirtySet(AttributePathParams(EndpointId(1), kTestClusterId, 1)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, engine.InsertPathIntoDirtySet(AttributePathParams(EndpointId(2), kTestClusterId, 1)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, engine.InsertPathIntoDirtySet(AttributePathParams(EndpointId(1), kTestClusterId + 1)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, engine.GetGlobalDirtySetSize() == 3);
+
+    // Concrete paths are found through the bucket of their cluster.
+    NL_TEST_ASSERT(apSuite, countDirtyPathsUnder(1, kTestClusterId, AttributePathParams(EndpointId(1), kTestClusterId, 1)) == 1);
+    NL_TEST_ASSERT(apSuite, countDirtyPathsUnder(2, kTestClusterId, AttributePathParams(EndpointId(2), kTestClusterId, 1)) == 1);
+    NL_TEST_ASSERT(apSuite,
+                   countDirtyPathsUnder(1, kTestClusterId + 1, AttributePathParams(EndpointId(1), kTestClusterId + 1, 7)) == 1);
+    NL_TEST_ASSERT(apSuite, countDirtyPathsUnder(3, kTestClusterId, AttributePathParams(EndpointId(3), kTestClusterId, 1)) == 0);
+
+    // Merging into an existing path, or widening it within its cluster, keeps it indexed.
+    NL_TEST_ASSERT(apSuite, engine.MergeOverlappedAttributePath(AttributePathParams(EndpointId(1), kTestClusterId + 1, 3)));
+    NL_TEST_ASSERT(apSuite, !engine.MergeOverlappedAttributePath(AttributePathParams(EndpointId(2), kTestClusterId, 2)));
+    NL_TEST_ASSERT(apSuite, engine.MergeOverlappedAttributePath(AttributePathParams(EndpointId(2), kTestClusterId)));
+    NL_TEST_ASSERT(apSuite, countDirtyPathsUnder(2, kTestClusterId, AttributePathParams(EndpointId(2), kTestClusterId, 2)) == 1);
+    NL_TEST_ASSERT(apSuite, engine.GetGlobalDirtySetSize() == 3);
+
+    // A path widened to a wildcard endpoint covers the cluster on every endpoint.
+    AttributePathParams wildcardEndpointPath;
+    wildcardEndpointPath.mClusterId   = kTestClusterId;
+    wildcardEndpointPath.mAttributeId = 1;
+    NL_TEST_ASSERT(apSuite, engine.InsertPathIntoDirtySet(wildcardEndpointPath) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, countDirtyPathsUnder(3, kTestClusterId, AttributePathParams(EndpointId(3), kTestClusterId, 1)) == 1);
+    NL_TEST_ASSERT(apSuite, countDirtyPathsUnder(3, kTestClusterId, AttributePathParams(EndpointId(3), kTestClusterId, 2)) == 0);
+    NL_TEST_ASSERT(apSuite, engine.MergeOverlappedAttributePath(AttributePathParams(EndpointId(5), kTestClusterId, 1)));
+
+    engine.ClearDirtySet();
+    NL_TEST_ASSERT(apSuite, countDirtyPathsUnder(2, kTestClusterId, AttributePathParams(EndpointId(2), kTestClusterId, 2)) == 0);
+
+    engine.Shutdown();
+}
+
+void TestReportingEngine::TestSetDirtyWithEventOnlyHandler(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx                 = *static_cast<TestContext *>(apContext);
+    InteractionModelEngine * imEngine = InteractionModelEngine::GetInstance();
+    CHIP_ERROR err = imEngine->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable(), app::reporting::GetDefaultReportScheduler());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    Engine & engine = imEngine->GetReportingEngine();
+    engine.ClearDirtySet();
+    engine.BumpDirtySetGeneration();
+
+    TestExchangeDelegate delegate;
+    ReadHandler * eventHandler = imEngine->mReadHandlers.CreateObject(*imEngine, ctx.NewExchangeToAlice(&delegate),
+                                                                      ReadHandler::InteractionType::Subscribe,
+                                                                      app::reporting::GetDefaultReportScheduler());
+    ReadHandler * attributeHandler = imEngine->mReadHandlers.CreateObject(*imEngine, ctx.NewExchangeToAlice(&delegate),
+                                                                          ReadHandler::InteractionType::Subscribe,
+                                                                          app::reporting::GetDefaultReportScheduler());
+    NL_TEST_ASSERT(apSuite, eventHandler != nullptr && attributeHandler != nullptr);
+
+    // One subscription only has event paths, the other has an attribute path.
+    EventPathParams eventPath(kTestEndpointId, kTestClusterId, 1);
+    AttributePathParams attributePath(kTestEndpointId, kTestClusterId, kTestFieldId1);
+    err = imEngine->PushFrontEventPathParamsList(eventHandler->mpEventPathList, eventPath);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    err = imEngine->PushFrontAttributePathList(attributeHandler->mpAttributePathList, attributePath);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    engine.AddReadHandlerInterests(attributeHandler);
+    eventHandler->MoveToState(ReadHandler::HandlerState::CanStartReporting);
+    attributeHandler->MoveToState(ReadHandler::HandlerState::CanStartReporting);
+    eventHandler->ClearForceDirtyFlag();
+    attributeHandler->ClearForceDirtyFlag();
+
+    // Both handlers are accounted for in the interest index, so SetDirty goes through it.
+    NL_TEST_ASSERT(apSuite, engine.mIndexedReadHandlerCount == imEngine->mReadHandlers.Allocated());
+
+    AttributePathParams otherPath(kTestEndpointId, kTestClusterId, kTestFieldId2);
+    NL_TEST_ASSERT(apSuite, engine.SetDirty(otherPath) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, !attributeHandler->IsDirty());
+    NL_TEST_ASSERT(apSuite, engine.GetGlobalDirtySetSize() == 0);
+
+    AttributePathParams dirtyPath(kTestEndpointId, kTestClusterId, kTestFieldId1);
+    NL_TEST_ASSERT(apSuite, engine.SetDirty(dirtyPath) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, attributeHandler->IsDirty());
+    NL_TEST_ASSERT(apSuite, !eventHandler->IsDirty());
+    NL_TEST_ASSERT(apSuite, engine.GetGlobalDirtySetSize() == 1);
+
+    imEngine->mReadHandlers.ReleaseObject(eventHandler);
+    imEngine->mReadHandlers.ReleaseObject(attributeHandler);
+    NL_TEST_ASSERT(apSuite, engine.mIndexedReadHandlerCount == 0);
+
+    engine.Shutdown();
+}
+
 } // namespace reporting
 } // namespace app
 } // namespace chip
@@ -341,6 +454,8 @@ const nlTest sTests[] =
     NL_TEST_DEF("CheckBuildAndSendSingleReportData", chip::app::reporting::TestReportingEngine::TestBuildAndSendSingleReportData),
     NL_TEST_DEF("TestMergeOverlappedAttributePath", chip::app::reporting::TestReportingEngine::TestMergeOverlappedAttributePath),
     NL_TEST_DEF("TestMergeAttributePathWhenDirtySetPoolExhausted", chip::app::reporting::TestReportingEngine::TestMergeAttributePathWhenDirtySetPoolExhausted),
+    NL_TEST_DEF("TestDirtySetIndex", chip::app::reporting::TestReportingEngine::TestDirtySetIndex),
+    NL_TEST_DEF("TestSetDirtyWithEventOnlyHandler", chip::app::reporting::TestReportingEngine::TestSetDirtyWithEventOnlyHandler),
     NL_TEST_SENTINEL()
 };
 // clang-format on
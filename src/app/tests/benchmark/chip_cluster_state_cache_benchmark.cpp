@@ -0,0 +1,305 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements chip-cluster-state-cache-benchmark, which measures the memory and
+ *      access costs of ClusterStateCache for a controller caching the wildcard subscriptions of
+ *      many nodes: one cache per node, filled by a priming report and then kept up to date by
+ *      reports changing some of the attributes.
+ *
+ *      Heap usage is sampled from the C library allocator, so it covers every allocation the
+ *      caches make. Only the public API of ClusterStateCache is used, so that the results of
+ *      different implementations of the cache can be compared.
+ *
+ */
+
+#include <app/ClusterStateCache.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/tests/BenchmarkSupport.h>
+
+#include <algorithm>
+#include <inttypes.h>
+#include <malloc.h>
+#include <memory>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::Benchmark;
+
+namespace {
+
+#define TOOL_NAME "chip-cluster-state-cache-benchmark"
+
+constexpr size_t kMaxValueSize = 1024;
+
+struct BenchmarkOptions
+{
+    uint32_t nodeCount       = 200;
+    uint32_t endpointCount   = 4;
+    uint32_t clusterCount    = 12;
+    uint32_t attributeCount  = 10;
+    uint32_t valueSize       = 24;
+    uint32_t reportCount     = 20;
+    uint32_t changePerReport = 10;
+} gOptions;
+
+const char * const gCmdOptionHelp =
+    "   --nodes <count>\n"
+    "       Number of nodes, each with its own cache. Defaults to 200.\n"
+    "\n"
+    "   --endpoints <count>\n"
+    "       Number of endpoints of each node. Defaults to 4.\n"
+    "\n"
+    "   --clusters <count>\n"
+    "       Number of clusters of each endpoint. Defaults to 12.\n"
+    "\n"
+    "   --attributes <count>\n"
+    "       Number of attributes of each cluster. Defaults to 10.\n"
+    "\n"
+    "   --value-size <bytes>\n"
+    "       Average size of the attribute values, which are octet strings of varying length. Defaults to 24.\n"
+    "\n"
+    "   --reports <count>\n"
+    "       Number of reports each cache receives after the priming report. Defaults to 20.\n"
+    "\n"
+    "   --changes <percent>\n"
+    "       Percentage of the attributes each of those reports changes. Defaults to 10.\n"
+    "\n";
+
+class NodeCallback : public ClusterStateCache::Callback
+{
+    void OnDone(ReadClient *) override {}
+};
+
+struct Node
+{
+    NodeCallback callback;
+    ClusterStateCache cache{ callback };
+};
+
+size_t HeapInUse()
+{
+    return mallinfo2().uordblks;
+}
+
+ConcreteAttributePath PathFor(uint32_t index)
+{
+    uint32_t attribute = index % gOptions.attributeCount;
+    uint32_t cluster   = index / gOptions.attributeCount % gOptions.clusterCount;
+    uint32_t endpoint  = index / gOptions.attributeCount / gOptions.clusterCount;
+    return ConcreteAttributePath(static_cast<EndpointId>(endpoint), static_cast<ClusterId>(0x100 + cluster),
+                                 static_cast<AttributeId>(attribute));
+}
+
+uint32_t AttributeCount()
+{
+    return gOptions.endpointCount * gOptions.clusterCount * gOptions.attributeCount;
+}
+
+CHIP_ERROR ReportValue(ReadClient::Callback & callback, const ConcreteAttributePath & path, uint32_t & random)
+{
+    static uint8_t sValue[kMaxValueSize];
+    uint8_t buf[kMaxValueSize + 8];
+
+    size_t valueSize = NextRandom(random) % (2 * gOptions.valueSize) + 1;
+    memset(sValue, static_cast<uint8_t>(random), valueSize);
+
+    TLV::TLVWriter writer;
+    writer.Init(buf);
+    ReturnErrorOnFailure(writer.Put(TLV::AnonymousTag(), ByteSpan(sValue, valueSize)));
+
+    TLV::TLVReader reader;
+    reader.Init(buf, writer.GetLengthWritten());
+    ReturnErrorOnFailure(reader.Next());
+
+    ConcreteDataAttributePath dataPath(path);
+    dataPath.mDataVersion.SetValue(random);
+    callback.OnAttributeData(dataPath, &reader, StatusIB());
+    return CHIP_NO_ERROR;
+}
+
+void PrintRate(const char * label, uint64_t elapsed, size_t operations, const char * unit)
+{
+    printf("  %-36s %8.1f ns/%s\n", label, static_cast<double>(elapsed) * 1000 / static_cast<double>(operations), unit);
+}
+
+void PrintHeap(const char * label, size_t bytes)
+{
+    size_t attributes = static_cast<size_t>(gOptions.nodeCount) * AttributeCount();
+    printf("  %-36s %10zu bytes, %6.1f bytes/attribute\n", label, bytes,
+           static_cast<double>(bytes) / static_cast<double>(attributes));
+}
+
+CHIP_ERROR RunClusterStateCache()
+{
+    const uint32_t attributeCount = AttributeCount();
+    uint32_t random               = 0x2545F491;
+    std::vector<std::unique_ptr<Node>> nodes;
+    nodes.reserve(gOptions.nodeCount);
+
+    printf("Nodes: %u, %u attributes each (%u endpoints, %u clusters per endpoint, %u attributes per cluster)\n",
+           static_cast<unsigned>(gOptions.nodeCount), static_cast<unsigned>(attributeCount),
+           static_cast<unsigned>(gOptions.endpointCount), static_cast<unsigned>(gOptions.clusterCount),
+           static_cast<unsigned>(gOptions.attributeCount));
+
+    // Priming reports: every attribute of every node, in path order.
+    size_t heapAtStart = HeapInUse();
+    uint64_t start     = NowMicroseconds();
+    for (uint32_t i = 0; i < gOptions.nodeCount; i++)
+    {
+        nodes.push_back(std::make_unique<Node>());
+        ReadClient::Callback & callback = nodes.back()->cache.GetBufferedCallback();
+        callback.OnReportBegin();
+        for (uint32_t index = 0; index < attributeCount; index++)
+        {
+            ReturnErrorOnFailure(ReportValue(callback, PathFor(index), random));
+        }
+        callback.OnReportEnd();
+    }
+    uint64_t elapsed = NowMicroseconds() - start;
+    PrintRate("priming reports", elapsed, static_cast<size_t>(gOptions.nodeCount) * attributeCount, "attribute");
+    PrintHeap("heap after priming", HeapInUse() - heapAtStart);
+
+    // Reports changing some attributes, in path order.
+    uint32_t changeCount = attributeCount * gOptions.changePerReport / 100;
+    if (gOptions.reportCount > 0 && changeCount > 0)
+    {
+        std::vector<uint32_t> changes(changeCount);
+        start = NowMicroseconds();
+        for (uint32_t report = 0; report < gOptions.reportCount; report++)
+        {
+            for (auto & node : nodes)
+            {
+                for (auto & change : changes)
+                {
+                    change = NextRandom(random) % attributeCount;
+                }
+                std::sort(changes.begin(), changes.end());
+
+                ReadClient::Callback & callback = node->cache.GetBufferedCallback();
+                callback.OnReportBegin();
+                for (auto change : changes)
+                {
+                    ReturnErrorOnFailure(ReportValue(callback, PathFor(change), random));
+                }
+                callback.OnReportEnd();
+            }
+        }
+        elapsed = NowMicroseconds() - start;
+        PrintRate("update reports", elapsed,
+                  static_cast<size_t>(gOptions.reportCount) * gOptions.nodeCount * changeCount, "attribute");
+        PrintHeap("heap after updates", HeapInUse() - heapAtStart);
+    }
+
+    // Reading every attribute value.
+    size_t valueBytes = 0;
+    start             = NowMicroseconds();
+    for (auto & node : nodes)
+    {
+        for (uint32_t index = 0; index < attributeCount; index++)
+        {
+            TLV::TLVReader reader;
+            ByteSpan value;
+            ReturnErrorOnFailure(node->cache.Get(PathFor(index), reader));
+            ReturnErrorOnFailure(reader.Get(value));
+            valueBytes += value.size();
+        }
+    }
+    elapsed = NowMicroseconds() - start;
+    PrintRate("Get", elapsed, static_cast<size_t>(gOptions.nodeCount) * attributeCount, "attribute");
+
+    // Iterating over the attributes of every cluster, as decoding cluster objects does.
+    size_t visited = 0;
+    start          = NowMicroseconds();
+    for (auto & node : nodes)
+    {
+        for (EndpointId endpoint = 0; endpoint < gOptions.endpointCount; endpoint++)
+        {
+            ReturnErrorOnFailure(node->cache.ForEachCluster(endpoint, [&](ClusterId cluster) {
+                return node->cache.ForEachAttribute(endpoint, cluster, [&](const ConcreteAttributePath & path) {
+                    visited++;
+                    return CHIP_NO_ERROR;
+                });
+            }));
+        }
+    }
+    elapsed = NowMicroseconds() - start;
+    PrintRate("ForEachAttribute(endpoint, cluster)", elapsed, visited, "attribute");
+
+    // Iterating over the instances of one cluster across endpoints.
+    visited = 0;
+    start   = NowMicroseconds();
+    for (auto & node : nodes)
+    {
+        for (uint32_t cluster = 0; cluster < gOptions.clusterCount; cluster++)
+        {
+            ReturnErrorOnFailure(
+                node->cache.ForEachAttribute(static_cast<ClusterId>(0x100 + cluster), [&](const ConcreteAttributePath & path) {
+                    visited++;
+                    return CHIP_NO_ERROR;
+                }));
+        }
+    }
+    elapsed = NowMicroseconds() - start;
+    PrintRate("ForEachAttribute(cluster)", elapsed, visited, "attribute");
+
+    printf("  (%zu value bytes read)\n", valueBytes);
+
+    nodes.clear();
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    CommandLine commandLine(TOOL_NAME,
+                            "Measure the memory use and access times of ClusterStateCache holding the state of many nodes.\n",
+                            {
+                                Option::Count("nodes", gOptions.nodeCount),
+                                Option::Count("endpoints", gOptions.endpointCount, 1, kInvalidEndpointId),
+                                Option::Count("clusters", gOptions.clusterCount),
+                                Option::Count("attributes", gOptions.attributeCount),
+                                Option::Count("value-size", gOptions.valueSize, 1, kMaxValueSize / 2),
+                                Option::Count("reports", gOptions.reportCount, 0),
+                                Option::Count("changes", gOptions.changePerReport, 0, 100),
+                            },
+                            gCmdOptionHelp);
+
+    CHIP_ERROR err = Platform::MemoryInit();
+    SuccessOrExit(err);
+
+    if (!commandLine.Parse(argc, argv))
+    {
+        Platform::MemoryShutdown();
+        return EXIT_FAILURE;
+    }
+
+    err = RunClusterStateCache();
+    SuccessOrExit(err);
+
+exit:
+    Platform::MemoryShutdown();
+    return commandLine.ExitStatus(err);
+}
@@ -0,0 +1,312 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements chip-event-fetch-benchmark, which measures EventManagement::FetchEventsSince
+ *      on a large event log, with and without the event index.
+ *
+ */
+
+#include <access/SubjectDescriptor.h>
+#include <app/EventLoggingDelegate.h>
+#include <app/EventManagement.h>
+#include <app/tests/AppTestContext.h>
+#include <lib/support/CHIPCounter.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/LinkedList.h>
+#include <lib/support/tests/BenchmarkSupport.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::Benchmark;
+
+namespace {
+
+#define TOOL_NAME "chip-event-fetch-benchmark"
+
+// Matches CHIP_DEVICE_CONFIG_EVENT_LOGGING_INDEX_BYTES_PER_EVENT on Linux.
+constexpr uint32_t kIndexBytesPerEvent = 24;
+// Roughly the room a report has for events.
+constexpr size_t kReportSize = 1024;
+
+struct BenchmarkOptions
+{
+    uint32_t logSize       = 16384;
+    uint32_t endpointCount = 8;
+    uint32_t clusterCount  = 8;
+    uint32_t fetchCount    = 500;
+} gOptions;
+
+const char * const gCmdOptionHelp =
+    "   --log-size <bytes>\n"
+    "       Total size of the event log: a quarter each for the debug and info buffers, half for the critical one.\n"
+    "       Defaults to 16384.\n"
+    "\n"
+    "   --endpoints <count>\n"
+    "       Number of endpoints the events are logged on. Defaults to 8.\n"
+    "\n"
+    "   --clusters <count>\n"
+    "       Number of clusters on each endpoint the events are logged on. Defaults to 8.\n"
+    "\n"
+    "   --fetches <count>\n"
+    "       Number of fetches of each kind. Defaults to 500.\n"
+    "\n";
+
+class BenchmarkEventGenerator : public EventLoggingDelegate
+{
+public:
+    CHIP_ERROR WriteEvent(TLV::TLVWriter & aWriter) override
+    {
+        TLV::TLVType dataContainerType;
+        ReturnErrorOnFailure(aWriter.StartContainer(TLV::ContextTag(to_underlying(EventDataIB::Tag::kData)),
+                                                    TLV::kTLVType_Structure, dataContainerType));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(1), mValue));
+        return aWriter.EndContainer(dataContainerType);
+    }
+
+    uint32_t mValue = 0;
+};
+
+/**
+ * An event log made of a debug, an info and a critical buffer, optionally indexed.
+ */
+class EventLog
+{
+public:
+    EventLog(uint32_t logSize, bool indexed) :
+        mDebugBuffer(logSize / 4), mInfoBuffer(logSize / 4), mCritBuffer(logSize - 2 * (logSize / 4))
+    {
+        if (indexed)
+        {
+            mDebugIndex.resize(mDebugBuffer.size() / kIndexBytesPerEvent + 1);
+            mInfoIndex.resize(mInfoBuffer.size() / kIndexBytesPerEvent + 1);
+            mCritIndex.resize(mCritBuffer.size() / kIndexBytesPerEvent + 1);
+        }
+    }
+
+    CHIP_ERROR Init(Test::AppContext & ctx)
+    {
+        const LogStorageResources logStorageResources[] = {
+            { mDebugBuffer.data(), static_cast<uint32_t>(mDebugBuffer.size()), PriorityLevel::Debug, mDebugIndex.data(),
+              static_cast<uint32_t>(mDebugIndex.size()) },
+            { mInfoBuffer.data(), static_cast<uint32_t>(mInfoBuffer.size()), PriorityLevel::Info, mInfoIndex.data(),
+              static_cast<uint32_t>(mInfoIndex.size()) },
+            { mCritBuffer.data(), static_cast<uint32_t>(mCritBuffer.size()), PriorityLevel::Critical, mCritIndex.data(),
+              static_cast<uint32_t>(mCritIndex.size()) },
+        };
+
+        ReturnErrorOnFailure(mEventCounter.Init(0));
+        EventManagement::CreateEventManagement(&ctx.GetExchangeManager(), ArraySize(logStorageResources), mCircularEventBuffer,
+                                               logStorageResources, &mEventCounter);
+        return CHIP_NO_ERROR;
+    }
+
+    size_t IndexBytes() const
+    {
+        return (mDebugIndex.size() + mInfoIndex.size() + mCritIndex.size()) * sizeof(EventIndexEntry);
+    }
+
+    bool IsIndexed() const
+    {
+        for (auto & buffer : mCircularEventBuffer)
+        {
+            VerifyOrReturnValue(buffer.IsIndexed(), false);
+        }
+        return true;
+    }
+
+private:
+    std::vector<uint8_t> mDebugBuffer;
+    std::vector<uint8_t> mInfoBuffer;
+    std::vector<uint8_t> mCritBuffer;
+    std::vector<EventIndexEntry> mDebugIndex;
+    std::vector<EventIndexEntry> mInfoIndex;
+    std::vector<EventIndexEntry> mCritIndex;
+    CircularEventBuffer mCircularEventBuffer[3];
+    MonotonicallyIncreasingCounter<EventNumber> mEventCounter;
+};
+
+ConcreteEventPath EventPathFor(uint32_t index)
+{
+    auto endpoint = static_cast<EndpointId>(index % gOptions.endpointCount + 1);
+    auto cluster  = static_cast<ClusterId>((index / gOptions.endpointCount) % gOptions.clusterCount + 1);
+    return ConcreteEventPath(endpoint, cluster, 1);
+}
+
+// Log enough events to fill the log a few times over, so that it has wrapped, moved and dropped events.
+CHIP_ERROR FillLog(EventNumber & aLastEventNumber, size_t & aEventCount)
+{
+    const PriorityLevel priorities[] = { PriorityLevel::Debug, PriorityLevel::Info, PriorityLevel::Info, PriorityLevel::Critical };
+    BenchmarkEventGenerator generator;
+    EventManagement & eventManagement = EventManagement::GetInstance();
+
+    for (uint32_t i = 0; i < gOptions.logSize / 8; i++)
+    {
+        EventOptions options;
+        options.mPath     = EventPathFor(i);
+        options.mPriority = priorities[i % ArraySize(priorities)];
+        generator.mValue  = i;
+        ReturnErrorOnFailure(eventManagement.LogEvent(&generator, options, aLastEventNumber));
+    }
+
+    // Count what is left in the log, with a wildcard fetch of everything.
+    std::vector<uint8_t> buffer(gOptions.logSize * 2);
+    TLV::TLVWriter writer;
+    EventNumber eventMin = 0;
+    SingleLinkedListNode<EventPathParams> wildcardPath;
+    aEventCount = 0;
+    writer.Init(buffer.data(), static_cast<uint32_t>(buffer.size()));
+    CHIP_ERROR err = eventManagement.FetchEventsSince(writer, &wildcardPath, eventMin, aEventCount, Access::SubjectDescriptor{});
+    return (err == CHIP_END_OF_TLV) ? CHIP_NO_ERROR : err;
+}
+
+struct FetchResult
+{
+    uint64_t elapsedMicroseconds = 0;
+    size_t eventCount            = 0;
+};
+
+CHIP_ERROR TimeFetches(const SingleLinkedListNode<EventPathParams> * apPaths, EventNumber aEventMin, FetchResult & aResult)
+{
+    uint8_t buffer[kReportSize];
+    EventManagement & eventManagement = EventManagement::GetInstance();
+
+    aResult        = FetchResult();
+    uint64_t start = NowMicroseconds();
+    for (uint32_t i = 0; i < gOptions.fetchCount; i++)
+    {
+        TLV::TLVWriter writer;
+        EventNumber eventMin = aEventMin;
+        size_t eventCount    = 0;
+        writer.Init(buffer);
+        CHIP_ERROR err = eventManagement.FetchEventsSince(writer, apPaths, eventMin, eventCount, Access::SubjectDescriptor{});
+        VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV || err == CHIP_ERROR_BUFFER_TOO_SMALL, err);
+        aResult.eventCount = eventCount;
+    }
+    aResult.elapsedMicroseconds = NowMicroseconds() - start;
+    return CHIP_NO_ERROR;
+}
+
+struct Scenario
+{
+    const char * label;
+    const SingleLinkedListNode<EventPathParams> * paths;
+    EventNumber eventMin;
+};
+
+CHIP_ERROR RunBenchmark(Test::AppContext & ctx)
+{
+    SingleLinkedListNode<EventPathParams> wildcardPath;
+    SingleLinkedListNode<EventPathParams> clusterPath;
+    clusterPath.mValue.mEndpointId = 1;
+    clusterPath.mValue.mClusterId  = 1;
+    SingleLinkedListNode<EventPathParams> missingPath;
+    missingPath.mValue.mEndpointId = static_cast<EndpointId>(gOptions.endpointCount + 1);
+
+    FetchResult results[2][4];
+    Scenario scenarios[4];
+    for (int indexed = 0; indexed < 2; indexed++)
+    {
+        EventLog log(gOptions.logSize, indexed != 0);
+        ReturnErrorOnFailure(log.Init(ctx));
+
+        EventNumber lastEventNumber = 0;
+        size_t eventCount           = 0;
+        CHIP_ERROR err              = FillLog(lastEventNumber, eventCount);
+        if (indexed)
+        {
+            printf("Event log: %u bytes, %u events, index of %u bytes%s\n", static_cast<unsigned>(gOptions.logSize),
+                   static_cast<unsigned>(eventCount), static_cast<unsigned>(log.IndexBytes()),
+                   log.IsIndexed() ? "" : " (too small, not in use)");
+        }
+
+        scenarios[0] = { "caught up, wildcard", &wildcardPath, lastEventNumber + 1 };
+        scenarios[1] = { "last 4 events, wildcard", &wildcardPath, lastEventNumber - 3 };
+        scenarios[2] = { "whole log, one cluster", &clusterPath, 0 };
+        scenarios[3] = { "whole log, no matching path", &missingPath, 0 };
+        for (size_t i = 0; err == CHIP_NO_ERROR && i < ArraySize(scenarios); i++)
+        {
+            err = TimeFetches(scenarios[i].paths, scenarios[i].eventMin, results[indexed][i]);
+        }
+
+        EventManagement::DestroyEventManagement();
+        ReturnErrorOnFailure(err);
+    }
+
+    printf("Fetches: %u of each kind, into %u bytes\n", static_cast<unsigned>(gOptions.fetchCount),
+           static_cast<unsigned>(kReportSize));
+    printf("  %-30s %10s %10s %8s %8s\n", "", "scan (us)", "index (us)", "speedup", "events");
+    for (size_t i = 0; i < ArraySize(scenarios); i++)
+    {
+        double scan    = static_cast<double>(results[0][i].elapsedMicroseconds) / gOptions.fetchCount;
+        double index   = static_cast<double>(results[1][i].elapsedMicroseconds) / gOptions.fetchCount;
+        double speedup = index > 0 ? scan / index : 0;
+        printf("  %-30s %10.2f %10.2f %7.1fx %8u\n", scenarios[i].label, scan, index, speedup,
+               static_cast<unsigned>(results[1][i].eventCount));
+        if (results[0][i].eventCount != results[1][i].eventCount)
+        {
+            ChipLogError(EventLogging, "%s: %u events fetched without the index, %u with it", scenarios[i].label,
+                         static_cast<unsigned>(results[0][i].eventCount), static_cast<unsigned>(results[1][i].eventCount));
+            return CHIP_ERROR_INTERNAL;
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    CommandLine commandLine(TOOL_NAME, "Measure fetching events from a large event log, with and without the event index.\n",
+                            {
+                                Option::Count("log-size", gOptions.logSize, 1024),
+                                Option::Count("endpoints", gOptions.endpointCount, 1, kInvalidEndpointId - 1),
+                                Option::Count("clusters", gOptions.clusterCount, 1, UINT16_MAX),
+                                Option::Count("fetches", gOptions.fetchCount),
+                            },
+                            gCmdOptionHelp);
+
+    // ParseArgs allocates from the CHIP heap, which the test context only initializes later on.
+    VerifyOrReturnValue(Platform::MemoryInit() == CHIP_NO_ERROR, EXIT_FAILURE);
+    bool argsParsed = commandLine.Parse(argc, argv);
+    Platform::MemoryShutdown();
+    if (!argsParsed)
+    {
+        return EXIT_FAILURE;
+    }
+
+    Test::AppContext ctx;
+    CHIP_ERROR err = ctx.SetUpTestSuite();
+    SuccessOrExit(err);
+    err = ctx.SetUp();
+    SuccessOrExit(err);
+
+    err = RunBenchmark(ctx);
+
+    ctx.TearDown();
+    ctx.TearDownTestSuite();
+
+exit:
+    return commandLine.ExitStatus(err);
+}
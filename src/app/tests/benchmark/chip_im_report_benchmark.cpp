@@ -0,0 +1,447 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements chip-im-report-benchmark, which measures the server side of the
+ *      Interaction Model reporting path (ReadHandler, reporting Engine, AttributeValueEncoder and
+ *      chunking) over the loopback transport, against a synthetic data model.
+ *
+ */
+
+#include <app/EventManagement.h>
+#include <app/InteractionModelEngine.h>
+#include <app/ReadClient.h>
+#include <app/tests/AppTestContext.h>
+#include <app/util/attribute-storage.h>
+#include <app/util/mock/Constants.h>
+#include <app/util/mock/Functions.h>
+#include <app/util/mock/MockNodeConfig.h>
+#include <lib/support/CHIPCounter.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/tests/BenchmarkSupport.h>
+
+#include <algorithm>
+#include <inttypes.h>
+#include <memory>
+#include <stdio.h>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::Benchmark;
+
+namespace {
+
+#define TOOL_NAME "chip-im-report-benchmark"
+
+constexpr uint16_t kMaxIntervalCeilingSeconds = 3600;
+
+struct BenchmarkOptions
+{
+    uint32_t endpointCount      = 16;
+    uint32_t clusterCount       = 8;
+    uint32_t subscriptionCount  = 32;
+    uint32_t wildcardReadCount  = 20;
+    uint32_t dirtyRoundCount    = 200;
+    uint32_t dirtyPathsPerRound = 16;
+    bool largeAttributes        = false;
+} gOptions;
+
+const char * const gCmdOptionHelp =
+    "   --endpoints <count>\n"
+    "       Number of endpoints of the synthetic data model. Defaults to 16.\n"
+    "\n"
+    "   --clusters <count>\n"
+    "       Number of clusters on each endpoint. Defaults to 8.\n"
+    "\n"
+    "   --subscriptions <count>\n"
+    "       Number of concurrent subscriptions, each to all the attributes of one cluster. Defaults to 32.\n"
+    "\n"
+    "   --reads <count>\n"
+    "       Number of wildcard reads of the whole data model. Defaults to 20.\n"
+    "\n"
+    "   --dirty-rounds <count>\n"
+    "       Number of SetDirty storms delivered to the subscriptions. Defaults to 200.\n"
+    "\n"
+    "   --dirty-paths <count>\n"
+    "       Number of attributes marked dirty in each storm. Defaults to 16.\n"
+    "\n"
+    "   --large-attributes\n"
+    "       Add a large list attribute to every cluster, so that reports need to be chunked.\n"
+    "\n";
+
+/**
+ * Counts the traffic the server sends to the client. On the loopback context the client (Bob) talks to the server
+ * (Alice), so every message addressed to Bob comes from the server.
+ */
+class TrafficCounter : public Test::LoopbackTransportDelegate
+{
+public:
+    TrafficCounter(const Transport::PeerAddress & clientAddress) : mClientAddress(clientAddress) {}
+
+    void OnMessageSent(const Transport::PeerAddress & address, const System::PacketBufferHandle & msgBuf) override
+    {
+        if (address == mClientAddress)
+        {
+            mMessages++;
+            mBytes += msgBuf->TotalLength();
+        }
+    }
+
+    void Reset()
+    {
+        mMessages = 0;
+        mBytes    = 0;
+    }
+
+    uint64_t mMessages = 0;
+    uint64_t mBytes    = 0;
+
+private:
+    const Transport::PeerAddress mClientAddress;
+};
+
+class LatencyRecorder
+{
+public:
+    void Record(uint64_t latencyMicroseconds) { mSamples.push_back(latencyMicroseconds); }
+
+    size_t Count() const { return mSamples.size(); }
+
+    uint64_t Percentile(unsigned percent)
+    {
+        VerifyOrReturnValue(!mSamples.empty(), 0);
+        std::sort(mSamples.begin(), mSamples.end());
+        size_t rank = (mSamples.size() * percent + 99) / 100;
+        return mSamples[rank > 0 ? rank - 1 : 0];
+    }
+
+private:
+    std::vector<uint64_t> mSamples;
+};
+
+class BenchmarkReadCallback : public ReadClient::Callback
+{
+public:
+    BenchmarkReadCallback(LatencyRecorder * apLatencies) : mpLatencies(apLatencies) {}
+
+    void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override
+    {
+        mAttributeCount++;
+    }
+
+    void OnReportEnd() override
+    {
+        mReportCount++;
+        mpLatencies->Record(NowMicroseconds() - mRequestTimestamp);
+    }
+
+    void OnSubscriptionEstablished(SubscriptionId aSubscriptionId) override { mEstablished = true; }
+
+    void OnError(CHIP_ERROR aError) override { mError = aError; }
+
+    void OnDone(ReadClient * apReadClient) override { mDone = true; }
+
+    void SetLatencyRecorder(LatencyRecorder * apLatencies) { mpLatencies = apLatencies; }
+
+    // Start of the request, or of the SetDirty storm, the next report answers to.
+    uint64_t mRequestTimestamp = 0;
+    uint64_t mAttributeCount   = 0;
+    uint32_t mReportCount      = 0;
+    bool mEstablished          = false;
+    bool mDone                 = false;
+    CHIP_ERROR mError          = CHIP_NO_ERROR;
+
+private:
+    LatencyRecorder * mpLatencies;
+};
+
+std::unique_ptr<Test::MockNodeConfig> BuildNodeConfig()
+{
+    using namespace chip::app::Clusters::Globals::Attributes;
+
+    std::vector<Test::MockEndpointConfig> endpoints;
+    // The mock configs keep pointers into their own storage, so the vectors must not reallocate while being filled.
+    endpoints.reserve(gOptions.endpointCount);
+    for (uint16_t endpoint = 1; endpoint <= gOptions.endpointCount; endpoint++)
+    {
+        std::vector<Test::MockClusterConfig> clusters;
+        clusters.reserve(gOptions.clusterCount);
+        for (uint16_t cluster = 1; cluster <= gOptions.clusterCount; cluster++)
+        {
+            if (gOptions.largeAttributes)
+            {
+                // MockAttributeId(4) is a list that is too large to fit in a single report.
+                clusters.emplace_back(Test::MockClusterId(cluster),
+                                      std::initializer_list<Test::MockAttributeConfig>{
+                                          ClusterRevision::Id, FeatureMap::Id, Test::MockAttributeId(1), Test::MockAttributeId(2),
+                                          Test::MockAttributeId(3), Test::MockAttributeId(4) });
+            }
+            else
+            {
+                clusters.emplace_back(Test::MockClusterId(cluster),
+                                      std::initializer_list<Test::MockAttributeConfig>{
+                                          ClusterRevision::Id, FeatureMap::Id, Test::MockAttributeId(1), Test::MockAttributeId(2),
+                                          Test::MockAttributeId(3) });
+            }
+        }
+        endpoints.emplace_back(endpoint, std::move(clusters));
+    }
+    return std::make_unique<Test::MockNodeConfig>(std::move(endpoints));
+}
+
+// Spread the subscriptions and the dirty paths over all the clusters of the data model.
+ConcreteClusterPath ClusterPathFor(uint32_t index)
+{
+    auto endpoint = static_cast<EndpointId>(index % gOptions.endpointCount + 1);
+    auto cluster  = static_cast<uint16_t>((index / gOptions.endpointCount) % gOptions.clusterCount + 1);
+    return ConcreteClusterPath(endpoint, Test::MockClusterId(cluster));
+}
+
+void PrintLatencies(const char * label, LatencyRecorder & latencies)
+{
+    printf("  %-28s p50 %" PRIu64 " us, p99 %" PRIu64 " us (%u samples)\n", label, latencies.Percentile(50),
+           latencies.Percentile(99), static_cast<unsigned>(latencies.Count()));
+}
+
+double PerSecond(uint64_t count, uint64_t elapsedMicroseconds)
+{
+    return elapsedMicroseconds > 0 ? static_cast<double>(count) * 1e6 / static_cast<double>(elapsedMicroseconds) : 0;
+}
+
+CHIP_ERROR RunWildcardReads(Test::AppContext & ctx, TrafficCounter & traffic)
+{
+    VerifyOrReturnError(gOptions.wildcardReadCount > 0, CHIP_NO_ERROR);
+
+    LatencyRecorder latencies;
+    uint64_t attributeCount = 0;
+    uint64_t chunkCount     = 0;
+    uint64_t byteCount      = 0;
+
+    uint64_t start = NowMicroseconds();
+    for (uint32_t i = 0; i < gOptions.wildcardReadCount; i++)
+    {
+        BenchmarkReadCallback callback(&latencies);
+        AttributePathParams wildcardPath;
+        ReadPrepareParams readPrepareParams(ctx.GetSessionBobToAlice());
+        readPrepareParams.mpAttributePathParamsList    = &wildcardPath;
+        readPrepareParams.mAttributePathParamsListSize = 1;
+
+        ReadClient readClient(InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), callback,
+                              ReadClient::InteractionType::Read);
+
+        traffic.Reset();
+        callback.mRequestTimestamp = NowMicroseconds();
+        ReturnErrorOnFailure(readClient.SendRequest(readPrepareParams));
+        ctx.DrainAndServiceIO();
+
+        ReturnErrorOnFailure(callback.mError);
+        VerifyOrReturnError(callback.mDone, CHIP_ERROR_INCORRECT_STATE);
+
+        // Every message the server sends during a read carries one chunk of the report.
+        attributeCount += callback.mAttributeCount;
+        chunkCount += traffic.mMessages;
+        byteCount += traffic.mBytes;
+    }
+    uint64_t elapsed = NowMicroseconds() - start;
+
+    printf("Wildcard reads: %u\n", static_cast<unsigned>(gOptions.wildcardReadCount));
+    printf("  %-28s %.1f\n", "reads/sec", PerSecond(gOptions.wildcardReadCount, elapsed));
+    printf("  %-28s %" PRIu64 "\n", "attribute reports per read", attributeCount / gOptions.wildcardReadCount);
+    printf("  %-28s %.2f\n", "chunks per read", static_cast<double>(chunkCount) / gOptions.wildcardReadCount);
+    printf("  %-28s %" PRIu64 "\n", "bytes per chunk", chunkCount > 0 ? byteCount / chunkCount : 0);
+    PrintLatencies("read latency", latencies);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR RunSubscriptions(Test::AppContext & ctx, TrafficCounter & traffic)
+{
+    VerifyOrReturnError(gOptions.subscriptionCount > 0, CHIP_NO_ERROR);
+
+    LatencyRecorder primingLatencies;
+    LatencyRecorder reportLatencies;
+    std::vector<std::unique_ptr<BenchmarkReadCallback>> callbacks;
+    std::vector<std::unique_ptr<ReadClient>> clients;
+    auto * engine = InteractionModelEngine::GetInstance();
+
+    uint64_t start = NowMicroseconds();
+    for (uint32_t i = 0; i < gOptions.subscriptionCount; i++)
+    {
+        ConcreteClusterPath clusterPath = ClusterPathFor(i);
+        AttributePathParams path(clusterPath.mEndpointId, clusterPath.mClusterId);
+        ReadPrepareParams readPrepareParams(ctx.GetSessionBobToAlice());
+        readPrepareParams.mpAttributePathParamsList    = &path;
+        readPrepareParams.mAttributePathParamsListSize = 1;
+        readPrepareParams.mMinIntervalFloorSeconds     = 0;
+        readPrepareParams.mMaxIntervalCeilingSeconds   = kMaxIntervalCeilingSeconds;
+        readPrepareParams.mKeepSubscriptions           = true;
+
+        callbacks.push_back(std::make_unique<BenchmarkReadCallback>(&primingLatencies));
+        clients.push_back(std::make_unique<ReadClient>(engine, &ctx.GetExchangeManager(), *callbacks.back(),
+                                                       ReadClient::InteractionType::Subscribe));
+
+        callbacks.back()->mRequestTimestamp = NowMicroseconds();
+        ReturnErrorOnFailure(clients.back()->SendRequest(readPrepareParams));
+        ctx.DrainAndServiceIO();
+
+        if (!callbacks.back()->mEstablished)
+        {
+            ChipLogError(DataManagement, "Subscription %u was not established: %" CHIP_ERROR_FORMAT, static_cast<unsigned>(i),
+                         callbacks.back()->mError.Format());
+            return CHIP_ERROR_INCORRECT_STATE;
+        }
+    }
+    uint64_t elapsed = NowMicroseconds() - start;
+
+    printf("Subscriptions: %u\n", static_cast<unsigned>(gOptions.subscriptionCount));
+    printf("  %-28s %.1f\n", "subscriptions/sec", PerSecond(gOptions.subscriptionCount, elapsed));
+    PrintLatencies("priming latency", primingLatencies);
+
+    VerifyOrReturnError(gOptions.dirtyRoundCount > 0, CHIP_NO_ERROR);
+
+    uint32_t reportCount = 0;
+    uint64_t byteCount   = 0;
+    for (auto & callback : callbacks)
+    {
+        callback->SetLatencyRecorder(&reportLatencies);
+        callback->mReportCount = 0;
+    }
+
+    start = NowMicroseconds();
+    for (uint32_t round = 0; round < gOptions.dirtyRoundCount; round++)
+    {
+        uint64_t roundStart = NowMicroseconds();
+        for (auto & callback : callbacks)
+        {
+            callback->mRequestTimestamp = roundStart;
+        }
+        traffic.Reset();
+
+        Test::BumpVersion();
+        for (uint32_t i = 0; i < gOptions.dirtyPathsPerRound; i++)
+        {
+            ConcreteClusterPath clusterPath = ClusterPathFor(round * gOptions.dirtyPathsPerRound + i);
+            auto attributeId                = Test::MockAttributeId(static_cast<uint16_t>(i % 3 + 1));
+            AttributePathParams dirtyPath(clusterPath.mEndpointId, clusterPath.mClusterId, attributeId);
+            ReturnErrorOnFailure(engine->GetReportingEngine().SetDirty(dirtyPath));
+        }
+        ctx.DrainAndServiceIO();
+
+        byteCount += traffic.mBytes;
+    }
+    elapsed = NowMicroseconds() - start;
+
+    for (auto & callback : callbacks)
+    {
+        reportCount += callback->mReportCount;
+        ReturnErrorOnFailure(callback->mError);
+    }
+
+    printf("SetDirty storms: %u rounds of %u paths\n", static_cast<unsigned>(gOptions.dirtyRoundCount),
+           static_cast<unsigned>(gOptions.dirtyPathsPerRound));
+    printf("  %-28s %u\n", "reports", static_cast<unsigned>(reportCount));
+    printf("  %-28s %.1f\n", "reports/sec", PerSecond(reportCount, elapsed));
+    // This includes the acknowledgements the server sends for the status responses of the client.
+    printf("  %-28s %" PRIu64 "\n", "bytes/report", reportCount > 0 ? byteCount / reportCount : 0);
+    PrintLatencies("report latency", reportLatencies);
+
+    // Tear the subscriptions down while the engine is still around.
+    clients.clear();
+    ctx.DrainAndServiceIO();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR RunBenchmark(Test::AppContext & ctx)
+{
+    std::unique_ptr<Test::MockNodeConfig> nodeConfig = BuildNodeConfig();
+    Test::SetMockNodeConfig(*nodeConfig);
+
+    TrafficCounter traffic(ctx.GetBobAddress());
+    ctx.GetLoopback().SetLoopbackTransportDelegate(&traffic);
+
+    printf("Data model: %u endpoints, %u clusters per endpoint%s\n", static_cast<unsigned>(gOptions.endpointCount),
+           static_cast<unsigned>(gOptions.clusterCount), gOptions.largeAttributes ? ", with large attributes" : "");
+
+    CHIP_ERROR err = RunWildcardReads(ctx, traffic);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = RunSubscriptions(ctx, traffic);
+    }
+
+    ctx.GetLoopback().SetLoopbackTransportDelegate(nullptr);
+    Test::ResetMockNodeConfig();
+    return err;
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    uint8_t debugEventBuffer[128];
+    uint8_t infoEventBuffer[128];
+    uint8_t critEventBuffer[128];
+    CircularEventBuffer circularEventBuffer[3];
+    MonotonicallyIncreasingCounter<EventNumber> eventCounter;
+    const LogStorageResources logStorageResources[] = {
+        { &debugEventBuffer[0], sizeof(debugEventBuffer), PriorityLevel::Debug },
+        { &infoEventBuffer[0], sizeof(infoEventBuffer), PriorityLevel::Info },
+        { &critEventBuffer[0], sizeof(critEventBuffer), PriorityLevel::Critical },
+    };
+
+    CommandLine commandLine(TOOL_NAME, "Measure the reporting path of the Interaction Model server over a loopback transport.\n",
+                            {
+                                Option::Count("endpoints", gOptions.endpointCount, 1, kEmberInvalidEndpointIndex - 1),
+                                Option::Count("clusters", gOptions.clusterCount, 1, UINT8_MAX - 1),
+                                Option::Count("subscriptions", gOptions.subscriptionCount, 0),
+                                Option::Count("reads", gOptions.wildcardReadCount, 0),
+                                Option::Count("dirty-rounds", gOptions.dirtyRoundCount, 0),
+                                Option::Count("dirty-paths", gOptions.dirtyPathsPerRound),
+                                Option::Flag("large-attributes", gOptions.largeAttributes),
+                            },
+                            gCmdOptionHelp);
+
+    // ParseArgs allocates from the CHIP heap, which the test context only initializes later on.
+    VerifyOrReturnValue(Platform::MemoryInit() == CHIP_NO_ERROR, EXIT_FAILURE);
+    bool argsParsed = commandLine.Parse(argc, argv);
+    Platform::MemoryShutdown();
+    if (!argsParsed)
+    {
+        return EXIT_FAILURE;
+    }
+
+    Test::AppContext ctx;
+    CHIP_ERROR err = ctx.SetUpTestSuite();
+    SuccessOrExit(err);
+    err = ctx.SetUp();
+    SuccessOrExit(err);
+    err = eventCounter.Init(0);
+    SuccessOrExit(err);
+    EventManagement::CreateEventManagement(&ctx.GetExchangeManager(), ArraySize(logStorageResources), circularEventBuffer,
+                                           logStorageResources, &eventCounter);
+
+    err = RunBenchmark(ctx);
+
+    EventManagement::DestroyEventManagement();
+    ctx.TearDown();
+    ctx.TearDownTestSuite();
+
+exit:
+    return commandLine.ExitStatus(err);
+}
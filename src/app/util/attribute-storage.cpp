@@ -21,6 +21,8 @@
 
 #include <app/AttributeAccessInterfaceCache.h>
 #include <app/AttributePersistenceProvider.h>
+#include <app/EndpointIndex.h>
+#include <app/EndpointTypeIndex.h>
 #include <app/InteractionModelEngine.h>
 #include <app/reporting/reporting.h>
 #include <app/util/config.h>
@@ -92,6 +94,16 @@ uint8_t singletonAttributeData[ACTUAL_SINGLETONS_SIZE];
 
 uint16_t emberEndpointCount = 0;
 
+// Maps endpoint ids to their index in emAfEndpoints.  Must be updated whenever
+// the endpoint id of an emAfEndpoints entry changes.
+EndpointIndex<MAX_ENDPOINT_COUNT> gEndpointIndex;
+
+// Clusters and attributes of the endpoint types in use, for the endpoint types that fit.  Must be
+// updated whenever the endpoint type of an emAfEndpoints entry changes.
+constexpr size_t kIndexedClusterCount   = CHIP_DEVICE_CONFIG_ENDPOINT_TYPE_INDEX_CLUSTER_CAPACITY;
+constexpr size_t kIndexedAttributeCount = CHIP_DEVICE_CONFIG_ENDPOINT_TYPE_INDEX_ATTRIBUTE_CAPACITY;
+EndpointTypeIndex<kIndexedClusterCount, kIndexedAttributeCount> gEndpointTypeIndex;
+
 // If we have attributes that are more than 4 bytes, then
 // we need this data block for the defaults
 #if (defined(GENERATED_DEFAULTS) && GENERATED_DEFAULTS_COUNT)
@@ -138,6 +150,10 @@ constexpr const EmberAfDeviceType fixedDeviceTypeList[]             = FIXED_DEVI
 
 // Not const, because these need to mutate.
 DataVersion fixedEndpointDataVersions[ZAP_FIXED_ENDPOINT_DATA_VERSION_COUNT];
+
+// Offset of the attribute storage of each fixed endpoint within attributeData.
+// Dynamic endpoints only use external storage.
+uint16_t fixedEndpointStorageOffsets[FIXED_ENDPOINT_COUNT];
 #endif // FIXED_ENDPOINT_COUNT > 0
 
 AttributeAccessInterface * gAttributeAccessOverrides = nullptr;
@@ -182,6 +198,22 @@ bool emberAfIsThisDataTypeAListType(EmberAfAttributeType dataType)
     return dataType == ZCL_ARRAY_ATTRIBUTE_TYPE;
 }
 
+// Drops the endpoint type of emAfEndpoints[index] from gEndpointTypeIndex, unless
+// another endpoint still uses it, since the caller may free it once its last
+// endpoint is gone.
+void ReleaseEndpointType(uint16_t index)
+{
+    const EmberAfEndpointType * endpointType = emAfEndpoints[index].endpointType;
+    for (uint16_t i = 0; i < MAX_ENDPOINT_COUNT; i++)
+    {
+        if (i != index && emAfEndpoints[i].endpoint != kInvalidEndpointId && emAfEndpoints[i].endpointType == endpointType)
+        {
+            return;
+        }
+    }
+    gEndpointTypeIndex.Remove(endpointType);
+}
+
 uint16_t findIndexFromEndpoint(EndpointId endpoint, bool ignoreDisabledEndpoints)
 {
     if (endpoint == kInvalidEndpointId)
@@ -189,16 +221,11 @@ uint16_t findIndexFromEndpoint(EndpointId endpoint, bool ignoreDisabledEndpoints
         return kEmberInvalidEndpointIndex;
     }
 
-    uint16_t epi;
-    for (epi = 0; epi < emberAfEndpointCount(); epi++)
-    {
-        if (emAfEndpoints[epi].endpoint == endpoint &&
-            (!ignoreDisabledEndpoints || emAfEndpoints[epi].bitmask.Has(EmberAfEndpointOptions::isEnabled)))
-        {
-            return epi;
-        }
-    }
-    return kEmberInvalidEndpointIndex;
+    static_assert(decltype(gEndpointIndex)::kInvalidSlot == kEmberInvalidEndpointIndex, "Invalid index values must match");
+    return gEndpointIndex.Find(endpoint, [ignoreDisabledEndpoints](uint16_t epi) {
+        return epi < emberAfEndpointCount() &&
+            (!ignoreDisabledEndpoints || emAfEndpoints[epi].bitmask.Has(EmberAfEndpointOptions::isEnabled));
+    });
 }
 
 // Returns the index of a given endpoint.  Considers disabled endpoints.
@@ -218,6 +245,8 @@ void emberAfEndpointConfigure()
                   "FIXED_ENDPOINT_COUNT must not exceed the size of the endpoint data type");
 
     emberEndpointCount = FIXED_ENDPOINT_COUNT;
+    gEndpointIndex.Clear();
+    gEndpointTypeIndex.Clear();
 
 #if FIXED_ENDPOINT_COUNT > 0
 
@@ -241,14 +270,17 @@ void emberAfEndpointConfigure()
 #endif // ZAP_FIXED_ENDPOINT_DATA_VERSION_COUNT > 0
 
     DataVersion * currentDataVersions = fixedEndpointDataVersions;
+    uint16_t currentStorageOffset     = 0;
     for (ep = 0; ep < FIXED_ENDPOINT_COUNT; ep++)
     {
         emAfEndpoints[ep].endpoint = fixedEndpoints[ep];
+        gEndpointIndex.Insert(fixedEndpoints[ep], ep);
         emAfEndpoints[ep].deviceTypeList =
             Span<const EmberAfDeviceType>(&fixedDeviceTypeList[fixedDeviceTypeListOffsets[ep]], fixedDeviceTypeListLengths[ep]);
         emAfEndpoints[ep].endpointType     = &generatedEmberAfEndpointTypes[fixedEmberAfEndpointTypes[ep]];
         emAfEndpoints[ep].dataVersions     = currentDataVersions;
         emAfEndpoints[ep].parentEndpointId = fixedParentEndpoints[ep];
+        gEndpointTypeIndex.Add(emAfEndpoints[ep].endpointType);
 
         emAfEndpoints[ep].bitmask.Set(EmberAfEndpointOptions::isEnabled);
         emAfEndpoints[ep].bitmask.Set(EmberAfEndpointOptions::isFlatComposition);
@@ -256,6 +288,11 @@ void emberAfEndpointConfigure()
         // Increment currentDataVersions by 1 (slot) for every server cluster
         // this endpoint has.
         currentDataVersions += emberAfClusterCountByIndex(ep, /* server = */ true);
+
+        // Fixed endpoints lay out their attribute storage back to back.
+        fixedEndpointStorageOffsets[ep] = currentStorageOffset;
+
+        currentStorageOffset = static_cast<uint16_t>(currentStorageOffset + emAfEndpoints[ep].endpointType->endpointSize);
     }
 
 #endif // FIXED_ENDPOINT_COUNT > 0
@@ -286,15 +323,12 @@ uint16_t emberAfGetDynamicIndexFromEndpoint(EndpointId id)
         return kEmberInvalidEndpointIndex;
     }
 
-    uint16_t index;
-    for (index = FIXED_ENDPOINT_COUNT; index < MAX_ENDPOINT_COUNT; index++)
+    uint16_t index = gEndpointIndex.Find(id, [](uint16_t i) { return i >= FIXED_ENDPOINT_COUNT; });
+    if (index == kEmberInvalidEndpointIndex)
     {
-        if (emAfEndpoints[index].endpoint == id)
-        {
-            return static_cast<uint8_t>(index - FIXED_ENDPOINT_COUNT);
-        }
+        return kEmberInvalidEndpointIndex;
     }
-    return kEmberInvalidEndpointIndex;
+    return static_cast<uint8_t>(index - FIXED_ENDPOINT_COUNT);
 }
 
 CHIP_ERROR emberAfSetDynamicEndpoint(uint16_t index, EndpointId id, const EmberAfEndpointType * ep,
@@ -319,14 +353,19 @@ CHIP_ERROR emberAfSetDynamicEndpoint(uint16_t index, EndpointId id, const EmberA
     }
 
     index = static_cast<uint16_t>(realIndex);
-    for (uint16_t i = FIXED_ENDPOINT_COUNT; i < MAX_ENDPOINT_COUNT; i++)
+    if (gEndpointIndex.Find(id, [](uint16_t i) { return i >= FIXED_ENDPOINT_COUNT; }) != kEmberInvalidEndpointIndex)
     {
-        if (emAfEndpoints[i].endpoint == id)
-        {
-            return CHIP_ERROR_ENDPOINT_EXISTS;
-        }
+        return CHIP_ERROR_ENDPOINT_EXISTS;
     }
 
+    if (emAfEndpoints[index].endpoint != kInvalidEndpointId)
+    {
+        gEndpointIndex.Remove(emAfEndpoints[index].endpoint, index);
+        ReleaseEndpointType(index);
+    }
+    VerifyOrDie(gEndpointIndex.Insert(id, index));
+    gEndpointTypeIndex.Add(ep);
+
     emAfEndpoints[index].endpoint       = id;
     emAfEndpoints[index].deviceTypeList = deviceTypeList;
     emAfEndpoints[index].endpointType   = ep;
@@ -365,6 +404,8 @@ EndpointId emberAfClearDynamicEndpoint(uint16_t index)
     {
         ep = emAfEndpoints[index].endpoint;
         emberAfEndpointEnableDisable(ep, false);
+        gEndpointIndex.Remove(ep, index);
+        ReleaseEndpointType(index);
         emAfEndpoints[index].endpoint = kInvalidEndpointId;
     }
 
@@ -615,117 +656,126 @@ Status emAfReadOrWriteAttribute(const EmberAfAttributeSearchRecord * attRecord,
 {
     assertChipStackLockedByCurrentThread();
 
-    uint16_t attributeOffsetIndex = 0;
+    uint16_t ep = emberAfIndexFromEndpoint(attRecord->endpoint);
+    if (ep == kEmberInvalidEndpointIndex)
+    {
+        return Status::UnsupportedEndpoint; // Sorry, endpoint was not found.
+    }
+
+    // Is this a dynamic endpoint?
+    bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
 
-    for (uint16_t ep = 0; ep < emberAfEndpointCount(); ep++)
+    // Dynamic endpoints are external and don't factor into storage size
+    uint16_t attributeOffsetIndex = 0;
+#if FIXED_ENDPOINT_COUNT > 0
+    if (!isDynamicEndpoint)
     {
-        // Is this a dynamic endpoint?
-        bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
+        attributeOffsetIndex = fixedEndpointStorageOffsets[ep];
+    }
+#endif // FIXED_ENDPOINT_COUNT > 0
 
-        if (emAfEndpoints[ep].endpoint == attRecord->endpoint)
+    const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
+    const EmberAfCluster * cluster           = nullptr;
+    uint16_t clusterOffset                   = 0;
+    if (!gEndpointTypeIndex.FindCluster(endpointType, attRecord->clusterId, CLUSTER_MASK_SERVER, &cluster, nullptr,
+                                        &clusterOffset))
+    {
+        // The endpoint type is not indexed, scan it.
+        for (uint8_t clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
         {
-            const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
-            uint8_t clusterIndex;
-            if (!emberAfEndpointIndexIsEnabled(ep))
+            const EmberAfCluster * candidate = &endpointType->cluster[clusterIndex];
+            if (emAfMatchCluster(candidate, attRecord))
             {
-                continue;
+                cluster = candidate;
+                break;
             }
-            for (clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
-            {
-                const EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
-                if (emAfMatchCluster(cluster, attRecord))
-                { // Got the cluster
-                    uint16_t attrIndex;
-                    for (attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
-                    {
-                        const EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
-                        if (emAfMatchAttribute(cluster, am, attRecord))
-                        { // Got the attribute
-                            // If passed metadata location is not null, populate
-                            if (metadata != nullptr)
-                            {
-                                *metadata = am;
-                            }
 
-                            {
-                                uint8_t * attributeLocation =
-                                    (am->mask & ATTRIBUTE_MASK_SINGLETON ? singletonAttributeLocation(am)
-                                                                         : attributeData + attributeOffsetIndex);
-                                uint8_t *src, *dst;
-                                if (write)
-                                {
-                                    src = buffer;
-                                    dst = attributeLocation;
-                                    if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                             am->attributeId))
-                                    {
-                                        return Status::UnsupportedAccess;
-                                    }
-                                }
-                                else
-                                {
-                                    if (buffer == nullptr)
-                                    {
-                                        return Status::Success;
-                                    }
-
-                                    src = attributeLocation;
-                                    dst = buffer;
-                                    if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                            am->attributeId))
-                                    {
-                                        return Status::UnsupportedAccess;
-                                    }
-                                }
-
-                                // Is the attribute externally stored?
-                                if (am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE)
-                                {
-                                    return (write ? emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                                          am, buffer)
-                                                  : emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                                         am, buffer, emberAfAttributeSize(am)));
-                                }
-
-                                // Internal storage is only supported for fixed endpoints
-                                if (!isDynamicEndpoint)
-                                {
-                                    return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
-                                }
-
-                                return Status::Failure;
-                            }
-                        }
-                        else
-                        { // Not the attribute we are looking for
-                            // Increase the index if attribute is not externally stored
-                            if (!(am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !(am->mask & ATTRIBUTE_MASK_SINGLETON))
-                            {
-                                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
-                            }
-                        }
-                    }
+            // Not the cluster we are looking for
+            clusterOffset = static_cast<uint16_t>(clusterOffset + candidate->clusterSize);
+        }
+    }
+    if (cluster == nullptr)
+    {
+        // Cluster is not in the endpoint.
+        return Status::UnsupportedCluster;
+    }
 
-                    // Attribute is not in the cluster.
-                    return Status::UnsupportedAttribute;
-                }
+    const EmberAfAttributeMetadata * am = nullptr;
+    uint16_t attributeOffset            = 0;
+    if (!gEndpointTypeIndex.FindAttribute(cluster, attRecord->attributeId, &am, &attributeOffset))
+    {
+        for (uint16_t attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
+        {
+            const EmberAfAttributeMetadata * candidate = &cluster->attributes[attrIndex];
+            if (emAfMatchAttribute(cluster, candidate, attRecord))
+            {
+                am = candidate;
+                break;
+            }
 
-                // Not the cluster we are looking for
-                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + cluster->clusterSize);
+            // Not the attribute we are looking for
+            // Increase the index if attribute is not externally stored
+            if (!(candidate->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !(candidate->mask & ATTRIBUTE_MASK_SINGLETON))
+            {
+                attributeOffset = static_cast<uint16_t>(attributeOffset + emberAfAttributeSize(candidate));
             }
+        }
+    }
+    if (am == nullptr)
+    {
+        // Attribute is not in the cluster.
+        return Status::UnsupportedAttribute;
+    }
+    attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + clusterOffset + attributeOffset);
+
+    // If passed metadata location is not null, populate
+    if (metadata != nullptr)
+    {
+        *metadata = am;
+    }
 
-            // Cluster is not in the endpoint.
-            return Status::UnsupportedCluster;
+    uint8_t * attributeLocation =
+        (am->mask & ATTRIBUTE_MASK_SINGLETON ? singletonAttributeLocation(am) : attributeData + attributeOffsetIndex);
+    uint8_t *src, *dst;
+    if (write)
+    {
+        src = buffer;
+        dst = attributeLocation;
+        if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
+        {
+            return Status::UnsupportedAccess;
+        }
+    }
+    else
+    {
+        if (buffer == nullptr)
+        {
+            return Status::Success;
         }
 
-        // Not the endpoint we are looking for
-        // Dynamic endpoints are external and don't factor into storage size
-        if (!isDynamicEndpoint)
+        src = attributeLocation;
+        dst = buffer;
+        if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
         {
-            attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emAfEndpoints[ep].endpointType->endpointSize);
+            return Status::UnsupportedAccess;
         }
     }
-    return Status::UnsupportedEndpoint; // Sorry, endpoint was not found.
+
+    // Is the attribute externally stored?
+    if (am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE)
+    {
+        return (write ? emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId, am, buffer)
+                      : emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am, buffer,
+                                                             emberAfAttributeSize(am)));
+    }
+
+    // Internal storage is only supported for fixed endpoints
+    if (!isDynamicEndpoint)
+    {
+        return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
+    }
+
+    return Status::Failure;
 }
 
 const EmberAfEndpointType * emberAfFindEndpointType(chip::EndpointId endpointId)
@@ -741,6 +791,12 @@ const EmberAfEndpointType * emberAfFindEndpointType(chip::EndpointId endpointId)
 const EmberAfCluster * emberAfFindClusterInType(const EmberAfEndpointType * endpointType, ClusterId clusterId,
                                                 EmberAfClusterMask mask, uint8_t * index)
 {
+    const EmberAfCluster * found;
+    if (gEndpointTypeIndex.FindCluster(endpointType, clusterId, mask, &found, index))
+    {
+        return found;
+    }
+
     uint8_t i;
     uint8_t scopedIndex = 0;
 
@@ -769,21 +825,14 @@ const EmberAfCluster * emberAfFindClusterInType(const EmberAfEndpointType * endp
 
 uint8_t emberAfClusterIndex(EndpointId endpoint, ClusterId clusterId, EmberAfClusterMask mask)
 {
-    for (uint16_t ep = 0; ep < emberAfEndpointCount(); ep++)
-    {
-        // Check the endpoint id first, because that way we avoid examining the
-        // endpoint type for endpoints that are not actually defined.
-        if (emAfEndpoints[ep].endpoint == endpoint)
-        {
-            const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
-            uint8_t index                            = 0xFF;
-            if (emberAfFindClusterInType(endpointType, clusterId, mask, &index) != nullptr)
-            {
-                return index;
-            }
-        }
-    }
-    return 0xFF;
+    uint8_t index = 0xFF;
+    // Only endpoints with the given id are examined, so we avoid looking at the
+    // endpoint type for endpoints that are not actually defined.
+    gEndpointIndex.Find(endpoint, [&](uint16_t ep) {
+        return ep < emberAfEndpointCount() &&
+            emberAfFindClusterInType(emAfEndpoints[ep].endpointType, clusterId, mask, &index) != nullptr;
+    });
+    return index;
 }
 
 // Returns whether the given endpoint has the server of the given cluster on it.
@@ -17,6 +17,7 @@
 
 #include <access/SubjectDescriptor.h>
 #include <app/AttributeAccessInterface.h>
+#include <app/ClusterAccessCheckCache.h>
 #include <app/ConcreteAttributePath.h>
 #include <app/ConcreteCommandPath.h>
 #include <app/ConcreteEventPath.h>
@@ -55,12 +56,16 @@ bool ConcreteAttributePathExists(const ConcreteAttributePath & aPath);
  *  @param[in]    aSubjectDescriptor    The subject descriptor for the read.
  *  @param[in]    aPath                 The concrete path of the data being read.
  *  @param[in]    aAttributeReports      The TLV Builder for Cluter attribute builder.
+ *  @param[in]    apAccessCheckCache    Optional cache of access control decisions for aSubjectDescriptor, used to avoid
+ *                                      repeating the same access check for every attribute of a cluster.  When provided, it
+ *                                      must have been created for aSubjectDescriptor.
  *
  *  @retval  CHIP_NO_ERROR on success
  */
 CHIP_ERROR ReadSingleClusterData(const Access::SubjectDescriptor & aSubjectDescriptor, bool aIsFabricFiltered,
                                  const ConcreteReadAttributePath & aPath, AttributeReportIBs::Builder & aAttributeReports,
-                                 AttributeValueEncoder::AttributeEncodeState * apEncoderState);
+                                 AttributeValueEncoder::AttributeEncodeState * apEncoderState,
+                                 ClusterAccessCheckCache * apAccessCheckCache = nullptr);
 
 /**
  * Returns the metadata of the attribute for the given path.
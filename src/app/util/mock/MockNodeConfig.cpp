@@ -77,10 +77,10 @@ const MockAttributeConfig * MockClusterConfig::attributeById(AttributeId attribu
     return findById(attributes, attributeId, outIndex);
 }
 
-MockEndpointConfig::MockEndpointConfig(EndpointId aId, std::initializer_list<MockClusterConfig> aClusters) :
-    id(aId), clusters(aClusters), mEmberEndpoint{}
+MockEndpointConfig::MockEndpointConfig(EndpointId aId, std::vector<MockClusterConfig> aClusters) :
+    id(aId), clusters(std::move(aClusters)), mEmberEndpoint{}
 {
-    VerifyOrDie(aClusters.size() < UINT8_MAX);
+    VerifyOrDie(clusters.size() < UINT8_MAX);
 
     // Note: We're copying all the EmberAfClusters because they need to be contiguous in memory
     for (const auto & cluster : clusters)
@@ -96,9 +96,9 @@ const MockClusterConfig * MockEndpointConfig::clusterById(ClusterId clusterId, p
     return findById(clusters, clusterId, outIndex);
 }
 
-MockNodeConfig::MockNodeConfig(std::initializer_list<MockEndpointConfig> aEndpoints) : endpoints(aEndpoints)
+MockNodeConfig::MockNodeConfig(std::vector<MockEndpointConfig> aEndpoints) : endpoints(std::move(aEndpoints))
 {
-    VerifyOrDie(aEndpoints.size() < kEmberInvalidEndpointIndex);
+    VerifyOrDie(endpoints.size() < kEmberInvalidEndpointIndex);
 }
 
 const MockEndpointConfig * MockNodeConfig::endpointById(EndpointId endpointId, ptrdiff_t * outIndex) const
@@ -59,7 +59,7 @@ private:
 
 struct MockEndpointConfig
 {
-    MockEndpointConfig(EndpointId aId, std::initializer_list<MockClusterConfig> aClusters = {});
+    MockEndpointConfig(EndpointId aId, std::vector<MockClusterConfig> aClusters = {});
 
     const MockClusterConfig * clusterById(ClusterId clusterId, ptrdiff_t * outIndex = nullptr) const;
     const EmberAfEndpointType * emberEndpoint() const { return &mEmberEndpoint; }
@@ -74,7 +74,7 @@ private:
 
 struct MockNodeConfig
 {
-    MockNodeConfig(std::initializer_list<MockEndpointConfig> aEndpoints);
+    MockNodeConfig(std::vector<MockEndpointConfig> aEndpoints);
 
     const MockEndpointConfig * endpointById(EndpointId endpointId, ptrdiff_t * outIndex = nullptr) const;
     const MockClusterConfig * clusterByIds(EndpointId endpointId, ClusterId clusterId, ptrdiff_t * outClusterIndex = nullptr) const;
@@ -285,6 +285,17 @@ CHIP_ERROR DeviceControllerFactory::InitSystemState(FactoryInitParams params)
     stateParams.caseSessionManager = Platform::New<CASESessionManager>();
     ReturnErrorOnFailure(stateParams.caseSessionManager->Init(stateParams.systemLayer, sessionManagerConfig));
 
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0 && !defined(CHIP_ADDRESS_RESOLVE_IMPL_INCLUDE_HEADER)
+    // Keep resolved operational addresses across restarts. Failing to load them
+    // (e.g. because real time is not known yet) only costs DNS-SD lookups.
+    CHIP_ERROR cacheErr = static_cast<AddressResolve::Impl::Resolver &>(AddressResolve::Resolver::Instance())
+                              .SetAddressCacheStorage(params.fabricIndependentStorage);
+    if (cacheErr != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Failed to load cached operational addresses: %" CHIP_ERROR_FORMAT, cacheErr.Format());
+    }
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0 && !defined(CHIP_ADDRESS_RESOLVE_IMPL_INCLUDE_HEADER)
+
     ReturnErrorOnFailure(chip::app::InteractionModelEngine::GetInstance()->Init(
         stateParams.exchangeMgr, stateParams.fabricTable, stateParams.reportScheduler, stateParams.caseSessionManager));
 
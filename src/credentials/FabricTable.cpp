@@ -354,14 +354,46 @@ CHIP_ERROR FabricTable::VerifyCredentials(FabricIndex fabricIndex, const ByteSpa
     uint8_t rootCertBuf[kMaxCHIPCertLength];
     MutableByteSpan rootCertSpan{ rootCertBuf };
     ReturnErrorOnFailure(FetchRootCert(fabricIndex, rootCertSpan));
-    return VerifyCredentials(noc, icac, rootCertSpan, context, outCompressedFabricId, outFabricId, outNodeId, outNocPubkey,
-                             outRootPublicKey);
+
+    VerifiedCredentials credentials;
+    if (!LookupVerifiedCredentials(fabricIndex, noc, icac, rootCertSpan, context, credentials))
+    {
+        ReturnErrorOnFailure(VerifyCredentials(noc, icac, rootCertSpan, context, credentials));
+        CacheVerifiedCredentials(fabricIndex, noc, icac, rootCertSpan, context, credentials);
+    }
+
+    outCompressedFabricId = credentials.compressedFabricId;
+    outFabricId           = credentials.fabricId;
+    outNodeId             = credentials.nodeId;
+    outNocPubkey          = credentials.nocPublicKey;
+    if (outRootPublicKey != nullptr)
+    {
+        *outRootPublicKey = credentials.rootPublicKey;
+    }
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR FabricTable::VerifyCredentials(const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac,
                                           ValidationContext & context, CompressedFabricId & outCompressedFabricId,
                                           FabricId & outFabricId, NodeId & outNodeId, Crypto::P256PublicKey & outNocPubkey,
                                           Crypto::P256PublicKey * outRootPublicKey)
+{
+    VerifiedCredentials credentials;
+    ReturnErrorOnFailure(VerifyCredentials(noc, icac, rcac, context, credentials));
+
+    outCompressedFabricId = credentials.compressedFabricId;
+    outFabricId           = credentials.fabricId;
+    outNodeId             = credentials.nodeId;
+    outNocPubkey          = credentials.nocPublicKey;
+    if (outRootPublicKey != nullptr)
+    {
+        *outRootPublicKey = credentials.rootPublicKey;
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR FabricTable::VerifyCredentials(const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac,
+                                          ValidationContext & context, VerifiedCredentials & outCredentials)
 {
     // TODO - Optimize credentials verification logic
     //        The certificate chain construction and verification is a compute and memory intensive operation.
@@ -389,7 +421,8 @@ CHIP_ERROR FabricTable::VerifyCredentials(const ByteSpan & noc, const ByteSpan &
     // It confirms that the certs link correctly (noc -> icac -> rcac), and have been correctly signed.
     ReturnErrorOnFailure(certificates.FindValidCert(nocSubjectDN, nocSubjectKeyId, context, &resultCert));
 
-    ReturnErrorOnFailure(ExtractNodeIdFabricIdFromOpCert(certificates.GetLastCert()[0], &outNodeId, &outFabricId));
+    ReturnErrorOnFailure(
+        ExtractNodeIdFabricIdFromOpCert(certificates.GetLastCert()[0], &outCredentials.nodeId, &outCredentials.fabricId));
 
     CHIP_ERROR err;
     FabricId icacFabricId = kUndefinedFabricId;
@@ -398,7 +431,7 @@ CHIP_ERROR FabricTable::VerifyCredentials(const ByteSpan & noc, const ByteSpan &
         err = ExtractFabricIdFromCert(certificates.GetCertSet()[1], &icacFabricId);
         if (err == CHIP_NO_ERROR)
         {
-            ReturnErrorCodeIf(icacFabricId != outFabricId, CHIP_ERROR_FABRIC_MISMATCH_ON_ICA);
+            ReturnErrorCodeIf(icacFabricId != outCredentials.fabricId, CHIP_ERROR_FABRIC_MISMATCH_ON_ICA);
         }
         // FabricId is optional field in ICAC and "not found" code is not treated as error.
         else if (err != CHIP_ERROR_NOT_FOUND)
@@ -411,7 +444,7 @@ CHIP_ERROR FabricTable::VerifyCredentials(const ByteSpan & noc, const ByteSpan &
     err                   = ExtractFabricIdFromCert(certificates.GetCertSet()[0], &rcacFabricId);
     if (err == CHIP_NO_ERROR)
     {
-        ReturnErrorCodeIf(rcacFabricId != outFabricId, CHIP_ERROR_WRONG_CERT_DN);
+        ReturnErrorCodeIf(rcacFabricId != outCredentials.fabricId, CHIP_ERROR_WRONG_CERT_DN);
     }
     // FabricId is optional field in RCAC and "not found" code is not treated as error.
     else if (err != CHIP_ERROR_NOT_FOUND)
@@ -425,23 +458,47 @@ CHIP_ERROR FabricTable::VerifyCredentials(const ByteSpan & noc, const ByteSpan &
         MutableByteSpan compressedFabricIdSpan(compressedFabricIdBuf);
         P256PublicKey rootPubkey(certificates.GetCertSet()[0].mPublicKey);
 
-        ReturnErrorOnFailure(GenerateCompressedFabricId(rootPubkey, outFabricId, compressedFabricIdSpan));
+        ReturnErrorOnFailure(GenerateCompressedFabricId(rootPubkey, outCredentials.fabricId, compressedFabricIdSpan));
 
         // Decode compressed fabric ID accounting for endianness, as GenerateCompressedFabricId()
         // returns a binary buffer and is agnostic of usage of the output as an integer type.
-        outCompressedFabricId = Encoding::BigEndian::Get64(compressedFabricIdBuf);
+        outCredentials.compressedFabricId = Encoding::BigEndian::Get64(compressedFabricIdBuf);
+        outCredentials.rootPublicKey      = rootPubkey;
+    }
 
-        if (outRootPublicKey != nullptr)
+    outCredentials.nocPublicKey = certificates.GetLastCert()->mPublicKey;
+
+    // The chain is only valid while all of its certificates are.
+    outCredentials.notBeforeTime = 0;
+    outCredentials.notAfterTime  = kNullCertTime;
+    for (uint8_t i = 0; i < certificates.GetCertCount(); i++)
+    {
+        const ChipCertificateData & cert = certificates.GetCertSet()[i];
+        outCredentials.notBeforeTime     = std::max(outCredentials.notBeforeTime, cert.mNotBeforeTime);
+        if (cert.mNotAfterTime != kNullCertTime &&
+            (outCredentials.notAfterTime == kNullCertTime || cert.mNotAfterTime < outCredentials.notAfterTime))
         {
-            *outRootPublicKey = rootPubkey;
+            outCredentials.notAfterTime = cert.mNotAfterTime;
         }
     }
 
-    outNocPubkey = certificates.GetLastCert()->mPublicKey;
-
     return CHIP_NO_ERROR;
 }
 
+bool FabricTable::LookupVerifiedCredentials(FabricIndex fabricIndex, const ByteSpan & noc, const ByteSpan & icac,
+                                            const ByteSpan & rcac, const ValidationContext & context,
+                                            VerifiedCredentials & outCredentials) const
+{
+    return mVerifiedCertificateCache.Lookup(fabricIndex, noc, icac, rcac, context, outCredentials);
+}
+
+void FabricTable::CacheVerifiedCredentials(FabricIndex fabricIndex, const ByteSpan & noc, const ByteSpan & icac,
+                                           const ByteSpan & rcac, const ValidationContext & context,
+                                           const VerifiedCredentials & credentials) const
+{
+    mVerifiedCertificateCache.Insert(fabricIndex, noc, icac, rcac, context, credentials);
+}
+
 const FabricInfo * FabricTable::FindFabric(const Crypto::P256PublicKey & rootPubKey, FabricId fabricId) const
 {
     return FindFabricCommon(rootPubKey, fabricId);
@@ -758,6 +815,8 @@ public:
 CHIP_ERROR FabricTable::NotifyFabricUpdated(FabricIndex fabricIndex)
 {
     MATTER_TRACE_SCOPE("NotifyFabricUpdated", "Fabric");
+    mVerifiedCertificateCache.Invalidate(fabricIndex);
+
     FabricTable::Delegate * delegate = mDelegateListRoot;
     while (delegate)
     {
@@ -773,6 +832,7 @@ CHIP_ERROR FabricTable::NotifyFabricUpdated(FabricIndex fabricIndex)
 CHIP_ERROR FabricTable::NotifyFabricCommitted(FabricIndex fabricIndex)
 {
     MATTER_TRACE_SCOPE("NotifyFabricCommitted", "Fabric");
+    mVerifiedCertificateCache.Invalidate(fabricIndex);
 
     FabricTable::Delegate * delegate = mDelegateListRoot;
     while (delegate)
@@ -786,6 +846,21 @@ CHIP_ERROR FabricTable::NotifyFabricCommitted(FabricIndex fabricIndex)
     return CHIP_NO_ERROR;
 }
 
+void FabricTable::NotifyFabricUpdateReverted(FabricIndex fabricIndex)
+{
+    MATTER_TRACE_SCOPE("NotifyFabricUpdateReverted", "Fabric");
+
+    FabricTable::Delegate * delegate = mDelegateListRoot;
+    while (delegate)
+    {
+        // It is possible that delegate will remove itself from the list in the callback
+        // so we grab the next delegate in the list now.
+        FabricTable::Delegate * nextDelegate = delegate->next;
+        delegate->OnFabricUpdateReverted(*this, fabricIndex);
+        delegate = nextDelegate;
+    }
+}
+
 CHIP_ERROR
 FabricTable::AddOrUpdateInner(FabricIndex fabricIndex, bool isAddition, Crypto::P256Keypair * existingOpKey,
                               bool isExistingOpKeyExternallyOwned, uint16_t vendorId, AdvertiseIdentity advertiseIdentity)
@@ -936,6 +1011,8 @@ CHIP_ERROR FabricTable::Delete(FabricIndex fabricIndex)
     VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(IsValidFabricIndex(fabricIndex), CHIP_ERROR_INVALID_ARGUMENT);
 
+    mVerifiedCertificateCache.Invalidate(fabricIndex);
+
     {
         FabricTable::Delegate * delegate = mDelegateListRoot;
         while (delegate)
@@ -1135,6 +1212,7 @@ void FabricTable::Forget(FabricIndex fabricIndex)
 
     RevertPendingFabricData();
     fabricInfo->Reset();
+    mVerifiedCertificateCache.Invalidate(fabricIndex);
 }
 
 void FabricTable::Shutdown()
@@ -1152,6 +1230,7 @@ void FabricTable::Shutdown()
     }
 
     RevertPendingFabricData();
+    mVerifiedCertificateCache.InvalidateAll();
     for (FabricInfo & fabricInfo : mStates)
     {
         // Clear-out any FabricInfo-owned operational keys and make sure any further
@@ -1899,6 +1978,10 @@ CHIP_ERROR FabricTable::CommitPendingFabricData()
         ChipLogError(FabricProvisioning, "Failed to store commit marker, may be inconsistent if reboot happens during fail-safe!");
     }
 
+    // Everything below is flushed to storage as one batch. The commit marker above is kept
+    // outside of it, so that it is durable before any of the fabric data.
+    PersistentStorageTransaction storageTransaction(*mStorage);
+
     {
         // This scope block is to illustrate the complete commit transaction
         // state. We can see it contains a LARGE number of items...
@@ -1999,6 +2082,13 @@ CHIP_ERROR FabricTable::CommitPendingFabricData()
         stickyError = (stickyError != CHIP_NO_ERROR) ? stickyError : fabricIndexErr;
     }
 
+    CHIP_ERROR transactionErr = storageTransaction.Commit();
+    if (transactionErr != CHIP_NO_ERROR)
+    {
+        ChipLogError(FabricProvisioning, "Failed to flush committed fabric data: %" CHIP_ERROR_FORMAT, transactionErr.Format());
+    }
+    stickyError = (stickyError != CHIP_NO_ERROR) ? stickyError : transactionErr;
+
     // Commit must have same side-effect as reverting all pending data
     mStateFlags.ClearAll();
     mFabricIndexWithPendingState = kUndefinedFabricIndex;
@@ -2052,6 +2142,12 @@ void FabricTable::RevertPendingOpCertsExceptRoot()
     MATTER_TRACE_SCOPE("RevertPendingOpCertsExceptRoot", "Fabric");
     mPendingFabric.Reset();
 
+    // Drop whatever was verified against the certificates being reverted.
+    if (IsValidFabricIndex(mFabricIndexWithPendingState))
+    {
+        mVerifiedCertificateCache.Invalidate(mFabricIndexWithPendingState);
+    }
+
     if (mStateFlags.Has(StateFlags::kIsPendingFabricDataPresent))
     {
         ChipLogError(FabricProvisioning, "Reverting pending fabric data for fabric 0x%x",
@@ -2069,12 +2165,21 @@ void FabricTable::RevertPendingOpCertsExceptRoot()
         Delete(mFabricIndexWithPendingState);
     }
 
+    // A reverted update brings back the previous operational identity of the fabric.
+    FabricIndex revertedUpdateFabricIndex =
+        mStateFlags.Has(StateFlags::kIsUpdatePending) ? mFabricIndexWithPendingState : kUndefinedFabricIndex;
+
     mStateFlags.Clear(StateFlags::kIsAddPending);
     mStateFlags.Clear(StateFlags::kIsUpdatePending);
     if (!mStateFlags.Has(StateFlags::kIsTrustedRootPending))
     {
         mFabricIndexWithPendingState = kUndefinedFabricIndex;
     }
+
+    if (IsValidFabricIndex(revertedUpdateFabricIndex))
+    {
+        NotifyFabricUpdateReverted(revertedUpdateFabricIndex);
+    }
 }
 
 CHIP_ERROR FabricTable::SetFabricLabel(FabricIndex fabricIndex, const CharSpan & fabricLabel)
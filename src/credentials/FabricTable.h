@@ -29,6 +29,7 @@
 #include <credentials/CertificateValidityPolicy.h>
 #include <credentials/LastKnownGoodTime.h>
 #include <credentials/OperationalCertificateStore.h>
+#include <credentials/VerifiedCertificateCache.h>
 #include <crypto/CHIPCryptoPAL.h>
 #include <crypto/OperationalKeystore.h>
 #include <lib/core/CHIPEncoding.h>
@@ -392,6 +393,14 @@ public:
          **/
         virtual void OnFabricUpdated(const FabricTable & fabricTable, FabricIndex fabricIndex){};
 
+        /**
+         * Gets called when a pending update of operational credentials is reverted, such as on
+         * RevertPendingFabricData(), so that the fabric is back to its last committed operational identity.
+         *
+         * Only meant for state derived from that identity (e.g. cached destination identifiers).
+         **/
+        virtual void OnFabricUpdateReverted(const FabricTable & fabricTable, FabricIndex fabricIndex) {}
+
         // Intrusive list pointer for FabricTable to manage the entries.
         Delegate * next = nullptr;
     };
@@ -955,6 +964,41 @@ public:
                                         Credentials::ValidationContext & context, CompressedFabricId & outCompressedFabricId,
                                         FabricId & outFabricId, NodeId & outNodeId, Crypto::P256PublicKey & outNocPubkey,
                                         Crypto::P256PublicKey * outRootPublicKey = nullptr);
+
+    // Verifies credentials, using the provided root certificate. Also reports the validity period of the chain,
+    // so that the result can be given to CacheVerifiedCredentials().
+    static CHIP_ERROR VerifyCredentials(const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac,
+                                        Credentials::ValidationContext & context,
+                                        Credentials::VerifiedCredentials & outCredentials);
+
+    /**
+     * @brief Looks up credentials of the given fabric that were verified before, and whose verification
+     *        still holds for `context` (see Credentials::VerifiedCertificateCache).
+     *
+     * This allows to skip VerifyCredentials() for a chain that is validated again and again, e.g. on every
+     * CASE session establishment with the same peer. The chain is still bound to the root certificate
+     * of `fabricIndex` passed as `rcac`.
+     *
+     * @retval true if `outCredentials` was filled from the cache
+     * @retval false if the chain needs to be verified
+     */
+    bool LookupVerifiedCredentials(FabricIndex fabricIndex, const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac,
+                                   const Credentials::ValidationContext & context,
+                                   Credentials::VerifiedCredentials & outCredentials) const;
+
+    /**
+     * @brief Records credentials of the given fabric successfully verified with VerifyCredentials().
+     *
+     * Cached credentials are dropped whenever the fabric is updated, committed, reverted or removed.
+     */
+    void CacheVerifiedCredentials(FabricIndex fabricIndex, const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac,
+                                  const Credentials::ValidationContext & context,
+                                  const Credentials::VerifiedCredentials & credentials) const;
+
+    const Credentials::VerifiedCertificateCache::Statistics & GetVerifiedCertificateCacheStatistics() const
+    {
+        return mVerifiedCertificateCache.GetStatistics();
+    }
     /**
      * @brief Enables FabricInfo instances to collide and reference the same logical fabric (i.e Root Public Key + FabricId).
      *
@@ -1156,6 +1200,7 @@ private:
 
     CHIP_ERROR NotifyFabricUpdated(FabricIndex fabricIndex);
     CHIP_ERROR NotifyFabricCommitted(FabricIndex fabricIndex);
+    void NotifyFabricUpdateReverted(FabricIndex fabricIndex);
 
     // Commit management clean-up APIs
     CHIP_ERROR StoreCommitMarker(const CommitMarker & commitMarker);
@@ -1181,6 +1226,14 @@ private:
 
     LastKnownGoodTime mLastKnownGoodTime;
 
+#if CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+    Credentials::VerifiedCertificateCache::Entry mVerifiedCertificateCacheEntries[CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE];
+    mutable Credentials::VerifiedCertificateCache mVerifiedCertificateCache{ Span<Credentials::VerifiedCertificateCache::Entry>(
+        mVerifiedCertificateCacheEntries) };
+#else
+    mutable Credentials::VerifiedCertificateCache mVerifiedCertificateCache{ Span<Credentials::VerifiedCertificateCache::Entry>() };
+#endif // CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+
     // We may not have an mNextAvailableFabricIndex if our table is as large as
     // it can go and is full.
     Optional<FabricIndex> mNextAvailableFabricIndex;
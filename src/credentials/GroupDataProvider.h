@@ -187,6 +187,23 @@ public:
         virtual void OnGroupRemoved(FabricIndex fabric_index, const GroupInfo & old_group) = 0;
     };
 
+    /**
+     *  Interface to listen for changes in the IPK key set of a fabric.
+     */
+    class IpkKeySetListener
+    {
+    public:
+        virtual ~IpkKeySetListener() = default;
+        /**
+         *  Callback invoked when the IPK key set of a fabric is being set or removed.
+         */
+        virtual void OnIpkKeySetChanged(FabricIndex fabric_index) = 0;
+
+    private:
+        friend class GroupDataProvider;
+        IpkKeySetListener * mNextIpkKeySetListener = nullptr;
+    };
+
     using GroupInfoIterator    = CommonIterator<GroupInfo>;
     using GroupKeyIterator     = CommonIterator<GroupKey>;
     using EndpointIterator     = CommonIterator<GroupEndpoint>;
@@ -316,6 +333,32 @@ public:
     void SetListener(GroupListener * listener) { mListener = listener; };
     void RemoveListener() { mListener = nullptr; };
 
+    // IPK key set listeners, of which there can be several. A listener must be removed before it is destroyed.
+    void AddIpkKeySetListener(IpkKeySetListener * listener)
+    {
+        for (IpkKeySetListener * iter = mIpkKeySetListeners; iter != nullptr; iter = iter->mNextIpkKeySetListener)
+        {
+            if (iter == listener)
+            {
+                return;
+            }
+        }
+        listener->mNextIpkKeySetListener = mIpkKeySetListeners;
+        mIpkKeySetListeners              = listener;
+    }
+    void RemoveIpkKeySetListener(IpkKeySetListener * listener)
+    {
+        for (IpkKeySetListener ** iter = &mIpkKeySetListeners; *iter != nullptr; iter = &(*iter)->mNextIpkKeySetListener)
+        {
+            if (*iter == listener)
+            {
+                *iter                            = listener->mNextIpkKeySetListener;
+                listener->mNextIpkKeySetListener = nullptr;
+                return;
+            }
+        }
+    }
+
 protected:
     void GroupAdded(FabricIndex fabric_index, const GroupInfo & new_group)
     {
@@ -331,9 +374,17 @@ protected:
             mListener->OnGroupRemoved(fabric_index, old_group);
         }
     }
+    void IpkKeySetChanged(FabricIndex fabric_index)
+    {
+        for (IpkKeySetListener * iter = mIpkKeySetListeners; iter != nullptr; iter = iter->mNextIpkKeySetListener)
+        {
+            iter->OnIpkKeySetChanged(fabric_index);
+        }
+    }
     const uint16_t mMaxGroupsPerFabric;
     const uint16_t mMaxGroupKeysPerFabric;
-    GroupListener * mListener = nullptr;
+    GroupListener * mListener               = nullptr;
+    IpkKeySetListener * mIpkKeySetListeners = nullptr;
 };
 
 /**
@@ -17,6 +17,7 @@
 #include <credentials/GroupDataProviderImpl.h>
 #include <crypto/CHIPCryptoPAL.h>
 #include <lib/core/TLV.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/CommonPersistentData.h>
 #include <lib/support/DefaultStorageKeyAllocator.h>
@@ -24,6 +25,9 @@
 #include <lib/support/Pool.h>
 #include <stdlib.h>
 
+#include <algorithm>
+#include <new>
+
 namespace chip {
 namespace Credentials {
 
@@ -832,12 +836,14 @@ void GroupDataProviderImpl::Finish()
     mKeySetIterators.ReleaseAll();
     mGroupSessionsIterator.ReleaseAll();
     mGroupKeyContexPool.ReleaseAll();
+    InvalidateGroupSessionIndex();
 }
 
 void GroupDataProviderImpl::SetStorageDelegate(PersistentStorageDelegate * storage)
 {
     VerifyOrDie(storage != nullptr);
     mStorage = storage;
+    InvalidateGroupSessionIndex();
 }
 
 //
@@ -896,6 +902,8 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupInfoAt(chip::FabricIndex fabric_index,
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
+    // The linked list updates below are flushed together
+    PersistentStorageTransaction transaction(*mStorage);
     FabricData fabric(fabric_index);
     GroupData group;
 
@@ -914,7 +922,8 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupInfoAt(chip::FabricIndex fabric_index,
     if (found)
     {
         // Update existing entry
-        return group.Save(mStorage);
+        ReturnErrorOnFailure(group.Save(mStorage));
+        return transaction.Commit();
     }
     if (index < fabric.group_count)
     {
@@ -954,6 +963,7 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupInfoAt(chip::FabricIndex fabric_index,
     }
     // Update fabric
     ReturnErrorOnFailure(fabric.Save(mStorage));
+    ReturnErrorOnFailure(transaction.Commit());
     GroupAdded(fabric_index, group);
     return CHIP_NO_ERROR;
 }
@@ -1349,7 +1359,10 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index
 CHIP_ERROR GroupDataProviderImpl::SetGroupKeyAt(chip::FabricIndex fabric_index, size_t index, const GroupKey & in_map)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
 
+    // The linked list updates below are flushed together
+    PersistentStorageTransaction transaction(*mStorage);
     FabricData fabric(fabric_index);
     KeyMapData map(fabric_index);
 
@@ -1368,7 +1381,8 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupKeyAt(chip::FabricIndex fabric_index,
     if (found)
     {
         // Update existing map
-        return map.Save(mStorage);
+        ReturnErrorOnFailure(map.Save(mStorage));
+        return transaction.Commit();
     }
 
     // Insert last
@@ -1393,7 +1407,8 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupKeyAt(chip::FabricIndex fabric_index,
     }
     // Update fabric
     fabric.map_count++;
-    return fabric.Save(mStorage);
+    ReturnErrorOnFailure(fabric.Save(mStorage));
+    return transaction.Commit();
 }
 
 CHIP_ERROR GroupDataProviderImpl::GetGroupKeyAt(chip::FabricIndex fabric_index, size_t index, GroupKey & out_map)
@@ -1415,6 +1430,7 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupKeyAt(chip::FabricIndex fabric_index,
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_index, size_t index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
 
     FabricData fabric(fabric_index);
     KeyMapData map;
@@ -1447,6 +1463,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_inde
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeys(chip::FabricIndex fabric_index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
 
     FabricData fabric(fabric_index);
     VerifyOrReturnError(CHIP_NO_ERROR == fabric.Load(mStorage), CHIP_ERROR_INVALID_FABRIC_INDEX);
@@ -1523,7 +1540,14 @@ CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, cons
                                             const KeySet & in_keyset)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
+    if (in_keyset.keyset_id == kIdentityProtectionKeySetId)
+    {
+        IpkKeySetChanged(fabric_index);
+    }
 
+    // The keyset and the fabric list are flushed together
+    PersistentStorageTransaction transaction(*mStorage);
     FabricData fabric(fabric_index);
     KeySetData keyset;
 
@@ -1553,7 +1577,8 @@ CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, cons
     if (found)
     {
         // Update existing keyset info, keep next
-        return keyset.Save(mStorage);
+        ReturnErrorOnFailure(keyset.Save(mStorage));
+        return transaction.Commit();
     }
 
     // New keyset
@@ -1565,7 +1590,8 @@ CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, cons
     // Update fabric
     fabric.keyset_count++;
     fabric.first_keyset = in_keyset.keyset_id;
-    return fabric.Save(mStorage);
+    ReturnErrorOnFailure(fabric.Save(mStorage));
+    return transaction.Commit();
 }
 
 CHIP_ERROR GroupDataProviderImpl::GetKeySet(chip::FabricIndex fabric_index, uint16_t target_id, KeySet & out_keyset)
@@ -1594,6 +1620,11 @@ CHIP_ERROR GroupDataProviderImpl::GetKeySet(chip::FabricIndex fabric_index, uint
 CHIP_ERROR GroupDataProviderImpl::RemoveKeySet(chip::FabricIndex fabric_index, uint16_t target_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
+    if (target_id == kIdentityProtectionKeySetId)
+    {
+        IpkKeySetChanged(fabric_index);
+    }
 
     FabricData fabric(fabric_index);
     KeySetData keyset;
@@ -1695,6 +1726,10 @@ void GroupDataProviderImpl::KeySetIteratorImpl::Release()
 
 CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
 {
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+
+    // Removing a fabric touches every record it owns, flush them all at once
+    PersistentStorageTransaction transaction(*mStorage);
     FabricData fabric(fabric_index);
 
     // Fabric data defaults to zero, so if not entry is found, no mappings, or keys are removed
@@ -1734,7 +1769,8 @@ CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
     }
 
     // Remove fabric
-    return fabric.Delete(mStorage);
+    ReturnErrorOnFailure(fabric.Delete(mStorage));
+    return transaction.Commit();
 }
 
 //
@@ -1839,12 +1875,145 @@ CHIP_ERROR GroupDataProviderImpl::GroupKeyContext::PrivacyDecrypt(const ByteSpan
 GroupDataProviderImpl::GroupSessionIterator * GroupDataProviderImpl::IterateGroupSessions(uint16_t session_id)
 {
     VerifyOrReturnError(IsInitialized(), nullptr);
+    if (!mSessionIndexValid && mGroupSessionsIterator.Allocated() == 0)
+    {
+        // Without the index, the iterator falls back to reading the storage
+        ReleaseGroupSessionIndex();
+        if (CHIP_NO_ERROR != BuildGroupSessionIndex())
+        {
+            ReleaseGroupSessionIndex();
+        }
+    }
     return mGroupSessionsIterator.CreateObject(*this, session_id);
 }
 
+CHIP_ERROR GroupDataProviderImpl::BuildGroupSessionIndex()
+{
+    FabricList fabric_list;
+    CHIP_ERROR err = fabric_list.Load(mStorage);
+    if (CHIP_ERROR_NOT_FOUND == err)
+    {
+        // No fabrics, no sessions
+        mSessionIndexValid = true;
+        return CHIP_NO_ERROR;
+    }
+    ReturnErrorOnFailure(err);
+
+    // Size the index from the fabric records: each group-key mapping yields at most one session per epoch key,
+    // and each keyset used by a mapping yields one key per epoch key.
+    FabricData fabric(fabric_list.first_entry);
+    size_t max_entries = 0;
+    size_t max_keys    = 0;
+    for (size_t i = 0; i < fabric_list.entry_count; i++, fabric.fabric_index = fabric.next)
+    {
+        ReturnErrorOnFailure(fabric.Load(mStorage));
+        max_entries += static_cast<size_t>(fabric.map_count) * KeySet::kEpochKeysMax;
+        max_keys += static_cast<size_t>(std::min(fabric.map_count, fabric.keyset_count)) * KeySet::kEpochKeysMax;
+    }
+
+    if (max_entries > 0 && max_keys > 0)
+    {
+        mSessionEntries = static_cast<GroupSessionEntry *>(Platform::MemoryCalloc(max_entries, sizeof(GroupSessionEntry)));
+        mSessionKeys    = static_cast<GroupSessionKey *>(Platform::MemoryCalloc(max_keys, sizeof(GroupSessionKey)));
+        VerifyOrReturnError(mSessionEntries != nullptr && mSessionKeys != nullptr, CHIP_ERROR_NO_MEMORY);
+    }
+
+    fabric.fabric_index = fabric_list.first_entry;
+    for (size_t i = 0; i < fabric_list.entry_count; i++, fabric.fabric_index = fabric.next)
+    {
+        ReturnErrorOnFailure(fabric.Load(mStorage));
+
+        // Keys of the keysets of the current fabric start here
+        const size_t first_key = mSessionKeyCount;
+
+        KeyMapData mapping(fabric.fabric_index, fabric.first_map);
+        for (uint16_t j = 0; j < fabric.map_count; ++j, mapping.id = mapping.next)
+        {
+            ReturnErrorOnFailure(mapping.Load(mStorage));
+
+            // Look for the keys of the mapped keyset, loading them the first time the keyset is mapped
+            size_t key = first_key;
+            while (key < mSessionKeyCount && mSessionKeys[key].keyset_id != mapping.keyset_id)
+            {
+                key++;
+            }
+            KeySetData keyset;
+            if (key == mSessionKeyCount && keyset.Find(mStorage, fabric, mapping.keyset_id))
+            {
+                const size_t keys_count = std::min<size_t>(keyset.keys_count, ArraySize(keyset.operational_keys));
+                VerifyOrReturnError(mSessionKeyCount + keys_count <= max_keys, CHIP_ERROR_INTERNAL);
+                for (size_t k = 0; k < keys_count; ++k)
+                {
+                    new (&mSessionKeys[mSessionKeyCount++])
+                        GroupSessionKey(*this, keyset.keyset_id, keyset.policy, keyset.operational_keys[k]);
+                }
+            }
+
+            for (; key < mSessionKeyCount && mSessionKeys[key].keyset_id == mapping.keyset_id; ++key)
+            {
+                VerifyOrReturnError(mSessionEntryCount < max_entries, CHIP_ERROR_INTERNAL);
+                GroupSessionEntry & entry = mSessionEntries[mSessionEntryCount++];
+                entry.session_id          = mSessionKeys[key].key_context.GetKeyHash();
+                entry.fabric_index        = fabric.fabric_index;
+                entry.group_id            = mapping.group_id;
+                entry.security_policy     = mSessionKeys[key].security_policy;
+                entry.key_context         = &mSessionKeys[key].key_context;
+            }
+        }
+    }
+
+    // Sort by session id, keeping the storage order of the sessions sharing an id
+    std::stable_sort(mSessionEntries, mSessionEntries + mSessionEntryCount,
+                     [](const GroupSessionEntry & a, const GroupSessionEntry & b) { return a.session_id < b.session_id; });
+
+    mSessionIndexValid = true;
+    return CHIP_NO_ERROR;
+}
+
+void GroupDataProviderImpl::InvalidateGroupSessionIndex()
+{
+    mSessionIndexValid = false;
+    if (mGroupSessionsIterator.Allocated() == 0)
+    {
+        ReleaseGroupSessionIndex();
+    }
+}
+
+void GroupDataProviderImpl::ReleaseGroupSessionIndex()
+{
+    for (size_t i = 0; i < mSessionKeyCount; ++i)
+    {
+        mSessionKeys[i].key_context.ReleaseKeys();
+        mSessionKeys[i].~GroupSessionKey();
+    }
+    Platform::MemoryFree(mSessionKeys);
+    Platform::MemoryFree(mSessionEntries);
+    mSessionKeys       = nullptr;
+    mSessionKeyCount   = 0;
+    mSessionEntries    = nullptr;
+    mSessionEntryCount = 0;
+    mSessionIndexValid = false;
+}
+
 GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupDataProviderImpl & provider, uint16_t session_id) :
     mProvider(provider), mSessionId(session_id), mGroupKeyContext(provider)
 {
+    if (provider.mSessionIndexValid)
+    {
+        const GroupSessionEntry * begin = provider.mSessionEntries;
+        const GroupSessionEntry * end   = begin + provider.mSessionEntryCount;
+        auto earlier                    = [](const GroupSessionEntry & entry, uint16_t id) { return entry.session_id < id; };
+        mFirstEntry                     = std::lower_bound(begin, end, session_id, earlier);
+        mNextEntry                      = mFirstEntry;
+        mEndEntry                       = mFirstEntry;
+        while (mEndEntry < end && mEndEntry->session_id == session_id)
+        {
+            mEndEntry++;
+        }
+        mIndexed = true;
+        return;
+    }
+
     FabricList fabric_list;
     ReturnOnFailure(fabric_list.Load(provider.mStorage));
     mFirstFabric = fabric_list.first_entry;
@@ -1857,6 +2026,11 @@ GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupD
 
 size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 {
+    if (mIndexed)
+    {
+        return static_cast<size_t>(mEndEntry - mFirstEntry);
+    }
+
     FabricData fabric(mFirstFabric);
     size_t count = 0;
 
@@ -1898,6 +2072,17 @@ size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 
 bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output)
 {
+    if (mIndexed)
+    {
+        VerifyOrReturnError(mNextEntry < mEndEntry, false);
+        output.fabric_index    = mNextEntry->fabric_index;
+        output.group_id        = mNextEntry->group_id;
+        output.security_policy = mNextEntry->security_policy;
+        output.keyContext      = mNextEntry->key_context;
+        mNextEntry++;
+        return true;
+    }
+
     while (mFabricCount < mFabricTotal)
     {
         FabricData fabric(mFabric);
@@ -1952,8 +2137,15 @@ bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output
 
 void GroupDataProviderImpl::GroupSessionIteratorImpl::Release()
 {
+    GroupDataProviderImpl & provider = mProvider;
     mGroupKeyContext.ReleaseKeys();
-    mProvider.mGroupSessionsIterator.ReleaseObject(this);
+    provider.mGroupSessionsIterator.ReleaseObject(this);
+
+    // Release an out-of-date index once its last user is gone
+    if (!provider.mSessionIndexValid && provider.mGroupSessionsIterator.Allocated() == 0)
+    {
+        provider.ReleaseGroupSessionIndex();
+    }
 }
 
 namespace {
@@ -221,6 +221,29 @@ protected:
         size_t mTotal       = 0;
     };
 
+    // The keys of one epoch key of a keyset, shared by all the groups mapped to the keyset.
+    struct GroupSessionKey
+    {
+        GroupSessionKey(GroupDataProviderImpl & provider, KeysetId id, SecurityPolicy policy,
+                        const Crypto::GroupOperationalCredentials & creds) :
+            keyset_id(id), security_policy(policy), key_context(provider, creds.encryption_key, creds.hash, creds.privacy_key)
+        {}
+
+        KeysetId keyset_id;
+        SecurityPolicy security_policy;
+        GroupKeyContext key_context;
+    };
+
+    // One session of the group session index, sorted by session id.
+    struct GroupSessionEntry
+    {
+        uint16_t session_id;
+        FabricIndex fabric_index;
+        GroupId group_id;
+        SecurityPolicy security_policy;
+        GroupKeyContext * key_context;
+    };
+
     class GroupSessionIteratorImpl : public GroupSessionIterator
     {
     public:
@@ -242,10 +265,24 @@ protected:
         uint16_t mKeyCount       = 0;
         bool mFirstMap           = true;
         GroupKeyContext mGroupKeyContext;
+
+        // Range of the group session index matching the session id, if the index was up to date on creation.
+        const GroupSessionEntry * mFirstEntry = nullptr;
+        const GroupSessionEntry * mNextEntry  = nullptr;
+        const GroupSessionEntry * mEndEntry   = nullptr;
+        bool mIndexed                         = false;
     };
     bool IsInitialized() { return (mStorage != nullptr); }
     CHIP_ERROR RemoveEndpoints(FabricIndex fabric_index, GroupId group_id);
 
+    // The group session index lets IterateGroupSessions() look up the sessions of an incoming group message without
+    // loading the fabrics, group-key mappings and keysets from storage, and without re-creating the keys. It is built on
+    // first use and rebuilt after any change to the keysets or the group-key mappings; while it is out of date and group
+    // session iterators are still in use, new iterators read the storage instead.
+    CHIP_ERROR BuildGroupSessionIndex();
+    void InvalidateGroupSessionIndex();
+    void ReleaseGroupSessionIndex();
+
     PersistentStorageDelegate * mStorage       = nullptr;
     Crypto::SessionKeystore * mSessionKeystore = nullptr;
     ObjectPool<GroupInfoIteratorImpl, kIteratorsMax> mGroupInfoIterators;
@@ -254,6 +291,12 @@ protected:
     ObjectPool<KeySetIteratorImpl, kIteratorsMax> mKeySetIterators;
     ObjectPool<GroupSessionIteratorImpl, kIteratorsMax> mGroupSessionsIterator;
     ObjectPool<GroupKeyContext, kIteratorsMax> mGroupKeyContexPool;
+
+    GroupSessionKey * mSessionKeys      = nullptr;
+    size_t mSessionKeyCount             = 0;
+    GroupSessionEntry * mSessionEntries = nullptr;
+    size_t mSessionEntryCount           = 0;
+    bool mSessionIndexValid             = false;
 };
 
 } // namespace Credentials
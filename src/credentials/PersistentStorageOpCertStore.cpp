@@ -335,6 +335,10 @@ CHIP_ERROR PersistentStorageOpCertStore::CommitOpCertsForFabric(FabricIndex fabr
 
     // TODO: Handle transaction marking to revert partial certs at next boot if we get interrupted by reboot.
 
+    // Storage that supports transactions makes the whole chain durable at once. On failure the
+    // transaction is aborted on return, which also restores the previous certs on update.
+    PersistentStorageTransaction storageTransaction(*mStorage);
+
     // Start committing NOC first so we don't have dangling roots if one was added.
     ByteSpan pendingNocSpan{ mPendingNoc.Get(), mPendingNoc.AllocatedSize() };
     CHIP_ERROR nocErr = SaveCertToStorage(mStorage, mPendingFabricIndex, CertChainElement::kNoc, pendingNocSpan);
@@ -354,6 +358,7 @@ CHIP_ERROR PersistentStorageOpCertStore::CommitOpCertsForFabric(FabricIndex fabr
     CHIP_ERROR stickyErr = nocErr;
     stickyErr            = (stickyErr != CHIP_NO_ERROR) ? stickyErr : icacErr;
     stickyErr            = (stickyErr != CHIP_NO_ERROR) ? stickyErr : rcacErr;
+    stickyErr            = (stickyErr != CHIP_NO_ERROR) ? stickyErr : storageTransaction.Commit();
 
     if (stickyErr != CHIP_NO_ERROR)
     {
@@ -0,0 +1,157 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <credentials/VerifiedCertificateCache.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+
+#include <string.h>
+
+namespace chip {
+namespace Credentials {
+
+bool VerifiedCertificateCache::Lookup(FabricIndex fabricIndex, const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac,
+                                      const ValidationContext & context, VerifiedCredentials & outCredentials)
+{
+    VerifyOrReturnValue(!mEntries.empty() && IsCacheable(context), false);
+
+    uint8_t chainDigest[Crypto::kSHA256_Hash_Length];
+    Entry * entry = nullptr;
+    if (ComputeChainDigest(noc, icac, rcac, chainDigest) == CHIP_NO_ERROR)
+    {
+        entry = Find(fabricIndex, chainDigest, context);
+    }
+
+    if (entry == nullptr || !IsValidAt(entry->credentials, context))
+    {
+        // An entry outside of its validity period is kept: the effective time may be corrected later.
+        mStatistics.misses++;
+        return false;
+    }
+
+    mStatistics.hits++;
+    entry->lastUsed = ++mUseCounter;
+    outCredentials  = entry->credentials;
+    return true;
+}
+
+void VerifiedCertificateCache::Insert(FabricIndex fabricIndex, const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac,
+                                      const ValidationContext & context, const VerifiedCredentials & credentials)
+{
+    VerifyOrReturn(!mEntries.empty() && IsCacheable(context) && IsValidFabricIndex(fabricIndex));
+
+    uint8_t chainDigest[Crypto::kSHA256_Hash_Length];
+    VerifyOrReturn(ComputeChainDigest(noc, icac, rcac, chainDigest) == CHIP_NO_ERROR);
+
+    Entry * entry = Find(fabricIndex, chainDigest, context);
+    if (entry == nullptr)
+    {
+        // Use a free entry, or else replace the least recently used one.
+        for (auto & candidate : mEntries)
+        {
+            if (candidate.fabricIndex == kUndefinedFabricIndex)
+            {
+                entry = &candidate;
+                break;
+            }
+            if (entry == nullptr || candidate.lastUsed < entry->lastUsed)
+            {
+                entry = &candidate;
+            }
+        }
+    }
+
+    entry->fabricIndex = fabricIndex;
+    memcpy(entry->chainDigest, chainDigest, sizeof(chainDigest));
+    entry->requiredKeyUsages   = context.mRequiredKeyUsages;
+    entry->requiredKeyPurposes = context.mRequiredKeyPurposes;
+    entry->requiredCertType    = context.mRequiredCertType;
+    entry->credentials         = credentials;
+    entry->lastUsed            = ++mUseCounter;
+}
+
+void VerifiedCertificateCache::Invalidate(FabricIndex fabricIndex)
+{
+    for (auto & entry : mEntries)
+    {
+        if (entry.fabricIndex == fabricIndex)
+        {
+            entry.fabricIndex = kUndefinedFabricIndex;
+        }
+    }
+}
+
+void VerifiedCertificateCache::InvalidateAll()
+{
+    for (auto & entry : mEntries)
+    {
+        entry.fabricIndex = kUndefinedFabricIndex;
+    }
+}
+
+bool VerifiedCertificateCache::IsValidAt(const VerifiedCredentials & credentials, const ValidationContext & context)
+{
+    // Same outcome as the default validity policy applied to every certificate of the chain:
+    // only a current time outside of the validity period rejects the chain.
+    if (context.mEffectiveTime.Is<CurrentChipEpochTime>())
+    {
+        const uint32_t now = context.mEffectiveTime.Get<CurrentChipEpochTime>().count();
+        return now >= credentials.notBeforeTime && (credentials.notAfterTime == kNullCertTime || now <= credentials.notAfterTime);
+    }
+    return true;
+}
+
+CHIP_ERROR VerifiedCertificateCache::ComputeChainDigest(const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac,
+                                                        uint8_t (&outDigest)[Crypto::kSHA256_Hash_Length])
+{
+    Crypto::Hash_SHA256_stream hash;
+    ReturnErrorOnFailure(hash.Begin());
+    for (const ByteSpan & cert : { noc, icac, rcac })
+    {
+        // Prefix every certificate with its length, so that the boundaries between them are part of the digest.
+        VerifyOrReturnError(CanCastTo<uint16_t>(cert.size()), CHIP_ERROR_INVALID_ARGUMENT);
+        uint8_t length[sizeof(uint16_t)];
+        Encoding::LittleEndian::Put16(length, static_cast<uint16_t>(cert.size()));
+        ReturnErrorOnFailure(hash.AddData(ByteSpan(length)));
+        ReturnErrorOnFailure(hash.AddData(cert));
+    }
+
+    MutableByteSpan digestSpan(outDigest);
+    return hash.Finish(digestSpan);
+}
+
+VerifiedCertificateCache::Entry * VerifiedCertificateCache::Find(FabricIndex fabricIndex,
+                                                                 const uint8_t (&chainDigest)[Crypto::kSHA256_Hash_Length],
+                                                                 const ValidationContext & context)
+{
+    for (auto & entry : mEntries)
+    {
+        if (entry.fabricIndex == fabricIndex && memcmp(entry.chainDigest, chainDigest, sizeof(chainDigest)) == 0 &&
+            entry.requiredKeyUsages.Raw() == context.mRequiredKeyUsages.Raw() &&
+            entry.requiredKeyPurposes.Raw() == context.mRequiredKeyPurposes.Raw() &&
+            entry.requiredCertType == context.mRequiredCertType)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace Credentials
+} // namespace chip
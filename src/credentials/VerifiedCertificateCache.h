@@ -0,0 +1,115 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @brief Defines a cache of operational certificate chains that have already been validated.
+ */
+
+#pragma once
+
+#include <credentials/CHIPCert.h>
+#include <credentials/CHIPCertificateSet.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/NodeId.h>
+#include <lib/support/Span.h>
+
+namespace chip {
+namespace Credentials {
+
+/// What a successful validation of an operational certificate chain (NOC, optional ICAC, RCAC) yields.
+struct VerifiedCredentials
+{
+    CompressedFabricId compressedFabricId = kUndefinedCompressedFabricId;
+    FabricId fabricId                     = kUndefinedFabricId;
+    NodeId nodeId                         = kUndefinedNodeId;
+    Crypto::P256PublicKey nocPublicKey;
+    Crypto::P256PublicKey rootPublicKey;
+
+    // Period, in seconds since the CHIP epoch, during which every certificate of the chain is valid.
+    uint32_t notBeforeTime = 0;
+    uint32_t notAfterTime  = kNullCertTime; // kNullCertTime if no certificate of the chain expires
+};
+
+/// Remembers the outcome of successful certificate chain validations, so that validating the same
+/// chain again (e.g. when a peer re-establishes a CASE session) does not need to decode the
+/// certificates and verify their signatures again.
+///
+/// Entries are scoped to a fabric and keyed by a digest of the whole chain. A cached chain is
+/// only reused for a validation context requiring the same key usages, key purposes and
+/// certificate type, and whose effective time falls within the validity period of the chain.
+/// Validations using a custom validity policy are never cached, since the policy may decide
+/// differently next time.
+///
+/// This class is not thread-safe.
+class VerifiedCertificateCache
+{
+public:
+    struct Entry
+    {
+        FabricIndex fabricIndex = kUndefinedFabricIndex; // kUndefinedFabricIndex for an unused entry
+        uint8_t chainDigest[Crypto::kSHA256_Hash_Length];
+        BitFlags<KeyUsageFlags> requiredKeyUsages;
+        BitFlags<KeyPurposeFlags> requiredKeyPurposes;
+        CertType requiredCertType = CertType::kNotSpecified;
+        VerifiedCredentials credentials;
+        uint32_t lastUsed = 0;
+    };
+
+    struct Statistics
+    {
+        uint32_t hits   = 0; // validations answered from the cache
+        uint32_t misses = 0; // cacheable validations that were not
+    };
+
+    /// The cache holds at most `entries.size()` chains, replacing the least recently used one when
+    /// full. An empty span disables the cache.
+    explicit VerifiedCertificateCache(Span<Entry> entries) : mEntries(entries) {}
+
+    /// Returns true and fills `outCredentials` if the chain was validated for `fabricIndex` before
+    /// and that validation still holds for `context`.
+    bool Lookup(FabricIndex fabricIndex, const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac,
+                const ValidationContext & context, VerifiedCredentials & outCredentials);
+
+    /// Records that the chain was successfully validated for `fabricIndex` using `context`.
+    void Insert(FabricIndex fabricIndex, const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac,
+                const ValidationContext & context, const VerifiedCredentials & credentials);
+
+    /// Removes all the entries of `fabricIndex`.
+    void Invalidate(FabricIndex fabricIndex);
+
+    /// Removes all the entries.
+    void InvalidateAll();
+
+    const Statistics & GetStatistics() const { return mStatistics; }
+
+private:
+    static bool IsCacheable(const ValidationContext & context) { return context.mValidityPolicy == nullptr; }
+    static bool IsValidAt(const VerifiedCredentials & credentials, const ValidationContext & context);
+    static CHIP_ERROR ComputeChainDigest(const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac,
+                                         uint8_t (&outDigest)[Crypto::kSHA256_Hash_Length]);
+
+    Entry * Find(FabricIndex fabricIndex, const uint8_t (&chainDigest)[Crypto::kSHA256_Hash_Length],
+                 const ValidationContext & context);
+
+    Span<Entry> mEntries;
+    uint32_t mUseCounter = 0;
+    Statistics mStatistics;
+};
+
+} // namespace Credentials
+} // namespace chip
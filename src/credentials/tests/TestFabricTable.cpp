@@ -183,6 +183,21 @@ static CHIP_ERROR LoadTestFabric_Node02_01(nlTestSuite * inSuite, FabricTable &
 
     return err;
 }
+class CountingFabricDelegate : public FabricTable::Delegate
+{
+public:
+    void OnFabricUpdated(const FabricTable & fabricTable, FabricIndex fabricIndex) override { ++mNumUpdated; }
+    void OnFabricUpdateReverted(const FabricTable & fabricTable, FabricIndex fabricIndex) override
+    {
+        ++mNumUpdateReverted;
+        mLastRevertedFabricIndex = fabricIndex;
+    }
+
+    size_t mNumUpdated                   = 0;
+    size_t mNumUpdateReverted            = 0;
+    FabricIndex mLastRevertedFabricIndex = kUndefinedFabricIndex;
+};
+
 void TestLastKnownGoodTimeInit(nlTestSuite * inSuite, void * inContext)
 {
     // Fabric table init should init Last Known Good Time to the firmware build time.
@@ -1952,9 +1967,13 @@ void TestUpdateNocFailSafe(nlTestSuite * inSuite, void * inContext)
         ByteSpan rcac = fabric44CertAuthority.GetRcac();
         ByteSpan noc  = fabric44CertAuthority.GetNoc();
 
+        CountingFabricDelegate fabricDelegate;
+        NL_TEST_ASSERT_SUCCESS(inSuite, fabricTable.AddFabricDelegate(&fabricDelegate));
+
         NL_TEST_ASSERT_EQUALS(inSuite, fabricTable.FabricCount(), 1);
         NL_TEST_ASSERT_SUCCESS(inSuite, fabricTable.UpdatePendingFabricWithOperationalKeystore(1, noc, ByteSpan{}));
         NL_TEST_ASSERT_EQUALS(inSuite, fabricTable.FabricCount(), 1);
+        NL_TEST_ASSERT_EQUALS(inSuite, fabricDelegate.mNumUpdated, 1u);
 
         // No storage yet
         NL_TEST_ASSERT(inSuite, storage.GetNumKeys() == numStorageAfterAdd);
@@ -1983,6 +2002,12 @@ void TestUpdateNocFailSafe(nlTestSuite * inSuite, void * inContext)
         fabricTable.RevertPendingFabricData();
         NL_TEST_ASSERT_EQUALS(inSuite, fabricTable.FabricCount(), 1);
 
+        // Only the narrow revert notification is sent, not a full fabric update.
+        NL_TEST_ASSERT_EQUALS(inSuite, fabricDelegate.mNumUpdated, 1u);
+        NL_TEST_ASSERT_EQUALS(inSuite, fabricDelegate.mNumUpdateReverted, 1u);
+        NL_TEST_ASSERT_EQUALS(inSuite, fabricDelegate.mLastRevertedFabricIndex, fabricIndex);
+        fabricTable.RemoveFabricDelegate(&fabricDelegate);
+
         NL_TEST_ASSERT_EQUALS(inSuite, storage.GetNumKeys(), numStorageAfterAdd);
 
         // Validate contents
@@ -2430,6 +2455,121 @@ void TestFetchCATs(nlTestSuite * inSuite, void * inContext)
     // TODO(#20335): Add test cases for NOCs that actually embed CATs
 }
 
+void TestVerifiedCertificateCache(nlTestSuite * inSuite, void * inContext)
+{
+    const ByteSpan rcac(TestCerts::sTestCert_Root01_Chip);
+    const ByteSpan icac(TestCerts::sTestCert_ICA01_Chip);
+    const ByteSpan noc01(TestCerts::sTestCert_Node01_01_Chip);
+    const ByteSpan noc02(TestCerts::sTestCert_Node01_02_Chip);
+    constexpr FabricIndex kFabricIndex = 1;
+
+    ValidationContext context;
+    context.Reset();
+    context.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    context.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+
+    VerifiedCredentials credentials01;
+    VerifiedCredentials credentials02;
+    NL_TEST_ASSERT_SUCCESS(inSuite, FabricTable::VerifyCredentials(noc01, icac, rcac, context, credentials01));
+    NL_TEST_ASSERT_SUCCESS(inSuite, FabricTable::VerifyCredentials(noc02, ByteSpan(), rcac, context, credentials02));
+    NL_TEST_ASSERT(inSuite, credentials01.nodeId != credentials02.nodeId);
+    NL_TEST_ASSERT(inSuite, credentials01.notBeforeTime > 0);
+    NL_TEST_ASSERT(inSuite, credentials01.notAfterTime != kNullCertTime);
+
+    VerifiedCertificateCache::Entry entries[1];
+    VerifiedCertificateCache cache{ Span<VerifiedCertificateCache::Entry>(entries) };
+    VerifiedCredentials cached;
+
+    // Nothing is cached at first.
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(kFabricIndex, noc01, icac, rcac, context, cached));
+
+    // A cached chain is found again, for the same fabric only.
+    cache.Insert(kFabricIndex, noc01, icac, rcac, context, credentials01);
+    NL_TEST_ASSERT(inSuite, cache.Lookup(kFabricIndex, noc01, icac, rcac, context, cached));
+    NL_TEST_ASSERT(inSuite, cached.nodeId == credentials01.nodeId);
+    NL_TEST_ASSERT(inSuite, cached.fabricId == credentials01.fabricId);
+    NL_TEST_ASSERT(inSuite, cached.nocPublicKey.Matches(credentials01.nocPublicKey));
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(kFabricIndex + 1, noc01, icac, rcac, context, cached));
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(kFabricIndex, noc01, ByteSpan(), rcac, context, cached));
+
+    // A chain is not reused for validations with other requirements.
+    {
+        ValidationContext clientContext = context;
+        clientContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kClientAuth);
+        NL_TEST_ASSERT(inSuite, !cache.Lookup(kFabricIndex, noc01, icac, rcac, clientContext, cached));
+    }
+
+    // Nor when a validity policy decides, nor at a current time outside of the validity period of the chain.
+    {
+        IgnoreCertificateValidityPeriodPolicy policy;
+        ValidationContext policyContext = context;
+        policyContext.mValidityPolicy   = &policy;
+        NL_TEST_ASSERT(inSuite, !cache.Lookup(kFabricIndex, noc01, icac, rcac, policyContext, cached));
+
+        ValidationContext timedContext = context;
+        timedContext.SetEffectiveTime<CurrentChipEpochTime>(System::Clock::Seconds32(credentials01.notBeforeTime - 1));
+        NL_TEST_ASSERT(inSuite, !cache.Lookup(kFabricIndex, noc01, icac, rcac, timedContext, cached));
+        timedContext.SetEffectiveTime<CurrentChipEpochTime>(System::Clock::Seconds32(credentials01.notBeforeTime));
+        NL_TEST_ASSERT(inSuite, cache.Lookup(kFabricIndex, noc01, icac, rcac, timedContext, cached));
+        timedContext.SetEffectiveTime<CurrentChipEpochTime>(System::Clock::Seconds32(credentials01.notAfterTime + 1));
+        NL_TEST_ASSERT(inSuite, !cache.Lookup(kFabricIndex, noc01, icac, rcac, timedContext, cached));
+        timedContext.SetEffectiveTime<LastKnownGoodChipEpochTime>(System::Clock::Seconds32(credentials01.notBeforeTime - 1));
+        NL_TEST_ASSERT(inSuite, cache.Lookup(kFabricIndex, noc01, icac, rcac, timedContext, cached));
+    }
+
+    // When full, the least recently used chain is replaced.
+    cache.Insert(kFabricIndex, noc02, ByteSpan(), rcac, context, credentials02);
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(kFabricIndex, noc01, icac, rcac, context, cached));
+    NL_TEST_ASSERT(inSuite, cache.Lookup(kFabricIndex, noc02, ByteSpan(), rcac, context, cached));
+    NL_TEST_ASSERT(inSuite, cached.nodeId == credentials02.nodeId);
+
+    cache.Invalidate(kFabricIndex);
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(kFabricIndex, noc02, ByteSpan(), rcac, context, cached));
+}
+
+#if CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+void TestFabricTableVerifiedCertificateCache(nlTestSuite * inSuite, void * inContext)
+{
+    chip::TestPersistentStorageDelegate testStorage;
+    ScopedFabricTable fabricTableHolder;
+    NL_TEST_ASSERT(inSuite, fabricTableHolder.Init(&testStorage) == CHIP_NO_ERROR);
+    FabricTable & fabricTable = fabricTableHolder.GetFabricTable();
+    NL_TEST_ASSERT(inSuite, LoadTestFabric_Node01_01(inSuite, fabricTable, /* doCommit = */ true) == CHIP_NO_ERROR);
+    constexpr FabricIndex kFabricIndex = 1;
+
+    // Verify the chain of another node of the fabric twice: the second time comes from the cache.
+    const ByteSpan noc(TestCerts::sTestCert_Node01_02_Chip);
+    ValidationContext context;
+    context.Reset();
+    context.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    context.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+
+    const auto & statistics = fabricTable.GetVerifiedCertificateCacheStatistics();
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        CompressedFabricId compressedFabricId;
+        FabricId fabricId;
+        NodeId nodeId;
+        Crypto::P256PublicKey nocPublicKey;
+        NL_TEST_ASSERT_SUCCESS(inSuite,
+                               fabricTable.VerifyCredentials(kFabricIndex, noc, ByteSpan(), context, compressedFabricId, fabricId,
+                                                             nodeId, nocPublicKey));
+        NL_TEST_ASSERT(inSuite, fabricId == 0xFAB000000000001D);
+        NL_TEST_ASSERT(inSuite, nodeId == 0xDEDEDEDE00010002);
+        NL_TEST_ASSERT(inSuite, statistics.hits == i);
+    }
+
+    // Removing the fabric drops its cached chains.
+    uint8_t rcacBuf[kMaxCHIPCertLength];
+    MutableByteSpan rcac(rcacBuf);
+    NL_TEST_ASSERT_SUCCESS(inSuite, fabricTable.FetchRootCert(kFabricIndex, rcac));
+    VerifiedCredentials cached;
+    NL_TEST_ASSERT(inSuite, fabricTable.LookupVerifiedCredentials(kFabricIndex, noc, ByteSpan(), rcac, context, cached));
+    NL_TEST_ASSERT_SUCCESS(inSuite, fabricTable.Delete(kFabricIndex));
+    NL_TEST_ASSERT(inSuite, !fabricTable.LookupVerifiedCredentials(kFabricIndex, noc, ByteSpan(), rcac, context, cached));
+}
+#endif // CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+
 // Validate that adding the same fabric twice fails (same root, same FabricId)
 void TestAddNocRootCollision(nlTestSuite * inSuite, void * inContext)
 {
@@ -3019,6 +3159,10 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Test compressed fabric ID is properly generated", TestCompressedFabricId),
     NL_TEST_DEF("Test fabric lookup by <root public key, fabric ID>", TestFabricLookup),
     NL_TEST_DEF("Test Fetching CATs", TestFetchCATs),
+    NL_TEST_DEF("Test verified certificate cache", TestVerifiedCertificateCache),
+#if CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+    NL_TEST_DEF("Test fabric table caching of verified certificates", TestFabricTableVerifiedCertificateCache),
+#endif // CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
     NL_TEST_DEF("Test AddNOC root collision", TestAddNocRootCollision),
     NL_TEST_DEF("Test invalid chaining in AddNOC and UpdateNOC", TestInvalidChaining),
     NL_TEST_DEF("Test ephemeral keys allocation", TestEphemeralKeys),
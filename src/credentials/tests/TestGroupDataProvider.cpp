@@ -1196,6 +1196,83 @@ void TestGroupDecryption(nlTestSuite * apSuite, void * apContext)
     }
 }
 
+using GroupSessionSet = std::set<std::pair<FabricIndex, GroupId>>;
+
+GroupSessionSet GetGroupSessions(GroupDataProvider * provider, uint16_t session_id)
+{
+    GroupSessionSet sessions;
+    GroupSession session;
+    auto it = provider->IterateGroupSessions(session_id);
+    VerifyOrReturnValue(it != nullptr, sessions);
+    while (it->Next(session))
+    {
+        sessions.emplace(session.fabric_index, session.group_id);
+    }
+    it->Release();
+    return sessions;
+}
+
+uint16_t GetSessionId(GroupDataProvider * provider, FabricIndex fabric_index, GroupId group_id)
+{
+    Crypto::SymmetricKeyContext * key_context = provider->GetKeyContext(fabric_index, group_id);
+    VerifyOrReturnValue(key_context != nullptr, 0);
+    uint16_t session_id = key_context->GetKeyHash();
+    key_context->Release();
+    return session_id;
+}
+
+void TestGroupSessionIndex(nlTestSuite * apSuite, void * apContext)
+{
+    GroupDataProvider * provider = GetGroupDataProvider();
+    NL_TEST_ASSERT(apSuite, provider);
+
+    // Reset test
+    ResetProvider(provider);
+
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->SetKeySet(kFabric1, kCompressedFabricId1, kKeySet1));
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->SetKeySet(kFabric2, kCompressedFabricId2, kKeySet1));
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->SetGroupKeyAt(kFabric1, 0, kGroup1Keyset1));
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->SetGroupKeyAt(kFabric1, 1, kGroup2Keyset1));
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->SetGroupKeyAt(kFabric2, 0, kGroup3Keyset1));
+
+    const uint16_t session1 = GetSessionId(provider, kFabric1, kGroup1);
+    const uint16_t session2 = GetSessionId(provider, kFabric2, kGroup3);
+    NL_TEST_ASSERT(apSuite, session1 != session2);
+    NL_TEST_ASSERT(apSuite,
+                   GetGroupSessions(provider, session1) == GroupSessionSet({ { kFabric1, kGroup1 }, { kFabric1, kGroup2 } }));
+    NL_TEST_ASSERT(apSuite, GetGroupSessions(provider, session2) == GroupSessionSet({ { kFabric2, kGroup3 } }));
+
+    // Changes made while an iterator is in use are seen by new iterators, and do not affect the existing one
+    auto it = provider->IterateGroupSessions(session1);
+    NL_TEST_ASSERT(apSuite, it);
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->RemoveGroupKeyAt(kFabric1, 1));
+    NL_TEST_ASSERT(apSuite, GetGroupSessions(provider, session1) == GroupSessionSet({ { kFabric1, kGroup1 } }));
+    if (it)
+    {
+        GroupSession session;
+        NL_TEST_ASSERT(apSuite, it->Count() == 2);
+        NL_TEST_ASSERT(apSuite, it->Next(session) && session.keyContext != nullptr);
+        NL_TEST_ASSERT(apSuite, it->Next(session) && session.keyContext != nullptr);
+        NL_TEST_ASSERT(apSuite, !it->Next(session));
+        it->Release();
+    }
+    NL_TEST_ASSERT(apSuite, GetGroupSessions(provider, session1) == GroupSessionSet({ { kFabric1, kGroup1 } }));
+
+    // Replacing the keys of a keyset replaces its sessions
+    KeySet rekeyed(kKeySet1);
+    memcpy(rekeyed.epoch_keys[0].key, kKeySet3.epoch_keys[0].key, EpochKey::kLengthBytes);
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->SetKeySet(kFabric1, kCompressedFabricId1, rekeyed));
+    const uint16_t session3 = GetSessionId(provider, kFabric1, kGroup1);
+    NL_TEST_ASSERT(apSuite, session3 != session1);
+    NL_TEST_ASSERT(apSuite, GetGroupSessions(provider, session1).empty());
+    NL_TEST_ASSERT(apSuite, GetGroupSessions(provider, session3) == GroupSessionSet({ { kFabric1, kGroup1 } }));
+
+    // Removing a fabric removes its sessions
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->RemoveFabric(kFabric2));
+    NL_TEST_ASSERT(apSuite, GetGroupSessions(provider, session2).empty());
+    NL_TEST_ASSERT(apSuite, GetGroupSessions(provider, session3) == GroupSessionSet({ { kFabric1, kGroup1 } }));
+}
+
 } // namespace TestGroups
 } // namespace app
 } // namespace chip
@@ -1275,6 +1352,7 @@ const nlTest sTests[] = { NL_TEST_DEF("TestStorageDelegate", chip::app::TestGrou
                           NL_TEST_DEF("TestIpk", chip::app::TestGroups::TestIpk),
                           NL_TEST_DEF("TestPerFabricData", chip::app::TestGroups::TestPerFabricData),
                           NL_TEST_DEF("TestGroupDecryption", chip::app::TestGroups::TestGroupDecryption),
+                          NL_TEST_DEF("TestGroupSessionIndex", chip::app::TestGroups::TestGroupSessionIndex),
                           NL_TEST_SENTINEL() };
 } // namespace
 
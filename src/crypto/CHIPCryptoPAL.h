@@ -786,6 +786,59 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
                            const uint8_t * tag, size_t tag_length, const Aes128KeyHandle & key, const uint8_t * nonce,
                            size_t nonce_length, uint8_t * plaintext);
 
+/**
+ * @brief Reusable AES-CCM-128 cipher state bound to a single key.
+ *
+ * AES_CCM_encrypt() and AES_CCM_decrypt() build and expand the key schedule on every call.
+ * For keys that protect many messages, such as the keys of a secure session, this class keeps
+ * that work around between messages. On backends that cannot hold cipher state across calls it
+ * simply forwards to the one-shot functions.
+ *
+ * The key handle passed to Init() must outlive the context or the next call to Release().
+ * Messages using a nonce length other than kAES_CCM128_Nonce_Length or a tag length other than
+ * CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES are processed by the one-shot functions.
+ */
+class AesCcm128Context
+{
+public:
+    AesCcm128Context() = default;
+    ~AesCcm128Context() { Release(); }
+
+    AesCcm128Context(const AesCcm128Context &)             = delete;
+    AesCcm128Context & operator=(const AesCcm128Context &) = delete;
+
+    /**
+     * @brief Bind the context to @p key, dropping any cipher state for a previous key.
+     */
+    CHIP_ERROR Init(const Aes128KeyHandle & key);
+
+    /**
+     * @brief Free the cipher state, wiping the expanded key, and unbind the key.
+     */
+    void Release();
+
+    bool IsInitialized() const { return mKey != nullptr; }
+
+    /**
+     * @brief Same as AES_CCM_encrypt(), using the key the context was initialized with.
+     */
+    CHIP_ERROR Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag, size_t tag_length);
+
+    /**
+     * @brief Same as AES_CCM_decrypt(), using the key the context was initialized with.
+     */
+    CHIP_ERROR Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length, uint8_t * plaintext);
+
+private:
+    const Aes128KeyHandle * mKey = nullptr;
+
+    // Backend specific cipher state for each direction, created on first use.
+    void * mEncryptState = nullptr;
+    void * mDecryptState = nullptr;
+};
+
 /**
  * @brief A function that implements AES-CTR encryption/decryption
  *
@@ -411,6 +411,229 @@ exit:
     return error;
 }
 
+#if !CHIP_CRYPTO_BORINGSSL
+static EVP_CIPHER_CTX * _newCcmCipherContext(const Aes128KeyHandle & key, int enc)
+{
+    EVP_CIPHER_CTX * context = EVP_CIPHER_CTX_new();
+    VerifyOrReturnValue(context != nullptr, nullptr);
+
+    // Fix the cipher, nonce length, tag length and key once, so that each message only has to
+    // provide its nonce (and expected tag).
+    int result = EVP_CipherInit_ex(context, EVP_aes_128_ccm(), nullptr, nullptr, nullptr, enc);
+    if (result == 1)
+    {
+        result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(kAES_CCM128_Nonce_Length), nullptr);
+    }
+    if (result == 1)
+    {
+        result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES), nullptr);
+    }
+    if (result == 1)
+    {
+        result = EVP_CipherInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), nullptr, enc);
+    }
+    if (result != 1)
+    {
+        EVP_CIPHER_CTX_free(context);
+        return nullptr;
+    }
+
+    return context;
+}
+#endif // !CHIP_CRYPTO_BORINGSSL
+
+CHIP_ERROR AesCcm128Context::Init(const Aes128KeyHandle & key)
+{
+    Release();
+    mKey = &key;
+
+#if CHIP_CRYPTO_BORINGSSL
+    // A single AEAD context serves both directions.
+    mEncryptState = EVP_AEAD_CTX_new(EVP_aead_aes_128_ccm_matter(), key.As<Symmetric128BitsKeyByteArray>(),
+                                     sizeof(Symmetric128BitsKeyByteArray), CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES);
+    if (mEncryptState == nullptr)
+    {
+        mKey = nullptr;
+        return CHIP_ERROR_NO_MEMORY;
+    }
+#endif // CHIP_CRYPTO_BORINGSSL
+
+    return CHIP_NO_ERROR;
+}
+
+void AesCcm128Context::Release()
+{
+    // Freeing the contexts also wipes the expanded key held by them.
+#if CHIP_CRYPTO_BORINGSSL
+    EVP_AEAD_CTX_free(static_cast<EVP_AEAD_CTX *>(mEncryptState));
+#else
+    EVP_CIPHER_CTX_free(static_cast<EVP_CIPHER_CTX *>(mEncryptState));
+    EVP_CIPHER_CTX_free(static_cast<EVP_CIPHER_CTX *>(mDecryptState));
+#endif // CHIP_CRYPTO_BORINGSSL
+
+    mEncryptState = nullptr;
+    mDecryptState = nullptr;
+    mKey          = nullptr;
+}
+
+CHIP_ERROR AesCcm128Context::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                     const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag,
+                                     size_t tag_length)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    // Empty messages and non-default parameters keep the argument handling of the one-shot path.
+    if (plaintext_length == 0 || plaintext == nullptr || ciphertext == nullptr || nonce == nullptr || tag == nullptr ||
+        nonce_length != kAES_CCM128_Nonce_Length || tag_length != CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES)
+    {
+        return AES_CCM_encrypt(plaintext, plaintext_length, aad, aad_length, *mKey, nonce, nonce_length, ciphertext, tag,
+                               tag_length);
+    }
+
+    VerifyOrReturnError(CanCastTo<int>(plaintext_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(aad_length), CHIP_ERROR_INVALID_ARGUMENT);
+
+    CHIP_ERROR error = CHIP_NO_ERROR;
+    int result       = 1;
+
+#if CHIP_CRYPTO_BORINGSSL
+    EVP_AEAD_CTX * context = static_cast<EVP_AEAD_CTX *>(mEncryptState);
+    size_t written_tag_len = 0;
+
+    result = EVP_AEAD_CTX_seal_scatter(context, ciphertext, tag, &written_tag_len, tag_length, nonce, nonce_length, plaintext,
+                                       plaintext_length, nullptr, 0, aad, aad_length);
+    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    VerifyOrExit(written_tag_len == tag_length, error = CHIP_ERROR_INTERNAL);
+#else
+    EVP_CIPHER_CTX * context = static_cast<EVP_CIPHER_CTX *>(mEncryptState);
+    int bytesWritten         = 0;
+
+    if (context == nullptr)
+    {
+        context = _newCcmCipherContext(*mKey, 1);
+        VerifyOrReturnError(context != nullptr, CHIP_ERROR_NO_MEMORY);
+        mEncryptState = context;
+    }
+
+    // Pass in nonce
+    result = EVP_EncryptInit_ex(context, nullptr, nullptr, nullptr, Uint8::to_const_uchar(nonce));
+    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+
+    // Pass in plain text length
+    result = EVP_EncryptUpdate(context, nullptr, &bytesWritten, nullptr, static_cast<int>(plaintext_length));
+    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+
+    // Pass in AAD
+    if (aad_length > 0 && aad != nullptr)
+    {
+        result = EVP_EncryptUpdate(context, nullptr, &bytesWritten, Uint8::to_const_uchar(aad), static_cast<int>(aad_length));
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    }
+
+    // Encrypt
+    result = EVP_EncryptUpdate(context, Uint8::to_uchar(ciphertext), &bytesWritten, Uint8::to_const_uchar(plaintext),
+                               static_cast<int>(plaintext_length));
+    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    VerifyOrExit(bytesWritten >= 0 && bytesWritten <= static_cast<int>(plaintext_length), error = CHIP_ERROR_INTERNAL);
+
+    // Finalize encryption
+    result = EVP_EncryptFinal_ex(context, ciphertext + bytesWritten, &bytesWritten);
+    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+
+    // Get tag
+    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_GET_TAG, static_cast<int>(tag_length), Uint8::to_uchar(tag));
+    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+#endif // CHIP_CRYPTO_BORINGSSL
+
+exit:
+#if !CHIP_CRYPTO_BORINGSSL
+    if (error != CHIP_NO_ERROR)
+    {
+        // Do not reuse a context left in an unknown state; it is rebuilt on the next message.
+        EVP_CIPHER_CTX_free(context);
+        mEncryptState = nullptr;
+    }
+#endif // !CHIP_CRYPTO_BORINGSSL
+
+    return error;
+}
+
+CHIP_ERROR AesCcm128Context::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                     const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length,
+                                     uint8_t * plaintext)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    // Empty messages and non-default parameters keep the argument handling of the one-shot path.
+    if (ciphertext_length == 0 || ciphertext == nullptr || plaintext == nullptr || nonce == nullptr || tag == nullptr ||
+        nonce_length != kAES_CCM128_Nonce_Length || tag_length != CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES)
+    {
+        return AES_CCM_decrypt(ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, *mKey, nonce, nonce_length,
+                               plaintext);
+    }
+
+    VerifyOrReturnError(CanCastTo<int>(ciphertext_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(aad_length), CHIP_ERROR_INVALID_ARGUMENT);
+
+    CHIP_ERROR error = CHIP_NO_ERROR;
+    int result       = 1;
+
+#if CHIP_CRYPTO_BORINGSSL
+    EVP_AEAD_CTX * context = static_cast<EVP_AEAD_CTX *>(mEncryptState);
+
+    result = EVP_AEAD_CTX_open_gather(context, plaintext, nonce, nonce_length, ciphertext, ciphertext_length, tag, tag_length, aad,
+                                      aad_length);
+    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+#else
+    EVP_CIPHER_CTX * context = static_cast<EVP_CIPHER_CTX *>(mDecryptState);
+    int bytesOutput          = 0;
+
+    if (context == nullptr)
+    {
+        context = _newCcmCipherContext(*mKey, 0);
+        VerifyOrReturnError(context != nullptr, CHIP_ERROR_NO_MEMORY);
+        mDecryptState = context;
+    }
+
+    // Pass in nonce
+    result = EVP_DecryptInit_ex(context, nullptr, nullptr, nullptr, Uint8::to_const_uchar(nonce));
+    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+
+    // Pass in expected tag
+    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length),
+                                 const_cast<void *>(static_cast<const void *>(tag)));
+    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+
+    // Pass in cipher text length
+    result = EVP_DecryptUpdate(context, nullptr, &bytesOutput, nullptr, static_cast<int>(ciphertext_length));
+    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+
+    // Pass in aad
+    if (aad_length > 0 && aad != nullptr)
+    {
+        result = EVP_DecryptUpdate(context, nullptr, &bytesOutput, Uint8::to_const_uchar(aad), static_cast<int>(aad_length));
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    }
+
+    // Pass in ciphertext. We wont get anything if validation fails.
+    result = EVP_DecryptUpdate(context, Uint8::to_uchar(plaintext), &bytesOutput, Uint8::to_const_uchar(ciphertext),
+                               static_cast<int>(ciphertext_length));
+    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+#endif // CHIP_CRYPTO_BORINGSSL
+
+exit:
+#if !CHIP_CRYPTO_BORINGSSL
+    if (error != CHIP_NO_ERROR)
+    {
+        // Do not reuse a context left in an unknown state; it is rebuilt on the next message.
+        EVP_CIPHER_CTX_free(context);
+        mDecryptState = nullptr;
+    }
+#endif // !CHIP_CRYPTO_BORINGSSL
+
+    return error;
+}
+
 CHIP_ERROR Hash_SHA256(const uint8_t * data, const size_t data_length, uint8_t * out_buffer)
 {
     // zero data length hash is supported.
@@ -0,0 +1,246 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests and a micro-benchmark for the reusable
+ *      AES-CCM-128 cipher context.
+ *
+ */
+
+#include "AES_CCM_128_test_vectors.h"
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+
+#include <nlunit-test.h>
+
+#if CHIP_CRYPTO_PSA
+#include <psa/crypto.h>
+#endif
+
+using namespace chip;
+using namespace chip::Crypto;
+
+namespace {
+
+constexpr size_t kBenchmarkMessageLength = 1024;
+constexpr size_t kBenchmarkIterations    = 2000;
+
+struct TestAesKey
+{
+    TestAesKey(nlTestSuite * inSuite, const uint8_t * keyBytes, size_t keyLength)
+    {
+        Symmetric128BitsKeyByteArray keyMaterial;
+        memcpy(&keyMaterial, keyBytes, keyLength);
+
+        NL_TEST_ASSERT(inSuite, keystore.CreateKey(keyMaterial, key) == CHIP_NO_ERROR);
+    }
+
+    ~TestAesKey() { keystore.DestroyKey(key); }
+
+    DefaultSessionKeystore keystore;
+    Aes128KeyHandle key;
+};
+
+void TestAesCcm128Context_TestVectors(nlTestSuite * inSuite, void * inContext)
+{
+    int numOfTestsRan = 0;
+
+    for (const ccm_128_test_vector * vector : ccm_128_test_vectors)
+    {
+        if (vector->pt_len == 0 || vector->result != CHIP_NO_ERROR)
+        {
+            continue;
+        }
+
+        TestAesKey key(inSuite, vector->key, vector->key_len);
+        AesCcm128Context context;
+        NL_TEST_ASSERT(inSuite, context.Init(key.key) == CHIP_NO_ERROR);
+
+        Platform::ScopedMemoryBuffer<uint8_t> out_ct;
+        Platform::ScopedMemoryBuffer<uint8_t> out_pt;
+        Platform::ScopedMemoryBuffer<uint8_t> out_tag;
+        NL_TEST_ASSERT(inSuite, out_ct.Alloc(vector->ct_len));
+        NL_TEST_ASSERT(inSuite, out_pt.Alloc(vector->pt_len));
+        NL_TEST_ASSERT(inSuite, out_tag.Alloc(vector->tag_len));
+
+        // Run every vector twice to exercise reuse of the cached cipher state.
+        for (int pass = 0; pass < 2; pass++)
+        {
+            CHIP_ERROR err = context.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->nonce,
+                                             vector->nonce_len, out_ct.Get(), out_tag.Get(), vector->tag_len);
+            NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, memcmp(out_ct.Get(), vector->ct, vector->ct_len) == 0);
+            NL_TEST_ASSERT(inSuite, memcmp(out_tag.Get(), vector->tag, vector->tag_len) == 0);
+
+            err = context.Decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, vector->tag, vector->tag_len,
+                                  vector->nonce, vector->nonce_len, out_pt.Get());
+            NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, memcmp(out_pt.Get(), vector->pt, vector->pt_len) == 0);
+        }
+
+        numOfTestsRan++;
+    }
+
+    NL_TEST_ASSERT(inSuite, numOfTestsRan > 0);
+}
+
+void TestAesCcm128Context_InvalidTag(nlTestSuite * inSuite, void * inContext)
+{
+    const uint8_t keyBytes[kAES_CCM128_Key_Length] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+                                                       0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10 };
+    const uint8_t nonce[kAES_CCM128_Nonce_Length]  = { 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+                                                       0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac };
+    const uint8_t aad[]                            = { 0x00, 0x11, 0x22, 0x33 };
+    const uint8_t plaintext[]                      = "Matter message payload";
+
+    uint8_t ciphertext[sizeof(plaintext)];
+    uint8_t expectedCiphertext[sizeof(plaintext)];
+    uint8_t decrypted[sizeof(plaintext)];
+    uint8_t tag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+    uint8_t expectedTag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+
+    TestAesKey key(inSuite, keyBytes, sizeof(keyBytes));
+    AesCcm128Context context;
+
+    NL_TEST_ASSERT(inSuite,
+                   context.Encrypt(plaintext, sizeof(plaintext), aad, sizeof(aad), nonce, sizeof(nonce), ciphertext, tag,
+                                   sizeof(tag)) == CHIP_ERROR_INCORRECT_STATE);
+    NL_TEST_ASSERT(inSuite, context.Init(key.key) == CHIP_NO_ERROR);
+
+    // The cached context produces the same output as the one-shot function.
+    NL_TEST_ASSERT(inSuite,
+                   AES_CCM_encrypt(plaintext, sizeof(plaintext), aad, sizeof(aad), key.key, nonce, sizeof(nonce),
+                                   expectedCiphertext, expectedTag, sizeof(expectedTag)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   context.Encrypt(plaintext, sizeof(plaintext), aad, sizeof(aad), nonce, sizeof(nonce), ciphertext, tag,
+                                   sizeof(tag)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(ciphertext, expectedCiphertext, sizeof(ciphertext)) == 0);
+    NL_TEST_ASSERT(inSuite, memcmp(tag, expectedTag, sizeof(tag)) == 0);
+
+    // A message that fails authentication does not break the following ones.
+    tag[0] ^= 0x01;
+    NL_TEST_ASSERT(inSuite,
+                   context.Decrypt(ciphertext, sizeof(ciphertext), aad, sizeof(aad), tag, sizeof(tag), nonce, sizeof(nonce),
+                                   decrypted) != CHIP_NO_ERROR);
+    tag[0] ^= 0x01;
+    NL_TEST_ASSERT(inSuite,
+                   context.Decrypt(ciphertext, sizeof(ciphertext), aad, sizeof(aad), tag, sizeof(tag), nonce, sizeof(nonce),
+                                   decrypted) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(decrypted, plaintext, sizeof(plaintext)) == 0);
+
+    context.Release();
+    NL_TEST_ASSERT(inSuite, !context.IsInitialized());
+    NL_TEST_ASSERT(inSuite,
+                   context.Decrypt(ciphertext, sizeof(ciphertext), aad, sizeof(aad), tag, sizeof(tag), nonce, sizeof(nonce),
+                                   decrypted) == CHIP_ERROR_INCORRECT_STATE);
+}
+
+void TestAesCcm128Context_Benchmark(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t keyBytes[kAES_CCM128_Key_Length] = {};
+    uint8_t nonce[kAES_CCM128_Nonce_Length]  = {};
+    uint8_t aad[16]                          = {};
+    uint8_t tag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+
+    Platform::ScopedMemoryBuffer<uint8_t> plaintext;
+    Platform::ScopedMemoryBuffer<uint8_t> ciphertext;
+    NL_TEST_ASSERT(inSuite, plaintext.Calloc(kBenchmarkMessageLength));
+    NL_TEST_ASSERT(inSuite, ciphertext.Calloc(kBenchmarkMessageLength));
+    NL_TEST_ASSERT(inSuite, DRBG_get_bytes(keyBytes, sizeof(keyBytes)) == CHIP_NO_ERROR);
+
+    TestAesKey key(inSuite, keyBytes, sizeof(keyBytes));
+    AesCcm128Context context;
+    NL_TEST_ASSERT(inSuite, context.Init(key.key) == CHIP_NO_ERROR);
+
+    auto & clock = System::SystemClock();
+    bool success = true;
+
+    // Encrypt then decrypt each message, changing the nonce the way a message counter would.
+    System::Clock::Microseconds64 start = clock.GetMonotonicMicroseconds64();
+    for (size_t i = 0; i < kBenchmarkIterations; i++)
+    {
+        nonce[0] = static_cast<uint8_t>(i);
+        success &= AES_CCM_encrypt(plaintext.Get(), kBenchmarkMessageLength, aad, sizeof(aad), key.key, nonce, sizeof(nonce),
+                                   ciphertext.Get(), tag, sizeof(tag)) == CHIP_NO_ERROR;
+        success &= AES_CCM_decrypt(ciphertext.Get(), kBenchmarkMessageLength, aad, sizeof(aad), tag, sizeof(tag), key.key, nonce,
+                                   sizeof(nonce), plaintext.Get()) == CHIP_NO_ERROR;
+    }
+    System::Clock::Microseconds64 oneShot = clock.GetMonotonicMicroseconds64() - start;
+
+    start = clock.GetMonotonicMicroseconds64();
+    for (size_t i = 0; i < kBenchmarkIterations; i++)
+    {
+        nonce[0] = static_cast<uint8_t>(i);
+        success &= context.Encrypt(plaintext.Get(), kBenchmarkMessageLength, aad, sizeof(aad), nonce, sizeof(nonce),
+                                   ciphertext.Get(), tag, sizeof(tag)) == CHIP_NO_ERROR;
+        success &= context.Decrypt(ciphertext.Get(), kBenchmarkMessageLength, aad, sizeof(aad), tag, sizeof(tag), nonce,
+                                   sizeof(nonce), plaintext.Get()) == CHIP_NO_ERROR;
+    }
+    System::Clock::Microseconds64 cached = clock.GetMonotonicMicroseconds64() - start;
+
+    NL_TEST_ASSERT(inSuite, success);
+
+    // Timings are reported rather than asserted on, since they depend on the host.
+    ChipLogProgress(Crypto, "AES-CCM %u byte message round trip: one-shot %u ns, cached context %u ns",
+                    static_cast<unsigned>(kBenchmarkMessageLength),
+                    static_cast<unsigned>(oneShot.count() * 1000 / kBenchmarkIterations),
+                    static_cast<unsigned>(cached.count() * 1000 / kBenchmarkIterations));
+}
+
+const nlTest sTests[] = { NL_TEST_DEF("Test AES-CCM-128 context test vectors", TestAesCcm128Context_TestVectors),
+                          NL_TEST_DEF("Test AES-CCM-128 context invalid tag", TestAesCcm128Context_InvalidTag),
+                          NL_TEST_DEF("Benchmark AES-CCM-128 context", TestAesCcm128Context_Benchmark), NL_TEST_SENTINEL() };
+
+int Test_Setup(void * inContext)
+{
+    CHIP_ERROR error = Platform::MemoryInit();
+    VerifyOrReturnError(error == CHIP_NO_ERROR, FAILURE);
+
+#if CHIP_CRYPTO_PSA
+    psa_crypto_init();
+#endif
+
+    return SUCCESS;
+}
+
+int Test_Teardown(void * inContext)
+{
+    Platform::MemoryShutdown();
+
+    return SUCCESS;
+}
+
+} // namespace
+
+int TestAesCcm128Context()
+{
+    nlTestSuite theSuite = { "AES-CCM-128 context tests", &sTests[0], Test_Setup, Test_Teardown };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestAesCcm128Context)
@@ -136,6 +136,16 @@
 #define CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE 1
 #endif
 
+/**
+ * CHIP_DEVICE_CONFIG_BG_TASK_COUNT
+ *
+ * The number of threads servicing the chip background event queue, on platforms
+ * that support more than one (currently POSIX).
+ */
+#ifndef CHIP_DEVICE_CONFIG_BG_TASK_COUNT
+#define CHIP_DEVICE_CONFIG_BG_TASK_COUNT 1
+#endif
+
 /**
  * CHIP_DEVICE_CONFIG_ICD_SLOW_POLL_INTERVAL
  *
@@ -1317,6 +1327,26 @@ static_assert(CHIP_DEVICE_CONFIG_BLE_EXT_ADVERTISING_INTERVAL_MIN <= CHIP_DEVICE
 #define CHIP_DEVICE_CONFIG_EVENT_LOGGING_DEBUG_BUFFER_SIZE (512)
 #endif
 
+/**
+ * @def CHIP_DEVICE_CONFIG_EVENT_LOGGING_INDEX_BYTES_PER_EVENT
+ *
+ * @brief
+ *   When non-zero, the server keeps an index of the events stored in each
+ *   event logging buffer, with one entry for every this many bytes of the
+ *   buffer.  Fetching events for a read or a subscription then seeks over the
+ *   events that are already reported or outside of the requested endpoints
+ *   and clusters instead of decoding them.  Each entry takes 16 bytes.
+ *
+ *   The value should not exceed the size of the smallest event logged: a
+ *   buffer holding more events than its index has entries falls back to
+ *   decoding every event.
+ *
+ *   Note: set to 0 to disable the index.
+ */
+#ifndef CHIP_DEVICE_CONFIG_EVENT_LOGGING_INDEX_BYTES_PER_EVENT
+#define CHIP_DEVICE_CONFIG_EVENT_LOGGING_INDEX_BYTES_PER_EVENT 0
+#endif
+
 /**
  *  @def CHIP_DEVICE_CONFIG_EVENT_ID_COUNTER_EPOCH
  *
@@ -1495,6 +1525,29 @@ static_assert(CHIP_DEVICE_CONFIG_BLE_EXT_ADVERTISING_INTERVAL_MIN <= CHIP_DEVICE
 #define CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT 0
 #endif
 
+/**
+ * CHIP_DEVICE_CONFIG_ENDPOINT_TYPE_INDEX_CLUSTER_CAPACITY
+ *
+ * Number of entries of the hash index used to find the clusters of endpoint types without
+ * scanning them.  An endpoint type takes one entry, plus one per cluster and one per cluster
+ * role (server or client); endpoint types that do not fit are scanned.  The index takes 32 to
+ * 64 bytes of RAM per entry on 32-bit platforms.  0 disables the index.
+ */
+#ifndef CHIP_DEVICE_CONFIG_ENDPOINT_TYPE_INDEX_CLUSTER_CAPACITY
+#define CHIP_DEVICE_CONFIG_ENDPOINT_TYPE_INDEX_CLUSTER_CAPACITY 0
+#endif
+
+/**
+ * CHIP_DEVICE_CONFIG_ENDPOINT_TYPE_INDEX_ATTRIBUTE_CAPACITY
+ *
+ * Number of entries of the hash index used to find the attributes of clusters without scanning
+ * them.  A cluster of an indexed endpoint type takes one entry, plus one per attribute.  The
+ * index takes 32 to 64 bytes of RAM per entry on 32-bit platforms.  0 disables the index.
+ */
+#ifndef CHIP_DEVICE_CONFIG_ENDPOINT_TYPE_INDEX_ATTRIBUTE_CAPACITY
+#define CHIP_DEVICE_CONFIG_ENDPOINT_TYPE_INDEX_ATTRIBUTE_CAPACITY 0
+#endif
+
 /**
  * CHIP_DISPATCH_EVENT_LONG_DISPATCH_TIME_WARNING_THRESHOLD_MS
  *
@@ -170,10 +170,47 @@ public:
      */
     CHIP_ERROR Delete(const char * key);
 
+    /**
+     * @brief
+     * Starts a batch of Put/Delete operations that are made durable together
+     * by CommitTransaction(). Transactions may be nested; only the outermost
+     * CommitTransaction() flushes.
+     *
+     * Platforms without transaction support make every Put/Delete durable
+     * immediately, and AbortTransaction() cannot undo them.
+     *
+     * @return CHIP_NO_ERROR the transaction was started
+     */
+    CHIP_ERROR BeginTransaction();
+
+    /**
+     * @brief
+     * Makes all Put/Delete operations done since BeginTransaction() durable.
+     *
+     * @return CHIP_NO_ERROR the pending operations were committed
+     *         CHIP_ERROR_TRANSACTION_CANCELED a nested transaction was aborted,
+     *                                         all pending operations were discarded
+     *         CHIP_ERROR_INCORRECT_STATE no transaction is open
+     *         CHIP_ERROR_PERSISTED_STORAGE_FAILED failed to write the values,
+     *                                             all pending operations were discarded
+     */
+    CHIP_ERROR CommitTransaction();
+
+    /**
+     * @brief
+     * Discards all Put/Delete operations done since BeginTransaction().
+     */
+    void AbortTransaction();
+
 private:
     using ImplClass = ::chip::DeviceLayer::PersistedStorage::KeyValueStoreManagerImpl;
 
 protected:
+    // Default no-op transaction support, hidden by platforms that implement batching.
+    CHIP_ERROR _BeginTransaction() { return CHIP_NO_ERROR; }
+    CHIP_ERROR _CommitTransaction() { return CHIP_NO_ERROR; }
+    void _AbortTransaction() {}
+
     // Construction/destruction limited to subclasses.
     KeyValueStoreManager()  = default;
     ~KeyValueStoreManager() = default;
@@ -233,6 +270,21 @@ inline CHIP_ERROR KeyValueStoreManager::Delete(const char * key)
     return static_cast<ImplClass *>(this)->_Delete(key);
 }
 
+inline CHIP_ERROR KeyValueStoreManager::BeginTransaction()
+{
+    return static_cast<ImplClass *>(this)->_BeginTransaction();
+}
+
+inline CHIP_ERROR KeyValueStoreManager::CommitTransaction()
+{
+    return static_cast<ImplClass *>(this)->_CommitTransaction();
+}
+
+inline void KeyValueStoreManager::AbortTransaction()
+{
+    static_cast<ImplClass *>(this)->_AbortTransaction();
+}
+
 } // namespace PersistedStorage
 } // namespace DeviceLayer
 } // namespace chip
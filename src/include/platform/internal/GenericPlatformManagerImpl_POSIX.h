@@ -93,6 +93,13 @@ protected:
     CHIP_ERROR _StartChipTimer(System::Clock::Timeout duration);
     void _Shutdown();
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+    CHIP_ERROR _PostBackgroundEvent(const ChipDeviceEvent * event);
+    void _RunBackgroundEventLoop();
+    CHIP_ERROR _StartBackgroundEventLoopTask();
+    CHIP_ERROR _StopBackgroundEventLoopTask();
+#endif
+
 #if CHIP_STACK_LOCK_TRACKING_ENABLED
     bool _IsChipStackLockedByCurrentThread() const;
 #endif
@@ -113,6 +120,19 @@ private:
     static void * EventLoopTaskMain(void * arg);
 #endif
     void ProcessDeviceEvents();
+
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+    // Background events are serviced by a pool of up to CHIP_DEVICE_CONFIG_BG_TASK_COUNT
+    // threads. All members below are protected by mBackgroundEventQueueLock.
+    pthread_mutex_t mBackgroundEventQueueLock = PTHREAD_MUTEX_INITIALIZER;
+    pthread_cond_t mBackgroundEventQueueCond  = PTHREAD_COND_INITIALIZER;
+    std::queue<ChipDeviceEvent> mBackgroundEventQueue;
+    pthread_t mBackgroundTasks[CHIP_DEVICE_CONFIG_BG_TASK_COUNT];
+    size_t mBackgroundTaskCount        = 0; // threads created by _StartBackgroundEventLoopTask()
+    size_t mBackgroundEventLoopCount   = 0; // threads currently running the background event loop
+    bool mShouldRunBackgroundEventLoop = false;
+    static void * BackgroundEventLoopTaskMain(void * arg);
+#endif
 };
 
 // Instruct the compiler to instantiate the template only when explicitly told to do so.
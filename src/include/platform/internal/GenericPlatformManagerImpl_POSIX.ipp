@@ -383,6 +383,143 @@ exit:
 #endif // CHIP_SYSTEM_CONFIG_USE_LIBEV
 }
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_PostBackgroundEvent(const ChipDeviceEvent * event)
+{
+    if (!(event->Type == DeviceEventType::kCallWorkFunct || event->Type == DeviceEventType::kNoOp))
+    {
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+
+    pthread_mutex_lock(&mBackgroundEventQueueLock);
+
+    // Without a thread to service the background queue, use the foreground event loop.
+    if (mBackgroundEventLoopCount == 0)
+    {
+        pthread_mutex_unlock(&mBackgroundEventQueueLock);
+        return Impl()->PostEvent(event);
+    }
+
+    if (mBackgroundEventQueue.size() >= CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE)
+    {
+        pthread_mutex_unlock(&mBackgroundEventQueueLock);
+        ChipLogDetail(DeviceLayer, "CHIP background event queue is full");
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    mBackgroundEventQueue.push(*event);
+    pthread_cond_signal(&mBackgroundEventQueueCond);
+    pthread_mutex_unlock(&mBackgroundEventQueueLock);
+
+    return CHIP_NO_ERROR;
+}
+
+template <class ImplClass>
+void GenericPlatformManagerImpl_POSIX<ImplClass>::_RunBackgroundEventLoop()
+{
+    pthread_mutex_lock(&mBackgroundEventQueueLock);
+
+    //
+    // Threads not created by StartBackgroundEventLoopTask run until StopBackgroundEventLoopTask is called.
+    //
+    if (mBackgroundTaskCount == 0)
+    {
+        mShouldRunBackgroundEventLoop = true;
+    }
+
+    mBackgroundEventLoopCount++;
+    while (mShouldRunBackgroundEventLoop)
+    {
+        if (mBackgroundEventQueue.empty())
+        {
+            pthread_cond_wait(&mBackgroundEventQueueCond, &mBackgroundEventQueueLock);
+            continue;
+        }
+
+        const ChipDeviceEvent event = mBackgroundEventQueue.front();
+        mBackgroundEventQueue.pop();
+
+        pthread_mutex_unlock(&mBackgroundEventQueueLock);
+        Impl()->DispatchEvent(&event);
+        pthread_mutex_lock(&mBackgroundEventQueueLock);
+    }
+    mBackgroundEventLoopCount--;
+
+    pthread_mutex_unlock(&mBackgroundEventQueueLock);
+}
+
+template <class ImplClass>
+void * GenericPlatformManagerImpl_POSIX<ImplClass>::BackgroundEventLoopTaskMain(void * arg)
+{
+    ChipLogDetail(DeviceLayer, "CHIP background task running");
+    static_cast<GenericPlatformManagerImpl_POSIX<ImplClass> *>(arg)->Impl()->RunBackgroundEventLoop();
+    return nullptr;
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StartBackgroundEventLoopTask()
+{
+    int err = 0;
+
+    pthread_mutex_lock(&mBackgroundEventQueueLock);
+    VerifyOrExit(mBackgroundTaskCount == 0, err = EALREADY);
+
+    mShouldRunBackgroundEventLoop = true;
+    for (; mBackgroundTaskCount < CHIP_DEVICE_CONFIG_BG_TASK_COUNT; mBackgroundTaskCount++)
+    {
+        err = pthread_create(&mBackgroundTasks[mBackgroundTaskCount], nullptr, BackgroundEventLoopTaskMain, this);
+        VerifyOrExit(err == 0, );
+    }
+
+exit:
+    pthread_mutex_unlock(&mBackgroundEventQueueLock);
+
+    // Threads that did start are stopped by StopBackgroundEventLoopTask, like on success.
+    return CHIP_ERROR_POSIX(err);
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StopBackgroundEventLoopTask()
+{
+    int err = 0;
+
+    pthread_mutex_lock(&mBackgroundEventQueueLock);
+    mShouldRunBackgroundEventLoop = false;
+    pthread_cond_broadcast(&mBackgroundEventQueueCond);
+    pthread_mutex_unlock(&mBackgroundEventQueueLock);
+
+    //
+    // Once joined, none of our threads touch mBackgroundTasks or mBackgroundTaskCount anymore.
+    //
+    for (size_t i = 0; i < mBackgroundTaskCount; i++)
+    {
+        if (pthread_equal(pthread_self(), mBackgroundTasks[i]) == 0)
+        {
+            int joinErr = pthread_join(mBackgroundTasks[i], nullptr);
+            err         = (err == 0) ? joinErr : err;
+        }
+    }
+
+    pthread_mutex_lock(&mBackgroundEventQueueLock);
+    mBackgroundTaskCount = 0;
+
+    //
+    // Hand work that was never picked up to the foreground event loop, so that whoever
+    // scheduled it still gets to run it.
+    //
+    while (!mBackgroundEventQueue.empty())
+    {
+        const ChipDeviceEvent event = mBackgroundEventQueue.front();
+        mBackgroundEventQueue.pop();
+        LogErrorOnFailure(Impl()->PostEvent(&event));
+    }
+    pthread_mutex_unlock(&mBackgroundEventQueueLock);
+
+    return CHIP_ERROR_POSIX(err);
+}
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::_Shutdown()
 {
@@ -393,6 +530,10 @@ void GenericPlatformManagerImpl_POSIX<ImplClass>::_Shutdown()
     //
     VerifyOrDie(mState.load(std::memory_order_relaxed) == State::kStopped);
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+    _StopBackgroundEventLoopTask();
+#endif
+
 #if !CHIP_SYSTEM_CONFIG_USE_LIBEV
     pthread_mutex_destroy(&mStateLock);
     pthread_cond_destroy(&mEventQueueStoppedCond);
@@ -240,6 +240,15 @@ public:
     /// a clear decision if the callback should or should not be invoked.
     virtual CHIP_ERROR CancelLookup(Impl::NodeLookupHandle & handle, FailureCallback cancel_method) = 0;
 
+    /// Forget any address remembered for the given node.
+    ///
+    /// Implementations that answer lookups from previously resolved addresses
+    /// must not use the current address of the node again until it is resolved
+    /// anew. Expected to be called when the node could not be reached at the
+    /// address a lookup returned. Does nothing by default, for implementations
+    /// that do not remember addresses.
+    virtual void InvalidateCachedAddress(const PeerId & peerId) {}
+
     /// Shut down any active resolves
     ///
     /// Will immediately fail any scheduled resolve calls and will refuse to register
@@ -27,6 +27,28 @@ namespace {
 
 static constexpr System::Clock::Timeout kInvalidTimeout{ System::Clock::Timeout::max() };
 
+// How long a resolved address is cached when the DNS-SD resolver does not report the time to live of the address records.
+// This is the TTL recommended for host records by RFC 6762 (section 10).
+static constexpr System::Clock::Seconds32 kDefaultAddressTtl{ 120 };
+
+/// Fills in everything but the IP address of a result.
+ResolveResult ResultWithoutAddress(const Dnssd::CommonResolutionData & resolutionData)
+{
+    ResolveResult result;
+
+    result.address.SetPort(resolutionData.port);
+    result.address.SetInterface(resolutionData.interfaceId);
+    result.mrpRemoteConfig = resolutionData.GetRemoteMRPConfig();
+    result.supportsTcp     = resolutionData.supportsTcp;
+
+    if (resolutionData.isICDOperatingAsLIT.HasValue())
+    {
+        result.isICDOperatingAsLIT = resolutionData.isICDOperatingAsLIT.Value();
+    }
+
+    return result;
+}
+
 } // namespace
 
 void NodeLookupHandle::ResetForLookup(System::Clock::Timestamp now, const NodeLookupRequest & request)
@@ -185,7 +207,19 @@ CHIP_ERROR Resolver::LookupNode(const NodeLookupRequest & request, Impl::NodeLoo
 
     VerifyOrReturnError(mSystemLayer != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    handle.ResetForLookup(mTimeSource.GetMonotonicTimestamp(), request);
+    ResolveResult cachedResult;
+    if (mAddressCache.Lookup(request.GetPeerId(), cachedResult))
+    {
+        // Answer with the cached address as soon as possible. The DNS-SD query below still goes out, so that a response
+        // refreshes the cache.
+        NodeLookupRequest cachedRequest(request);
+        handle.ResetForLookup(mTimeSource.GetMonotonicTimestamp(), cachedRequest.SetMinLookupTime(System::Clock::kZero));
+        handle.LookupResult(cachedResult);
+    }
+    else
+    {
+        handle.ResetForLookup(mTimeSource.GetMonotonicTimestamp(), request);
+    }
     ReturnErrorOnFailure(Dnssd::Resolver::Instance().ResolveNodeId(request.GetPeerId()));
     mActiveLookups.PushBack(&handle);
     ReArmTimer();
@@ -264,12 +298,22 @@ void Resolver::Shutdown()
     // internal list of active lookups is empty at this point.
     ReArmTimer();
 
+    // The storage may be released along with whoever set it: stop persisting to it.
+    mAddressCache.Init(nullptr);
+
     mSystemLayer = nullptr;
     Dnssd::Resolver::Instance().SetOperationalDelegate(nullptr);
 }
 
+void Resolver::InvalidateCachedAddress(const PeerId & peerId)
+{
+    mAddressCache.Invalidate(peerId);
+}
+
 void Resolver::OnOperationalNodeResolved(const Dnssd::ResolvedNodeData & nodeData)
 {
+    UpdateAddressCache(nodeData);
+
     auto it = mActiveLookups.begin();
     while (it != mActiveLookups.end())
     {
@@ -280,17 +324,7 @@ void Resolver::OnOperationalNodeResolved(const Dnssd::ResolvedNodeData & nodeDat
             continue;
         }
 
-        ResolveResult result;
-
-        result.address.SetPort(nodeData.resolutionData.port);
-        result.address.SetInterface(nodeData.resolutionData.interfaceId);
-        result.mrpRemoteConfig = nodeData.resolutionData.GetRemoteMRPConfig();
-        result.supportsTcp     = nodeData.resolutionData.supportsTcp;
-
-        if (nodeData.resolutionData.isICDOperatingAsLIT.HasValue())
-        {
-            result.isICDOperatingAsLIT = nodeData.resolutionData.isICDOperatingAsLIT.Value();
-        }
+        ResolveResult result = ResultWithoutAddress(nodeData.resolutionData);
 
         for (size_t i = 0; i < nodeData.resolutionData.numIPs; i++)
         {
@@ -311,6 +345,31 @@ void Resolver::OnOperationalNodeResolved(const Dnssd::ResolvedNodeData & nodeDat
     ReArmTimer();
 }
 
+void Resolver::UpdateAddressCache(const Dnssd::ResolvedNodeData & nodeData)
+{
+    NodeLookupResults best;
+    ResolveResult result = ResultWithoutAddress(nodeData.resolutionData);
+
+    for (size_t i = 0; i < nodeData.resolutionData.numIPs; i++)
+    {
+        const Inet::IPAddress & address = nodeData.resolutionData.ipAddress[i];
+#if !INET_CONFIG_ENABLE_IPV4
+        if (!address.IsIPv6())
+        {
+            continue;
+        }
+#endif
+        result.address.SetIPAddress(address);
+        best.UpdateResults(result, Dnssd::IPAddressSorter::ScoreIpAddress(address, result.address.GetInterface()));
+    }
+
+    if (best.HasValidResult())
+    {
+        mAddressCache.Update(nodeData.operationalData.peerId, best.results[0],
+                             nodeData.resolutionData.ttl.ValueOr(kDefaultAddressTtl));
+    }
+}
+
 void Resolver::HandleAction(IntrusiveList<NodeLookupHandle>::Iterator & current)
 {
     const NodeLookupAction action = current->NextAction(mTimeSource.GetMonotonicTimestamp());
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <lib/address_resolve/AddressResolve.h>
+#include <lib/address_resolve/NodeAddressCache.h>
 #include <lib/dnssd/IPAddressSorter.h>
 #include <lib/dnssd/Resolver.h>
 #include <system/TimeSource.h>
@@ -174,8 +175,16 @@ public:
     CHIP_ERROR LookupNode(const NodeLookupRequest & request, Impl::NodeLookupHandle & handle) override;
     CHIP_ERROR TryNextResult(Impl::NodeLookupHandle & handle) override;
     CHIP_ERROR CancelLookup(Impl::NodeLookupHandle & handle, FailureCallback cancel_method) override;
+    void InvalidateCachedAddress(const PeerId & peerId) override;
     void Shutdown() override;
 
+    /// Persist the cached node addresses in the given storage, and load the
+    /// ones persisted previously. Addresses are only cached in memory until
+    /// this is called.
+    CHIP_ERROR SetAddressCacheStorage(PersistentStorageDelegate * storage) { return mAddressCache.Init(storage); }
+
+    const NodeAddressCache::Statistics & GetAddressCacheStatistics() const { return mAddressCache.GetStatistics(); }
+
     // Dnssd::OperationalResolveDelegate
 
     void OnOperationalNodeResolved(const Dnssd::ResolvedNodeData & nodeData) override;
@@ -200,9 +209,19 @@ private:
     /// be used after calling this method.
     void HandleAction(IntrusiveList<NodeLookupHandle>::Iterator & current);
 
+    /// Caches the best address of a resolved node, for as long as its DNS-SD
+    /// address records are valid.
+    void UpdateAddressCache(const Dnssd::ResolvedNodeData & nodeData);
+
     System::Layer * mSystemLayer = nullptr;
     Time::TimeSource<Time::Source::kSystem> mTimeSource;
     IntrusiveList<NodeLookupHandle> mActiveLookups;
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    NodeAddressCache::Entry mAddressCacheEntries[CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE];
+    NodeAddressCache mAddressCache{ Span<NodeAddressCache::Entry>(mAddressCacheEntries) };
+#else
+    NodeAddressCache mAddressCache{ Span<NodeAddressCache::Entry>() };
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
 };
 
 } // namespace Impl
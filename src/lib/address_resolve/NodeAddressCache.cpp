@@ -0,0 +1,346 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/address_resolve/AddressResolve.h>
+#include <lib/address_resolve/NodeAddressCache.h>
+
+#include <lib/core/TLV.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/SafeInt.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace AddressResolve {
+namespace Impl {
+namespace {
+
+// Tags of the fields of a persisted entry
+constexpr TLV::Tag kCompressedFabricIdTag   = TLV::ContextTag(1);
+constexpr TLV::Tag kNodeIdTag               = TLV::ContextTag(2);
+constexpr TLV::Tag kAddressTag              = TLV::ContextTag(3);
+constexpr TLV::Tag kPortTag                 = TLV::ContextTag(4);
+constexpr TLV::Tag kIdleRetransTimeoutTag   = TLV::ContextTag(5);
+constexpr TLV::Tag kActiveRetransTimeoutTag = TLV::ContextTag(6);
+constexpr TLV::Tag kActiveThresholdTimeTag  = TLV::ContextTag(7);
+constexpr TLV::Tag kSupportsTcpTag          = TLV::ContextTag(8);
+constexpr TLV::Tag kICDOperatingAsLITTag    = TLV::ContextTag(9);
+constexpr TLV::Tag kExpiryTag               = TLV::ContextTag(10); // real time, in seconds since the Unix epoch
+
+constexpr size_t kAddressSize = 16;
+
+constexpr System::Clock::Seconds32 kPersistedLifetime(CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_PERSISTED_LIFETIME_SECS);
+
+constexpr size_t kMaxPersistedEntrySize =
+    TLV::EstimateStructOverhead(sizeof(CompressedFabricId), sizeof(NodeId), kAddressSize, sizeof(uint16_t), sizeof(uint32_t),
+                                sizeof(uint32_t), sizeof(uint16_t), sizeof(bool), sizeof(bool), sizeof(uint64_t));
+
+CHIP_ERROR GetRealTimeSeconds(uint64_t & seconds)
+{
+    System::Clock::Microseconds64 realTime;
+    ReturnErrorOnFailure(System::SystemClock().GetClock_RealTime(realTime));
+    seconds = std::chrono::duration_cast<System::Clock::Seconds64>(realTime).count();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR EncodeEntry(TLV::TLVWriter & writer, const NodeAddressCache::Entry & entry, uint64_t expirySeconds)
+{
+    uint8_t address[kAddressSize];
+    uint8_t * addressData = address;
+    entry.result.address.GetIPAddress().WriteAddress(addressData);
+
+    const ReliableMessageProtocolConfig & mrpConfig = entry.result.mrpRemoteConfig;
+
+    TLV::TLVType containerType;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, containerType));
+    ReturnErrorOnFailure(writer.Put(kCompressedFabricIdTag, entry.peerId.GetCompressedFabricId()));
+    ReturnErrorOnFailure(writer.Put(kNodeIdTag, entry.peerId.GetNodeId()));
+    ReturnErrorOnFailure(writer.Put(kAddressTag, ByteSpan(address)));
+    ReturnErrorOnFailure(writer.Put(kPortTag, entry.result.address.GetPort()));
+    ReturnErrorOnFailure(writer.Put(kIdleRetransTimeoutTag, mrpConfig.mIdleRetransTimeout.count()));
+    ReturnErrorOnFailure(writer.Put(kActiveRetransTimeoutTag, mrpConfig.mActiveRetransTimeout.count()));
+    ReturnErrorOnFailure(writer.Put(kActiveThresholdTimeTag, mrpConfig.mActiveThresholdTime.count()));
+    ReturnErrorOnFailure(writer.PutBoolean(kSupportsTcpTag, entry.result.supportsTcp));
+    ReturnErrorOnFailure(writer.PutBoolean(kICDOperatingAsLITTag, entry.result.isICDOperatingAsLIT));
+    ReturnErrorOnFailure(writer.Put(kExpiryTag, expirySeconds));
+    ReturnErrorOnFailure(writer.EndContainer(containerType));
+    return writer.Finalize();
+}
+
+// Whether two results hold the same persisted fields.
+bool IsSamePersistedResult(const ResolveResult & a, const ResolveResult & b)
+{
+    return a.address.GetIPAddress() == b.address.GetIPAddress() && a.address.GetPort() == b.address.GetPort() &&
+        a.mrpRemoteConfig == b.mrpRemoteConfig && a.supportsTcp == b.supportsTcp && a.isICDOperatingAsLIT == b.isICDOperatingAsLIT;
+}
+
+} // namespace
+
+CHIP_ERROR NodeAddressCache::Init(PersistentStorageDelegate * storage)
+{
+    mStorage = storage;
+    VerifyOrReturnError(mStorage != nullptr, CHIP_NO_ERROR);
+
+    // Without real time, there is no telling which persisted entries are still valid.
+    uint64_t realTimeSeconds;
+    ReturnErrorOnFailure(GetRealTimeSeconds(realTimeSeconds));
+
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    for (size_t index = 0; index < mEntries.size(); index++)
+    {
+        if (mEntries[index].inUse)
+        {
+            // Resolved before storage became available: the entry is more recent than what was persisted.
+            Persist(index);
+            continue;
+        }
+
+        CHIP_ERROR err = Load(index, now, realTimeSeconds);
+        if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+        {
+            mStorage->SyncDeleteKeyValue(DefaultStorageKeyAllocator::OperationalAddressCacheEntry(index).KeyName());
+        }
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+bool NodeAddressCache::Lookup(const PeerId & peerId, ResolveResult & result)
+{
+    Entry * entry = Find(peerId);
+    if (entry != nullptr && entry->expiry <= System::SystemClock().GetMonotonicTimestamp())
+    {
+        // Keep the persisted copy, which has its own expiry.
+        entry->inUse = false;
+        entry        = nullptr;
+    }
+
+    if (entry == nullptr)
+    {
+        mStatistics.misses++;
+        return false;
+    }
+
+    mStatistics.hits++;
+    result = entry->result;
+    return true;
+}
+
+void NodeAddressCache::Update(const PeerId & peerId, const ResolveResult & result, System::Clock::Seconds32 ttl)
+{
+    if (ttl == System::Clock::kZero)
+    {
+        Invalidate(peerId);
+        return;
+    }
+
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+
+    Entry * entry = FindSlot(peerId);
+    VerifyOrReturn(entry != nullptr);
+
+    // Storage is only written when the persisted copy of the entry would change, or is getting old.
+    const bool persistedCopyIsCurrent = entry->peerId == peerId && IsSamePersistedResult(entry->result, result) &&
+        entry->persistedExpiry > now + kPersistedLifetime / 2;
+
+    entry->peerId = peerId;
+    entry->result = result;
+    entry->expiry = now + ttl;
+    entry->inUse  = true;
+    if (!persistedCopyIsCurrent)
+    {
+        Persist(static_cast<size_t>(entry - mEntries.data()));
+    }
+}
+
+void NodeAddressCache::Invalidate(const PeerId & peerId)
+{
+    Entry * entry = Find(peerId);
+    if (entry != nullptr)
+    {
+        Release(*entry);
+    }
+}
+
+NodeAddressCache::Entry * NodeAddressCache::Find(const PeerId & peerId)
+{
+    for (auto & entry : mEntries)
+    {
+        if (entry.inUse && entry.peerId == peerId)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+NodeAddressCache::Entry * NodeAddressCache::FindSlot(const PeerId & peerId)
+{
+    Entry * entry = Find(peerId);
+    VerifyOrReturnValue(entry == nullptr, entry);
+
+    // Use a free entry, preferring the one that last held the node (its persisted copy may still be current), else the
+    // entry that expires first.
+    Entry * freeEntry = nullptr;
+    for (auto & candidate : mEntries)
+    {
+        if (!candidate.inUse)
+        {
+            if (candidate.peerId == peerId)
+            {
+                return &candidate;
+            }
+            if (freeEntry == nullptr)
+            {
+                freeEntry = &candidate;
+            }
+        }
+        else if (entry == nullptr || candidate.expiry < entry->expiry)
+        {
+            entry = &candidate;
+        }
+    }
+    return (freeEntry != nullptr) ? freeEntry : entry;
+}
+
+void NodeAddressCache::Release(Entry & entry)
+{
+    entry.inUse = false;
+    Persist(static_cast<size_t>(&entry - mEntries.data()));
+}
+
+CHIP_ERROR NodeAddressCache::Load(size_t index, System::Clock::Timestamp now, uint64_t realTimeSeconds)
+{
+    uint8_t buffer[kMaxPersistedEntrySize];
+    uint16_t size = sizeof(buffer);
+    ReturnErrorOnFailure(
+        mStorage->SyncGetKeyValue(DefaultStorageKeyAllocator::OperationalAddressCacheEntry(index).KeyName(), buffer, size));
+
+    TLV::TLVReader reader;
+    reader.Init(buffer, size);
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag()));
+
+    TLV::TLVType containerType;
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+
+    Entry entry;
+    CompressedFabricId compressedFabricId;
+    NodeId nodeId;
+    ReturnErrorOnFailure(reader.Next(kCompressedFabricIdTag));
+    ReturnErrorOnFailure(reader.Get(compressedFabricId));
+    ReturnErrorOnFailure(reader.Next(kNodeIdTag));
+    ReturnErrorOnFailure(reader.Get(nodeId));
+    entry.peerId.SetCompressedFabricId(compressedFabricId).SetNodeId(nodeId);
+
+    ByteSpan addressBytes;
+    ReturnErrorOnFailure(reader.Next(kAddressTag));
+    ReturnErrorOnFailure(reader.Get(addressBytes));
+    VerifyOrReturnError(addressBytes.size() == kAddressSize, CHIP_ERROR_INVALID_TLV_ELEMENT);
+    const uint8_t * addressData = addressBytes.data();
+    Inet::IPAddress address;
+    Inet::IPAddress::ReadAddress(addressData, address);
+    entry.result.address.SetIPAddress(address);
+
+    uint16_t port;
+    ReturnErrorOnFailure(reader.Next(kPortTag));
+    ReturnErrorOnFailure(reader.Get(port));
+    entry.result.address.SetPort(port);
+
+    uint32_t idleRetransTimeout;
+    uint32_t activeRetransTimeout;
+    uint16_t activeThresholdTime;
+    ReturnErrorOnFailure(reader.Next(kIdleRetransTimeoutTag));
+    ReturnErrorOnFailure(reader.Get(idleRetransTimeout));
+    ReturnErrorOnFailure(reader.Next(kActiveRetransTimeoutTag));
+    ReturnErrorOnFailure(reader.Get(activeRetransTimeout));
+    ReturnErrorOnFailure(reader.Next(kActiveThresholdTimeTag));
+    ReturnErrorOnFailure(reader.Get(activeThresholdTime));
+    entry.result.mrpRemoteConfig.mIdleRetransTimeout   = System::Clock::Milliseconds32(idleRetransTimeout);
+    entry.result.mrpRemoteConfig.mActiveRetransTimeout = System::Clock::Milliseconds32(activeRetransTimeout);
+    entry.result.mrpRemoteConfig.mActiveThresholdTime  = System::Clock::Milliseconds16(activeThresholdTime);
+
+    ReturnErrorOnFailure(reader.Next(kSupportsTcpTag));
+    ReturnErrorOnFailure(reader.Get(entry.result.supportsTcp));
+    ReturnErrorOnFailure(reader.Next(kICDOperatingAsLITTag));
+    ReturnErrorOnFailure(reader.Get(entry.result.isICDOperatingAsLIT));
+
+    uint64_t expirySeconds;
+    ReturnErrorOnFailure(reader.Next(kExpiryTag));
+    ReturnErrorOnFailure(reader.Get(expirySeconds));
+    ReturnErrorOnFailure(reader.ExitContainer(containerType));
+
+    VerifyOrReturnError(expirySeconds > realTimeSeconds, CHIP_ERROR_INVALID_TIME);
+    VerifyOrReturnError(CanCastTo<uint32_t>(expirySeconds - realTimeSeconds), CHIP_ERROR_INVALID_TIME);
+    VerifyOrReturnError(Find(entry.peerId) == nullptr, CHIP_ERROR_DUPLICATE_KEY_ID);
+
+    entry.expiry          = now + System::Clock::Seconds32(static_cast<uint32_t>(expirySeconds - realTimeSeconds));
+    entry.persistedExpiry = entry.expiry;
+    entry.inUse           = true;
+    mEntries[index]       = entry;
+    return CHIP_NO_ERROR;
+}
+
+void NodeAddressCache::Persist(size_t index)
+{
+    VerifyOrReturn(mStorage != nullptr);
+
+    Entry & entry  = mEntries[index];
+    const auto key = DefaultStorageKeyAllocator::OperationalAddressCacheEntry(index);
+
+    // An entry that cannot be persisted still replaces whatever was persisted in its place.
+    if (!entry.inUse || entry.result.address.GetIPAddress().IsIPv6LinkLocal())
+    {
+        mStorage->SyncDeleteKeyValue(key.KeyName());
+        entry.persistedExpiry = entry.inUse ? System::Clock::Timestamp::max() : System::Clock::kZero;
+        return;
+    }
+
+    // The entry is only persisted when it can be expired after a reboot.
+    uint64_t realTimeSeconds;
+    if (GetRealTimeSeconds(realTimeSeconds) != CHIP_NO_ERROR)
+    {
+        mStorage->SyncDeleteKeyValue(key.KeyName());
+        entry.persistedExpiry = System::Clock::kZero;
+        return;
+    }
+
+    const uint64_t expirySeconds = realTimeSeconds + kPersistedLifetime.count();
+
+    uint8_t buffer[kMaxPersistedEntrySize];
+    TLV::TLVWriter writer;
+    writer.Init(buffer);
+
+    CHIP_ERROR err = EncodeEntry(writer, entry, expirySeconds);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = mStorage->SyncSetKeyValue(key.KeyName(), buffer, static_cast<uint16_t>(writer.GetLengthWritten()));
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Discovery, "Failed to persist cached address: %" CHIP_ERROR_FORMAT, err.Format());
+        mStorage->SyncDeleteKeyValue(key.KeyName());
+        entry.persistedExpiry = System::Clock::kZero;
+        return;
+    }
+
+    entry.persistedExpiry = System::SystemClock().GetMonotonicTimestamp() + kPersistedLifetime;
+}
+
+} // namespace Impl
+} // namespace AddressResolve
+} // namespace chip
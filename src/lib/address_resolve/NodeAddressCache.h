@@ -0,0 +1,109 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/address_resolve/AddressResolve.h>
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <lib/core/PeerId.h>
+#include <lib/support/Span.h>
+#include <system/SystemClock.h>
+
+namespace chip {
+namespace AddressResolve {
+namespace Impl {
+
+/// Remembers the last operational address resolved for a number of nodes,
+/// for as long as the DNS-SD records it came from are valid.
+///
+/// Lookups for a node that has a valid entry can then be answered without
+/// waiting for a DNS-SD response.
+///
+/// If given a storage delegate, entries are also persisted, so that lookups
+/// after a reboot can be answered before DNS-SD resolves the node again.
+/// Persisted entries expire (in real time) after
+/// CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_PERSISTED_LIFETIME_SECS rather than with
+/// the DNS-SD records, and are only written again when the persisted data
+/// changes or the persisted entry is half-way to its expiry. Entries for
+/// link-local addresses are not persisted, since the interface they are
+/// bound to may not be the same after a reboot.
+class NodeAddressCache
+{
+public:
+    struct Entry
+    {
+        PeerId peerId;
+        ResolveResult result;
+        System::Clock::Timestamp expiry;
+        // When the persisted copy of the entry expires; zero if there is none. Entries that are not to be persisted
+        // are marked as never expiring, so that they are not persisted again until they change.
+        System::Clock::Timestamp persistedExpiry = System::Clock::kZero;
+        bool inUse                               = false;
+    };
+
+    struct Statistics
+    {
+        uint32_t hits   = 0; // lookups answered from the cache
+        uint32_t misses = 0; // lookups for nodes without a valid entry
+    };
+
+    /// The cache holds at most `entries.size()` nodes. An empty span disables
+    /// the cache: every lookup is a miss.
+    explicit NodeAddressCache(Span<Entry> entries) : mEntries(entries) {}
+
+    /// Sets the storage used to persist entries and loads the entries that
+    /// were persisted previously and have not expired yet. Expired or
+    /// unreadable persisted entries are deleted. Loaded entries answer
+    /// lookups until their persisted copy expires, or until DNS-SD resolves
+    /// the node again.
+    ///
+    /// A null storage stops persisting entries (and keeps the current ones).
+    CHIP_ERROR Init(PersistentStorageDelegate * storage);
+
+    /// Returns true and fills `result` if the cache holds a valid entry for
+    /// `peerId`.
+    bool Lookup(const PeerId & peerId, ResolveResult & result);
+
+    /// Records `result` as the address of `peerId`, valid for `ttl`.
+    ///
+    /// If the cache is full, the entry that expires first is replaced. A ttl
+    /// of zero (a DNS-SD "goodbye") removes the entry for `peerId`.
+    void Update(const PeerId & peerId, const ResolveResult & result, System::Clock::Seconds32 ttl);
+
+    /// Removes the entry for `peerId`, if any, along with its persisted copy.
+    ///
+    /// Entries that merely expire are only removed from memory: their
+    /// persisted copy is still used after a reboot.
+    void Invalidate(const PeerId & peerId);
+
+    const Statistics & GetStatistics() const { return mStatistics; }
+
+private:
+    Entry * Find(const PeerId & peerId);
+    Entry * FindSlot(const PeerId & peerId);
+    void Release(Entry & entry);
+
+    CHIP_ERROR Load(size_t index, System::Clock::Timestamp now, uint64_t realTimeSeconds);
+    void Persist(size_t index);
+
+    Span<Entry> mEntries;
+    PersistentStorageDelegate * mStorage = nullptr;
+    Statistics mStatistics;
+};
+
+} // namespace Impl
+} // namespace AddressResolve
+} // namespace chip
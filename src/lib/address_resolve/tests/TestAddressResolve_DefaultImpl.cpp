@@ -15,7 +15,12 @@
  */
 #include <lib/address_resolve/AddressResolve_DefaultImpl.h>
 
+#include <lib/support/CHIPMem.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
 #include <lib/support/UnitTestRegistration.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayerImpl.h>
 
 #include <nlunit-test.h>
 
@@ -24,11 +29,71 @@ using namespace chip::AddressResolve;
 
 namespace {
 
+using chip::AddressResolve::Impl::NodeAddressCache;
 using chip::Dnssd::IPAddressSorter::IpScore;
 using chip::Dnssd::IPAddressSorter::ScoreIpAddress;
+using namespace chip::System::Clock::Literals;
 
 constexpr uint8_t kNumberOfAvailableSlots = CHIP_CONFIG_MDNS_RESOLVE_LOOKUP_RESULTS;
 
+constexpr System::Clock::Seconds32 kPersistedLifetime(CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_PERSISTED_LIFETIME_SECS);
+
+// Counts the values written, to check that unchanged addresses are not persisted again.
+class WriteCountingStorage : public TestPersistentStorageDelegate
+{
+public:
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override
+    {
+        mWrites++;
+        return TestPersistentStorageDelegate::SyncSetKeyValue(key, value, size);
+    }
+
+    size_t GetNumWrites() const { return mWrites; }
+
+private:
+    size_t mWrites = 0;
+};
+
+class MockOperationalResolver : public Dnssd::Resolver
+{
+public:
+    CHIP_ERROR Init(Inet::EndPointManager<Inet::UDPEndPoint> *) override { return CHIP_NO_ERROR; }
+    bool IsInitialized() override { return true; }
+    void Shutdown() override {}
+    void SetOperationalDelegate(Dnssd::OperationalResolveDelegate * delegate) override {}
+    CHIP_ERROR ResolveNodeId(const PeerId & peerId) override
+    {
+        mResolveCalls++;
+        return CHIP_NO_ERROR;
+    }
+    void NodeIdResolutionNoLongerNeeded(const PeerId & peerId) override {}
+    CHIP_ERROR DiscoverCommissionableNodes(Dnssd::DiscoveryFilter filter, Dnssd::DiscoveryContext & context) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR DiscoverCommissioners(Dnssd::DiscoveryFilter filter, Dnssd::DiscoveryContext & context) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR StopDiscovery(Dnssd::DiscoveryContext & context) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+    CHIP_ERROR ReconfirmRecord(const char * hostname, Inet::IPAddress address, Inet::InterfaceId interfaceId) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+    size_t GetNumResolveCalls() const { return mResolveCalls; }
+
+private:
+    size_t mResolveCalls = 0;
+};
+
+class MockNodeListener : public NodeListener
+{
+public:
+    void OnNodeAddressResolved(const PeerId & peerId, const ResolveResult & result) override {}
+    void OnNodeAddressResolutionFailed(const PeerId & peerId, CHIP_ERROR reason) override {}
+};
+
 Transport::PeerAddress GetAddressWithLowScore(uint16_t port = CHIP_PORT, Inet::InterfaceId interfaceId = Inet::InterfaceId::Null())
 {
     // Unique Local - expect score "3"
@@ -200,16 +265,292 @@ void TestLookupResult(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, !handle.HasLookupResult());
 }
 
+void TestAddressCacheLookup(nlTestSuite * inSuite, void * inContext)
+{
+    System::Clock::Internal::MockClock clock;
+    System::Clock::ClockBase * realClock = &System::SystemClock();
+    System::Clock::Internal::SetSystemClockForTesting(&clock);
+
+    NodeAddressCache::Entry entries[2];
+    NodeAddressCache cache{ Span<NodeAddressCache::Entry>(entries) };
+
+    const PeerId peer1(1, 10);
+    const PeerId peer2(1, 20);
+    const PeerId peer3(2, 10);
+
+    ResolveResult result;
+    result.address     = GetAddressWithMediumScore(5541);
+    result.supportsTcp = true;
+
+    ResolveResult outResult;
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(peer1, outResult));
+
+    cache.Update(peer1, result, 120_s32);
+    NL_TEST_ASSERT(inSuite, cache.Lookup(peer1, outResult));
+    NL_TEST_ASSERT(inSuite, outResult.address == result.address);
+    NL_TEST_ASSERT(inSuite, outResult.supportsTcp);
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(peer2, outResult));
+
+    // Entries expire with their TTL.
+    clock.AdvanceMonotonic(119_s);
+    NL_TEST_ASSERT(inSuite, cache.Lookup(peer1, outResult));
+    clock.AdvanceMonotonic(1_s);
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(peer1, outResult));
+
+    // When full, the entry that expires first is replaced.
+    cache.Update(peer1, result, 60_s32);
+    cache.Update(peer2, result, 30_s32);
+    cache.Update(peer3, result, 90_s32);
+    NL_TEST_ASSERT(inSuite, cache.Lookup(peer1, outResult));
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(peer2, outResult));
+    NL_TEST_ASSERT(inSuite, cache.Lookup(peer3, outResult));
+
+    // Invalidated entries, and entries updated with a zero TTL, are gone.
+    cache.Invalidate(peer1);
+    cache.Update(peer3, result, 0_s32);
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(peer1, outResult));
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(peer3, outResult));
+
+    NL_TEST_ASSERT(inSuite, cache.GetStatistics().hits == 4);
+    NL_TEST_ASSERT(inSuite, cache.GetStatistics().misses == 6);
+
+    System::Clock::Internal::SetSystemClockForTesting(realClock);
+}
+
+void TestAddressCachePersistence(nlTestSuite * inSuite, void * inContext)
+{
+    System::Clock::Internal::MockClock clock;
+    System::Clock::ClockBase * realClock = &System::SystemClock();
+    System::Clock::Internal::SetSystemClockForTesting(&clock);
+    clock.SetClock_RealTime(System::Clock::Seconds64(1700000000));
+
+    WriteCountingStorage storage;
+
+    const PeerId peer1(1, 10);
+    const PeerId peer2(1, 20);
+
+    ResolveResult result;
+    result.address                             = GetAddressWithLowScore(5541);
+    result.mrpRemoteConfig.mIdleRetransTimeout = 2000_ms32;
+    result.isICDOperatingAsLIT                 = true;
+
+    ResolveResult movedResult = result;
+    movedResult.address       = GetAddressWithLowScore(5542);
+
+    ResolveResult linkLocalResult;
+    linkLocalResult.address = GetAddressWithHighScore();
+
+    {
+        NodeAddressCache::Entry entries[4];
+        NodeAddressCache cache{ Span<NodeAddressCache::Entry>(entries) };
+        NL_TEST_ASSERT(inSuite, cache.Init(&storage) == CHIP_NO_ERROR);
+
+        cache.Update(peer1, result, 120_s32);
+        cache.Update(peer2, linkLocalResult, 120_s32);
+
+        // Link-local addresses are not persisted.
+        NL_TEST_ASSERT(inSuite, storage.GetNumKeys() == 1);
+        NL_TEST_ASSERT(inSuite, storage.GetNumWrites() == 1);
+
+        // Refreshing unchanged addresses does not write to storage, changing them does.
+        clock.AdvanceMonotonic(100_s);
+        cache.Update(peer1, result, 120_s32);
+        cache.Update(peer2, linkLocalResult, 120_s32);
+        NL_TEST_ASSERT(inSuite, storage.GetNumWrites() == 1);
+        cache.Update(peer1, movedResult, 120_s32);
+        NL_TEST_ASSERT(inSuite, storage.GetNumWrites() == 2);
+        cache.Update(peer1, result, 120_s32);
+        NL_TEST_ASSERT(inSuite, storage.GetNumWrites() == 3);
+
+        // Entries that expire in memory keep their persisted copy, which is written again once half-way to its expiry.
+        clock.AdvanceMonotonic(kPersistedLifetime / 2);
+        ResolveResult outResult;
+        NL_TEST_ASSERT(inSuite, !cache.Lookup(peer1, outResult));
+        NL_TEST_ASSERT(inSuite, storage.GetNumKeys() == 1);
+        cache.Update(peer1, result, 120_s32);
+        NL_TEST_ASSERT(inSuite, storage.GetNumWrites() == 4);
+    }
+
+    // Persisted entries outlive the DNS-SD records they came from.
+    clock.AdvanceMonotonic(1000_s);
+    clock.AdvanceRealTime(3600_s);
+    {
+        NodeAddressCache::Entry entries[4];
+        NodeAddressCache cache{ Span<NodeAddressCache::Entry>(entries) };
+        NL_TEST_ASSERT(inSuite, cache.Init(&storage) == CHIP_NO_ERROR);
+
+        ResolveResult outResult;
+        NL_TEST_ASSERT(inSuite, cache.Lookup(peer1, outResult));
+        NL_TEST_ASSERT(inSuite, outResult.address == result.address);
+        NL_TEST_ASSERT(inSuite, outResult.mrpRemoteConfig.mIdleRetransTimeout == 2000_ms32);
+        NL_TEST_ASSERT(inSuite, outResult.isICDOperatingAsLIT);
+        NL_TEST_ASSERT(inSuite, !cache.Lookup(peer2, outResult));
+
+        cache.Update(peer1, result, 120_s32);
+        NL_TEST_ASSERT(inSuite, storage.GetNumWrites() == 4);
+
+        // Invalidated entries are deleted from storage.
+        cache.Invalidate(peer1);
+        NL_TEST_ASSERT(inSuite, storage.GetNumKeys() == 0);
+
+        cache.Update(peer1, result, 120_s32);
+        NL_TEST_ASSERT(inSuite, storage.GetNumWrites() == 5);
+    }
+
+    // Expired entries are deleted when loading.
+    clock.AdvanceRealTime(kPersistedLifetime);
+    {
+        NodeAddressCache::Entry entries[4];
+        NodeAddressCache cache{ Span<NodeAddressCache::Entry>(entries) };
+        NL_TEST_ASSERT(inSuite, storage.GetNumKeys() == 1);
+        NL_TEST_ASSERT(inSuite, cache.Init(&storage) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, storage.GetNumKeys() == 0);
+
+        ResolveResult outResult;
+        NL_TEST_ASSERT(inSuite, !cache.Lookup(peer1, outResult));
+    }
+
+    System::Clock::Internal::SetSystemClockForTesting(realClock);
+}
+
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+void TestLookupNodeFromCache(nlTestSuite * inSuite, void * inContext)
+{
+    System::LayerImpl systemLayer;
+    NL_TEST_ASSERT(inSuite, systemLayer.Init() == CHIP_NO_ERROR);
+
+    MockOperationalResolver dnssdResolver;
+    Dnssd::Resolver::SetInstance(dnssdResolver);
+
+    Impl::Resolver resolver;
+    NL_TEST_ASSERT(inSuite, resolver.Init(&systemLayer) == CHIP_NO_ERROR);
+
+    const PeerId peer(1, 10);
+    MockNodeListener listener;
+
+    Dnssd::ResolvedNodeData nodeData;
+    nodeData.operationalData.peerId      = peer;
+    nodeData.resolutionData.port         = 5541;
+    nodeData.resolutionData.numIPs       = 1;
+    nodeData.resolutionData.ipAddress[0] = GetAddressWithMediumScore().GetIPAddress();
+    nodeData.resolutionData.supportsTcp  = true;
+    nodeData.resolutionData.ttl.SetValue(120_s32);
+
+    // Without an address in the cache, the lookup waits for DNS-SD.
+    {
+        Impl::NodeLookupHandle handle;
+        handle.SetListener(&listener);
+        NL_TEST_ASSERT(inSuite, resolver.LookupNode(NodeLookupRequest(peer), handle) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, dnssdResolver.GetNumResolveCalls() == 1);
+        NL_TEST_ASSERT(inSuite, !handle.HasLookupResult());
+        NL_TEST_ASSERT(inSuite, resolver.CancelLookup(handle, Resolver::FailureCallback::Skip) == CHIP_NO_ERROR);
+    }
+
+    resolver.OnOperationalNodeResolved(nodeData);
+
+    // The resolved address answers the next lookup right away, and DNS-SD is still queried to refresh it.
+    {
+        Impl::NodeLookupHandle handle;
+        handle.SetListener(&listener);
+        NL_TEST_ASSERT(inSuite, resolver.LookupNode(NodeLookupRequest(peer), handle) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, dnssdResolver.GetNumResolveCalls() == 2);
+        NL_TEST_ASSERT(inSuite, handle.HasLookupResult());
+
+        ResolveResult result = handle.TakeLookupResult();
+        NL_TEST_ASSERT(inSuite, result.address.GetIPAddress() == nodeData.resolutionData.ipAddress[0]);
+        NL_TEST_ASSERT(inSuite, result.address.GetPort() == 5541);
+        NL_TEST_ASSERT(inSuite, result.supportsTcp);
+        NL_TEST_ASSERT(inSuite, resolver.CancelLookup(handle, Resolver::FailureCallback::Skip) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, resolver.GetAddressCacheStatistics().hits == 1);
+
+    // Once invalidated, the address is not used again.
+    resolver.InvalidateCachedAddress(peer);
+    {
+        Impl::NodeLookupHandle handle;
+        handle.SetListener(&listener);
+        NL_TEST_ASSERT(inSuite, resolver.LookupNode(NodeLookupRequest(peer), handle) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, !handle.HasLookupResult());
+        NL_TEST_ASSERT(inSuite, resolver.CancelLookup(handle, Resolver::FailureCallback::Skip) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, resolver.GetAddressCacheStatistics().hits == 1);
+
+    resolver.Shutdown();
+    Dnssd::Resolver::SetInstance(Dnssd::GetDefaultResolver());
+    systemLayer.Shutdown();
+}
+
+void TestShutdownReleasesCacheStorage(nlTestSuite * inSuite, void * inContext)
+{
+    System::Clock::Internal::MockClock clock;
+    System::Clock::ClockBase * realClock = &System::SystemClock();
+    System::Clock::Internal::SetSystemClockForTesting(&clock);
+    clock.SetClock_RealTime(System::Clock::Seconds64(1700000000));
+
+    System::LayerImpl systemLayer;
+    NL_TEST_ASSERT(inSuite, systemLayer.Init() == CHIP_NO_ERROR);
+
+    MockOperationalResolver dnssdResolver;
+    Dnssd::Resolver::SetInstance(dnssdResolver);
+
+    WriteCountingStorage storage;
+    Impl::Resolver resolver;
+    NL_TEST_ASSERT(inSuite, resolver.Init(&systemLayer) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, resolver.SetAddressCacheStorage(&storage) == CHIP_NO_ERROR);
+
+    const PeerId peer(1, 10);
+    Dnssd::ResolvedNodeData nodeData;
+    nodeData.operationalData.peerId      = peer;
+    nodeData.resolutionData.port         = 5541;
+    nodeData.resolutionData.numIPs       = 1;
+    nodeData.resolutionData.ipAddress[0] = GetAddressWithLowScore().GetIPAddress();
+    nodeData.resolutionData.ttl.SetValue(120_s32);
+
+    resolver.OnOperationalNodeResolved(nodeData);
+    NL_TEST_ASSERT(inSuite, storage.GetNumWrites() == 1);
+    NL_TEST_ASSERT(inSuite, storage.GetNumKeys() == 1);
+
+    // Whoever set the storage may release it once the resolver is shut down, so it is not touched anymore.
+    resolver.Shutdown();
+    resolver.InvalidateCachedAddress(peer);
+    NL_TEST_ASSERT(inSuite, storage.GetNumKeys() == 1);
+
+    Dnssd::Resolver::SetInstance(Dnssd::GetDefaultResolver());
+    systemLayer.Shutdown();
+    System::Clock::Internal::SetSystemClockForTesting(realClock);
+}
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
+int Setup(void * inContext)
+{
+    CHIP_ERROR error = chip::Platform::MemoryInit();
+    if (error != CHIP_NO_ERROR)
+        return FAILURE;
+    return SUCCESS;
+}
+
+int Teardown(void * inContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
 const nlTest sTests[] = {
-    NL_TEST_DEF("TestLookupResult", TestLookupResult), //
-    NL_TEST_SENTINEL()                                 //
+    NL_TEST_DEF("TestLookupResult", TestLookupResult),                       //
+    NL_TEST_DEF("TestAddressCacheLookup", TestAddressCacheLookup),           //
+    NL_TEST_DEF("TestAddressCachePersistence", TestAddressCachePersistence), //
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    NL_TEST_DEF("TestLookupNodeFromCache", TestLookupNodeFromCache),                   //
+    NL_TEST_DEF("TestShutdownReleasesCacheStorage", TestShutdownReleasesCacheStorage), //
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    NL_TEST_SENTINEL()                                                       //
 };
 
 } // namespace
 
 int TestAddressResolve_DefaultImpl()
 {
-    nlTestSuite theSuite = { "AddressResolve_DefaultImpl", sTests, nullptr, nullptr };
+    nlTestSuite theSuite = { "AddressResolve_DefaultImpl", sTests, Setup, Teardown };
     nlTestRunner(&theSuite, nullptr);
     return nlTestRunnerStats(&theSuite);
 }
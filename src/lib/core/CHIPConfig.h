@@ -931,6 +931,16 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_SERVER_MAX_NUM_DIRTY_SET 8
 #endif
 
+/**
+ * @def CHIP_IM_SERVER_PATH_INDEX_BUCKETS
+ *
+ * @brief Defines the number of hash buckets the reporting engine uses to index the global dirty set and the attribute paths
+ *        of read handlers by endpoint and cluster, so that marking a path dirty only visits the paths that may intersect it.
+ */
+#ifndef CHIP_IM_SERVER_PATH_INDEX_BUCKETS
+#define CHIP_IM_SERVER_PATH_INDEX_BUCKETS 16
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_WRITE_HANDLER
  *
@@ -1206,6 +1216,38 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
     "Please enable at least one of CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_FAST_COPY_SUPPORT or CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_FLEXIBLE_COPY_SUPPORT"
 #endif
 
+/**
+ * @def CHIP_CONFIG_ACCESS_CONTROL_COMPILED_CHECK
+ *
+ * Enables (1) or disables (0) checking access against a copy of the access
+ * control list flattened into heap-allocated arrays, instead of walking the
+ * entries through their delegates for every check. The copy is made by the
+ * first check after the access control list changes; checks fall back to
+ * walking the entries if it cannot be allocated.
+ *
+ * The copy takes 16 bytes of heap per entry, 8 per subject and 16 per target,
+ * i.e. about 400 bytes per fabric with the example access control limits.
+ * Each decision cached (see CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE) adds
+ * 48 bytes of static RAM. Disabled by default, platforms with RAM to spare
+ * enable it.
+ */
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_COMPILED_CHECK
+#define CHIP_CONFIG_ACCESS_CONTROL_COMPILED_CHECK 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE
+ *
+ * Defines the number of access control decisions cached, when
+ * CHIP_CONFIG_ACCESS_CONTROL_COMPILED_CHECK is enabled, so that checks
+ * repeated for the same subject, endpoint, cluster and privilege (e.g. for
+ * each attribute of a cluster in a wildcard read) are answered without
+ * evaluating the access control list. 0 disables the cache.
+ */
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE
+#define CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE 8
+#endif
+
 /**
  * @def CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE
  *
@@ -1370,6 +1412,46 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MDNS_RESOLVE_LOOKUP_RESULTS 1
 #endif // CHIP_CONFIG_MDNS_RESOLVE_LOOKUP_RESULTS
 
+/**
+ * def CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+ *
+ * @brief Determines the maximum number of operational node addresses that the default
+ *        address resolver keeps, until their DNS-SD records expire, to answer node
+ *        lookups without waiting for DNS-SD.  Controllers talking to many nodes should
+ *        size this for the number of nodes.  0 disables the cache.
+ *
+ */
+#ifndef CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+#define CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE 0
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+
+/**
+ * @def CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_PERSISTED_LIFETIME_SECS
+ *
+ * @brief How long, in seconds, an operational node address persisted by the address
+ *        resolve cache is used after a restart, until DNS-SD resolves the node again.
+ *        DNS-SD address records usually live for a couple of minutes only, so persisted
+ *        addresses get their own, longer lifetime.  A persisted address is only written
+ *        again when it changes or when half of this lifetime has passed.
+ *
+ */
+#ifndef CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_PERSISTED_LIFETIME_SECS
+#define CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_PERSISTED_LIFETIME_SECS (24 * 60 * 60)
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_PERSISTED_LIFETIME_SECS
+
+/**
+ * @def CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE
+ *
+ * @brief Determines the maximum number of peer operational certificate chains that the
+ *        fabric table remembers as verified, so that CASE session establishment with a
+ *        known peer skips decoding the chain and verifying its signatures.  Each entry
+ *        takes about 200 bytes.  0 disables the cache.
+ *
+ */
+#ifndef CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE
+#define CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE 0
+#endif // CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE
+
 /*
  * @def CHIP_CONFIG_NETWORK_COMMISSIONING_DEBUG_TEXT_BUFFER_SIZE
  *
@@ -1679,6 +1761,29 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION_MAX_RETRY_INTERVAL_SECS (3600 * 6)
 #endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION_MAX_RETRY_INTERVAL_SECS
 
+/**
+ *  @def CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_CONCURRENT_ATTEMPTS
+ *
+ *  @brief
+ *    The maximum number of persisted subscriptions that are being resumed (i.e. that are establishing their CASE session)
+ *    at the same time. The remaining subscriptions wait until one of the ongoing attempts completes, so that a device with
+ *    many persisted subscriptions does not flood the network and its subscribers when it restarts. Must be at least 1.
+ */
+#ifndef CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_CONCURRENT_ATTEMPTS
+#define CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_CONCURRENT_ATTEMPTS 4
+#endif // CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_CONCURRENT_ATTEMPTS
+
+/**
+ *  @def CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_JITTER_MS
+ *
+ *  @brief
+ *    The upper bound of the random delay, in milliseconds, that is waited before starting each subscription resumption
+ *    after the first one. Set to 0 to start resumptions as soon as the concurrency limit allows.
+ */
+#ifndef CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_JITTER_MS
+#define CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_JITTER_MS 500
+#endif // CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_JITTER_MS
+
 /**
  * @def CHIP_CONFIG_SYNCHRONOUS_REPORTS_ENABLED
  *
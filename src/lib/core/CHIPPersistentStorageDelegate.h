@@ -110,6 +110,82 @@ public:
         CHIP_ERROR err = SyncGetKeyValue(key, nullptr, size);
         return (err == CHIP_ERROR_BUFFER_TOO_SMALL) || (err == CHIP_NO_ERROR);
     }
+
+    /**
+     * @brief
+     *   Start a batch of writes that should be made durable together.
+     *
+     *   Until the matching SyncCommitTransaction() or SyncAbortTransaction(), implementations that
+     *   support transactions may keep SyncSetKeyValue/SyncDeleteKeyValue changes pending and flush
+     *   them as a single atomic operation on commit. Reads issued inside the transaction observe its
+     *   pending writes. Transactions may be nested; only the outermost commit flushes, and aborting
+     *   a nested transaction dooms the outermost one.
+     *
+     *   The default implementation does nothing, in which case every write stays individually
+     *   durable and SyncAbortTransaction() cannot undo writes that were already made.
+     *
+     *   Prefer the scoped PersistentStorageTransaction helper over calling this directly.
+     *
+     * @return CHIP_NO_ERROR on success, or another CHIP_ERROR value from implementation on failure.
+     */
+    virtual CHIP_ERROR SyncBeginTransaction() { return CHIP_NO_ERROR; }
+
+    /**
+     * @brief
+     *   Make all writes done since the matching SyncBeginTransaction() durable.
+     *
+     * @return CHIP_NO_ERROR on success, CHIP_ERROR_TRANSACTION_CANCELED if a nested transaction was
+     *         aborted (all pending writes have then been discarded), or another CHIP_ERROR value from
+     *         implementation on failure, in which case the pending writes have been discarded too.
+     */
+    virtual CHIP_ERROR SyncCommitTransaction() { return CHIP_NO_ERROR; }
+
+    /**
+     * @brief
+     *   Discard the writes done since the matching SyncBeginTransaction(), when supported.
+     */
+    virtual void SyncAbortTransaction() {}
+};
+
+/**
+ * @brief
+ *   Scoped transaction on a PersistentStorageDelegate: the transaction begins on construction and is
+ *   aborted on destruction unless Commit() was called first, so early error returns discard the
+ *   partially written batch.
+ */
+class PersistentStorageTransaction
+{
+public:
+    explicit PersistentStorageTransaction(PersistentStorageDelegate & storage) : mStorage(storage)
+    {
+        // If the transaction cannot be started, writes simply go through one by one.
+        mActive = (mStorage.SyncBeginTransaction() == CHIP_NO_ERROR);
+    }
+
+    ~PersistentStorageTransaction()
+    {
+        if (mActive)
+        {
+            mStorage.SyncAbortTransaction();
+        }
+    }
+
+    PersistentStorageTransaction(const PersistentStorageTransaction &)             = delete;
+    PersistentStorageTransaction & operator=(const PersistentStorageTransaction &) = delete;
+
+    CHIP_ERROR Commit()
+    {
+        if (!mActive)
+        {
+            return CHIP_NO_ERROR;
+        }
+        mActive = false;
+        return mStorage.SyncCommitTransaction();
+    }
+
+private:
+    PersistentStorageDelegate & mStorage;
+    bool mActive = false;
 };
 
 } // namespace chip
@@ -24,6 +24,8 @@
 #include <lib/support/CHIPMemString.h>
 #include <tracing/macros.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace Dnssd {
 
@@ -261,7 +263,7 @@ CHIP_ERROR IncrementalResolver::OnRecord(Inet::InterfaceId interface, const Reso
             return CHIP_ERROR_INVALID_ARGUMENT;
         }
 
-        return OnIpAddress(interface, addr);
+        return OnIpAddress(interface, addr, data.GetTtlSeconds());
 #else
 #if CHIP_MINMDNS_HIGH_VERBOSITY
         ChipLogProgress(Discovery, "Ignoring A record: IPv4 not supported");
@@ -283,7 +285,7 @@ CHIP_ERROR IncrementalResolver::OnRecord(Inet::InterfaceId interface, const Reso
             return CHIP_ERROR_INVALID_ARGUMENT;
         }
 
-        return OnIpAddress(interface, addr);
+        return OnIpAddress(interface, addr, data.GetTtlSeconds());
     }
     case QType::SRV: // SRV handled on creation, ignored for 'additional data'
     default:
@@ -316,7 +318,7 @@ CHIP_ERROR IncrementalResolver::OnTxtRecord(const ResourceData & data, BytesRang
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR IncrementalResolver::OnIpAddress(Inet::InterfaceId interface, const Inet::IPAddress & addr)
+CHIP_ERROR IncrementalResolver::OnIpAddress(Inet::InterfaceId interface, const Inet::IPAddress & addr, uint64_t ttlSeconds)
 {
     if (mCommonResolutionData.numIPs >= ArraySize(mCommonResolutionData.ipAddress))
     {
@@ -336,6 +338,13 @@ CHIP_ERROR IncrementalResolver::OnIpAddress(Inet::InterfaceId interface, const I
 
     mCommonResolutionData.ipAddress[mCommonResolutionData.numIPs++] = addr;
 
+    // The resolved data is valid for as long as all of its addresses are.
+    System::Clock::Seconds32 ttl(static_cast<uint32_t>(std::min<uint64_t>(ttlSeconds, UINT32_MAX)));
+    if (!mCommonResolutionData.ttl.HasValue() || ttl < mCommonResolutionData.ttl.Value())
+    {
+        mCommonResolutionData.ttl.SetValue(ttl);
+    }
+
     LogFoundIPAddress(mTargetHostName.Get(), addr);
 
     return CHIP_NO_ERROR;
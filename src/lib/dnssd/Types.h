@@ -94,6 +94,7 @@ struct CommonResolutionData
     Optional<System::Clock::Milliseconds32> mrpRetryIntervalIdle;
     Optional<System::Clock::Milliseconds32> mrpRetryIntervalActive;
     Optional<System::Clock::Milliseconds16> mrpRetryActiveThreshold;
+    Optional<System::Clock::Seconds32> ttl; // Shortest time to live of the address records, if the resolver reports it
 
     CommonResolutionData() { Reset(); }
 
@@ -128,6 +129,7 @@ struct CommonResolutionData
         mrpRetryIntervalActive  = NullOptional;
         mrpRetryActiveThreshold = NullOptional;
         isICDOperatingAsLIT     = NullOptional;
+        ttl                     = NullOptional;
         numIPs                  = 0;
         port                    = 0;
         supportsTcp             = false;
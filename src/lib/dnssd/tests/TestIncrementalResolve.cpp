@@ -318,6 +318,8 @@ void TestParseOperational(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, !nodeData.resolutionData.GetMrpRetryIntervalActive().HasValue());
     NL_TEST_ASSERT(inSuite, nodeData.resolutionData.GetMrpRetryIntervalIdle().HasValue());
     NL_TEST_ASSERT(inSuite, nodeData.resolutionData.GetMrpRetryIntervalIdle().Value() == chip::System::Clock::Milliseconds32(23));
+    NL_TEST_ASSERT(inSuite, nodeData.resolutionData.ttl.HasValue());
+    NL_TEST_ASSERT(inSuite, nodeData.resolutionData.ttl.Value() == chip::System::Clock::Seconds32(ResourceRecord::kDefaultTtl));
 
     Inet::IPAddress addr;
     NL_TEST_ASSERT(inSuite, Inet::IPAddress::FromString("fe80::abcd:ef11:2233:4455", addr));
@@ -209,6 +209,12 @@ public:
     }
     static StorageKeyName SubscriptionResumptionMaxCount() { return StorageKeyName::Formatted("g/sum"); }
 
+    // Operational address cache
+    static StorageKeyName OperationalAddressCacheEntry(size_t index)
+    {
+        return StorageKeyName::Formatted("g/oac/%x", static_cast<unsigned>(index));
+    }
+
     // Number of scenes stored in a given endpoint's scene table, across all fabrics.
     static StorageKeyName EndpointSceneCountKey(EndpointId endpoint) { return StorageKeyName::Formatted("g/scc/e/%x", endpoint); }
 
@@ -0,0 +1,226 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <utility>
+
+namespace chip {
+
+template <typename T, typename Compare>
+class IntrusivePairingHeap;
+
+/**
+ * Links of an object stored in an IntrusivePairingHeap. The object type @a T must derive publicly from
+ * IntrusivePairingHeapNode<T>, and can be in at most one heap at a time.
+ */
+template <typename T>
+class IntrusivePairingHeapNode
+{
+private:
+    template <typename, typename>
+    friend class IntrusivePairingHeap;
+
+    // mPrev is the parent of a first child, and the previous sibling of any other node.
+    T * mChild   = nullptr;
+    T * mSibling = nullptr;
+    T * mPrev    = nullptr;
+};
+
+/**
+ * Priority queue of objects linked through their IntrusivePairingHeapNode base, which does not own or allocate them.
+ *
+ * @a Compare is a function object type, where `Compare()(a, b)` is true when @a a must leave the heap before @a b. Adding
+ * an object takes constant time, and removing one, whether it is the top of the heap or not, takes logarithmic amortized
+ * time.
+ */
+template <typename T, typename Compare>
+class IntrusivePairingHeap
+{
+public:
+    IntrusivePairingHeap() = default;
+    IntrusivePairingHeap(IntrusivePairingHeap && other) : mTop(other.mTop) { other.mTop = nullptr; }
+    IntrusivePairingHeap & operator=(IntrusivePairingHeap && other)
+    {
+        std::swap(mTop, other.mTop);
+        return *this;
+    }
+
+    IntrusivePairingHeap(const IntrusivePairingHeap &)             = delete;
+    IntrusivePairingHeap & operator=(const IntrusivePairingHeap &) = delete;
+
+    bool Empty() const { return mTop == nullptr; }
+
+    /**
+     * @return The object that leaves the heap first, or nullptr if the heap is empty.
+     */
+    T * Top() const { return mTop; }
+
+    /**
+     * Check whether @a node is in this heap, provided it is not in another one.
+     */
+    bool Contains(const T & node) const { return &node == mTop || node.mPrev != nullptr; }
+
+    /**
+     * Add @a node, which must not be in any heap.
+     */
+    void Push(T & node)
+    {
+        node.mChild   = nullptr;
+        node.mSibling = nullptr;
+        node.mPrev    = nullptr;
+        mTop          = (mTop == nullptr) ? &node : Meld(mTop, &node);
+    }
+
+    /**
+     * Remove and return the top of the heap.
+     *
+     * @return The removed object, or nullptr if the heap is empty.
+     */
+    T * Pop()
+    {
+        T * top = mTop;
+        if (top != nullptr)
+        {
+            Remove(*top);
+        }
+        return top;
+    }
+
+    /**
+     * Remove @a node, which must be in this heap.
+     */
+    void Remove(T & node)
+    {
+        T * children = MergePairs(node.mChild);
+        node.mChild  = nullptr;
+
+        if (&node == mTop)
+        {
+            mTop = children;
+            return;
+        }
+
+        if (node.mPrev->mChild == &node)
+        {
+            node.mPrev->mChild = node.mSibling;
+        }
+        else
+        {
+            node.mPrev->mSibling = node.mSibling;
+        }
+        if (node.mSibling != nullptr)
+        {
+            node.mSibling->mPrev = node.mPrev;
+        }
+        node.mSibling = nullptr;
+        node.mPrev    = nullptr;
+
+        if (children != nullptr)
+        {
+            mTop = Meld(mTop, children);
+        }
+    }
+
+    /**
+     * Forget all objects in the heap, without unlinking them.
+     */
+    void Clear() { mTop = nullptr; }
+
+    /**
+     * Visit the objects of the heap, in no particular order. Starting from Top(), returns the object after @a node, or
+     * nullptr after the last one. The heap must not change during the visit.
+     */
+    static T * Next(T * node)
+    {
+        if (node->mChild != nullptr)
+        {
+            return node->mChild;
+        }
+        while (node->mSibling == nullptr)
+        {
+            // Go back to the first child, whose mPrev is the parent.
+            while (node->mPrev != nullptr && node->mPrev->mChild != node)
+            {
+                node = node->mPrev;
+            }
+            node = node->mPrev;
+            if (node == nullptr)
+            {
+                return nullptr;
+            }
+        }
+        return node->mSibling;
+    }
+
+private:
+    static T * Meld(T * a, T * b)
+    {
+        if (Compare()(b, a))
+        {
+            std::swap(a, b);
+        }
+        b->mPrev    = a;
+        b->mSibling = a->mChild;
+        if (a->mChild != nullptr)
+        {
+            a->mChild->mPrev = b;
+        }
+        a->mChild = b;
+        return a;
+    }
+
+    static T * MergePairs(T * first)
+    {
+        // Meld siblings pairwise from left to right, stacking the results through mSibling...
+        T * stack = nullptr;
+        while (first != nullptr)
+        {
+            T * a = first;
+            T * b = a->mSibling;
+            first = (b != nullptr) ? b->mSibling : nullptr;
+
+            a->mSibling = nullptr;
+            if (b != nullptr)
+            {
+                b->mSibling = nullptr;
+                a           = Meld(a, b);
+            }
+            a->mSibling = stack;
+            stack       = a;
+        }
+
+        // ... then meld the stacked heaps from right to left.
+        T * result = nullptr;
+        while (stack != nullptr)
+        {
+            T * next        = stack->mSibling;
+            stack->mSibling = nullptr;
+            result          = (result == nullptr) ? stack : Meld(result, stack);
+            stack           = next;
+        }
+
+        if (result != nullptr)
+        {
+            result->mPrev = nullptr;
+        }
+        return result;
+    }
+
+    T * mTop = nullptr;
+};
+
+} // namespace chip
@@ -0,0 +1,118 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "BenchmarkSupport.h"
+
+#include <lib/core/ErrorStr.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace chip {
+namespace Benchmark {
+
+using namespace chip::ArgParser;
+
+namespace {
+
+constexpr uint16_t kFirstOptionId = 0x1000;
+
+} // namespace
+
+CommandLine::CommandLine(const char * toolName, const char * description, std::initializer_list<Option> options,
+                         const char * optionHelp) :
+    mToolName(toolName), mUsage(std::string("Usage: ") + toolName + " [<options...>]\n"), mOptions(options),
+    mHelpOptions(toolName, mUsage.c_str(), "1.0\nCopyright (c) 2024 Project CHIP Authors. All rights reserved.\n", description)
+{
+    mOptionDefs.reserve(mOptions.size() + 1);
+    for (size_t i = 0; i < mOptions.size(); i++)
+    {
+        mOptionDefs.push_back({ mOptions[i].name, mOptions[i].flag != nullptr ? kNoArgument : kArgumentRequired,
+                                static_cast<uint16_t>(kFirstOptionId + i) });
+    }
+    mOptionDefs.push_back({});
+
+    OptionDefs    = mOptionDefs.data();
+    HelpGroupName = "BENCHMARK OPTIONS";
+    OptionHelp    = optionHelp;
+}
+
+bool CommandLine::Parse(int argc, char * argv[])
+{
+    OptionSet * optionSets[] = { this, &mHelpOptions, nullptr };
+    VerifyOrReturnValue(ParseArgs(mToolName, argc, argv, optionSets), false);
+
+    // Keep the logs from skewing the timings; errors are still reported.
+    Logging::SetLogFilter(Logging::kLogCategory_Error);
+    return true;
+}
+
+int CommandLine::ExitStatus(CHIP_ERROR err) const
+{
+    if (err != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "%s failed: %s\n", mToolName, ErrorStr(err));
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+bool CommandLine::HandleOption(const char * progName, OptionSet * optSet, int id, const char * name, const char * arg)
+{
+    size_t index = static_cast<size_t>(id - kFirstOptionId);
+    if (id < kFirstOptionId || index >= mOptions.size())
+    {
+        PrintArgError("%s: INTERNAL ERROR: Unhandled option: %s\n", progName, name);
+        return false;
+    }
+
+    const Option & option = mOptions[index];
+    if (option.flag != nullptr)
+    {
+        *option.flag = true;
+        return true;
+    }
+
+    uint32_t value = 0;
+    if (!ParseInt(arg, value) || value < option.min || value > option.max)
+    {
+        PrintArgError("%s: Invalid value for %s: %s\n", progName, name, arg);
+        return false;
+    }
+    *option.count = value;
+    return true;
+}
+
+uint64_t NowMicroseconds()
+{
+    return System::SystemClock().GetMonotonicMicroseconds64().count();
+}
+
+uint32_t NextRandom(uint32_t & state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+} // namespace Benchmark
+} // namespace chip
@@ -0,0 +1,140 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Scaffolding shared by the chip-*-benchmark tools: command line parsing, timing and
+ *      pseudo-random inputs, so that each benchmark only holds its own scenarios.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/CHIPArgParser.hpp>
+
+#include <initializer_list>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace chip {
+namespace Benchmark {
+
+/**
+ * A command line option of a benchmark: either a count, given as `--<name> <count>` and rejected
+ * outside of [min, max], or a flag, given as `--<name>`.
+ */
+struct Option
+{
+    static Option Count(const char * name, uint32_t & value, uint32_t min = 1, uint32_t max = UINT32_MAX)
+    {
+        return Option{ name, &value, nullptr, min, max };
+    }
+    static Option Flag(const char * name, bool & value) { return Option{ name, nullptr, &value, 0, 0 }; }
+
+    const char * name;
+    uint32_t * count;
+    bool * flag;
+    uint32_t min;
+    uint32_t max;
+};
+
+/**
+ * The command line of a benchmark: its own options, along with --help and --version.
+ */
+class CommandLine : public ArgParser::OptionSetBase
+{
+public:
+    /**
+     * @param toolName     Name of the benchmark executable.
+     * @param description  One line describing what the benchmark measures.
+     * @param options      Options of the benchmark, which store their value where they point to.
+     * @param optionHelp   Help text of the options.
+     */
+    CommandLine(const char * toolName, const char * description, std::initializer_list<Option> options,
+                const char * optionHelp);
+
+    /**
+     * Parse the command line. On success, the logs are also filtered down to errors, so that they
+     * do not skew the timings.
+     *
+     * ParseArgs allocates from the CHIP heap, which must be initialized.
+     */
+    bool Parse(int argc, char * argv[]);
+
+    /**
+     * Report @a err, if any, and return the matching exit status of the benchmark.
+     */
+    int ExitStatus(CHIP_ERROR err) const;
+
+    bool HandleOption(const char * progName, ArgParser::OptionSet * optSet, int id, const char * name, const char * arg) override;
+
+private:
+    const char * mToolName;
+    std::string mUsage;
+    std::vector<Option> mOptions;
+    std::vector<ArgParser::OptionDef> mOptionDefs;
+    ArgParser::HelpOptions mHelpOptions;
+};
+
+/**
+ * Monotonic time, in microseconds.
+ */
+uint64_t NowMicroseconds();
+
+/**
+ * Next value of a xorshift32 sequence, from a non-zero @a state. Deterministic, so that successive
+ * runs of a benchmark replay the same inputs in the same order.
+ */
+uint32_t NextRandom(uint32_t & state);
+
+/**
+ * Outcome of timing an operation over a sequence of inputs.
+ */
+struct Timing
+{
+    uint64_t elapsedMicroseconds = 0;
+    size_t operationCount        = 0;
+    size_t successCount          = 0; ///< Operations that returned true.
+
+    double MicrosecondsPerOperation() const
+    {
+        return operationCount > 0 ? static_cast<double>(elapsedMicroseconds) / static_cast<double>(operationCount) : 0;
+    }
+};
+
+/**
+ * Time @a operation, a predicate, over each of @a inputs in turn.
+ */
+template <typename Input, typename Operation>
+Timing TimeEach(const std::vector<Input> & inputs, Operation && operation)
+{
+    Timing timing;
+    uint64_t start = NowMicroseconds();
+    for (const Input & input : inputs)
+    {
+        timing.successCount += operation(input) ? 1 : 0;
+    }
+    timing.elapsedMicroseconds = NowMicroseconds() - start;
+    timing.operationCount      = inputs.size();
+    return timing;
+}
+
+} // namespace Benchmark
+} // namespace chip
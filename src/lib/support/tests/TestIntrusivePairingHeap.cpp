@@ -0,0 +1,142 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <cstdlib>
+#include <ctime>
+#include <set>
+
+#include <lib/support/IntrusivePairingHeap.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+namespace {
+
+using namespace chip;
+
+struct HeapNode : public IntrusivePairingHeapNode<HeapNode>
+{
+    int key = 0;
+};
+
+struct LessKey
+{
+    bool operator()(const HeapNode * a, const HeapNode * b) const { return a->key < b->key; }
+};
+
+using Heap = IntrusivePairingHeap<HeapNode, LessKey>;
+
+size_t CountNodes(const Heap & heap)
+{
+    size_t count = 0;
+    for (HeapNode * node = heap.Top(); node != nullptr; node = Heap::Next(node))
+    {
+        count++;
+    }
+    return count;
+}
+
+void TestIntrusivePairingHeapOrder(nlTestSuite * inSuite, void * inContext)
+{
+    Heap heap;
+    HeapNode node[5];
+    const int keys[] = { 3, 1, 4, 1, 5 };
+
+    NL_TEST_ASSERT(inSuite, heap.Empty());
+    NL_TEST_ASSERT(inSuite, heap.Pop() == nullptr);
+
+    for (size_t i = 0; i < 5; i++)
+    {
+        node[i].key = keys[i];
+        heap.Push(node[i]);
+        NL_TEST_ASSERT(inSuite, heap.Contains(node[i]));
+    }
+    NL_TEST_ASSERT(inSuite, CountNodes(heap) == 5);
+
+    // Remove a node from inside the heap, then drain it.
+    heap.Remove(node[2]);
+    NL_TEST_ASSERT(inSuite, !heap.Contains(node[2]));
+
+    const int expected[] = { 1, 1, 3, 5 };
+    for (int key : expected)
+    {
+        HeapNode * top = heap.Pop();
+        NL_TEST_ASSERT(inSuite, top != nullptr && top->key == key);
+        NL_TEST_ASSERT(inSuite, top != nullptr && !heap.Contains(*top));
+    }
+    NL_TEST_ASSERT(inSuite, heap.Empty());
+}
+
+void TestIntrusivePairingHeapRandom(nlTestSuite * inSuite, void * inContext)
+{
+    Heap heap;
+    HeapNode node[100];
+    std::multiset<int> keys;
+
+    for (int round = 0; round < 1000; round++)
+    {
+        HeapNode & n = node[std::rand() % 100];
+        if (!heap.Contains(n))
+        {
+            n.key = std::rand() % 50;
+            heap.Push(n);
+            keys.insert(n.key);
+        }
+        else if (std::rand() % 2 == 0)
+        {
+            heap.Remove(n);
+            keys.erase(keys.find(n.key));
+        }
+        else
+        {
+            HeapNode * top = heap.Pop();
+            NL_TEST_ASSERT(inSuite, top != nullptr && top->key == *keys.begin());
+            keys.erase(keys.begin());
+        }
+
+        NL_TEST_ASSERT(inSuite, heap.Empty() == keys.empty());
+        NL_TEST_ASSERT(inSuite, heap.Empty() || heap.Top()->key == *keys.begin());
+        NL_TEST_ASSERT(inSuite, CountNodes(heap) == keys.size());
+    }
+}
+
+} // namespace
+
+#define NL_TEST_DEF_FN(fn) NL_TEST_DEF("Test " #fn, fn)
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+static const nlTest sTests[] = {
+    NL_TEST_DEF_FN(TestIntrusivePairingHeapOrder),  //
+    NL_TEST_DEF_FN(TestIntrusivePairingHeapRandom), //
+    NL_TEST_SENTINEL(),                             //
+};
+
+int TestIntrusivePairingHeap()
+{
+    nlTestSuite theSuite = { "CHIP IntrusivePairingHeap tests", &sTests[0], nullptr, nullptr };
+
+    unsigned seed = static_cast<unsigned>(std::time(nullptr));
+    printf("Running " __FILE__ " using seed %d", seed);
+    std::srand(seed);
+
+    // Run test suite against one context.
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestIntrusivePairingHeap);
@@ -107,7 +107,42 @@ ExchangeContext * ExchangeManager::NewContext(const SessionHandle & session, Exc
         ChipLogError(ExchangeManager, "NewContext failed: session inactive");
         return nullptr;
     }
-    return mContextPool.CreateObject(this, mNextExchangeId++, session, isInitiator, delegate);
+    return AddToIndex(mContextPool.CreateObject(this, mNextExchangeId++, session, isInitiator, delegate));
+}
+
+void ExchangeManager::ReleaseContext(ExchangeContext * ec)
+{
+    ExchangeContext ** link = &mExchangeIndex[ExchangeIndexBucket(ec->GetExchangeId())];
+    while (*link != ec)
+    {
+        // An exchange that is not in its bucket means the index is corrupt.
+        VerifyOrDie(*link != nullptr);
+        link = &(*link)->mNextInBucket;
+    }
+    *link = ec->mNextInBucket;
+
+    mContextPool.ReleaseObject(ec);
+}
+
+ExchangeContext * ExchangeManager::AddToIndex(ExchangeContext * ec)
+{
+    VerifyOrReturnValue(ec != nullptr, nullptr);
+
+    ExchangeContext *& head = mExchangeIndex[ExchangeIndexBucket(ec->GetExchangeId())];
+    ec->mNextInBucket       = head;
+    head                    = ec;
+    return ec;
+}
+
+ExchangeContext * ExchangeManager::FindExchange(const SessionHandle & session, const PacketHeader & packetHeader,
+                                                const PayloadHeader & payloadHeader)
+{
+    ExchangeContext * ec = mExchangeIndex[ExchangeIndexBucket(payloadHeader.GetExchangeID())];
+    while (ec != nullptr && !ec->MatchExchange(session, packetHeader, payloadHeader))
+    {
+        ec = ec->mNextInBucket;
+    }
+    return ec;
 }
 
 CHIP_ERROR ExchangeManager::RegisterUnsolicitedMessageHandlerForProtocol(Protocols::Id protocolId,
@@ -230,23 +265,14 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
     if (!packetHeader.IsGroupSession())
     {
         // Search for an existing exchange that the message applies to. If a match is found...
-        bool found = false;
-        mContextPool.ForEachActiveObject([&](auto * ec) {
-            if (ec->MatchExchange(session, packetHeader, payloadHeader))
-            {
-                ChipLogDetail(ExchangeManager, "Found matching exchange: " ChipLogFormatExchange ", Delegate: %p",
-                              ChipLogValueExchange(ec), ec->GetDelegate());
-
-                // Matched ExchangeContext; send to message handler.
-                ec->HandleMessage(packetHeader.GetMessageCounter(), payloadHeader, msgFlags, std::move(msgBuf));
-                found = true;
-                return Loop::Break;
-            }
-            return Loop::Continue;
-        });
-
-        if (found)
+        ExchangeContext * ec = FindExchange(session, packetHeader, payloadHeader);
+        if (ec != nullptr)
         {
+            ChipLogDetail(ExchangeManager, "Found matching exchange: " ChipLogFormatExchange ", Delegate: %p",
+                          ChipLogValueExchange(ec), ec->GetDelegate());
+
+            // Matched ExchangeContext; send to message handler.
+            ec->HandleMessage(packetHeader.GetMessageCounter(), payloadHeader, msgFlags, std::move(msgBuf));
             return;
         }
     }
@@ -321,7 +347,7 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
             return;
         }
 
-        ExchangeContext * ec = mContextPool.CreateObject(this, payloadHeader.GetExchangeID(), session, false, delegate);
+        ExchangeContext * ec = AddToIndex(mContextPool.CreateObject(this, payloadHeader.GetExchangeID(), session, false, delegate));
 
         if (ec == nullptr)
         {
@@ -373,8 +399,9 @@ void ExchangeManager::SendStandaloneAckIfNeeded(const PacketHeader & packetHeade
     // If rcvd msg is from initiator then this exchange is created as not Initiator.
     // If rcvd msg is not from initiator then this exchange is created as Initiator.
     // Create a EphemeralExchange to generate a StandaloneAck
-    ExchangeContext * ec = mContextPool.CreateObject(this, payloadHeader.GetExchangeID(), session, !payloadHeader.IsInitiator(),
-                                                     nullptr, true /* IsEphemeralExchange */);
+    ExchangeContext * ec =
+        AddToIndex(mContextPool.CreateObject(this, payloadHeader.GetExchangeID(), session, !payloadHeader.IsInitiator(), nullptr,
+                                             true /* IsEphemeralExchange */));
 
     if (ec == nullptr)
     {
@@ -100,7 +100,7 @@ public:
      */
     ExchangeContext * NewContext(const SessionHandle & session, ExchangeDelegate * delegate, bool isInitiator = true);
 
-    void ReleaseContext(ExchangeContext * ec) { mContextPool.ReleaseObject(ec); }
+    void ReleaseContext(ExchangeContext * ec);
 
     /**
      *  Register an unsolicited message handler for a given protocol identifier. This handler would be
@@ -230,11 +230,23 @@ private:
 
     ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> mContextPool;
 
+    // Index of the exchanges in mContextPool by exchange id, chained through ExchangeContext::mNextInBucket. The session
+    // and initiator parts of the key of an exchange are matched while walking a bucket rather than hashed, since the
+    // session of an exchange can be released or shifted without the manager being told.
+    static constexpr size_t kExchangeIndexBucketCount = Transport::SessionIndexBucketCount(CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS);
+
+    ExchangeContext * mExchangeIndex[kExchangeIndexBucketCount] = {};
+
     SessionManager * mSessionManager;
     ReliableMessageMgr mReliableMessageMgr;
 
     UnsolicitedMessageHandlerSlot UMHandlerPool[CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS];
 
+    static size_t ExchangeIndexBucket(uint16_t exchangeId) { return exchangeId & (kExchangeIndexBucketCount - 1); }
+    ExchangeContext * AddToIndex(ExchangeContext * ec);
+    ExchangeContext * FindExchange(const SessionHandle & session, const PacketHeader & packetHeader,
+                                   const PayloadHeader & payloadHeader);
+
     CHIP_ERROR RegisterUMH(Protocols::Id protocolId, int16_t msgType, UnsolicitedMessageHandler * handler);
     CHIP_ERROR UnregisterUMH(Protocols::Id protocolId, int16_t msgType);
 
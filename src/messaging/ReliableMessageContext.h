@@ -47,6 +47,7 @@ class ChipMessageInfo;
 class ExchangeContext;
 enum class MessageFlagValues : uint32_t;
 class ReliableMessageMgr;
+struct RetransTableEntry;
 
 class ReliableMessageContext
 {
@@ -208,6 +209,7 @@ private:
     void SetPendingPeerAckMessageCounter(uint32_t aPeerAckMessageCounter);
 
     friend class ReliableMessageMgr;
+    friend struct RetransTableEntry;
     friend class ExchangeContext;
     friend class ExchangeMessageDispatch;
     friend class ::chip::app::TestCommandInteraction;
@@ -216,6 +218,7 @@ private:
 
     System::Clock::Timestamp mNextAckTime; // Next time for triggering Solo Ack
     uint32_t mPendingPeerAckMessageCounter;
+    RetransTableEntry * mRetransEntry = nullptr; // The message awaiting acknowledgment, while IsWaitingForAck()
 };
 
 inline bool ReliableMessageContext::AutoRequestAck() const
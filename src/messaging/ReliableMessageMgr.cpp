@@ -23,6 +23,7 @@
 
 #include <errno.h>
 #include <inttypes.h>
+#include <utility>
 
 #include <app/icd/server/ICDServerConfig.h>
 #include <lib/support/BitFlags.h>
@@ -36,6 +37,7 @@
 #include <messaging/ReliableMessageContext.h>
 #include <messaging/ReliableMessageMgr.h>
 #include <platform/ConnectivityManager.h>
+#include <tracing/metric_event.h>
 
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
 #include <app/icd/server/ICDConfigurationData.h> // nogncheck
@@ -51,14 +53,16 @@ namespace Messaging {
 Optional<System::Clock::Milliseconds64> ReliableMessageMgr::sAdditionalMRPBackoffTime;
 #endif // CHIP_DEVICE_CONFIG_ENABLE_DYNAMIC_MRP_CONFIG
 
-ReliableMessageMgr::RetransTableEntry::RetransTableEntry(ReliableMessageContext * rc) :
-    ec(*rc->GetExchangeContext()), nextRetransTime(0), sendCount(0)
+RetransTableEntry::RetransTableEntry(ReliableMessageContext * rc) :
+    ec(*rc->GetExchangeContext()), nextRetransTime(0), firstSendTime(0), sendCount(0)
 {
     ec->SetWaitingForAck(true);
+    ec->mRetransEntry = this;
 }
 
-ReliableMessageMgr::RetransTableEntry::~RetransTableEntry()
+RetransTableEntry::~RetransTableEntry()
 {
+    ec->mRetransEntry = nullptr;
     ec->SetWaitingForAck(false);
 }
 
@@ -78,6 +82,7 @@ void ReliableMessageMgr::Shutdown()
     StopTimer();
 
     // Clear the retransmit table
+    mRetransQueue.Clear();
     mRetransTable.ForEachActiveObject([&](auto * entry) {
         mRetransTable.ReleaseObject(entry);
         return Loop::Continue;
@@ -123,10 +128,11 @@ void ReliableMessageMgr::ExecuteActions()
         }
     });
 
-    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime > now)
-            return Loop::Continue;
+    // Retransmit / cancel anything in the retrans queue whose retrans timeout has expired
+    while (!mRetransQueue.Empty() && mRetransQueue.Top()->nextRetransTime <= now)
+    {
+        RetransTableEntry * entry = mRetransQueue.Top();
+        DequeueForRetrans(*entry);
 
         VerifyOrDie(!entry->retainedBuf.IsNull());
 
@@ -161,10 +167,12 @@ void ReliableMessageMgr::ExecuteActions()
                 session->DispatchSessionEvent(&SessionDelegate::OnSessionHang);
             }
 
+            MATTER_LOG_METRIC(Tracing::kMetricMRPGiveUp, sendCount);
+
             // Do not StartTimer, we will schedule the timer at the end of the timer handler.
             mRetransTable.ReleaseObject(entry);
 
-            return Loop::Continue;
+            continue;
         }
 
         entry->sendCount++;
@@ -172,12 +180,13 @@ void ReliableMessageMgr::ExecuteActions()
                         "Retransmitting MessageCounter:" ChipLogFormatMessageCounter " on exchange " ChipLogFormatExchange
                         " Send Cnt %d",
                         messageCounter, ChipLogValueExchange(&entry->ec.Get()), entry->sendCount);
+        MATTER_LOG_METRIC(Tracing::kMetricMRPRetransmit, entry->sendCount);
 
+        // Queue the entry again before sending, since a failed send clears it.
         CalculateNextRetransTime(*entry);
+        QueueForRetrans(*entry);
         SendFromRetransTable(entry);
-
-        return Loop::Continue;
-    });
+    }
 
     TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries after processing");
 }
@@ -278,30 +287,30 @@ System::Clock::Timestamp ReliableMessageMgr::GetBackoff(System::Clock::Timestamp
 
 void ReliableMessageMgr::StartRetransmision(RetransTableEntry * entry)
 {
+    MATTER_LOG_METRIC(Tracing::kMetricMRPSend);
+
+    entry->firstSendTime = System::SystemClock().GetMonotonicTimestamp();
     CalculateNextRetransTime(*entry);
+    QueueForRetrans(*entry);
     StartTimer();
 }
 
 bool ReliableMessageMgr::CheckAndRemRetransTable(ReliableMessageContext * rc, uint32_t ackMessageCounter)
 {
-    bool removed = false;
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->ec->GetReliableMessageContext() == rc && entry->retainedBuf.GetMessageCounter() == ackMessageCounter)
-        {
-            // Clear the entry from the retransmision table.
-            ClearRetransTable(*entry);
-
-            ChipLogDetail(ExchangeManager,
-                          "Rxd Ack; Removing MessageCounter:" ChipLogFormatMessageCounter
-                          " from Retrans Table on exchange " ChipLogFormatExchange,
-                          ackMessageCounter, ChipLogValueExchange(rc->GetExchangeContext()));
-            removed = true;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
+    RetransTableEntry * entry = rc->mRetransEntry;
+    VerifyOrReturnValue(entry != nullptr && entry->retainedBuf.GetMessageCounter() == ackMessageCounter, false);
+
+    MATTER_LOG_METRIC(Tracing::kMetricMRPAckLatency,
+                      static_cast<uint32_t>((System::SystemClock().GetMonotonicTimestamp() - entry->firstSendTime).count()));
+
+    // Clear the entry from the retransmision table.
+    ClearRetransTable(*entry);
 
-    return removed;
+    ChipLogDetail(ExchangeManager,
+                  "Rxd Ack; Removing MessageCounter:" ChipLogFormatMessageCounter
+                  " from Retrans Table on exchange " ChipLogFormatExchange,
+                  ackMessageCounter, ChipLogValueExchange(rc->GetExchangeContext()));
+    return true;
 }
 
 CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
@@ -360,18 +369,18 @@ CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
 
 void ReliableMessageMgr::ClearRetransTable(ReliableMessageContext * rc)
 {
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->ec->GetReliableMessageContext() == rc)
-        {
-            ClearRetransTable(*entry);
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
+    if (rc->mRetransEntry != nullptr)
+    {
+        ClearRetransTable(*rc->mRetransEntry);
+    }
 }
 
 void ReliableMessageMgr::ClearRetransTable(RetransTableEntry & entry)
 {
+    if (IsQueued(entry))
+    {
+        DequeueForRetrans(entry);
+    }
     mRetransTable.ReleaseObject(&entry);
     // Expire any virtual ticks that have expired so all wakeup sources reflect the current time
     StartTimer();
@@ -390,13 +399,10 @@ void ReliableMessageMgr::StartTimer()
     });
 
     // When do we need to next wake up for ReliableMessageProtocol retransmit?
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime < nextWakeTime)
-        {
-            nextWakeTime = entry->nextRetransTime;
-        }
-        return Loop::Continue;
-    });
+    if (!mRetransQueue.Empty() && mRetransQueue.Top()->nextRetransTime < nextWakeTime)
+    {
+        nextWakeTime = mRetransQueue.Top()->nextRetransTime;
+    }
 
     StopTimer();
 
@@ -482,6 +488,17 @@ void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
     entry.nextRetransTime            = System::SystemClock().GetMonotonicTimestamp() + backoff;
 }
 
+void ReliableMessageMgr::QueueForRetrans(RetransTableEntry & entry)
+{
+    VerifyOrDie(!IsQueued(entry));
+    mRetransQueue.Push(entry);
+}
+
+void ReliableMessageMgr::DequeueForRetrans(RetransTableEntry & entry)
+{
+    mRetransQueue.Remove(entry);
+}
+
 #if CHIP_CONFIG_TEST
 int ReliableMessageMgr::TestGetCountRetransTable()
 {
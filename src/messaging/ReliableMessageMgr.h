@@ -29,6 +29,7 @@
 #include <lib/core/CHIPError.h>
 #include <lib/core/Optional.h>
 #include <lib/support/BitFlags.h>
+#include <lib/support/IntrusivePairingHeap.h>
 #include <lib/support/Pool.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
@@ -43,30 +44,41 @@ namespace Messaging {
 enum class SendMessageFlags : uint16_t;
 class ReliableMessageContext;
 
+/**
+ *  @class RetransTableEntry
+ *
+ *  @brief
+ *    This class is part of the CHIP Reliable Messaging Protocol and is used
+ *    to keep track of CHIP messages that have been sent and are expecting an
+ *    acknowledgment back. If the acknowledgment is not received within a
+ *    specific timeout, the message would be retransmitted from this table.
+ *
+ *    An exchange has at most one message awaiting acknowledgment; the entry
+ *    registers itself with the exchange while it exists, so that an ack can be
+ *    matched to its entry without searching the table.
+ *
+ *    Once its first transmission has been scheduled, the entry is also queued
+ *    by its next retransmission time, so that ReliableMessageMgr only visits
+ *    the entries that are due.
+ *
+ */
+struct RetransTableEntry : public IntrusivePairingHeapNode<RetransTableEntry>
+{
+    RetransTableEntry(ReliableMessageContext * rc);
+    ~RetransTableEntry();
+
+    ExchangeHandle ec;                        /**< The context for the stored CHIP message. */
+    EncryptedPacketBufferHandle retainedBuf;  /**< The packet buffer holding the CHIP message. */
+    System::Clock::Timestamp nextRetransTime; /**< A counter representing the next retransmission time for the message. */
+    System::Clock::Timestamp firstSendTime;   /**< The time at which the message was first sent. */
+    uint8_t sendCount;                        /**< The number of times we have tried to send this entry,
+                                                   including both successfully and failure send. */
+};
+
 class ReliableMessageMgr
 {
 public:
-    /**
-     *  @class RetransTableEntry
-     *
-     *  @brief
-     *    This class is part of the CHIP Reliable Messaging Protocol and is used
-     *    to keep track of CHIP messages that have been sent and are expecting an
-     *    acknowledgment back. If the acknowledgment is not received within a
-     *    specific timeout, the message would be retransmitted from this table.
-     *
-     */
-    struct RetransTableEntry
-    {
-        RetransTableEntry(ReliableMessageContext * rc);
-        ~RetransTableEntry();
-
-        ExchangeHandle ec;                        /**< The context for the stored CHIP message. */
-        EncryptedPacketBufferHandle retainedBuf;  /**< The packet buffer holding the CHIP message. */
-        System::Clock::Timestamp nextRetransTime; /**< A counter representing the next retransmission time for the message. */
-        uint8_t sendCount;                        /**< The number of times we have tried to send this entry,
-                                                       including both successfully and failure send. */
-    };
+    using RetransTableEntry = Messaging::RetransTableEntry;
 
     ReliableMessageMgr(ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool);
     ~ReliableMessageMgr();
@@ -75,7 +87,7 @@ public:
     void Shutdown();
 
     /**
-     * Iterate through active exchange contexts and retrans table entries.  If an
+     * Iterate through active exchange contexts and the retrans table entries that are due.  If an
      * action needs to be triggered by ReliableMessageProtocol time facilities,
      * execute that action.
      */
@@ -125,8 +137,8 @@ public:
     void StartRetransmision(RetransTableEntry * entry);
 
     /**
-     *  Iterate through active exchange contexts and retrans table entries. Clear the entry matching
-     *  the specified ExchangeContext and the message ID from the retransmision table.
+     *  Clear the entry of the specified ExchangeContext from the retransmision table, if it holds the
+     *  message with the acknowledged message counter.
      *
      *  @param[in]    rc                 A pointer to the ExchangeContext object.
      *  @param[in]    ackMessageCounter  The acknowledged message counter of the received packet.
@@ -161,7 +173,7 @@ public:
     void ClearRetransTable(RetransTableEntry & rEntry);
 
     /**
-     * Iterate through active exchange contexts and retrans table entries.
+     * Iterate through active exchange contexts and the earliest retrans table entry.
      * Determine how many ReliableMessageProtocol ticks we need to sleep before we
      * need to physically wake the CPU to perform an action.  Set a timer to go off
      * when we next need to wake the system.
@@ -235,6 +247,18 @@ private:
      */
     void CalculateNextRetransTime(RetransTableEntry & entry);
 
+    struct EarlierRetransTime
+    {
+        bool operator()(const RetransTableEntry * a, const RetransTableEntry * b) const
+        {
+            return a->nextRetransTime < b->nextRetransTime;
+        }
+    };
+
+    bool IsQueued(const RetransTableEntry & entry) const { return mRetransQueue.Contains(entry); }
+    void QueueForRetrans(RetransTableEntry & entry);
+    void DequeueForRetrans(RetransTableEntry & entry);
+
     ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & mContextPool;
     chip::System::Layer * mSystemLayer;
 
@@ -253,6 +277,9 @@ private:
     // ReliableMessageProtocol Global tables for timer context
     ObjectPool<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransTable;
 
+    // Retransmission queue, ordered by next retransmission time.
+    IntrusivePairingHeap<RetransTableEntry, EarlierRetransTime> mRetransQueue;
+
     SessionUpdateDelegate * mSessionUpdateDelegate = nullptr;
 
 #if CHIP_DEVICE_CONFIG_ENABLE_DYNAMIC_MRP_CONFIG
@@ -90,6 +90,45 @@ public:
     bool IsOnResponseTimeoutCalled = false;
 };
 
+class EchoDelegate : public UnsolicitedMessageHandler, public ExchangeDelegate
+{
+public:
+    CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, ExchangeDelegate *& newDelegate) override
+    {
+        newDelegate = this;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && buffer) override
+    {
+        RequestCount++;
+        return ec->SendMessage(Protocols::BDX::Id, kMsgType_TEST2, std::move(buffer),
+                               SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck));
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+
+    int RequestCount = 0;
+};
+
+class ResponseDelegate : public ExchangeDelegate
+{
+public:
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && buffer) override
+    {
+        ReceivedOn = ec;
+        ResponseCount++;
+        return CHIP_NO_ERROR;
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+
+    ExchangeContext * ReceivedOn = nullptr;
+    int ResponseCount            = 0;
+};
+
 class ExpireSessionFromTimeoutDelegate : public WaitForTimeoutDelegate
 {
     void OnResponseTimeout(ExchangeContext * ec) override
@@ -261,6 +300,48 @@ void CheckExchangeMessages(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
 }
 
+void CheckExchangeRouting(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    constexpr size_t kExchangeCount = 4;
+
+    EchoDelegate echoDelegate;
+    CHIP_ERROR err =
+        ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1, &echoDelegate);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    ResponseDelegate responseDelegates[kExchangeCount];
+    ExchangeContext * exchanges[kExchangeCount];
+    for (size_t i = 0; i < kExchangeCount; i++)
+    {
+        exchanges[i] = ctx.NewExchangeToBob(&responseDelegates[i]);
+        NL_TEST_EXIT_ON_FAILED_ASSERT(inSuite, exchanges[i] != nullptr);
+    }
+
+    // The exchanges of the responder have the same exchange ids as those of the initiator, so each response has to be
+    // told apart from the request by the session and initiator flag of its exchange.
+    SendFlags sendFlags = SendFlags(SendMessageFlags::kExpectResponse).Set(SendMessageFlags::kNoAutoRequestAck);
+    for (auto * exchange : exchanges)
+    {
+        err = exchange->SendMessage(Protocols::BDX::Id, kMsgType_TEST1,
+                                    System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize), sendFlags);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(inSuite, echoDelegate.RequestCount == static_cast<int>(kExchangeCount));
+    for (size_t i = 0; i < kExchangeCount; i++)
+    {
+        NL_TEST_ASSERT(inSuite, responseDelegates[i].ResponseCount == 1);
+        NL_TEST_ASSERT(inSuite, responseDelegates[i].ReceivedOn == exchanges[i]);
+    }
+    NL_TEST_ASSERT(inSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+
+    err = ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+}
+
 // Test Suite
 
 /**
@@ -272,6 +353,7 @@ const nlTest sTests[] =
     NL_TEST_DEF("Test ExchangeMgr::NewContext",               CheckNewContextTest),
     NL_TEST_DEF("Test ExchangeMgr::CheckUmhRegistrationTest", CheckUmhRegistrationTest),
     NL_TEST_DEF("Test ExchangeMgr::CheckExchangeMessages",    CheckExchangeMessages),
+    NL_TEST_DEF("Test ExchangeMgr::CheckExchangeRouting",     CheckExchangeRouting),
     NL_TEST_DEF("Test OnConnectionExpired basics",            CheckSessionExpirationBasics),
     NL_TEST_DEF("Test OnConnectionExpired timeout handling",  CheckSessionExpirationTimeout),
     NL_TEST_DEF("Test session eviction in timeout handling",  CheckSessionExpirationDuringTimeout),
@@ -319,6 +319,7 @@ class TestReliableMessageProtocol
 public:
     static void CheckAddClearRetrans(nlTestSuite * inSuite, void * inContext);
     static void CheckResendApplicationMessage(nlTestSuite * inSuite, void * inContext);
+    static void CheckResendQueuedMessages(nlTestSuite * inSuite, void * inContext);
     static void CheckCloseExchangeAndResendApplicationMessage(nlTestSuite * inSuite, void * inContext);
     static void CheckFailedMessageRetainOnSend(nlTestSuite * inSuite, void * inContext);
     static void CheckResendApplicationMessageWithPeerExchange(nlTestSuite * inSuite, void * inContext);
@@ -357,8 +358,17 @@ void TestReliableMessageProtocol::CheckAddClearRetrans(nlTestSuite * inSuite, vo
 
     rm->AddToRetransTable(rc, &entry);
     NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 1);
+    NL_TEST_ASSERT(inSuite, rc->IsWaitingForAck());
     rm->ClearRetransTable(*entry);
     NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
+    NL_TEST_ASSERT(inSuite, !rc->IsWaitingForAck());
+
+    // Clearing by exchange finds the entry of the exchange.
+    rm->AddToRetransTable(rc, &entry);
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 1);
+    rm->ClearRetransTable(rc);
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
+    NL_TEST_ASSERT(inSuite, !rc->IsWaitingForAck());
 
     exchange->Close();
 }
@@ -506,6 +516,69 @@ void TestReliableMessageProtocol::CheckResendApplicationMessage(nlTestSuite * in
     exchange->Close();
 }
 
+/**
+ * Tests that messages of several exchanges are each retransmitted once when their first transmission is lost, and that
+ * clearing the retransmission of some of them, including the one due first, does not affect the others.
+ */
+void TestReliableMessageProtocol::CheckResendQueuedMessages(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    constexpr int kExchangeCount = 4;
+
+    MockAppDelegate mockSender(ctx);
+    ExchangeContext * exchanges[kExchangeCount];
+
+    ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    NL_TEST_ASSERT(inSuite, rm != nullptr);
+
+    ctx.GetSessionBobToAlice()->AsSecureSession()->SetRemoteSessionParameters(ReliableMessageProtocolConfig({
+        System::Clock::Timestamp(300), // CHIP_CONFIG_MRP_LOCAL_IDLE_RETRY_INTERVAL
+        System::Clock::Timestamp(300), // CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL
+    }));
+
+    // Drop the first transmission of every message.
+    auto & loopback               = ctx.GetLoopback();
+    loopback.mSentMessageCount    = 0;
+    loopback.mNumMessagesToDrop   = kExchangeCount;
+    loopback.mDroppedMessageCount = 0;
+
+    for (auto & exchange : exchanges)
+    {
+        exchange = ctx.NewExchangeToAlice(&mockSender);
+        NL_TEST_ASSERT(inSuite, exchange != nullptr);
+
+        chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+
+        CHIP_ERROR err = exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer), SendMessageFlags::kExpectResponse);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(inSuite, loopback.mDroppedMessageCount == kExchangeCount);
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == kExchangeCount);
+
+    // Clear the retransmission of some of the messages, wherever they are in the queue.
+    rm->ClearRetransTable(exchanges[0]->GetReliableMessageContext());
+    rm->ClearRetransTable(exchanges[2]->GetReliableMessageContext());
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == kExchangeCount - 2);
+
+    // Wait for the remaining messages to be retransmitted and acknowledged (should take 330-413ms).
+    ctx.GetIOContext().DriveIOUntil(1000_ms32 + retryBoosterTimeout, [&] { return rm->TestGetCountRetransTable() == 0; });
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
+    // Only the two messages still in the table were retransmitted, and each retransmission was acknowledged.
+    NL_TEST_ASSERT(inSuite, loopback.mSentMessageCount == kExchangeCount + 2 + 2);
+    NL_TEST_ASSERT(inSuite, loopback.mDroppedMessageCount == kExchangeCount);
+
+    for (auto * exchange : exchanges)
+    {
+        exchange->Close();
+    }
+}
+
 void TestReliableMessageProtocol::CheckCloseExchangeAndResendApplicationMessage(nlTestSuite * inSuite, void * inContext)
 {
     TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
@@ -2164,6 +2237,7 @@ const nlTest sTests[] = {
     NL_TEST_DEF("Test ReliableMessageMgr::CheckAddClearRetrans", TestReliableMessageProtocol::CheckAddClearRetrans),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckResendApplicationMessage",
                 TestReliableMessageProtocol::CheckResendApplicationMessage),
+    NL_TEST_DEF("Test ReliableMessageMgr::CheckResendQueuedMessages", TestReliableMessageProtocol::CheckResendQueuedMessages),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckCloseExchangeAndResendApplicationMessage",
                 TestReliableMessageProtocol::CheckCloseExchangeAndResendApplicationMessage),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckFailedMessageRetainOnSend",
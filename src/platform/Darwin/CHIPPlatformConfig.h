@@ -65,6 +65,10 @@ extern "C" int __cxa_atexit(void (*f)(void *), void * p, void * d);
 #define CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS 1
 #endif // CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
 
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_COMPILED_CHECK
+#define CHIP_CONFIG_ACCESS_CONTROL_COMPILED_CHECK 1
+#endif // CHIP_CONFIG_ACCESS_CONTROL_COMPILED_CHECK
+
 #ifndef CHIP_CONFIG_KVS_PATH
 #define CHIP_CONFIG_KVS_PATH "/tmp/chip_kvs"
 #endif // CHIP_CONFIG_KVS_PATH
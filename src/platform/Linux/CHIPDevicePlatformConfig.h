@@ -54,6 +54,38 @@
 // These are configuration options that are unique to Linux platforms.
 // These can be overridden by the application as needed.
 
+/**
+ * CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL
+ *
+ * Back the KeyValueStoreManager with an append-only journal (ChipLinuxStorageJournal)
+ * instead of rewriting the whole INI file on every Put/Delete. Selected with the
+ * `chip_linux_kvs_journal` GN argument.
+ */
+#ifndef CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL
+#define CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL 0
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL
+
+/**
+ * CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL_COMPACTION_THRESHOLD
+ *
+ * Minimum number of bytes of superseded records in the KVS journal before it is
+ * compacted. Compaction additionally waits until at least half of the journal is stale.
+ */
+#ifndef CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL_COMPACTION_THRESHOLD
+#define CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL_COMPACTION_THRESHOLD (64 * 1024)
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL_COMPACTION_THRESHOLD
+
+/**
+ * CHIP_DEVICE_CONFIG_LINUX_KVS_WRITE_BACK_DELAY_MS
+ *
+ * Coalescing window, in milliseconds, for KVS keys of the kDeferred durability class:
+ * their changes are held in memory and committed together once it expires. 0 disables
+ * the write-back cache, making every key write-through.
+ */
+#ifndef CHIP_DEVICE_CONFIG_LINUX_KVS_WRITE_BACK_DELAY_MS
+#define CHIP_DEVICE_CONFIG_LINUX_KVS_WRITE_BACK_DELAY_MS 1000
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_WRITE_BACK_DELAY_MS
+
 // ========== Platform-specific Configuration Overrides =========
 
 #ifndef CHIP_DEVICE_CONFIG_CHIP_TASK_STACK_SIZE
@@ -68,6 +100,18 @@
 #define CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS 1
 #endif // CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS
 
+#ifndef CHIP_DEVICE_CONFIG_EVENT_LOGGING_INDEX_BYTES_PER_EVENT
+#define CHIP_DEVICE_CONFIG_EVENT_LOGGING_INDEX_BYTES_PER_EVENT 24
+#endif // CHIP_DEVICE_CONFIG_EVENT_LOGGING_INDEX_BYTES_PER_EVENT
+
+#ifndef CHIP_DEVICE_CONFIG_ENDPOINT_TYPE_INDEX_CLUSTER_CAPACITY
+#define CHIP_DEVICE_CONFIG_ENDPOINT_TYPE_INDEX_CLUSTER_CAPACITY 512
+#endif // CHIP_DEVICE_CONFIG_ENDPOINT_TYPE_INDEX_CLUSTER_CAPACITY
+
+#ifndef CHIP_DEVICE_CONFIG_ENDPOINT_TYPE_INDEX_ATTRIBUTE_CAPACITY
+#define CHIP_DEVICE_CONFIG_ENDPOINT_TYPE_INDEX_ATTRIBUTE_CAPACITY 2048
+#endif // CHIP_DEVICE_CONFIG_ENDPOINT_TYPE_INDEX_ATTRIBUTE_CAPACITY
+
 #define CHIP_DEVICE_CONFIG_ENABLE_WIFI_TELEMETRY 0
 #define CHIP_DEVICE_CONFIG_ENABLE_THREAD_TELEMETRY 0
 #define CHIP_DEVICE_CONFIG_ENABLE_THREAD_TELEMETRY_FULL 0
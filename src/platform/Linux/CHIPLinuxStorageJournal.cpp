@@ -0,0 +1,671 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *         Implements an append-only, journaled key-value store for the Linux
+ *         platform.
+ *
+ *         Journal layout:
+ *
+ *           magic "CHIPKVJ" | version (1)
+ *           record*
+ *
+ *         Record layout (little endian):
+ *
+ *           crc32 (4) | type (1) | key length (2) | value length (4) | key | value
+ *
+ *         The CRC covers everything after the CRC field, so a record that was
+ *         only partially written before a crash is detected and dropped.
+ *
+ *         A batch record carries a sequence of Put/Delete records as its value,
+ *         which makes all of them durable (or lost) together.
+ *
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <libgen.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/BufferReader.h>
+#include <lib/support/BufferWriter.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/Linux/CHIPLinuxStorageIni.h>
+#include <platform/Linux/CHIPLinuxStorageJournal.h>
+#include <platform/internal/CHIPDeviceLayerInternal.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+namespace {
+
+constexpr uint8_t kJournalMagic[]     = { 'C', 'H', 'I', 'P', 'K', 'V', 'J' };
+constexpr uint8_t kJournalVersion     = 1;
+constexpr size_t kJournalHeaderSize   = sizeof(kJournalMagic) + sizeof(kJournalVersion);
+constexpr size_t kMaxJournalValueSize = UINT32_MAX;
+
+uint32_t Crc32(const uint8_t * data, size_t len, uint32_t crc = 0)
+{
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++)
+    {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+CHIP_ERROR WriteAll(int fd, const uint8_t * data, size_t len)
+{
+    while (len > 0)
+    {
+        ssize_t written = write(fd, data, len);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            ChipLogError(DeviceLayer, "KVS journal write failed: %s (%d)", strerror(errno), errno);
+            return CHIP_ERROR_WRITE_FAILED;
+        }
+        data += written;
+        len -= static_cast<size_t>(written);
+    }
+    return CHIP_NO_ERROR;
+}
+
+// A rename() is only durable once the directory that holds the file has been synced.
+void SyncParentDirectory(const std::string & path)
+{
+    std::string dirPath = path;
+    int dirFd           = open(dirname(&dirPath[0]), O_RDONLY | O_DIRECTORY);
+    if (dirFd >= 0)
+    {
+        fsync(dirFd);
+        close(dirFd);
+    }
+}
+
+} // namespace
+
+ChipLinuxStorageJournal::~ChipLinuxStorageJournal()
+{
+    Shutdown();
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::Init(const char * journalFile, const char * legacyIniFile)
+{
+    VerifyOrReturnError(journalFile != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+
+    ChipLogDetail(DeviceLayer, "ChipLinuxStorageJournal::Init: Using KVS journal file: %s", journalFile);
+    if (mInitialized)
+    {
+        ChipLogError(DeviceLayer, "ChipLinuxStorageJournal::Init: Attempt to re-initialize with KVS journal file: %s", journalFile);
+        return CHIP_NO_ERROR;
+    }
+
+    mJournalPath.assign(journalFile);
+    mEntries.clear();
+    mJournalSize = 0;
+    mLiveSize    = kJournalHeaderSize;
+
+    if (access(journalFile, F_OK) != 0)
+    {
+        if (legacyIniFile != nullptr && access(legacyIniFile, F_OK) == 0)
+        {
+            ReturnErrorOnFailure(ImportLegacyIni(legacyIniFile));
+        }
+
+        // Either an empty store or the freshly imported entries: write them out as the initial snapshot.
+        ReturnErrorOnFailure(CompactLocked());
+
+        if (legacyIniFile != nullptr && access(legacyIniFile, F_OK) == 0)
+        {
+            std::string migratedPath = std::string(legacyIniFile) + ".migrated";
+            if (rename(legacyIniFile, migratedPath.c_str()) == 0)
+            {
+                ChipLogProgress(DeviceLayer, "Migrated KVS from %s, kept a copy at %s", legacyIniFile, migratedPath.c_str());
+            }
+            else
+            {
+                ChipLogError(DeviceLayer, "failed to rename (%s), %s (%d)", legacyIniFile, strerror(errno), errno);
+            }
+        }
+
+        mInitialized = true;
+        return CHIP_NO_ERROR;
+    }
+
+    size_t validLength = 0;
+    ReturnErrorOnFailure(Replay(validLength));
+
+    if (validLength < kJournalHeaderSize)
+    {
+        // Crashed while the journal was first being created: start over from an empty snapshot.
+        ReturnErrorOnFailure(CompactLocked());
+        mInitialized = true;
+        return CHIP_NO_ERROR;
+    }
+
+    ReturnErrorOnFailure(OpenForAppend());
+
+    if (validLength < mJournalSize)
+    {
+        // Discard the torn tail so that subsequent records are appended right after the last good one.
+        ChipLogError(DeviceLayer, "KVS journal %s: dropping %u trailing bytes of incomplete or corrupt data", journalFile,
+                     static_cast<unsigned>(mJournalSize - validLength));
+        if (ftruncate(mFd, static_cast<off_t>(validLength)) != 0 || fsync(mFd) != 0)
+        {
+            ChipLogError(DeviceLayer, "failed to truncate (%s), %s (%d)", journalFile, strerror(errno), errno);
+            CloseFile();
+            return CHIP_ERROR_WRITE_FAILED;
+        }
+        mJournalSize = validLength;
+    }
+
+    mInitialized = true;
+    return CHIP_NO_ERROR;
+}
+
+void ChipLinuxStorageJournal::Shutdown()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    if (mFd >= 0 && mSyncPending)
+    {
+        fdatasync(mFd);
+        mSyncPending = false;
+    }
+    CloseFile();
+    mInitialized = false;
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::Replay(size_t & validLength)
+{
+    int fd = open(mJournalPath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to open KVS journal: %s", mJournalPath.c_str());
+        return CHIP_ERROR_OPEN_FAILED;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+        return CHIP_ERROR_OPEN_FAILED;
+    }
+
+    size_t fileSize = static_cast<size_t>(st.st_size);
+    Platform::ScopedMemoryBuffer<uint8_t> contents;
+    if (fileSize > 0 && !contents.Alloc(fileSize))
+    {
+        close(fd);
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    size_t readSoFar = 0;
+    while (readSoFar < fileSize)
+    {
+        ssize_t n = read(fd, contents.Get() + readSoFar, fileSize - readSoFar);
+        if (n < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (n <= 0)
+        {
+            break;
+        }
+        readSoFar += static_cast<size_t>(n);
+    }
+    close(fd);
+
+    mJournalSize = readSoFar;
+    validLength  = 0;
+
+    if (readSoFar < kJournalHeaderSize || memcmp(contents.Get(), kJournalMagic, sizeof(kJournalMagic)) != 0 ||
+        contents[sizeof(kJournalMagic)] != kJournalVersion)
+    {
+        // A crash while creating the journal can only leave a short header behind; anything else is not ours.
+        VerifyOrReturnError(readSoFar < kJournalHeaderSize, CHIP_ERROR_INCORRECT_STATE);
+        return CHIP_NO_ERROR;
+    }
+
+    validLength = kJournalHeaderSize + ApplyRecords(contents.Get() + kJournalHeaderSize, readSoFar - kJournalHeaderSize);
+    return CHIP_NO_ERROR;
+}
+
+size_t ChipLinuxStorageJournal::ApplyRecords(const uint8_t * data, size_t len)
+{
+    size_t offset = 0;
+    while (offset < len)
+    {
+        Encoding::LittleEndian::Reader reader(data + offset, len - offset);
+        uint32_t crc      = 0;
+        uint8_t type      = 0;
+        uint16_t keyLen   = 0;
+        uint32_t valueLen = 0;
+
+        if (!reader.Read32(&crc).Read8(&type).Read16(&keyLen).Read32(&valueLen).IsSuccess() ||
+            !reader.HasAtLeast(static_cast<size_t>(keyLen) + valueLen))
+        {
+            break;
+        }
+
+        size_t recordSize      = RecordSize(keyLen, valueLen);
+        const uint8_t * record = data + offset;
+        if (Crc32(record + sizeof(crc), recordSize - sizeof(crc)) != crc)
+        {
+            break;
+        }
+
+        std::string key(reinterpret_cast<const char *>(record + kRecordHeaderSize), keyLen);
+        const uint8_t * value = record + kRecordHeaderSize + keyLen;
+
+        if (type == kRecordTypeBatch)
+        {
+            // The batch is covered by a single CRC, so it is either applied as a whole or not at all.
+            if (ApplyRecords(value, valueLen) != valueLen)
+            {
+                break;
+            }
+            offset += recordSize;
+            continue;
+        }
+
+        auto it = mEntries.find(key);
+        if (it != mEntries.end())
+        {
+            mLiveSize -= RecordSize(it->first.size(), it->second.size());
+        }
+
+        if (type == kRecordTypePut)
+        {
+            mEntries[key].assign(value, value + valueLen);
+            mLiveSize += recordSize;
+        }
+        else if (type == kRecordTypeDelete)
+        {
+            if (it != mEntries.end())
+            {
+                mEntries.erase(it);
+            }
+        }
+        else
+        {
+            break;
+        }
+
+        offset += recordSize;
+    }
+
+    return offset;
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::ImportLegacyIni(const std::string & iniFile)
+{
+    ChipLinuxStorageIni legacy;
+    std::vector<std::string> keys;
+
+    ReturnErrorOnFailure(legacy.Init());
+    ReturnErrorOnFailure(legacy.AddConfig(iniFile));
+    ReturnErrorOnFailure(legacy.GetKeys(keys));
+
+    for (const std::string & key : keys)
+    {
+        size_t valueLen = 0;
+        CHIP_ERROR err  = legacy.GetBinaryBlobValue(key.c_str(), nullptr, 0, valueLen);
+        if (err != CHIP_NO_ERROR && err != CHIP_ERROR_BUFFER_TOO_SMALL)
+        {
+            ChipLogError(DeviceLayer, "Skipping KVS key %s during migration: %" CHIP_ERROR_FORMAT, key.c_str(), err.Format());
+            continue;
+        }
+
+        std::vector<uint8_t> value(valueLen);
+        err = legacy.GetBinaryBlobValue(key.c_str(), value.data(), value.size(), valueLen);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DeviceLayer, "Skipping KVS key %s during migration: %" CHIP_ERROR_FORMAT, key.c_str(), err.Format());
+            continue;
+        }
+        value.resize(valueLen);
+
+        mLiveSize += RecordSize(key.size(), value.size());
+        mEntries[key] = std::move(value);
+    }
+
+    ChipLogProgress(DeviceLayer, "Imported %u KVS entries from %s", static_cast<unsigned>(mEntries.size()), iniFile.c_str());
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::ReadValueBin(const char * key, uint8_t * buf, size_t bufSize, size_t & outLen)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    auto it = mEntries.find(key);
+    VerifyOrReturnError(it != mEntries.end(), CHIP_ERROR_KEY_NOT_FOUND);
+
+    outLen = it->second.size();
+    VerifyOrReturnError(outLen <= bufSize, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    if (outLen > 0)
+    {
+        memcpy(buf, it->second.data(), outLen);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::WriteValueBin(const char * key, const uint8_t * data, size_t dataLen)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(data != nullptr || dataLen == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+
+    std::string keyStr(key);
+    ReturnErrorOnFailure(AppendRecord(kRecordTypePut, keyStr, data, dataLen));
+
+    auto it = mEntries.find(keyStr);
+    if (it != mEntries.end())
+    {
+        mLiveSize -= RecordSize(it->first.size(), it->second.size());
+    }
+    mEntries[keyStr].assign(data, data + dataLen);
+    mLiveSize += RecordSize(keyStr.size(), dataLen);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::ClearValue(const char * key)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+
+    auto it = mEntries.find(key);
+    VerifyOrReturnError(it != mEntries.end(), CHIP_ERROR_KEY_NOT_FOUND);
+
+    ReturnErrorOnFailure(AppendRecord(kRecordTypeDelete, it->first, nullptr, 0));
+
+    mLiveSize -= RecordSize(it->first.size(), it->second.size());
+    mEntries.erase(it);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::ClearAll()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!mInBatch, CHIP_ERROR_INCORRECT_STATE);
+
+    mEntries.clear();
+    mLiveSize = kJournalHeaderSize;
+
+    return CompactLocked();
+}
+
+bool ChipLinuxStorageJournal::HasValue(const char * key)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    return mEntries.find(key) != mEntries.end();
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::Commit()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+
+    // Records of an open batch only reach the file through CommitBatch().
+    VerifyOrReturnError(!mInBatch, CHIP_NO_ERROR);
+
+    size_t staleSize = mJournalSize - mLiveSize;
+    if (staleSize >= CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL_COMPACTION_THRESHOLD && staleSize >= mLiveSize)
+    {
+        // The snapshot is synced before it replaces the journal, which covers any pending records too.
+        return CompactLocked();
+    }
+
+    if (mSyncPending)
+    {
+        if (fdatasync(mFd) != 0)
+        {
+            ChipLogError(DeviceLayer, "KVS journal sync failed: %s (%d)", strerror(errno), errno);
+            return CHIP_ERROR_WRITE_FAILED;
+        }
+        mSyncPending = false;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::BeginBatch()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!mInBatch, CHIP_ERROR_INCORRECT_STATE);
+
+    mInBatch = true;
+    mBatchBuffer.clear();
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::CommitBatch()
+{
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        VerifyOrReturnError(mInBatch, CHIP_ERROR_INCORRECT_STATE);
+
+        if (!mBatchBuffer.empty())
+        {
+            // Leave batch mode so the envelope itself goes to the file. On failure the batch stays
+            // open so that the caller can still roll back and abort it.
+            mInBatch       = false;
+            CHIP_ERROR err = AppendRecord(kRecordTypeBatch, std::string(), mBatchBuffer.data(), mBatchBuffer.size());
+            if (err != CHIP_NO_ERROR)
+            {
+                mInBatch = true;
+                return err;
+            }
+        }
+
+        mInBatch = false;
+        mBatchBuffer.clear();
+    }
+
+    return Commit();
+}
+
+void ChipLinuxStorageJournal::AbortBatch()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    mInBatch = false;
+    mBatchBuffer.clear();
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::Compact()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!mInBatch, CHIP_ERROR_INCORRECT_STATE);
+
+    return CompactLocked();
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::AppendRecord(uint8_t type, const std::string & key, const uint8_t * data, size_t dataLen)
+{
+    VerifyOrReturnError(mFd >= 0 || mInBatch, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(CanCastTo<uint16_t>(key.size()), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(dataLen <= kMaxJournalValueSize, CHIP_ERROR_INVALID_ARGUMENT);
+
+    size_t recordSize = RecordSize(key.size(), dataLen);
+    Platform::ScopedMemoryBuffer<uint8_t> record;
+    VerifyOrReturnError(record.Alloc(recordSize), CHIP_ERROR_NO_MEMORY);
+
+    Encoding::LittleEndian::BufferWriter writer(record.Get(), recordSize);
+    writer.Put32(0).Put8(type).Put16(static_cast<uint16_t>(key.size())).Put32(static_cast<uint32_t>(dataLen));
+    writer.Put(key.data(), key.size());
+    if (dataLen > 0)
+    {
+        writer.Put(data, dataLen);
+    }
+    VerifyOrReturnError(writer.Fit(), CHIP_ERROR_INTERNAL);
+
+    uint32_t crc = Crc32(record.Get() + sizeof(crc), recordSize - sizeof(crc));
+    Encoding::LittleEndian::Put32(record.Get(), crc);
+
+    if (mInBatch)
+    {
+        mBatchBuffer.insert(mBatchBuffer.end(), record.Get(), record.Get() + recordSize);
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR err = WriteAll(mFd, record.Get(), recordSize);
+    if (err != CHIP_NO_ERROR)
+    {
+        // Do not leave a partial record behind for the next append to be written after.
+        if (ftruncate(mFd, static_cast<off_t>(mJournalSize)) != 0)
+        {
+            ChipLogError(DeviceLayer, "failed to truncate (%s), %s (%d)", mJournalPath.c_str(), strerror(errno), errno);
+        }
+        return err;
+    }
+
+    mJournalSize += recordSize;
+    mSyncPending = true;
+
+    return CHIP_NO_ERROR;
+}
+
+// Same atomic update scheme as ChipLinuxStorageIni::CommitConfig: write a snapshot to a
+// temporary file, sync it, then rename() it over the journal.
+CHIP_ERROR ChipLinuxStorageJournal::CompactLocked()
+{
+    std::string tmpPath = mJournalPath + "-XXXXXX";
+
+    int fd = mkstemp(&tmpPath[0]);
+    if (fd == -1)
+    {
+        ChipLogError(DeviceLayer, "failed to open file (%s) for writing", tmpPath.c_str());
+        return CHIP_ERROR_OPEN_FAILED;
+    }
+
+    size_t snapshotSize = kJournalHeaderSize;
+    CHIP_ERROR err      = WriteAll(fd, kJournalMagic, sizeof(kJournalMagic));
+    SuccessOrExit(err);
+    err = WriteAll(fd, &kJournalVersion, sizeof(kJournalVersion));
+    SuccessOrExit(err);
+
+    {
+        // Reuse AppendRecord by temporarily redirecting it to the snapshot file.
+        int journalFd       = mFd;
+        size_t journalSize  = mJournalSize;
+        bool journalPending = mSyncPending;
+
+        VerifyOrDie(!mInBatch);
+        mFd          = fd;
+        mJournalSize = snapshotSize;
+        for (const auto & entry : mEntries)
+        {
+            err = AppendRecord(kRecordTypePut, entry.first, entry.second.data(), entry.second.size());
+            if (err != CHIP_NO_ERROR)
+            {
+                break;
+            }
+        }
+        snapshotSize = mJournalSize;
+
+        mFd          = journalFd;
+        mJournalSize = journalSize;
+        mSyncPending = journalPending;
+    }
+    SuccessOrExit(err);
+
+    VerifyOrExit(fsync(fd) == 0, err = CHIP_ERROR_WRITE_FAILED);
+    close(fd);
+    fd = -1;
+
+    if (rename(tmpPath.c_str(), mJournalPath.c_str()) != 0)
+    {
+        ChipLogError(DeviceLayer, "failed to rename (%s), %s (%d)", tmpPath.c_str(), strerror(errno), errno);
+        ExitNow(err = CHIP_ERROR_WRITE_FAILED);
+    }
+    SyncParentDirectory(mJournalPath);
+
+    ChipLogProgress(DeviceLayer, "Compacted KVS journal %s from %u to %u bytes", mJournalPath.c_str(),
+                    static_cast<unsigned>(mJournalSize), static_cast<unsigned>(snapshotSize));
+
+    CloseFile();
+    mJournalSize = snapshotSize;
+    mLiveSize    = snapshotSize;
+    mSyncPending = false;
+    return OpenForAppend();
+
+exit:
+    if (fd != -1)
+    {
+        close(fd);
+    }
+    unlink(tmpPath.c_str());
+    return err;
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::OpenForAppend()
+{
+    mFd = open(mJournalPath.c_str(), O_WRONLY | O_APPEND | O_CLOEXEC);
+    if (mFd < 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to open KVS journal for writing: %s, %s (%d)", mJournalPath.c_str(), strerror(errno),
+                     errno);
+        return CHIP_ERROR_OPEN_FAILED;
+    }
+    return CHIP_NO_ERROR;
+}
+
+void ChipLinuxStorageJournal::CloseFile()
+{
+    if (mFd >= 0)
+    {
+        close(mFd);
+        mFd = -1;
+    }
+}
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
@@ -0,0 +1,152 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *         This file defines an append-only, journaled key-value store for the
+ *         Linux platform.
+ *
+ *         Every Put/Delete appends a single self-checking record to the end of
+ *         the journal file, so the cost of a write depends on the size of the
+ *         record and not on the size of the store. The journal is replayed into
+ *         memory on Init; a torn or corrupt tail left behind by a crash is
+ *         discarded. Once enough stale records have accumulated the journal is
+ *         compacted into a fresh snapshot using the same temp-file + rename
+ *         scheme as ChipLinuxStorageIni::CommitConfig.
+ *
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+class ChipLinuxStorageJournal
+{
+public:
+    ChipLinuxStorageJournal() = default;
+    ~ChipLinuxStorageJournal();
+
+    ChipLinuxStorageJournal(const ChipLinuxStorageJournal &)             = delete;
+    ChipLinuxStorageJournal & operator=(const ChipLinuxStorageJournal &) = delete;
+
+    /**
+     * @brief
+     *   Open (or create) the journal at @p journalFile and replay it into memory.
+     *
+     *   If the journal does not exist yet and @p legacyIniFile names an existing
+     *   INI store written by ChipLinuxStorage, its contents are imported into a
+     *   fresh journal and the INI file is renamed with a ".migrated" suffix.
+     */
+    CHIP_ERROR Init(const char * journalFile, const char * legacyIniFile = nullptr);
+
+    /**
+     * @brief Close the journal file, syncing any pending records first.
+     */
+    void Shutdown();
+
+    CHIP_ERROR ReadValueBin(const char * key, uint8_t * buf, size_t bufSize, size_t & outLen);
+    CHIP_ERROR WriteValueBin(const char * key, const uint8_t * data, size_t dataLen);
+    CHIP_ERROR ClearValue(const char * key);
+    CHIP_ERROR ClearAll();
+    bool HasValue(const char * key);
+
+    /**
+     * @brief
+     *   Make all records appended so far durable. Compacts the journal when the
+     *   amount of stale data exceeds the configured threshold.
+     */
+    CHIP_ERROR Commit();
+
+    /**
+     * @brief
+     *   Start buffering records in memory instead of appending them one by one. Reads
+     *   observe the buffered writes immediately.
+     */
+    CHIP_ERROR BeginBatch();
+
+    /**
+     * @brief
+     *   Append all buffered records as a single batch record and make it durable. On
+     *   failure the batch stays open and must be closed with AbortBatch().
+     */
+    CHIP_ERROR CommitBatch();
+
+    /**
+     * @brief
+     *   Drop the buffered records without writing them. The in-memory entries are not
+     *   reverted; the caller is expected to have restored them while the batch was open.
+     */
+    void AbortBatch();
+
+    /**
+     * @brief Rewrite the journal so it only contains the live entries.
+     */
+    CHIP_ERROR Compact();
+
+    /**
+     * @brief Size in bytes of the journal file, including stale records.
+     */
+    size_t GetJournalSize() const { return mJournalSize; }
+
+    /**
+     * @brief Size in bytes the journal would have right after compaction.
+     */
+    size_t GetLiveSize() const { return mLiveSize; }
+
+private:
+    static constexpr uint8_t kRecordTypePut    = 1;
+    static constexpr uint8_t kRecordTypeDelete = 2;
+    static constexpr uint8_t kRecordTypeBatch  = 3;
+
+    // crc32 (4) + type (1) + key length (2) + value length (4)
+    static constexpr size_t kRecordHeaderSize = 11;
+
+    static size_t RecordSize(size_t keyLen, size_t valueLen) { return kRecordHeaderSize + keyLen + valueLen; }
+
+    CHIP_ERROR Replay(size_t & validLength);
+    size_t ApplyRecords(const uint8_t * data, size_t len);
+    CHIP_ERROR ImportLegacyIni(const std::string & iniFile);
+    CHIP_ERROR AppendRecord(uint8_t type, const std::string & key, const uint8_t * data, size_t dataLen);
+    CHIP_ERROR CompactLocked();
+    CHIP_ERROR OpenForAppend();
+    void CloseFile();
+
+    std::mutex mLock;
+    std::map<std::string, std::vector<uint8_t>> mEntries;
+    std::string mJournalPath;
+    int mFd             = -1;
+    size_t mJournalSize = 0;
+    size_t mLiveSize    = 0;
+    bool mSyncPending   = false;
+    bool mInBatch       = false;
+    bool mInitialized   = false;
+    std::vector<uint8_t> mBatchBuffer;
+};
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
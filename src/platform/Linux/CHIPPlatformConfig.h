@@ -64,6 +64,10 @@ using CHIP_CONFIG_PERSISTED_STORAGE_KEY_TYPE = const char *;
 #define CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS 1
 #endif // CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
 
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_COMPILED_CHECK
+#define CHIP_CONFIG_ACCESS_CONTROL_COMPILED_CHECK 1
+#endif // CHIP_CONFIG_ACCESS_CONTROL_COMPILED_CHECK
+
 // ==================== Security Configuration Overrides ====================
 
 #ifndef CHIP_CONFIG_KVS_PATH
@@ -25,17 +25,159 @@
 
 #include <algorithm>
 #include <string.h>
+#include <string>
 
 #include <lib/support/CodeUtils.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
 #include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceLayer.h>
 #include <platform/Linux/CHIPLinuxStorage.h>
 
 namespace chip {
 namespace DeviceLayer {
 namespace PersistedStorage {
 
+namespace {
+
+CHIP_ERROR CopyValue(const uint8_t * data, size_t size, void * value, size_t value_size, size_t * read_bytes_size,
+                     size_t offset_bytes)
+{
+    VerifyOrReturnError(offset_bytes <= size, CHIP_ERROR_INVALID_ARGUMENT);
+
+    size_t total_size_to_read = size - offset_bytes;
+    size_t copy_size          = std::min(value_size, total_size_to_read);
+    if (read_bytes_size != nullptr)
+    {
+        *read_bytes_size = copy_size;
+    }
+    if (copy_size > 0)
+    {
+        ::memcpy(value, data + offset_bytes, copy_size);
+    }
+
+    return (value_size < total_size_to_read) ? CHIP_ERROR_BUFFER_TOO_SMALL : CHIP_NO_ERROR;
+}
+
+} // namespace
+
 KeyValueStoreManagerImpl KeyValueStoreManagerImpl::sInstance;
 
+KeyValueStoreManagerImpl::KeyValueStoreManagerImpl()
+{
+    // Last Known Good Time is refreshed often and only ever used as a lower bound on the current
+    // time, so losing its latest update to a crash is harmless.
+    mDurabilityClasses.emplace_back(DefaultStorageKeyAllocator::LastKnownGoodTimeKey().KeyName(), DurabilityClass::kDeferred);
+
+    // Persisted counters reserve their next epoch on disk, which has to be durable before any value
+    // of the new epoch goes out.
+    mDurabilityClasses.emplace_back(DefaultStorageKeyAllocator::GroupDataCounter().KeyName(), DurabilityClass::kCritical);
+    mDurabilityClasses.emplace_back(DefaultStorageKeyAllocator::GroupControlCounter().KeyName(), DurabilityClass::kCritical);
+    mDurabilityClasses.emplace_back(DefaultStorageKeyAllocator::ICDCheckInCounter().KeyName(), DurabilityClass::kCritical);
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::Init(const char * file)
+{
+    std::unique_lock<std::mutex> lock = LockOutsideForeignTransaction();
+
+    // Do not drop changes still held for a previously opened store.
+    if (!mPendingWrites.empty())
+    {
+        ReturnErrorOnFailure(FlushLocked());
+    }
+
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL
+    VerifyOrReturnError(file != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    std::string journalFile = std::string(file) + ".journal";
+    return mStorage.Init(journalFile.c_str(), file);
+#else
+    return mStorage.Init(file);
+#endif
+}
+
+void KeyValueStoreManagerImpl::Shutdown()
+{
+    std::unique_lock<std::mutex> lock = LockOutsideForeignTransaction();
+
+    if (mFlushScheduled)
+    {
+        SystemLayer().CancelTimer(OnFlushTimer, this);
+        mFlushScheduled = false;
+    }
+
+    CHIP_ERROR err = FlushLocked();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to flush KVS write-back cache on shutdown: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::SetDurabilityClass(const char * keyPrefix, DurabilityClass durability)
+{
+    VerifyOrReturnError(keyPrefix != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+    for (auto & entry : mDurabilityClasses)
+    {
+        if (entry.first == keyPrefix)
+        {
+            entry.second = durability;
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    mDurabilityClasses.emplace_back(keyPrefix, durability);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::Flush()
+{
+    std::unique_lock<std::mutex> lock = LockOutsideForeignTransaction();
+    return FlushLocked();
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::FlushLocked()
+{
+    VerifyOrReturnError(mTransactionDepth == 0, CHIP_ERROR_INCORRECT_STATE);
+
+    CHIP_ERROR err = ApplyPendingWrites();
+    if (mCommitPending)
+    {
+        CHIP_ERROR commitErr = CommitStorage();
+        err                  = (err != CHIP_NO_ERROR) ? err : commitErr;
+    }
+
+    return err;
+}
+
+std::unique_lock<std::mutex> KeyValueStoreManagerImpl::LockOutsideForeignTransaction()
+{
+    std::unique_lock<std::mutex> lock(mLock);
+    mTransactionEnded.wait(lock, [this] { return mTransactionDepth == 0 || mTransactionOwner == std::this_thread::get_id(); });
+    return lock;
+}
+
+KeyValueStoreManagerImpl::DurabilityClass KeyValueStoreManagerImpl::GetDurabilityClass(const char * key) const
+{
+    DurabilityClass durability = DurabilityClass::kImmediate;
+    size_t matchLength         = 0;
+
+    for (const auto & entry : mDurabilityClasses)
+    {
+        if (entry.first.size() >= matchLength && strncmp(key, entry.first.c_str(), entry.first.size()) == 0)
+        {
+            durability  = entry.second;
+            matchLength = entry.first.size();
+        }
+    }
+
+    if (durability == DurabilityClass::kDeferred && CHIP_DEVICE_CONFIG_LINUX_KVS_WRITE_BACK_DELAY_MS == 0)
+    {
+        durability = DurabilityClass::kImmediate;
+    }
+
+    return durability;
+}
+
 CHIP_ERROR KeyValueStoreManagerImpl::_Get(const char * key, void * value, size_t value_size, size_t * read_bytes_size,
                                           size_t offset_bytes)
 {
@@ -44,6 +186,18 @@ CHIP_ERROR KeyValueStoreManagerImpl::_Get(const char * key, void * value, size_t
     // Copy data into value buffer
     VerifyOrReturnError(value != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
+    std::unique_lock<std::mutex> lock = LockOutsideForeignTransaction();
+
+    auto pending = mPendingWrites.find(key);
+    if (pending != mPendingWrites.end())
+    {
+        mCacheStats.hits++;
+        VerifyOrReturnError(!pending->second.deleted, CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+        return CopyValue(pending->second.value.data(), pending->second.value.size(), value, value_size, read_bytes_size,
+                         offset_bytes);
+    }
+    mCacheStats.misses++;
+
     // On linux read first without a buffer which returns the size, and then
     // use a local buffer to read the entire object, which allows partial and
     // offset reads.
@@ -65,26 +219,41 @@ CHIP_ERROR KeyValueStoreManagerImpl::_Get(const char * key, void * value, size_t
     VerifyOrReturnError(buf.Alloc(read_size), CHIP_ERROR_NO_MEMORY);
     ReturnErrorOnFailure(mStorage.ReadValueBin(key, buf.Get(), read_size, read_size));
 
-    size_t total_size_to_read = read_size - offset_bytes;
-    size_t copy_size          = std::min(value_size, total_size_to_read);
-    if (read_bytes_size != nullptr)
-    {
-        *read_bytes_size = copy_size;
-    }
-    ::memcpy(value, buf.Get() + offset_bytes, copy_size);
-
-    return (value_size < total_size_to_read) ? CHIP_ERROR_BUFFER_TOO_SMALL : CHIP_NO_ERROR;
+    return CopyValue(buf.Get(), read_size, value, value_size, read_bytes_size, offset_bytes);
 }
 
 CHIP_ERROR KeyValueStoreManagerImpl::_Put(const char * key, const void * value, size_t value_size)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::unique_lock<std::mutex> lock = LockOutsideForeignTransaction();
+
+    if (mTransactionDepth > 0)
+    {
+        ReturnErrorOnFailure(RecordUndo(key));
+    }
+    else
+    {
+        DurabilityClass durability = GetDurabilityClass(key);
+        if (durability == DurabilityClass::kDeferred)
+        {
+            return PutDeferred(key, value, value_size);
+        }
+        // Writing through a key with a cached change, or a critical key, takes the cached changes along.
+        if (durability == DurabilityClass::kCritical || mPendingWrites.find(key) != mPendingWrites.end())
+        {
+            ReturnErrorOnFailure(ApplyPendingWrites());
+        }
+    }
+
     err = mStorage.WriteValueBin(key, reinterpret_cast<const uint8_t *>(value), value_size);
     SuccessOrExit(err);
 
-    // Commit the value to the persistent store.
-    err = mStorage.Commit();
+    // Commit the value to the persistent store, unless a transaction will do so later.
+    VerifyOrExit(mTransactionDepth == 0, err = CHIP_NO_ERROR);
+    err = CommitStorage();
     SuccessOrExit(err);
 
 exit:
@@ -94,7 +263,29 @@ exit:
 CHIP_ERROR KeyValueStoreManagerImpl::_Delete(const char * key)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
-    err            = mStorage.ClearValue(key);
+
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::unique_lock<std::mutex> lock = LockOutsideForeignTransaction();
+
+    if (mTransactionDepth > 0)
+    {
+        ReturnErrorOnFailure(RecordUndo(key));
+    }
+    else
+    {
+        DurabilityClass durability = GetDurabilityClass(key);
+        if (durability == DurabilityClass::kDeferred)
+        {
+            return DeleteDeferred(key);
+        }
+        if (durability == DurabilityClass::kCritical || mPendingWrites.find(key) != mPendingWrites.end())
+        {
+            ReturnErrorOnFailure(ApplyPendingWrites());
+        }
+    }
+
+    err = mStorage.ClearValue(key);
 
     if (err == CHIP_ERROR_KEY_NOT_FOUND)
     {
@@ -102,14 +293,253 @@ CHIP_ERROR KeyValueStoreManagerImpl::_Delete(const char * key)
     }
     SuccessOrExit(err);
 
-    // Commit the value to the persistent store.
-    err = mStorage.Commit();
+    // Commit the value to the persistent store, unless a transaction will do so later.
+    VerifyOrExit(mTransactionDepth == 0, err = CHIP_NO_ERROR);
+    err = CommitStorage();
     SuccessOrExit(err);
 
 exit:
     return err;
 }
 
+CHIP_ERROR KeyValueStoreManagerImpl::_BeginTransaction()
+{
+    assertChipStackLockedByCurrentThread();
+
+    std::unique_lock<std::mutex> lock = LockOutsideForeignTransaction();
+
+    if (mTransactionDepth == 0)
+    {
+        // Writes inside the transaction bypass the write-back cache, so it must not hold older values for them.
+        ReturnErrorOnFailure(ApplyPendingWrites());
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL
+        ReturnErrorOnFailure(mStorage.BeginBatch());
+#endif
+        mTransactionOwner = std::this_thread::get_id();
+    }
+
+    mTransactionDepth++;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::_CommitTransaction()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mTransactionDepth > 0 && mTransactionOwner == std::this_thread::get_id(), CHIP_ERROR_INCORRECT_STATE);
+
+    if (--mTransactionDepth > 0)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    if (mTransactionAborted)
+    {
+        RollbackTransaction();
+        EndTransaction();
+        return CHIP_ERROR_TRANSACTION_CANCELED;
+    }
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL
+    // All pending records are appended as one batch record, so they become durable together.
+    err = mStorage.CommitBatch();
+    if (err == CHIP_NO_ERROR)
+    {
+        mCacheStats.flushes++;
+        mCommitPending = false;
+    }
+#else
+    // The INI backend rewrites the whole file atomically, so a single commit covers every pending change.
+    if (!mUndoLog.empty() || mCommitPending)
+    {
+        err = CommitStorage();
+    }
+#endif
+
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "KVS transaction commit failed: %" CHIP_ERROR_FORMAT, err.Format());
+        RollbackTransaction();
+        err = CHIP_ERROR_PERSISTED_STORAGE_FAILED;
+    }
+
+    EndTransaction();
+    return err;
+}
+
+void KeyValueStoreManagerImpl::_AbortTransaction()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturn(mTransactionDepth > 0 && mTransactionOwner == std::this_thread::get_id());
+
+    // Aborting a nested transaction dooms the enclosing ones; the rollback happens once the outermost one ends.
+    mTransactionAborted = true;
+    if (--mTransactionDepth == 0)
+    {
+        RollbackTransaction();
+        EndTransaction();
+    }
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::RecordUndo(const char * key)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::string keyStr(key);
+    if (mUndoLog.find(keyStr) != mUndoLog.end())
+    {
+        // Only the value from before the transaction matters.
+        return CHIP_NO_ERROR;
+    }
+
+    UndoEntry entry;
+    size_t size    = 0;
+    CHIP_ERROR err = mStorage.ReadValueBin(key, nullptr, 0, size);
+    if (err == CHIP_ERROR_BUFFER_TOO_SMALL || (err == CHIP_NO_ERROR && size > 0))
+    {
+        entry.value.resize(size);
+        err = mStorage.ReadValueBin(key, entry.value.data(), entry.value.size(), size);
+    }
+
+    if (err == CHIP_NO_ERROR)
+    {
+        entry.existed = true;
+    }
+    else if (err != CHIP_ERROR_KEY_NOT_FOUND)
+    {
+        return err;
+    }
+
+    mUndoLog.emplace(std::move(keyStr), std::move(entry));
+    return CHIP_NO_ERROR;
+}
+
+void KeyValueStoreManagerImpl::RollbackTransaction()
+{
+    // Restore the in-memory state. Nothing of the transaction reached the disk yet, so there is nothing
+    // to commit: the journal drops its batch and the INI file was simply never rewritten.
+    for (const auto & undo : mUndoLog)
+    {
+        CHIP_ERROR err = undo.second.existed
+            ? mStorage.WriteValueBin(undo.first.c_str(), undo.second.value.data(), undo.second.value.size())
+            : mStorage.ClearValue(undo.first.c_str());
+        if (err != CHIP_NO_ERROR && err != CHIP_ERROR_KEY_NOT_FOUND)
+        {
+            ChipLogError(DeviceLayer, "KVS rollback of key %s failed: %" CHIP_ERROR_FORMAT, undo.first.c_str(), err.Format());
+        }
+    }
+
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL
+    mStorage.AbortBatch();
+#endif
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::PutDeferred(const char * key, const void * value, size_t value_size)
+{
+    // The flush timer is armed from here.
+    assertChipStackLockedByCurrentThread();
+    VerifyOrReturnError(value != nullptr || value_size == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const uint8_t * bytes  = reinterpret_cast<const uint8_t *>(value);
+    PendingWrite & pending = mPendingWrites[key];
+    pending.deleted        = false;
+    pending.value.assign(bytes, bytes + value_size);
+    mCacheStats.deferredWrites++;
+
+    return ScheduleFlush();
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::DeleteDeferred(const char * key)
+{
+    assertChipStackLockedByCurrentThread();
+
+    auto it     = mPendingWrites.find(key);
+    bool exists = (it != mPendingWrites.end()) ? !it->second.deleted : mStorage.HasValue(key);
+    VerifyOrReturnError(exists, CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    PendingWrite & pending = mPendingWrites[key];
+    pending.deleted        = true;
+    pending.value.clear();
+    mCacheStats.deferredWrites++;
+
+    return ScheduleFlush();
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::ApplyPendingWrites()
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    for (const auto & pending : mPendingWrites)
+    {
+        const char * key    = pending.first.c_str();
+        CHIP_ERROR writeErr = pending.second.deleted
+            ? mStorage.ClearValue(key)
+            : mStorage.WriteValueBin(key, pending.second.value.data(), pending.second.value.size());
+
+        // The key may have been put and deleted again before ever reaching the store.
+        if (writeErr == CHIP_NO_ERROR || (pending.second.deleted && writeErr == CHIP_ERROR_KEY_NOT_FOUND))
+        {
+            mCommitPending = true;
+            continue;
+        }
+
+        ChipLogError(DeviceLayer, "Failed to write back KVS key %s: %" CHIP_ERROR_FORMAT, key, writeErr.Format());
+        err = (err != CHIP_NO_ERROR) ? err : writeErr;
+    }
+    mPendingWrites.clear();
+
+    return err;
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::CommitStorage()
+{
+    mCacheStats.flushes++;
+
+    ReturnErrorOnFailure(mStorage.Commit());
+    mCommitPending = false;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::ScheduleFlush()
+{
+    VerifyOrReturnError(!mFlushScheduled, CHIP_NO_ERROR);
+
+    if (SystemLayer().IsInitialized() &&
+        SystemLayer().StartTimer(System::Clock::Milliseconds32(CHIP_DEVICE_CONFIG_LINUX_KVS_WRITE_BACK_DELAY_MS), OnFlushTimer,
+                                 this) == CHIP_NO_ERROR)
+    {
+        mFlushScheduled = true;
+        return CHIP_NO_ERROR;
+    }
+
+    // Nothing would flush the cache later without a running event loop, so write through.
+    return FlushLocked();
+}
+
+void KeyValueStoreManagerImpl::OnFlushTimer(System::Layer * systemLayer, void * appState)
+{
+    auto * self = static_cast<KeyValueStoreManagerImpl *>(appState);
+
+    // Do not block the event loop on a transaction of another thread: try again later instead.
+    std::unique_lock<std::mutex> lock(self->mLock);
+    self->mFlushScheduled = false;
+    CHIP_ERROR err        = (self->mTransactionDepth > 0) ? self->ScheduleFlush() : self->FlushLocked();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to flush KVS write-back cache: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+void KeyValueStoreManagerImpl::EndTransaction()
+{
+    mUndoLog.clear();
+    mTransactionDepth   = 0;
+    mTransactionAborted = false;
+    mTransactionOwner   = std::thread::id();
+    mTransactionEnded.notify_all();
+}
+
 } // namespace PersistedStorage
 } // namespace DeviceLayer
 } // namespace chip
@@ -24,6 +24,15 @@
 #pragma once
 
 #include <platform/Linux/CHIPLinuxStorage.h>
+#include <platform/Linux/CHIPLinuxStorageJournal.h>
+#include <system/SystemLayer.h>
+
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace chip {
 namespace DeviceLayer {
@@ -32,18 +41,127 @@ namespace PersistedStorage {
 class KeyValueStoreManagerImpl : public KeyValueStoreManager
 {
 public:
+    /**
+     * How soon a Put/Delete of a key has to reach the disk.
+     */
+    enum class DurabilityClass : uint8_t
+    {
+        kImmediate, ///< Committed by the Put/Delete itself (default).
+        kDeferred,  ///< Kept in the write-back cache and committed once the coalescing window expires.
+        kCritical,  ///< Committed by the Put/Delete itself, along with everything held in the write-back cache.
+    };
+
+    struct CacheStats
+    {
+        uint32_t hits;           ///< Reads served from the write-back cache.
+        uint32_t misses;         ///< Reads served by the backing store.
+        uint32_t deferredWrites; ///< Put/Delete calls absorbed by the write-back cache.
+        uint32_t flushes;        ///< Commits of the backing store.
+    };
+
+    KeyValueStoreManagerImpl();
+
     /**
      * @brief
      * Initalize the KVS, must be called before using.
+     *
+     * When CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL is enabled the data lives in `<file>.journal`,
+     * and an existing INI store at `file` is migrated into it on first use.
+     */
+    CHIP_ERROR Init(const char * file);
+
+    /**
+     * @brief
+     * Commit any changes held in the write-back cache. Called on platform shutdown.
+     */
+    void Shutdown();
+
+    /**
+     * @brief
+     * Set the durability class of all keys starting with @p keyPrefix. The longest
+     * matching prefix wins; keys without a match are kImmediate.
+     *
+     * Changes to kDeferred keys are committed together at most
+     * CHIP_DEVICE_CONFIG_LINUX_KVS_WRITE_BACK_DELAY_MS after the first one. Since the
+     * flush runs on the CHIP event loop, kDeferred keys must be written with the CHIP
+     * stack lock held.
+     */
+    CHIP_ERROR SetDurabilityClass(const char * keyPrefix, DurabilityClass durability);
+
+    /**
+     * @brief
+     * Commit all changes held in the write-back cache now.
      */
-    CHIP_ERROR Init(const char * file) { return mStorage.Init(file); }
+    CHIP_ERROR Flush();
+
+    const CacheStats & GetCacheStats() const { return mCacheStats; }
+    void ResetCacheStats() { mCacheStats = {}; }
 
     CHIP_ERROR _Get(const char * key, void * value, size_t value_size, size_t * read_bytes_size = nullptr, size_t offset = 0);
     CHIP_ERROR _Delete(const char * key);
     CHIP_ERROR _Put(const char * key, const void * value, size_t value_size);
 
+    /**
+     * @brief
+     * Transactions defer the commit of the backing store until the outermost
+     * _CommitTransaction(), so a batch of writes costs a single sync. They must be
+     * used with the CHIP stack lock held, and belong to the thread that began them:
+     * other threads accessing the KVS wait until the transaction ends, so that their
+     * changes are neither part of it nor rolled back with it.
+     */
+    CHIP_ERROR _BeginTransaction();
+    CHIP_ERROR _CommitTransaction();
+    void _AbortTransaction();
+
 private:
+    // Change held in the write-back cache; deleted marks a pending Delete.
+    struct PendingWrite
+    {
+        bool deleted = false;
+        std::vector<uint8_t> value;
+    };
+
+    std::unique_lock<std::mutex> LockOutsideForeignTransaction();
+    DurabilityClass GetDurabilityClass(const char * key) const;
+    CHIP_ERROR PutDeferred(const char * key, const void * value, size_t value_size);
+    CHIP_ERROR DeleteDeferred(const char * key);
+    CHIP_ERROR ApplyPendingWrites();
+    CHIP_ERROR FlushLocked();
+    CHIP_ERROR CommitStorage();
+    CHIP_ERROR ScheduleFlush();
+    static void OnFlushTimer(System::Layer * systemLayer, void * appState);
+
+    // Guards the write-back cache and the transaction state, as the KVS may be used off the CHIP stack thread.
+    std::mutex mLock;
+
+    std::map<std::string, PendingWrite> mPendingWrites;
+    std::vector<std::pair<std::string, DurabilityClass>> mDurabilityClasses;
+    CacheStats mCacheStats = {};
+    bool mFlushScheduled   = false;
+    bool mCommitPending    = false;
+
+    // Value of a key before it was first touched by the open transaction.
+    struct UndoEntry
+    {
+        bool existed = false;
+        std::vector<uint8_t> value;
+    };
+
+    CHIP_ERROR RecordUndo(const char * key);
+    void RollbackTransaction();
+    void EndTransaction();
+
+    std::map<std::string, UndoEntry> mUndoLog;
+    uint32_t mTransactionDepth = 0;
+    bool mTransactionAborted   = false;
+    std::thread::id mTransactionOwner;
+    std::condition_variable mTransactionEnded;
+
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL
+    DeviceLayer::Internal::ChipLinuxStorageJournal mStorage;
+#else
     DeviceLayer::Internal::ChipLinuxStorage mStorage;
+#endif
 
     // ===== Members for internal use by the following friends.
     friend KeyValueStoreManager & KeyValueStoreMgr();
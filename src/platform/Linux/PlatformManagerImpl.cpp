@@ -40,6 +40,7 @@
 #include <lib/support/logging/CHIPLogging.h>
 #include <platform/DeviceControlServer.h>
 #include <platform/DeviceInstanceInfoProvider.h>
+#include <platform/KeyValueStoreManager.h>
 #include <platform/Linux/DeviceInstanceInfoProviderImpl.h>
 #include <platform/Linux/DiagnosticDataProviderImpl.h>
 #include <platform/PlatformManager.h>
@@ -272,6 +273,9 @@ void PlatformManagerImpl::_Shutdown()
         ChipLogError(DeviceLayer, "Failed to get current uptime since the Node’s last reboot");
     }
 
+    // Commit whatever the KVS write-back cache still holds while the system layer is up.
+    PersistedStorage::KeyValueStoreMgrImpl().Shutdown();
+
     Internal::GenericPlatformManagerImpl_POSIX<PlatformManagerImpl>::_Shutdown();
 
 #if CHIP_DEVICE_CONFIG_WITH_GLIB_MAIN_LOOP
@@ -0,0 +1,219 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the write-back cache
+ *      of the Linux KeyValueStoreManager.
+ *
+ */
+
+#include <nlunit-test.h>
+
+#include <atomic>
+#include <thread>
+#include <unistd.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <platform/CHIPDeviceLayer.h>
+#include <platform/KeyValueStoreManager.h>
+
+using namespace chip;
+using namespace chip::DeviceLayer;
+using namespace chip::DeviceLayer::PersistedStorage;
+
+namespace {
+
+using DurabilityClass = KeyValueStoreManagerImpl::DurabilityClass;
+
+constexpr char kStorePath[] = "/tmp/chip_test_kvs_write_back";
+
+void RemoveTestFiles()
+{
+    unlink(kStorePath);
+    unlink("/tmp/chip_test_kvs_write_back.journal");
+}
+
+void TestKeyValueStoreMgr_WriteBack(nlTestSuite * inSuite, void * inContext)
+{
+    KeyValueStoreManagerImpl & kvs = KeyValueStoreMgrImpl();
+    NL_TEST_ASSERT(inSuite, kvs.SetDurabilityClass("wb/", DurabilityClass::kDeferred) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, kvs.SetDurabilityClass("wb/critical", DurabilityClass::kCritical) == CHIP_NO_ERROR);
+    kvs.ResetCacheStats();
+
+    uint32_t value     = 1;
+    uint32_t readValue = 0;
+
+    // Deferred writes stay in the cache and are read back from it.
+    NL_TEST_ASSERT(inSuite, kvs.Put("wb/a", value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, kvs.Put("wb/b", value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, kvs.Get("wb/a", &readValue) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, readValue == value);
+    NL_TEST_ASSERT(inSuite, kvs.Delete("wb/b") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, kvs.Get("wb/b", &readValue) == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite, kvs.Delete("wb/b") == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite, kvs.GetCacheStats().deferredWrites == 3);
+    NL_TEST_ASSERT(inSuite, kvs.GetCacheStats().hits == 2);
+    NL_TEST_ASSERT(inSuite, kvs.GetCacheStats().flushes == 0);
+
+    // A critical write commits everything held in the cache with a single flush.
+    NL_TEST_ASSERT(inSuite, kvs.Put("wb/critical", value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, kvs.GetCacheStats().flushes == 1);
+    NL_TEST_ASSERT(inSuite, kvs.Get("wb/a", &readValue) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, readValue == value);
+    NL_TEST_ASSERT(inSuite, kvs.GetCacheStats().misses == 1);
+
+    // Forced flush.
+    value = 2;
+    NL_TEST_ASSERT(inSuite, kvs.Put("wb/a", value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, kvs.Flush() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, kvs.GetCacheStats().flushes == 2);
+    NL_TEST_ASSERT(inSuite, kvs.Flush() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, kvs.GetCacheStats().flushes == 2);
+
+    // Deferred writes survive a shutdown: a store opened afresh on the same file reads them back.
+    value = 3;
+    NL_TEST_ASSERT(inSuite, kvs.Put("wb/a", value) == CHIP_NO_ERROR);
+    kvs.Shutdown();
+    {
+        KeyValueStoreManagerImpl reloadedKvs;
+        NL_TEST_ASSERT(inSuite, reloadedKvs.Init(kStorePath) == CHIP_NO_ERROR);
+        readValue = 0;
+        NL_TEST_ASSERT(inSuite, reloadedKvs.Get("wb/a", &readValue) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, readValue == value);
+        NL_TEST_ASSERT(inSuite, reloadedKvs.Get("wb/critical", &readValue) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, reloadedKvs.GetCacheStats().hits == 0);
+        reloadedKvs.Shutdown();
+    }
+
+    NL_TEST_ASSERT(inSuite, kvs.Delete("wb/a") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, kvs.Delete("wb/critical") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, kvs.Flush() == CHIP_NO_ERROR);
+}
+
+void TestKeyValueStoreMgr_WriteBackTransaction(nlTestSuite * inSuite, void * inContext)
+{
+    KeyValueStoreManagerImpl & kvs = KeyValueStoreMgrImpl();
+    NL_TEST_ASSERT(inSuite, kvs.SetDurabilityClass("wb/", DurabilityClass::kDeferred) == CHIP_NO_ERROR);
+
+    uint32_t value     = 1;
+    uint32_t readValue = 0;
+
+    NL_TEST_ASSERT(inSuite, kvs.Put("wb/a", value) == CHIP_NO_ERROR);
+
+    // An aborted transaction does not drop changes that were cached before it started.
+    NL_TEST_ASSERT(inSuite, kvs.BeginTransaction() == CHIP_NO_ERROR);
+    value = 2;
+    NL_TEST_ASSERT(inSuite, kvs.Put("wb/a", value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, kvs.Flush() == CHIP_ERROR_INCORRECT_STATE);
+    kvs.AbortTransaction();
+
+    NL_TEST_ASSERT(inSuite, kvs.Get("wb/a", &readValue) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, readValue == 1);
+
+    NL_TEST_ASSERT(inSuite, kvs.Delete("wb/a") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, kvs.Flush() == CHIP_NO_ERROR);
+}
+
+void TestKeyValueStoreMgr_WriteDuringForeignTransaction(nlTestSuite * inSuite, void * inContext)
+{
+    KeyValueStoreManagerImpl & kvs = KeyValueStoreMgrImpl();
+    NL_TEST_ASSERT(inSuite, kvs.SetDurabilityClass("wb/", DurabilityClass::kDeferred) == CHIP_NO_ERROR);
+
+    uint32_t value     = 1;
+    uint32_t readValue = 0;
+
+    NL_TEST_ASSERT(inSuite, kvs.BeginTransaction() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, kvs.Put("tx/a", value) == CHIP_NO_ERROR);
+
+    // A deferred write of another thread waits for the open transaction to end instead of joining it.
+    // This thread does not touch the stack until it has joined the writer, which stands in for the stack lock.
+    std::atomic<bool> written{ false };
+    CHIP_ERROR foreignErr = CHIP_ERROR_INTERNAL;
+    std::thread writer([&] {
+        uint32_t foreignValue = 2;
+        foreignErr            = kvs.Put("wb/a", foreignValue);
+        written               = true;
+    });
+
+    usleep(50 * 1000);
+    NL_TEST_ASSERT(inSuite, !written);
+    kvs.AbortTransaction();
+    writer.join();
+    NL_TEST_ASSERT(inSuite, foreignErr == CHIP_NO_ERROR);
+
+    // The abort only rolled back the transaction's own change.
+    NL_TEST_ASSERT(inSuite, kvs.Get("tx/a", &readValue) == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite, kvs.Get("wb/a", &readValue) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, readValue == 2);
+
+    // Only the thread that began a transaction can end it.
+    NL_TEST_ASSERT(inSuite, kvs.BeginTransaction() == CHIP_NO_ERROR);
+    CHIP_ERROR foreignCommitErr = CHIP_NO_ERROR;
+    std::thread committer([&] { foreignCommitErr = kvs.CommitTransaction(); });
+    committer.join();
+    NL_TEST_ASSERT(inSuite, foreignCommitErr == CHIP_ERROR_INCORRECT_STATE);
+    NL_TEST_ASSERT(inSuite, kvs.CommitTransaction() == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, kvs.Delete("wb/a") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, kvs.Flush() == CHIP_NO_ERROR);
+}
+
+const nlTest sTests[] = { NL_TEST_DEF("Test KeyValueStoreMgr_WriteBack", TestKeyValueStoreMgr_WriteBack),
+                          NL_TEST_DEF("Test KeyValueStoreMgr_WriteBackTransaction", TestKeyValueStoreMgr_WriteBackTransaction),
+                          NL_TEST_DEF("Test KeyValueStoreMgr_WriteDuringForeignTransaction",
+                                      TestKeyValueStoreMgr_WriteDuringForeignTransaction),
+                          NL_TEST_SENTINEL() };
+
+int TestLinuxKeyValueStoreMgr_Setup(void * inContext)
+{
+    VerifyOrReturnError(chip::Platform::MemoryInit() == CHIP_NO_ERROR, FAILURE);
+
+    // Deferred writes are only cached while there is an event loop to flush them later.
+    VerifyOrReturnError(SystemLayer().Init() == CHIP_NO_ERROR, FAILURE);
+
+    RemoveTestFiles();
+    VerifyOrReturnError(KeyValueStoreMgrImpl().Init(kStorePath) == CHIP_NO_ERROR, FAILURE);
+
+    return SUCCESS;
+}
+
+int TestLinuxKeyValueStoreMgr_Teardown(void * inContext)
+{
+    KeyValueStoreMgrImpl().Shutdown();
+    RemoveTestFiles();
+
+    SystemLayer().Shutdown();
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+} // namespace
+
+int TestLinuxKeyValueStoreMgr()
+{
+    nlTestSuite theSuite = { "LinuxKeyValueStoreMgr tests", &sTests[0], TestLinuxKeyValueStoreMgr_Setup,
+                             TestLinuxKeyValueStoreMgr_Teardown };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestLinuxKeyValueStoreMgr);
@@ -0,0 +1,289 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the journaled Linux
+ *      key-value store backend.
+ *
+ */
+
+#include <nlunit-test.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <platform/CHIPDeviceConfig.h>
+#include <platform/Linux/CHIPLinuxStorage.h>
+#include <platform/Linux/CHIPLinuxStorageJournal.h>
+
+using namespace chip;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+constexpr char kJournalPath[]  = "/tmp/chip_test_kvs.journal";
+constexpr char kLegacyPath[]   = "/tmp/chip_test_kvs";
+constexpr char kMigratedPath[] = "/tmp/chip_test_kvs.migrated";
+
+void RemoveTestFiles()
+{
+    unlink(kJournalPath);
+    unlink(kLegacyPath);
+    unlink(kMigratedPath);
+}
+
+void TestJournal_PutGetDelete(nlTestSuite * inSuite, void * inContext)
+{
+    RemoveTestFiles();
+
+    ChipLinuxStorageJournal journal;
+    NL_TEST_ASSERT(inSuite, journal.Init(kJournalPath) == CHIP_NO_ERROR);
+
+    const uint8_t value[] = { 1, 2, 3, 4 };
+    uint8_t readValue[sizeof(value)];
+    size_t readSize = 0;
+
+    NL_TEST_ASSERT(inSuite, journal.WriteValueBin("key", value, sizeof(value)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, journal.Commit() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, journal.ReadValueBin("key", readValue, sizeof(readValue), readSize) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, readSize == sizeof(value));
+    NL_TEST_ASSERT(inSuite, memcmp(readValue, value, sizeof(value)) == 0);
+
+    NL_TEST_ASSERT(inSuite, journal.ReadValueBin("key", readValue, 1, readSize) == CHIP_ERROR_BUFFER_TOO_SMALL);
+    NL_TEST_ASSERT(inSuite, readSize == sizeof(value));
+
+    NL_TEST_ASSERT(inSuite, journal.ClearValue("key") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, journal.ClearValue("key") == CHIP_ERROR_KEY_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite, journal.ReadValueBin("key", readValue, sizeof(readValue), readSize) == CHIP_ERROR_KEY_NOT_FOUND);
+
+    RemoveTestFiles();
+}
+
+void TestJournal_Replay(nlTestSuite * inSuite, void * inContext)
+{
+    RemoveTestFiles();
+
+    {
+        ChipLinuxStorageJournal journal;
+        NL_TEST_ASSERT(inSuite, journal.Init(kJournalPath) == CHIP_NO_ERROR);
+
+        for (uint32_t i = 0; i < 100; i++)
+        {
+            NL_TEST_ASSERT(inSuite, journal.WriteValueBin("counter", reinterpret_cast<uint8_t *>(&i), sizeof(i)) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, journal.Commit() == CHIP_NO_ERROR);
+        }
+        NL_TEST_ASSERT(inSuite, journal.WriteValueBin("deleted", nullptr, 0) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, journal.ClearValue("deleted") == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, journal.Commit() == CHIP_NO_ERROR);
+    }
+
+    // Simulate a crash in the middle of appending a record.
+    FILE * file = fopen(kJournalPath, "ab");
+    NL_TEST_ASSERT(inSuite, file != nullptr);
+    const uint8_t tornRecord[] = { 0xde, 0xad, 0xbe, 0xef, 0x01, 0x07 };
+    fwrite(tornRecord, 1, sizeof(tornRecord), file);
+    fclose(file);
+
+    {
+        ChipLinuxStorageJournal journal;
+        NL_TEST_ASSERT(inSuite, journal.Init(kJournalPath) == CHIP_NO_ERROR);
+
+        uint32_t counter = 0;
+        size_t readSize  = 0;
+        NL_TEST_ASSERT(inSuite,
+                       journal.ReadValueBin("counter", reinterpret_cast<uint8_t *>(&counter), sizeof(counter), readSize) ==
+                           CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, counter == 99);
+        NL_TEST_ASSERT(inSuite, !journal.HasValue("deleted"));
+
+        // Records appended after recovery must survive the next replay.
+        counter = 100;
+        NL_TEST_ASSERT(inSuite,
+                       journal.WriteValueBin("counter", reinterpret_cast<uint8_t *>(&counter), sizeof(counter)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, journal.Commit() == CHIP_NO_ERROR);
+    }
+
+    {
+        ChipLinuxStorageJournal journal;
+        NL_TEST_ASSERT(inSuite, journal.Init(kJournalPath) == CHIP_NO_ERROR);
+
+        uint32_t counter = 0;
+        size_t readSize  = 0;
+        NL_TEST_ASSERT(inSuite,
+                       journal.ReadValueBin("counter", reinterpret_cast<uint8_t *>(&counter), sizeof(counter), readSize) ==
+                           CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, counter == 100);
+    }
+
+    RemoveTestFiles();
+}
+
+void TestJournal_Compaction(nlTestSuite * inSuite, void * inContext)
+{
+    RemoveTestFiles();
+
+    ChipLinuxStorageJournal journal;
+    NL_TEST_ASSERT(inSuite, journal.Init(kJournalPath) == CHIP_NO_ERROR);
+
+    uint8_t value[256] = {};
+    for (size_t i = 0; i < 1000; i++)
+    {
+        value[0] = static_cast<uint8_t>(i);
+        NL_TEST_ASSERT(inSuite, journal.WriteValueBin("blob", value, sizeof(value)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, journal.Commit() == CHIP_NO_ERROR);
+    }
+
+    // Stale records never accumulate much beyond the compaction threshold.
+    NL_TEST_ASSERT(inSuite,
+                   journal.GetJournalSize() <= journal.GetLiveSize() + CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL_COMPACTION_THRESHOLD +
+                           sizeof(value) + 32);
+
+    NL_TEST_ASSERT(inSuite, journal.Compact() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, journal.GetJournalSize() == journal.GetLiveSize());
+
+    uint8_t readValue[sizeof(value)];
+    size_t readSize = 0;
+    NL_TEST_ASSERT(inSuite, journal.ReadValueBin("blob", readValue, sizeof(readValue), readSize) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, readValue[0] == static_cast<uint8_t>(999));
+
+    RemoveTestFiles();
+}
+
+void TestJournal_Batch(nlTestSuite * inSuite, void * inContext)
+{
+    RemoveTestFiles();
+
+    const uint8_t value[] = { 5, 6, 7 };
+    off_t sizeBeforeBatch = 0;
+
+    {
+        ChipLinuxStorageJournal journal;
+        NL_TEST_ASSERT(inSuite, journal.Init(kJournalPath) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, journal.WriteValueBin("stale", value, sizeof(value)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, journal.Commit() == CHIP_NO_ERROR);
+
+        NL_TEST_ASSERT(inSuite, journal.BeginBatch() == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, journal.BeginBatch() == CHIP_ERROR_INCORRECT_STATE);
+        NL_TEST_ASSERT(inSuite, journal.WriteValueBin("a", value, sizeof(value)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, journal.WriteValueBin("b", value, 1) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, journal.ClearValue("stale") == CHIP_NO_ERROR);
+
+        // Pending writes are visible, but nothing reached the file yet.
+        NL_TEST_ASSERT(inSuite, journal.HasValue("a"));
+        NL_TEST_ASSERT(inSuite, journal.Commit() == CHIP_NO_ERROR);
+        sizeBeforeBatch = static_cast<off_t>(journal.GetJournalSize());
+        NL_TEST_ASSERT(inSuite, journal.CommitBatch() == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, static_cast<off_t>(journal.GetJournalSize()) > sizeBeforeBatch);
+
+        // An aborted batch never reaches the file.
+        NL_TEST_ASSERT(inSuite, journal.BeginBatch() == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, journal.WriteValueBin("aborted", value, sizeof(value)) == CHIP_NO_ERROR);
+        journal.AbortBatch();
+    }
+
+    {
+        ChipLinuxStorageJournal journal;
+        NL_TEST_ASSERT(inSuite, journal.Init(kJournalPath) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, journal.HasValue("a"));
+        NL_TEST_ASSERT(inSuite, journal.HasValue("b"));
+        NL_TEST_ASSERT(inSuite, !journal.HasValue("stale"));
+        NL_TEST_ASSERT(inSuite, !journal.HasValue("aborted"));
+    }
+
+    // A batch torn by a crash is dropped as a whole.
+    NL_TEST_ASSERT(inSuite, truncate(kJournalPath, sizeBeforeBatch + 20) == 0);
+
+    {
+        ChipLinuxStorageJournal journal;
+        NL_TEST_ASSERT(inSuite, journal.Init(kJournalPath) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, !journal.HasValue("a"));
+        NL_TEST_ASSERT(inSuite, !journal.HasValue("b"));
+        NL_TEST_ASSERT(inSuite, journal.HasValue("stale"));
+    }
+
+    RemoveTestFiles();
+}
+
+void TestJournal_MigrateFromIni(nlTestSuite * inSuite, void * inContext)
+{
+    RemoveTestFiles();
+
+    const uint8_t value[] = { 0xaa, 0xbb, 0xcc };
+
+    {
+        ChipLinuxStorage legacy;
+        NL_TEST_ASSERT(inSuite, legacy.Init(kLegacyPath) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, legacy.WriteValueBin("f/1/n", value, sizeof(value)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, legacy.WriteValueBin("weird=key", value, 1) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, legacy.Commit() == CHIP_NO_ERROR);
+    }
+
+    ChipLinuxStorageJournal journal;
+    NL_TEST_ASSERT(inSuite, journal.Init(kJournalPath, kLegacyPath) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, access(kLegacyPath, F_OK) != 0);
+    NL_TEST_ASSERT(inSuite, access(kMigratedPath, F_OK) == 0);
+
+    uint8_t readValue[sizeof(value)];
+    size_t readSize = 0;
+    NL_TEST_ASSERT(inSuite, journal.ReadValueBin("f/1/n", readValue, sizeof(readValue), readSize) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, readSize == sizeof(value));
+    NL_TEST_ASSERT(inSuite, memcmp(readValue, value, sizeof(value)) == 0);
+    NL_TEST_ASSERT(inSuite, journal.ReadValueBin("weird=key", readValue, sizeof(readValue), readSize) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, readSize == 1);
+
+    RemoveTestFiles();
+}
+
+const nlTest sTests[] = { NL_TEST_DEF("Test Journal_PutGetDelete", TestJournal_PutGetDelete),
+                          NL_TEST_DEF("Test Journal_Replay", TestJournal_Replay),
+                          NL_TEST_DEF("Test Journal_Compaction", TestJournal_Compaction),
+                          NL_TEST_DEF("Test Journal_Batch", TestJournal_Batch),
+                          NL_TEST_DEF("Test Journal_MigrateFromIni", TestJournal_MigrateFromIni), NL_TEST_SENTINEL() };
+
+int TestLinuxStorageJournal_Setup(void * inContext)
+{
+    CHIP_ERROR error = chip::Platform::MemoryInit();
+    if (error != CHIP_NO_ERROR)
+        return FAILURE;
+
+    return SUCCESS;
+}
+
+int TestLinuxStorageJournal_Teardown(void * inContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+} // namespace
+
+int TestLinuxStorageJournal()
+{
+    nlTestSuite theSuite = { "LinuxStorageJournal tests", &sTests[0], TestLinuxStorageJournal_Setup,
+                             TestLinuxStorageJournal_Teardown };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestLinuxStorageJournal);
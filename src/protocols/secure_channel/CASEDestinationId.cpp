@@ -21,8 +21,11 @@
 #include <credentials/GroupDataProvider.h>
 #include <lib/core/CHIPError.h>
 #include <lib/support/BufferWriter.h>
+#include <lib/support/CodeUtils.h>
 #include <lib/support/Span.h>
 
+#include <algorithm>
+
 #include "CASEDestinationId.h"
 
 namespace chip {
@@ -62,4 +65,135 @@ CHIP_ERROR GenerateCaseDestinationId(const ByteSpan & ipk, const ByteSpan & init
     return err;
 }
 
+CHIP_ERROR CASEDestinationIdTable::Init(FabricTable * fabricTable, Credentials::GroupDataProvider * groupDataProvider)
+{
+    VerifyOrReturnError(fabricTable != nullptr && groupDataProvider != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Shutdown();
+    ReturnErrorOnFailure(fabricTable->AddFabricDelegate(this));
+    groupDataProvider->AddIpkKeySetListener(this);
+    mFabricTable       = fabricTable;
+    mGroupDataProvider = groupDataProvider;
+    return CHIP_NO_ERROR;
+}
+
+void CASEDestinationIdTable::Shutdown()
+{
+    if (mFabricTable != nullptr)
+    {
+        mFabricTable->RemoveFabricDelegate(this);
+        mFabricTable = nullptr;
+    }
+    if (mGroupDataProvider != nullptr)
+    {
+        mGroupDataProvider->RemoveIpkKeySetListener(this);
+        mGroupDataProvider = nullptr;
+    }
+    Invalidate();
+}
+
+void CASEDestinationIdTable::Invalidate()
+{
+    // The candidates hold IPKs: do not leave them around.
+    if (mCandidates)
+    {
+        ClearSecretData(reinterpret_cast<uint8_t *>(mCandidates.Get()), mCandidateCount * sizeof(Candidate));
+    }
+    mCandidates.Free();
+    mCandidateCount = 0;
+    mValid          = false;
+}
+
+CHIP_ERROR CASEDestinationIdTable::Build()
+{
+    Invalidate();
+    VerifyOrReturnError(mFabricTable != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    size_t maxCandidates = 0;
+    for (const FabricInfo & fabricInfo : *mFabricTable)
+    {
+        (void) fabricInfo;
+        maxCandidates += Credentials::GroupDataProvider::KeySet::kEpochKeysMax;
+    }
+    if (maxCandidates > 0)
+    {
+        VerifyOrReturnError(mCandidates.Calloc(maxCandidates), CHIP_ERROR_NO_MEMORY);
+    }
+
+    for (const FabricInfo & fabricInfo : *mFabricTable)
+    {
+        // A fabric without IPK cannot be the destination of a Sigma1.
+        Credentials::GroupDataProvider::KeySet ipkKeySet;
+        CHIP_ERROR err = mGroupDataProvider->GetIpkKeySet(fabricInfo.GetFabricIndex(), ipkKeySet);
+        if ((err != CHIP_NO_ERROR) ||
+            ((ipkKeySet.num_keys_used == 0) || (ipkKeySet.num_keys_used > Credentials::GroupDataProvider::KeySet::kEpochKeysMax)))
+        {
+            continue;
+        }
+
+        Crypto::P256PublicKey rootPubKey;
+        err = mFabricTable->FetchRootPubkey(fabricInfo.GetFabricIndex(), rootPubKey);
+        if (err != CHIP_NO_ERROR)
+        {
+            Invalidate();
+            return err;
+        }
+
+        for (size_t keyIdx = 0; keyIdx < ipkKeySet.num_keys_used; ++keyIdx)
+        {
+            Candidate & candidate = mCandidates[mCandidateCount++];
+            candidate.fabricIndex = fabricInfo.GetFabricIndex();
+            candidate.nodeId      = fabricInfo.GetNodeId();
+            memcpy(candidate.ipk, ipkKeySet.epoch_keys[keyIdx].key, kIPKSize);
+
+            Encoding::LittleEndian::BufferWriter bbuf(candidate.message, sizeof(candidate.message));
+            bbuf.Skip(kSigmaParamRandomNumberSize);
+            bbuf.Put(rootPubKey.ConstBytes(), rootPubKey.Length());
+            bbuf.Put64(fabricInfo.GetFabricId());
+            bbuf.Put64(fabricInfo.GetNodeId());
+            VerifyOrDie(bbuf.Fit());
+        }
+    }
+
+    mValid = true;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASEDestinationIdTable::FindLocalNode(const ByteSpan & destinationId, const ByteSpan & initiatorRandom,
+                                                 FabricIndex & outFabricIndex, NodeId & outNodeId, MutableByteSpan & outIpk)
+{
+    VerifyOrReturnError(initiatorRandom.size() == kSigmaParamRandomNumberSize, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(outIpk.size() >= kIPKSize, CHIP_ERROR_BUFFER_TOO_SMALL);
+    if (!mValid && Build() != CHIP_NO_ERROR)
+    {
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+
+    for (size_t i = 0; i < mCandidateCount; i++)
+    {
+        Candidate & candidate = mCandidates[i];
+        memcpy(candidate.message, initiatorRandom.data(), kSigmaParamRandomNumberSize);
+
+        uint8_t candidateDestinationId[kSHA256_Hash_Length];
+        HMAC_sha hmac;
+        CHIP_ERROR err = hmac.HMAC_SHA256(candidate.ipk, sizeof(candidate.ipk), candidate.message, sizeof(candidate.message),
+                                          candidateDestinationId, sizeof(candidateDestinationId));
+        if ((err != CHIP_NO_ERROR) || !destinationId.data_equal(ByteSpan(candidateDestinationId)))
+        {
+            continue;
+        }
+
+        outFabricIndex = candidate.fabricIndex;
+        outNodeId      = candidate.nodeId;
+        memcpy(outIpk.data(), candidate.ipk, kIPKSize);
+        outIpk.reduce_size(kIPKSize);
+
+        // Try this candidate first next time.
+        std::rotate(&mCandidates[0], &mCandidates[i], &mCandidates[i + 1]);
+        return CHIP_NO_ERROR;
+    }
+
+    return CHIP_ERROR_KEY_NOT_FOUND;
+}
+
 } // namespace chip
@@ -24,6 +24,7 @@
 
 #include <lib/core/CHIPError.h>
 #include <lib/core/DataModelTypes.h>
+#include <lib/support/ScopedBuffer.h>
 #include <lib/support/Span.h>
 
 namespace chip {
@@ -34,4 +35,71 @@ inline constexpr uint16_t kIPKSize                    = Crypto::CHIP_CRYPTO_SYMM
 CHIP_ERROR GenerateCaseDestinationId(const ByteSpan & ipk, const ByteSpan & initiatorRandom, const ByteSpan & rootPubKey,
                                      FabricId fabricId, NodeId nodeId, MutableByteSpan & outDestinationId);
 
+/**
+ * Destination identifier candidates of the local operational identities, for a CASE responder to
+ * find which identity the destination identifier of a received Sigma1 designates.
+ *
+ * Each candidate (one per fabric and IPK epoch key) keeps its IPK and the destination message
+ * already serialized, so matching a Sigma1 does not load the IPK key sets from the group data
+ * provider nor fetch root public keys. Since the destination identifier binds the initiator random,
+ * one HMAC per candidate tried is still needed; candidates are tried most recently matched first,
+ * so that repeated handshakes on the same fabric usually need a single one.
+ *
+ * The candidates are built on first use, and rebuilt after any change to the fabric table or to the
+ * IPK key set of a fabric, which the table listens for.
+ */
+class CASEDestinationIdTable : public FabricTable::Delegate, public Credentials::GroupDataProvider::IpkKeySetListener
+{
+public:
+    CASEDestinationIdTable() = default;
+    ~CASEDestinationIdTable() override { Shutdown(); }
+
+    CHIP_ERROR Init(FabricTable * fabricTable, Credentials::GroupDataProvider * groupDataProvider);
+    void Shutdown();
+
+    /**
+     * Find the local identity that `destinationId` designates for a Sigma1 with `initiatorRandom`.
+     *
+     * @param[out] outIpk  Receives the IPK that matched; must be at least kIPKSize bytes.
+     *
+     * @retval CHIP_ERROR_KEY_NOT_FOUND if no local identity matches
+     * @retval CHIP_ERROR_INCORRECT_STATE if the table is not initialized, or could not be built
+     */
+    CHIP_ERROR FindLocalNode(const ByteSpan & destinationId, const ByteSpan & initiatorRandom, FabricIndex & outFabricIndex,
+                             NodeId & outNodeId, MutableByteSpan & outIpk);
+
+    /// Drops the candidates, so that they are rebuilt from the fabric table and group data provider on next use.
+    void Invalidate();
+
+    //////////// FabricTable::Delegate Implementation ///////////////
+    void OnFabricRemoved(const FabricTable & fabricTable, FabricIndex fabricIndex) override { Invalidate(); }
+    void OnFabricCommitted(const FabricTable & fabricTable, FabricIndex fabricIndex) override { Invalidate(); }
+    void OnFabricUpdated(const FabricTable & fabricTable, FabricIndex fabricIndex) override { Invalidate(); }
+    void OnFabricUpdateReverted(const FabricTable & fabricTable, FabricIndex fabricIndex) override { Invalidate(); }
+
+    //////////// GroupDataProvider::IpkKeySetListener Implementation ///////////////
+    void OnIpkKeySetChanged(FabricIndex fabricIndex) override { Invalidate(); }
+
+private:
+    static constexpr size_t kDestinationMessageLength =
+        kSigmaParamRandomNumberSize + Crypto::kP256_PublicKey_Length + sizeof(FabricId) + sizeof(NodeId);
+
+    struct Candidate
+    {
+        FabricIndex fabricIndex;
+        NodeId nodeId;
+        uint8_t ipk[kIPKSize];
+        // Destination message, whose leading initiator random is filled in for each Sigma1.
+        uint8_t message[kDestinationMessageLength];
+    };
+
+    CHIP_ERROR Build();
+
+    FabricTable * mFabricTable                          = nullptr;
+    Credentials::GroupDataProvider * mGroupDataProvider = nullptr;
+    Platform::ScopedMemoryBuffer<Candidate> mCandidates;
+    size_t mCandidateCount = 0;
+    bool mValid            = false;
+};
+
 } // namespace chip
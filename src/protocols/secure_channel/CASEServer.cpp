@@ -50,6 +50,13 @@ CHIP_ERROR CASEServer::ListenForSessionEstablishment(Messaging::ExchangeManager
     // Set up the group state provider that persists across all handshakes.
     GetSession().SetGroupDataProvider(mGroupDataProvider);
 
+    // Likewise for the destination identifiers of the local identities, derived from the fabric table.
+    if (mFabrics != nullptr)
+    {
+        ReturnErrorOnFailure(mDestinationIdTable.Init(mFabrics, mGroupDataProvider));
+    }
+    GetSession().SetDestinationIdTable(&mDestinationIdTable);
+
     ChipLogProgress(Inet, "CASE Server enabling CASE session setups");
     mExchangeManager->RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1, this);
 
@@ -48,6 +48,7 @@ public:
             mExchangeManager = nullptr;
         }
 
+        mDestinationIdTable.Shutdown();
         GetSession().Clear();
         mPinnedSecureSession.ClearValue();
     }
@@ -96,6 +97,9 @@ private:
     FabricTable * mFabrics                              = nullptr;
     Credentials::GroupDataProvider * mGroupDataProvider = nullptr;
 
+    // Destination identifiers of the local identities, to match Sigma1 messages.
+    CASEDestinationIdTable mDestinationIdTable;
+
     CHIP_ERROR InitCASEHandshake(Messaging::ExchangeContext * ec);
 
     /*
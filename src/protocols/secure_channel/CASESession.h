@@ -117,6 +117,16 @@ public:
      */
     void SetGroupDataProvider(Credentials::GroupDataProvider * groupDataProvider) { mGroupDataProvider = groupDataProvider; }
 
+    /**
+     * @brief Set the table of precomputed destination identifier candidates used to match received Sigma1
+     *
+     * Without a table (or if the table has no match), each Sigma1 is matched against every fabric and IPK
+     * from the fabric table and group data provider.
+     *
+     * @param destinationIdTable - Pointer to the table, which must outlive its use by this session (may be nullptr).
+     */
+    void SetDestinationIdTable(CASEDestinationIdTable * destinationIdTable) { mDestinationIdTable = destinationIdTable; }
+
     /**
      * Parse a sigma1 message.  This function will return success only if the
      * message passes schema checks.  Specifically:
@@ -203,6 +213,7 @@ public:
         kFinishedViaResume   = 7,
         kSendSigma3Pending   = 8,
         kHandleSigma3Pending = 9,
+        kHandleSigma2Pending = 10,
     };
 
     State GetState() { return mState; }
@@ -241,7 +252,12 @@ private:
                                 ByteSpan initiatorRandom);
     CHIP_ERROR SendSigma2();
     CHIP_ERROR HandleSigma2_and_SendSigma3(System::PacketBufferHandle && msg);
-    CHIP_ERROR HandleSigma2(System::PacketBufferHandle && msg);
+
+    struct HandleSigma2Data;
+    CHIP_ERROR HandleSigma2a(System::PacketBufferHandle && msg);
+    static CHIP_ERROR HandleSigma2b(HandleSigma2Data & data, bool & cancel);
+    CHIP_ERROR HandleSigma2c(HandleSigma2Data & data, CHIP_ERROR status);
+
     CHIP_ERROR HandleSigma2Resume(System::PacketBufferHandle && msg);
 
     struct SendSigma3Data;
@@ -296,6 +312,7 @@ private:
     Crypto::P256ECDHDerivedSecret mSharedSecret;
     Credentials::ValidationContext mValidContext;
     Credentials::GroupDataProvider * mGroupDataProvider = nullptr;
+    CASEDestinationIdTable * mDestinationIdTable        = nullptr;
 
     uint8_t mMessageDigest[Crypto::kSHA256_Hash_Length];
     uint8_t mIPK[kIPKSize];
@@ -315,6 +332,7 @@ private:
 
     template <class DATA>
     class WorkHelper;
+    Platform::SharedPtr<WorkHelper<HandleSigma2Data>> mHandleSigma2Helper;
     Platform::SharedPtr<WorkHelper<SendSigma3Data>> mSendSigma3Helper;
     Platform::SharedPtr<WorkHelper<HandleSigma3Data>> mHandleSigma3Helper;
 
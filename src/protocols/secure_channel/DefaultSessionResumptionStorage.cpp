@@ -20,11 +20,48 @@
 #include <lib/support/Base64.h>
 #include <lib/support/SafeInt.h>
 
+#include <algorithm>
+#include <cstring>
+
 namespace chip {
 
+namespace {
+
+bool NodeLess(const ScopedNodeId & a, const ScopedNodeId & b)
+{
+    if (a.GetFabricIndex() != b.GetFabricIndex())
+    {
+        return a.GetFabricIndex() < b.GetFabricIndex();
+    }
+    return a.GetNodeId() < b.GetNodeId();
+}
+
+bool ResumptionIdLess(const uint8_t * a, const uint8_t * b)
+{
+    return memcmp(a, b, SessionResumptionStorage::kResumptionIdSize) < 0;
+}
+
+// Insert slot into the sorted table of count slots, keeping it sorted according to less.
+template <typename SlotType, typename Less>
+void InsertSorted(SlotType * table, size_t count, SlotType slot, Less less)
+{
+    SlotType * end = table + count;
+    SlotType * pos = std::upper_bound(table, end, slot, less);
+    std::move_backward(pos, end, end + 1);
+    *pos = slot;
+}
+
+} // namespace
+
 CHIP_ERROR DefaultSessionResumptionStorage::FindByScopedNodeId(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
                                                                Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)
 {
+    // Only go to storage for nodes that are in the index.  If the index cannot be loaded, fall back to looking up the state.
+    if (LoadIndexCache() == CHIP_NO_ERROR)
+    {
+        size_t slot;
+        VerifyOrReturnError(FindSlotByNode(node, slot), CHIP_ERROR_KEY_NOT_FOUND);
+    }
     ReturnErrorOnFailure(LoadState(node, resumptionId, sharedSecret, peerCATs));
     return CHIP_NO_ERROR;
 }
@@ -42,6 +79,17 @@ CHIP_ERROR DefaultSessionResumptionStorage::FindByResumptionId(ConstResumptionId
 
 CHIP_ERROR DefaultSessionResumptionStorage::FindNodeByResumptionId(ConstResumptionIdView resumptionId, ScopedNodeId & node)
 {
+    if (LoadIndexCache() == CHIP_NO_ERROR)
+    {
+        size_t slot;
+        if (FindSlotByResumptionId(resumptionId, slot))
+        {
+            node = mIndex.mNodes[slot];
+            return CHIP_NO_ERROR;
+        }
+        // Only nodes whose state could not be loaded may still have a link that is not known here.
+        VerifyOrReturnError(mResumptionIdCount < mIndex.mSize, CHIP_ERROR_KEY_NOT_FOUND);
+    }
     ReturnErrorOnFailure(LoadLink(resumptionId, node));
     return CHIP_NO_ERROR;
 }
@@ -49,133 +97,99 @@ CHIP_ERROR DefaultSessionResumptionStorage::FindNodeByResumptionId(ConstResumpti
 CHIP_ERROR DefaultSessionResumptionStorage::Save(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
                                                  const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs)
 {
-    SessionIndex index;
-    ReturnErrorOnFailure(LoadIndex(index));
+    ReturnErrorOnFailure(LoadIndexCache());
 
-    for (size_t i = 0; i < index.mSize; ++i)
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    size_t slot;
+    if (FindSlotByNode(node, slot))
     {
-        if (index.mNodes[i] == node)
+        // Node already exists in the index.  Save in place; the index itself does not change.
+        //
+        // This follows the approach in Delete.  Removal of the old
+        // resumption-id-keyed link is best effort.  If we do not know
+        // the resumption ID for the key, the entry in the link table
+        // will be leaked.
+        if (mHasResumptionId[slot])
         {
-            // Node already exists in the index.  Save in place.
-            CHIP_ERROR err = CHIP_NO_ERROR;
-            ResumptionIdStorage oldResumptionId;
-            Crypto::P256ECDHDerivedSecret oldSharedSecret;
-            CATValues oldPeerCATs;
-            // This follows the approach in Delete.  Removal of the old
-            // resumption-id-keyed link is best effort.  If we cannot load
-            // state to lookup the resumption ID for the key, the entry in
-            // the link table will be leaked.
-            err = LoadState(node, oldResumptionId, oldSharedSecret, oldPeerCATs);
+            err = DeleteLink(mResumptionIds[slot]);
             if (err != CHIP_NO_ERROR)
             {
                 ChipLogError(SecureChannel,
-                             "LoadState failed; unable to fully delete session resumption record for node " ChipLogFormatX64
+                             "DeleteLink failed; unable to fully delete session resumption record for node " ChipLogFormatX64
                              ": %" CHIP_ERROR_FORMAT,
                              ChipLogValueX64(node.GetNodeId()), err.Format());
             }
-            else
-            {
-                err = DeleteLink(oldResumptionId);
-                if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(SecureChannel,
-                                 "DeleteLink failed; unable to fully delete session resumption record for node " ChipLogFormatX64
-                                 ": %" CHIP_ERROR_FORMAT,
-                                 ChipLogValueX64(node.GetNodeId()), err.Format());
-                }
-            }
-            ReturnErrorOnFailure(SaveState(node, resumptionId, sharedSecret, peerCATs));
-            ReturnErrorOnFailure(SaveLink(resumptionId, node));
-            return CHIP_NO_ERROR;
         }
+        else
+        {
+            ChipLogError(SecureChannel,
+                         "Resumption ID unknown; unable to fully delete session resumption record for node " ChipLogFormatX64,
+                         ChipLogValueX64(node.GetNodeId()));
+        }
+
+        err = SaveState(node, resumptionId, sharedSecret, peerCATs);
+        if (err == CHIP_NO_ERROR)
+        {
+            err = SaveLink(resumptionId, node);
+        }
+        if (err != CHIP_NO_ERROR)
+        {
+            InvalidateIndexCache();
+            return err;
+        }
+
+        SetIndexEntryResumptionId(slot, resumptionId);
+        return CHIP_NO_ERROR;
     }
 
-    if (index.mSize == CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE)
+    if (mIndex.mSize == CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE)
     {
         // TODO: implement LRU for resumption
-        ReturnErrorOnFailure(Delete(index.mNodes[0]));
-        ReturnErrorOnFailure(LoadIndex(index));
+        DeleteRecords(mIndex.mNodes[0], mHasResumptionId[0] ? &mResumptionIds[0] : nullptr);
+        RemoveIndexEntry(0);
     }
 
-    ReturnErrorOnFailure(SaveState(node, resumptionId, sharedSecret, peerCATs));
-    ReturnErrorOnFailure(SaveLink(resumptionId, node));
-
-    index.mNodes[index.mSize++] = node;
-    ReturnErrorOnFailure(SaveIndex(index));
-
-    return CHIP_NO_ERROR;
-}
-
-CHIP_ERROR DefaultSessionResumptionStorage::Delete(const ScopedNodeId & node)
-{
-    SessionIndex index;
-    ReturnErrorOnFailure(LoadIndex(index));
-
-    ResumptionIdStorage resumptionId;
-    Crypto::P256ECDHDerivedSecret sharedSecret;
-    CATValues peerCATs;
-    CHIP_ERROR err = LoadState(node, resumptionId, sharedSecret, peerCATs);
+    err = SaveState(node, resumptionId, sharedSecret, peerCATs);
     if (err == CHIP_NO_ERROR)
     {
-        err = DeleteLink(resumptionId);
-        if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
-        {
-            ChipLogError(SecureChannel,
-                         "Unable to delete session resumption link for node " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
-                         ChipLogValueX64(node.GetNodeId()), err.Format());
-        }
+        err = SaveLink(resumptionId, node);
     }
-    else if (err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    if (err == CHIP_NO_ERROR)
     {
-        ChipLogError(SecureChannel,
-                     "Unable to load session resumption state during session deletion for node " ChipLogFormatX64
-                     ": %" CHIP_ERROR_FORMAT,
-                     ChipLogValueX64(node.GetNodeId()), err.Format());
+        AppendIndexEntry(node, resumptionId);
+        err = SaveIndex(mIndex);
     }
-
-    err = DeleteState(node);
-    if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    if (err != CHIP_NO_ERROR)
     {
-        ChipLogError(SecureChannel, "Unable to delete session resumption state for node " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
-                     ChipLogValueX64(node.GetNodeId()), err.Format());
+        InvalidateIndexCache();
+        return err;
     }
 
-    bool found = false;
-    for (size_t i = 0; i < index.mSize; ++i)
-    {
-        if (found)
-        {
-            // index.mSize was decreased by 1 when found was set to true.
-            // So the (i+1)th element isn't out of bounds.
-            index.mNodes[i] = index.mNodes[i + 1];
-        }
-        else
-        {
-            if (index.mNodes[i] == node)
-            {
-                found = true;
-                if (i + 1 < index.mSize)
-                {
-                    index.mNodes[i] = index.mNodes[i + 1];
-                }
-                index.mSize -= 1;
-            }
-        }
-    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DefaultSessionResumptionStorage::Delete(const ScopedNodeId & node)
+{
+    ReturnErrorOnFailure(LoadIndexCache());
+
+    size_t slot;
+    bool found = FindSlotByNode(node, slot);
+    DeleteRecords(node, (found && mHasResumptionId[slot]) ? &mResumptionIds[slot] : nullptr);
 
     if (found)
     {
-        err = SaveIndex(index);
+        RemoveIndexEntry(slot);
+        CHIP_ERROR err = SaveIndex(mIndex);
         if (err != CHIP_NO_ERROR)
         {
             ChipLogError(SecureChannel, "Unable to save session resumption index: %" CHIP_ERROR_FORMAT, err.Format());
+            InvalidateIndexCache();
         }
     }
     else
     {
-        ChipLogError(SecureChannel,
-                     "Unable to find session resumption state for node in index" ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
-                     ChipLogValueX64(node.GetNodeId()), err.Format());
+        ChipLogError(SecureChannel, "Unable to find session resumption state for node in index " ChipLogFormatX64,
+                     ChipLogValueX64(node.GetNodeId()));
     }
 
     return CHIP_NO_ERROR;
@@ -183,64 +197,74 @@ CHIP_ERROR DefaultSessionResumptionStorage::Delete(const ScopedNodeId & node)
 
 CHIP_ERROR DefaultSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
 {
-    CHIP_ERROR stickyErr = CHIP_NO_ERROR;
-    size_t found         = 0;
-    SessionIndex index;
-    ReturnErrorOnFailure(LoadIndex(index));
-    size_t initialSize = index.mSize;
-    for (size_t i = 0; i < initialSize; ++i)
-    {
-        CHIP_ERROR err = CHIP_NO_ERROR;
-        size_t cur     = i - found;
-        size_t remain  = initialSize - i;
+    ReturnErrorOnFailure(LoadIndexCache());
+
+    auto deleteNode = [&](size_t slot) -> CHIP_ERROR {
         ResumptionIdStorage resumptionId;
-        Crypto::P256ECDHDerivedSecret sharedSecret;
-        CATValues peerCATs;
-        if (index.mNodes[cur].GetFabricIndex() != fabricIndex)
+        if (mHasResumptionId[slot])
         {
-            continue;
+            resumptionId = mResumptionIds[slot];
         }
-        err       = LoadState(index.mNodes[cur], resumptionId, sharedSecret, peerCATs);
-        stickyErr = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
-        if (err != CHIP_NO_ERROR)
+        else
         {
-            ChipLogError(SecureChannel,
-                         "Session resumption cache deletion partially failed for fabric index %u, "
-                         "unable to load node state: %" CHIP_ERROR_FORMAT,
-                         fabricIndex, err.Format());
-            continue;
+            Crypto::P256ECDHDerivedSecret sharedSecret;
+            CATValues peerCATs;
+            CHIP_ERROR err = LoadState(mIndex.mNodes[slot], resumptionId, sharedSecret, peerCATs);
+            if (err != CHIP_NO_ERROR)
+            {
+                ChipLogError(SecureChannel,
+                             "Session resumption cache deletion partially failed for fabric index %u, "
+                             "unable to load node state: %" CHIP_ERROR_FORMAT,
+                             fabricIndex, err.Format());
+                return err;
+            }
         }
-        err       = DeleteLink(resumptionId);
-        stickyErr = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
+        CHIP_ERROR err = DeleteLink(resumptionId);
         if (err != CHIP_NO_ERROR)
         {
             ChipLogError(SecureChannel,
                          "Session resumption cache deletion partially failed for fabric index %u, "
                          "unable to delete node link: %" CHIP_ERROR_FORMAT,
                          fabricIndex, err.Format());
-            continue;
+            return err;
         }
-        err       = DeleteState(index.mNodes[cur]);
-        stickyErr = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
+        err = DeleteState(mIndex.mNodes[slot]);
         if (err != CHIP_NO_ERROR)
         {
             ChipLogError(SecureChannel,
                          "Session resumption cache is in an inconsistent state!  "
                          "Unable to delete node state during attempted deletion of fabric index %u: %" CHIP_ERROR_FORMAT,
                          fabricIndex, err.Format());
-            continue;
+            return err;
         }
-        ++found;
-        --remain;
-        if (remain)
+        return CHIP_NO_ERROR;
+    };
+
+    CHIP_ERROR stickyErr = CHIP_NO_ERROR;
+    size_t kept          = 0;
+    for (size_t i = 0; i < mIndex.mSize; ++i)
+    {
+        if (mIndex.mNodes[i].GetFabricIndex() == fabricIndex)
         {
-            memmove(&index.mNodes[cur], &index.mNodes[cur + 1], remain * sizeof(index.mNodes[0]));
+            CHIP_ERROR err = deleteNode(i);
+            stickyErr      = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
+            if (err == CHIP_NO_ERROR)
+            {
+                continue;
+            }
         }
+        // Keep this node, compacting the index in place.
+        mIndex.mNodes[kept]    = mIndex.mNodes[i];
+        mResumptionIds[kept]   = mResumptionIds[i];
+        mHasResumptionId[kept] = mHasResumptionId[i];
+        ++kept;
     }
-    if (found)
+
+    if (kept != mIndex.mSize)
     {
-        index.mSize -= found;
-        CHIP_ERROR err = SaveIndex(index);
+        mIndex.mSize = kept;
+        RebuildIndexLookups();
+        CHIP_ERROR err = SaveIndex(mIndex);
         stickyErr      = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
         if (err != CHIP_NO_ERROR)
         {
@@ -249,9 +273,171 @@ CHIP_ERROR DefaultSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
                 "Session resumption cache is in an inconsistent state!  "
                 "Unable to save session resumption index during attempted deletion of fabric index %u: %" CHIP_ERROR_FORMAT,
                 fabricIndex, err.Format());
+            InvalidateIndexCache();
         }
     }
     return stickyErr;
 }
 
+void DefaultSessionResumptionStorage::DeleteRecords(const ScopedNodeId & node, const ResumptionIdStorage * knownResumptionId)
+{
+    ResumptionIdStorage resumptionId;
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    if (knownResumptionId != nullptr)
+    {
+        resumptionId = *knownResumptionId;
+    }
+    else
+    {
+        Crypto::P256ECDHDerivedSecret sharedSecret;
+        CATValues peerCATs;
+        err = LoadState(node, resumptionId, sharedSecret, peerCATs);
+    }
+
+    if (err == CHIP_NO_ERROR)
+    {
+        err = DeleteLink(resumptionId);
+        if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+        {
+            ChipLogError(SecureChannel,
+                         "Unable to delete session resumption link for node " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                         ChipLogValueX64(node.GetNodeId()), err.Format());
+        }
+    }
+    else if (err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        ChipLogError(SecureChannel,
+                     "Unable to load session resumption state during session deletion for node " ChipLogFormatX64
+                     ": %" CHIP_ERROR_FORMAT,
+                     ChipLogValueX64(node.GetNodeId()), err.Format());
+    }
+
+    err = DeleteState(node);
+    if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        ChipLogError(SecureChannel, "Unable to delete session resumption state for node " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                     ChipLogValueX64(node.GetNodeId()), err.Format());
+    }
+}
+
+CHIP_ERROR DefaultSessionResumptionStorage::LoadIndexCache()
+{
+    VerifyOrReturnError(!mIndexCacheLoaded, CHIP_NO_ERROR);
+
+    ReturnErrorOnFailure(LoadIndex(mIndex));
+    // Learn the resumption ID of every node once, so that resumption IDs can be looked up without going to storage.
+    for (size_t i = 0; i < mIndex.mSize; ++i)
+    {
+        Crypto::P256ECDHDerivedSecret sharedSecret;
+        CATValues peerCATs;
+        mHasResumptionId[i] = (LoadState(mIndex.mNodes[i], mResumptionIds[i], sharedSecret, peerCATs) == CHIP_NO_ERROR);
+    }
+    RebuildIndexLookups();
+
+    mIndexCacheLoaded = true;
+    return CHIP_NO_ERROR;
+}
+
+void DefaultSessionResumptionStorage::RebuildIndexLookups()
+{
+    mResumptionIdCount = 0;
+    for (size_t i = 0; i < mIndex.mSize; ++i)
+    {
+        mSlotsByNode[i] = static_cast<IndexSlot>(i);
+        if (mHasResumptionId[i])
+        {
+            mSlotsByResumptionId[mResumptionIdCount++] = static_cast<IndexSlot>(i);
+        }
+    }
+    std::sort(mSlotsByNode, mSlotsByNode + mIndex.mSize,
+              [this](IndexSlot a, IndexSlot b) { return NodeLess(mIndex.mNodes[a], mIndex.mNodes[b]); });
+    std::sort(mSlotsByResumptionId, mSlotsByResumptionId + mResumptionIdCount,
+              [this](IndexSlot a, IndexSlot b) { return ResumptionIdLess(mResumptionIds[a].data(), mResumptionIds[b].data()); });
+}
+
+bool DefaultSessionResumptionStorage::FindSlotByNode(const ScopedNodeId & node, size_t & slot) const
+{
+    const IndexSlot * end = mSlotsByNode + mIndex.mSize;
+    const IndexSlot * it  = std::lower_bound(mSlotsByNode, end, node, [this](IndexSlot candidate, const ScopedNodeId & value) {
+        return NodeLess(mIndex.mNodes[candidate], value);
+    });
+    VerifyOrReturnValue(it != end && mIndex.mNodes[*it] == node, false);
+    slot = *it;
+    return true;
+}
+
+bool DefaultSessionResumptionStorage::FindSlotByResumptionId(ConstResumptionIdView resumptionId, size_t & slot) const
+{
+    const IndexSlot * end = mSlotsByResumptionId + mResumptionIdCount;
+    const IndexSlot * it =
+        std::lower_bound(mSlotsByResumptionId, end, resumptionId.data(), [this](IndexSlot candidate, const uint8_t * value) {
+            return ResumptionIdLess(mResumptionIds[candidate].data(), value);
+        });
+    VerifyOrReturnValue(it != end && memcmp(mResumptionIds[*it].data(), resumptionId.data(), kResumptionIdSize) == 0, false);
+    slot = *it;
+    return true;
+}
+
+void DefaultSessionResumptionStorage::AppendIndexEntry(const ScopedNodeId & node, ConstResumptionIdView resumptionId)
+{
+    const auto slot = static_cast<IndexSlot>(mIndex.mSize);
+
+    mIndex.mNodes[slot] = node;
+    std::copy(resumptionId.begin(), resumptionId.end(), mResumptionIds[slot].begin());
+    mHasResumptionId[slot] = true;
+
+    InsertSorted(mSlotsByNode, mIndex.mSize, slot,
+                 [this](IndexSlot a, IndexSlot b) { return NodeLess(mIndex.mNodes[a], mIndex.mNodes[b]); });
+    InsertSorted(mSlotsByResumptionId, mResumptionIdCount, slot,
+                 [this](IndexSlot a, IndexSlot b) { return ResumptionIdLess(mResumptionIds[a].data(), mResumptionIds[b].data()); });
+    ++mIndex.mSize;
+    ++mResumptionIdCount;
+}
+
+void DefaultSessionResumptionStorage::RemoveIndexEntry(size_t slot)
+{
+    // Drop the slot from both lookup tables; the slots after it move down by one, which keeps the tables sorted.
+    size_t count = 0;
+    for (size_t i = 0; i < mIndex.mSize; ++i)
+    {
+        IndexSlot candidate = mSlotsByNode[i];
+        if (candidate != slot)
+        {
+            mSlotsByNode[count++] = static_cast<IndexSlot>(candidate > slot ? candidate - 1 : candidate);
+        }
+    }
+    count = 0;
+    for (size_t i = 0; i < mResumptionIdCount; ++i)
+    {
+        IndexSlot candidate = mSlotsByResumptionId[i];
+        if (candidate != slot)
+        {
+            mSlotsByResumptionId[count++] = static_cast<IndexSlot>(candidate > slot ? candidate - 1 : candidate);
+        }
+    }
+    mResumptionIdCount = count;
+
+    std::move(mIndex.mNodes + slot + 1, mIndex.mNodes + mIndex.mSize, mIndex.mNodes + slot);
+    std::move(mResumptionIds + slot + 1, mResumptionIds + mIndex.mSize, mResumptionIds + slot);
+    std::move(mHasResumptionId + slot + 1, mHasResumptionId + mIndex.mSize, mHasResumptionId + slot);
+    --mIndex.mSize;
+}
+
+void DefaultSessionResumptionStorage::SetIndexEntryResumptionId(size_t slot, ConstResumptionIdView resumptionId)
+{
+    if (mHasResumptionId[slot])
+    {
+        IndexSlot * end = mSlotsByResumptionId + mResumptionIdCount;
+        IndexSlot * pos = std::find(mSlotsByResumptionId, end, slot);
+        std::move(pos + 1, end, pos);
+        --mResumptionIdCount;
+    }
+
+    std::copy(resumptionId.begin(), resumptionId.end(), mResumptionIds[slot].begin());
+    mHasResumptionId[slot] = true;
+    InsertSorted(mSlotsByResumptionId, mResumptionIdCount, static_cast<IndexSlot>(slot),
+                 [this](IndexSlot a, IndexSlot b) { return ResumptionIdLess(mResumptionIds[a].data(), mResumptionIds[b].data()); });
+    ++mResumptionIdCount;
+}
+
 } // namespace chip
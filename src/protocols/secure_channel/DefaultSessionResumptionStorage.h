@@ -29,6 +29,10 @@ namespace chip {
  *   The implementation saves 2 maps:
  *     * <FabricIndex, PeerNodeId>   => <ResumptionId, ShareSecret, PeerCATs>
  *     * <ResumptionId>              => <FabricIndex, PeerNodeId>
+ *
+ *   The index of stored nodes, together with the resumption ID of each node, is loaded from storage on first use and then kept
+ *   in memory, so looking up a node or a resumption ID does not need to read storage, and updating the record of a node that is
+ *   already stored does not rewrite the index.
  */
 class DefaultSessionResumptionStorage : public SessionResumptionStorage
 {
@@ -50,10 +54,16 @@ public:
     CHIP_ERROR FindNodeByResumptionId(ConstResumptionIdView resumptionId, ScopedNodeId & node);
     CHIP_ERROR Save(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
                     const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs) override;
-    CHIP_ERROR Delete(const ScopedNodeId & node);
+    virtual CHIP_ERROR Delete(const ScopedNodeId & node);
     CHIP_ERROR DeleteAll(FabricIndex fabricIndex) override;
 
 protected:
+    /**
+     * Drop the in-memory copy of the index, so that it is loaded again from storage on next use.  Must be called whenever the
+     * stored index may have changed behind the back of this class, e.g. when writes to storage were rolled back.
+     */
+    void InvalidateIndexCache() { mIndexCacheLoaded = false; }
+
     CHIP_ERROR virtual SaveIndex(const SessionIndex & index) = 0;
     CHIP_ERROR virtual LoadIndex(SessionIndex & index)       = 0;
 
@@ -66,6 +76,31 @@ protected:
     CHIP_ERROR virtual LoadState(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
                                  Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)             = 0;
     CHIP_ERROR virtual DeleteState(const ScopedNodeId & node)                                                    = 0;
+
+private:
+    // Position of a node in mIndex.  The lookup tables below store slots instead of copies of the nodes.
+    using IndexSlot = uint16_t;
+    static_assert(CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE <= UINT16_MAX, "IndexSlot is too small");
+
+    CHIP_ERROR LoadIndexCache();
+    void RebuildIndexLookups();
+    bool FindSlotByNode(const ScopedNodeId & node, size_t & slot) const;
+    bool FindSlotByResumptionId(ConstResumptionIdView resumptionId, size_t & slot) const;
+    void AppendIndexEntry(const ScopedNodeId & node, ConstResumptionIdView resumptionId);
+    void RemoveIndexEntry(size_t slot);
+    void SetIndexEntryResumptionId(size_t slot, ConstResumptionIdView resumptionId);
+    void DeleteRecords(const ScopedNodeId & node, const ResumptionIdStorage * knownResumptionId);
+
+    bool mIndexCacheLoaded = false;
+    // The stored index, in storage order; the first node is the one evicted when the index is full.
+    SessionIndex mIndex;
+    // Resumption ID of each node of mIndex, when its state could be loaded.
+    ResumptionIdStorage mResumptionIds[CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE];
+    bool mHasResumptionId[CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE];
+    // Slots of mIndex sorted by node, and slots with a known resumption ID sorted by resumption ID.
+    IndexSlot mSlotsByNode[CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE];
+    IndexSlot mSlotsByResumptionId[CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE];
+    size_t mResumptionIdCount = 0;
 };
 
 } // namespace chip
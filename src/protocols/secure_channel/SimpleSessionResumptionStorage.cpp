@@ -48,6 +48,49 @@ StorageKeyName SimpleSessionResumptionStorage::GetStorageKey(ConstResumptionIdVi
     return DefaultStorageKeyAllocator::SessionResumption(resumptionIdBase64);
 }
 
+CHIP_ERROR SimpleSessionResumptionStorage::Save(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
+                                                const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs)
+{
+    PersistentStorageTransaction transaction(*mStorage);
+    CHIP_ERROR err = DefaultSessionResumptionStorage::Save(node, resumptionId, sharedSecret, peerCATs);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = transaction.Commit();
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        // The writes made so far are rolled back, so the cached index may no longer match storage.
+        InvalidateIndexCache();
+    }
+    return err;
+}
+
+CHIP_ERROR SimpleSessionResumptionStorage::Delete(const ScopedNodeId & node)
+{
+    // The link, the state and the index entry of the node are removed together.
+    PersistentStorageTransaction transaction(*mStorage);
+    CHIP_ERROR err       = DefaultSessionResumptionStorage::Delete(node);
+    CHIP_ERROR commitErr = transaction.Commit();
+    if (commitErr != CHIP_NO_ERROR)
+    {
+        InvalidateIndexCache();
+    }
+    return (err != CHIP_NO_ERROR) ? err : commitErr;
+}
+
+CHIP_ERROR SimpleSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
+{
+    // Deletion is best effort, so whatever was deleted is committed even if some entries failed.
+    PersistentStorageTransaction transaction(*mStorage);
+    CHIP_ERROR err       = DefaultSessionResumptionStorage::DeleteAll(fabricIndex);
+    CHIP_ERROR commitErr = transaction.Commit();
+    if (commitErr != CHIP_NO_ERROR)
+    {
+        InvalidateIndexCache();
+    }
+    return (err != CHIP_NO_ERROR) ? err : commitErr;
+}
+
 CHIP_ERROR SimpleSessionResumptionStorage::SaveIndex(const SessionIndex & index)
 {
     std::array<uint8_t, MaxIndexSize()> buf;
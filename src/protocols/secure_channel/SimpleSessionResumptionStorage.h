@@ -40,9 +40,16 @@ public:
     {
         VerifyOrReturnError(storage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
         mStorage = storage;
+        InvalidateIndexCache();
         return CHIP_NO_ERROR;
     }
 
+    // Wrap the multi-record updates of DefaultSessionResumptionStorage in a single storage transaction.
+    CHIP_ERROR Save(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
+                    const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs) override;
+    CHIP_ERROR Delete(const ScopedNodeId & node) override;
+    CHIP_ERROR DeleteAll(FabricIndex fabricIndex) override;
+
     CHIP_ERROR SaveIndex(const SessionIndex & index) override;
     CHIP_ERROR LoadIndex(SessionIndex & index) override;
 
@@ -30,11 +30,13 @@
 #include <lib/core/CHIPSafeCasts.h>
 #include <lib/core/DataModelTypes.h>
 #include <lib/core/ScopedNodeId.h>
+#include <lib/support/CHIPFaultInjection.h>
 #include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/ScopedBuffer.h>
 #include <lib/support/TestPersistentStorageDelegate.h>
 #include <lib/support/UnitTestContext.h>
+#include <lib/support/UnitTestExtendedAssertions.h>
 #include <lib/support/UnitTestRegistration.h>
 #include <messaging/tests/MessagingContext.h>
 #include <nlunit-test.h>
@@ -373,7 +375,12 @@ public:
     static void ClientReceivesBusyTest(nlTestSuite * inSuite, void * inContext);
     static void Sigma1ParsingTest(nlTestSuite * inSuite, void * inContext);
     static void DestinationIdTest(nlTestSuite * inSuite, void * inContext);
+    static void DestinationIdTableTest(nlTestSuite * inSuite, void * inContext);
     static void SessionResumptionStorage(nlTestSuite * inSuite, void * inContext);
+    static void Sigma2ValidatedAsScheduledWorkTest(nlTestSuite * inSuite, void * inContext);
+#if CHIP_WITH_NLFAULTINJECTION
+    static void HandshakesBeyondBackgroundQueueTest(nlTestSuite * inSuite, void * inContext);
+#endif // CHIP_WITH_NLFAULTINJECTION
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     static void SimulateUpdateNOCInvalidatePendingEstablishment(nlTestSuite * inSuite, void * inContext);
 #endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
@@ -720,6 +727,78 @@ void TestCASESession::DestinationIdTest(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, !destinationIdSpan.data_equal(ByteSpan(kExpectedDestinationIdFromSpec)));
 }
 
+void TestCASESession::DestinationIdTableTest(nlTestSuite * inSuite, void * inContext)
+{
+    const FabricInfo * fabricInfo = gDeviceFabrics.FindFabricWithIndex(gDeviceFabricIndex);
+    NL_TEST_ASSERT(inSuite, fabricInfo != nullptr);
+    if (fabricInfo == nullptr)
+    {
+        return;
+    }
+
+    GroupDataProvider::KeySet ipkKeySet;
+    NL_TEST_ASSERT_SUCCESS(inSuite, gDeviceGroupDataProvider.GetIpkKeySet(gDeviceFabricIndex, ipkKeySet));
+    Crypto::P256PublicKey rootPubKey;
+    NL_TEST_ASSERT_SUCCESS(inSuite, gDeviceFabrics.FetchRootPubkey(gDeviceFabricIndex, rootPubKey));
+    const ByteSpan ipk(ipkKeySet.epoch_keys[0].key);
+
+    uint8_t initiatorRandom[kSigmaParamRandomNumberSize];
+    NL_TEST_ASSERT_SUCCESS(inSuite, Crypto::DRBG_get_bytes(initiatorRandom, sizeof(initiatorRandom)));
+
+    uint8_t destinationIdBuf[Crypto::kSHA256_Hash_Length];
+    MutableByteSpan destinationId(destinationIdBuf);
+    const ByteSpan rootPubKeySpan(rootPubKey.ConstBytes(), rootPubKey.Length());
+    NL_TEST_ASSERT_SUCCESS(inSuite,
+                           GenerateCaseDestinationId(ipk, ByteSpan(initiatorRandom), rootPubKeySpan, fabricInfo->GetFabricId(),
+                                                     fabricInfo->GetNodeId(), destinationId));
+
+    FabricIndex fabricIndex;
+    NodeId nodeId;
+    uint8_t ipkBuf[kIPKSize];
+    MutableByteSpan ipkSpan(ipkBuf);
+
+    // Nothing can be found before Init().
+    CASEDestinationIdTable table;
+    NL_TEST_ASSERT(inSuite,
+                   table.FindLocalNode(destinationId, ByteSpan(initiatorRandom), fabricIndex, nodeId, ipkSpan) ==
+                       CHIP_ERROR_INCORRECT_STATE);
+
+    NL_TEST_ASSERT_SUCCESS(inSuite, table.Init(&gDeviceFabrics, &gDeviceGroupDataProvider));
+    NL_TEST_ASSERT_SUCCESS(inSuite, table.FindLocalNode(destinationId, ByteSpan(initiatorRandom), fabricIndex, nodeId, ipkSpan));
+    NL_TEST_ASSERT(inSuite, fabricIndex == gDeviceFabricIndex);
+    NL_TEST_ASSERT(inSuite, nodeId == fabricInfo->GetNodeId());
+    NL_TEST_ASSERT(inSuite, ipkSpan.data_equal(ipk));
+
+    // A destination identifier for another initiator random does not match.
+    initiatorRandom[0] ^= 0xFF;
+    NL_TEST_ASSERT(inSuite,
+                   table.FindLocalNode(destinationId, ByteSpan(initiatorRandom), fabricIndex, nodeId, ipkSpan) ==
+                       CHIP_ERROR_KEY_NOT_FOUND);
+    initiatorRandom[0] ^= 0xFF;
+
+    // The table is rebuilt after the fabric changes.
+    gDeviceFabrics.SendUpdateFabricNotificationForTest(gDeviceFabricIndex);
+    ipkSpan = MutableByteSpan(ipkBuf);
+    NL_TEST_ASSERT_SUCCESS(inSuite, table.FindLocalNode(destinationId, ByteSpan(initiatorRandom), fabricIndex, nodeId, ipkSpan));
+    NL_TEST_ASSERT(inSuite, fabricIndex == gDeviceFabricIndex);
+
+    // The table is rebuilt after the IPK key set changes, without any fabric change.
+    NL_TEST_ASSERT_SUCCESS(
+        inSuite, gDeviceGroupDataProvider.RemoveKeySet(gDeviceFabricIndex, GroupDataProvider::kIdentityProtectionKeySetId));
+    NL_TEST_ASSERT(inSuite,
+                   table.FindLocalNode(destinationId, ByteSpan(initiatorRandom), fabricIndex, nodeId, ipkSpan) ==
+                       CHIP_ERROR_KEY_NOT_FOUND);
+    NL_TEST_ASSERT_SUCCESS(inSuite, InitTestIpk(gDeviceGroupDataProvider, *fabricInfo, /* numIpks= */ 1));
+    ipkSpan = MutableByteSpan(ipkBuf);
+    NL_TEST_ASSERT_SUCCESS(inSuite, table.FindLocalNode(destinationId, ByteSpan(initiatorRandom), fabricIndex, nodeId, ipkSpan));
+    NL_TEST_ASSERT(inSuite, ipkSpan.data_equal(ipk));
+
+    table.Shutdown();
+    NL_TEST_ASSERT(inSuite,
+                   table.FindLocalNode(destinationId, ByteSpan(initiatorRandom), fabricIndex, nodeId, ipkSpan) ==
+                       CHIP_ERROR_INCORRECT_STATE);
+}
+
 template <typename Params>
 static CHIP_ERROR EncodeSigma1(MutableByteSpan & buf)
 {
@@ -1056,6 +1135,116 @@ void TestCASESession::SessionResumptionStorage(nlTestSuite * inSuite, void * inC
     }
 }
 
+void TestCASESession::Sigma2ValidatedAsScheduledWorkTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+    TemporarySessionManager sessionManager(inSuite, ctx);
+
+    TestCASESecurePairingDelegate delegateCommissioner;
+    CASESession pairingCommissioner;
+    pairingCommissioner.SetGroupDataProvider(&gCommissionerGroupDataProvider);
+
+    TestCASESecurePairingDelegate delegateAccessory;
+    CASESession pairingAccessory;
+
+    auto & loopback            = ctx.GetLoopback();
+    loopback.mSentMessageCount = 0;
+
+    NL_TEST_ASSERT(inSuite,
+                   ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1,
+                                                                                     &pairingAccessory) == CHIP_NO_ERROR);
+
+    ExchangeContext * contextCommissioner = ctx.NewUnauthenticatedExchangeToBob(&pairingCommissioner);
+
+    pairingAccessory.SetGroupDataProvider(&gDeviceGroupDataProvider);
+    NL_TEST_ASSERT(inSuite,
+                   pairingAccessory.PrepareForSessionEstablishment(
+                       sessionManager, &gDeviceFabrics, nullptr, nullptr, &delegateAccessory, ScopedNodeId(),
+                       Optional<ReliableMessageProtocolConfig>::Missing()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   pairingCommissioner.EstablishSession(sessionManager, &gCommissionerFabrics,
+                                                        ScopedNodeId{ Node01_01, gCommissionerFabricIndex }, contextCommissioner,
+                                                        nullptr, nullptr, &delegateCommissioner,
+                                                        Optional<ReliableMessageProtocolConfig>::Missing()) == CHIP_NO_ERROR);
+
+    // Deliver Sigma1 and Sigma2 without running the event loop: the responder's credentials
+    // are validated by scheduled work, so Sigma3 must not have been sent yet.
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(inSuite, pairingCommissioner.GetState() == CASESession::State::kHandleSigma2Pending);
+    NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingComplete == 0);
+    NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingErrors == 0);
+
+    ServiceEvents(ctx);
+
+    NL_TEST_ASSERT(inSuite, loopback.mSentMessageCount == sTestCaseMessageCount);
+    NL_TEST_ASSERT(inSuite, delegateAccessory.mNumPairingComplete == 1);
+    NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingComplete == 1);
+    NL_TEST_ASSERT(inSuite, delegateAccessory.mNumPairingErrors == 0);
+    NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingErrors == 0);
+}
+
+#if CHIP_WITH_NLFAULTINJECTION
+void TestCASESession::HandshakesBeyondBackgroundQueueTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+    TemporarySessionManager sessionManager(inSuite, ctx);
+
+    constexpr size_t kNumHandshakes = 3;
+
+    TestCASESecurePairingDelegate delegateCommissioner[kNumHandshakes];
+    CASESession pairingCommissioner[kNumHandshakes];
+    TestCASESecurePairingDelegate delegateAccessory[kNumHandshakes];
+    CASESession pairingAccessory[kNumHandshakes];
+
+    // Behave as if the background queue had room for a single piece of work, which stays queued
+    // until the event loop runs: every other handshake must be processed in the foreground.
+    FaultInjection::GetManager().FailAtFault(FaultInjection::kFault_CASEBackgroundWorkBusy, 1, UINT16_MAX);
+
+    for (size_t i = 0; i < kNumHandshakes; i++)
+    {
+        pairingCommissioner[i].SetGroupDataProvider(&gCommissionerGroupDataProvider);
+        pairingAccessory[i].SetGroupDataProvider(&gDeviceGroupDataProvider);
+
+        NL_TEST_ASSERT(inSuite,
+                       ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(
+                           Protocols::SecureChannel::MsgType::CASE_Sigma1, &pairingAccessory[i]) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite,
+                       pairingAccessory[i].PrepareForSessionEstablishment(
+                           sessionManager, &gDeviceFabrics, nullptr, nullptr, &delegateAccessory[i], ScopedNodeId(),
+                           Optional<ReliableMessageProtocolConfig>::Missing()) == CHIP_NO_ERROR);
+
+        ExchangeContext * contextCommissioner = ctx.NewUnauthenticatedExchangeToBob(&pairingCommissioner[i]);
+        NL_TEST_ASSERT(inSuite,
+                       pairingCommissioner[i].EstablishSession(
+                           sessionManager, &gCommissionerFabrics, ScopedNodeId{ Node01_01, gCommissionerFabricIndex },
+                           contextCommissioner, nullptr, nullptr, &delegateCommissioner[i],
+                           Optional<ReliableMessageProtocolConfig>::Missing()) == CHIP_NO_ERROR);
+        ctx.DrainAndServiceIO();
+    }
+
+    // The first handshake waits for its queued Sigma2 validation, the others completed in the foreground.
+    NL_TEST_ASSERT(inSuite, pairingCommissioner[0].GetState() == CASESession::State::kHandleSigma2Pending);
+    NL_TEST_ASSERT(inSuite, delegateCommissioner[0].mNumPairingComplete == 0);
+    for (size_t i = 1; i < kNumHandshakes; i++)
+    {
+        NL_TEST_ASSERT(inSuite, delegateAccessory[i].mNumPairingComplete == 1);
+        NL_TEST_ASSERT(inSuite, delegateCommissioner[i].mNumPairingComplete == 1);
+    }
+
+    ServiceEvents(ctx);
+
+    for (size_t i = 0; i < kNumHandshakes; i++)
+    {
+        NL_TEST_ASSERT(inSuite, delegateAccessory[i].mNumPairingComplete == 1);
+        NL_TEST_ASSERT(inSuite, delegateCommissioner[i].mNumPairingComplete == 1);
+        NL_TEST_ASSERT(inSuite, delegateAccessory[i].mNumPairingErrors == 0);
+        NL_TEST_ASSERT(inSuite, delegateCommissioner[i].mNumPairingErrors == 0);
+    }
+
+    FaultInjection::GetManager().ResetFaultConfigurations(FaultInjection::kFault_CASEBackgroundWorkBusy);
+}
+#endif // CHIP_WITH_NLFAULTINJECTION
+
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
 void TestCASESession::SimulateUpdateNOCInvalidatePendingEstablishment(nlTestSuite * inSuite, void * inContext)
 {
@@ -1225,7 +1414,12 @@ static const nlTest sTests[] =
     NL_TEST_DEF("ClientReceivesBusy", chip::TestCASESession::ClientReceivesBusyTest),
     NL_TEST_DEF("Sigma1Parsing", chip::TestCASESession::Sigma1ParsingTest),
     NL_TEST_DEF("DestinationId", chip::TestCASESession::DestinationIdTest),
+    NL_TEST_DEF("DestinationIdTable", chip::TestCASESession::DestinationIdTableTest),
     NL_TEST_DEF("SessionResumptionStorage", chip::TestCASESession::SessionResumptionStorage),
+    NL_TEST_DEF("Sigma2ValidatedAsScheduledWork", chip::TestCASESession::Sigma2ValidatedAsScheduledWorkTest),
+#if CHIP_WITH_NLFAULTINJECTION
+    NL_TEST_DEF("HandshakesBeyondBackgroundQueue", chip::TestCASESession::HandshakesBeyondBackgroundQueueTest),
+#endif // CHIP_WITH_NLFAULTINJECTION
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     // This is compiled for host tests which is enough test coverage to ensure updating NOC invalidates
     // CASESession that are in the process of establishing.
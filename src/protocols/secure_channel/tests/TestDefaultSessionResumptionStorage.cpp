@@ -429,6 +429,154 @@ void TestDeleteAll(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+// Counts the reads of any key and the writes of the session resumption index.
+class CountingPersistentStorageDelegate : public chip::TestPersistentStorageDelegate
+{
+public:
+    CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override
+    {
+        ++mReads;
+        return chip::TestPersistentStorageDelegate::SyncGetKeyValue(key, buffer, size);
+    }
+
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override
+    {
+        if (strcmp(key, chip::DefaultStorageKeyAllocator::SessionResumptionIndex().KeyName()) == 0)
+        {
+            ++mIndexWrites;
+        }
+        return chip::TestPersistentStorageDelegate::SyncSetKeyValue(key, value, size);
+    }
+
+    size_t mReads       = 0;
+    size_t mIndexWrites = 0;
+};
+
+void TestIndexCache(nlTestSuite * inSuite, void * inContext)
+{
+    CountingPersistentStorageDelegate storage;
+    chip::Crypto::P256ECDHDerivedSecret sharedSecret;
+    struct
+    {
+        chip::SessionResumptionStorage::ResumptionIdStorage resumptionId;
+        chip::ScopedNodeId node;
+    } vectors[CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE];
+
+    // Create a shared secret.  We can use the same one for all entries.
+    sharedSecret.SetLength(sharedSecret.Capacity());
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR == chip::Crypto::DRBG_get_bytes(sharedSecret.Bytes(), sharedSecret.Length()));
+
+    // Populate test vectors.
+    for (size_t i = 0; i < ArraySize(vectors); ++i)
+    {
+        NL_TEST_ASSERT(
+            inSuite, CHIP_NO_ERROR == chip::Crypto::DRBG_get_bytes(vectors[i].resumptionId.data(), vectors[i].resumptionId.size()));
+        // Use a unique first byte, and make both nodes and resumption IDs sort in reverse order of insertion.
+        *vectors[i].resumptionId.data() = static_cast<uint8_t>(ArraySize(vectors) - i);
+        vectors[i].node = chip::ScopedNodeId(static_cast<chip::NodeId>(ArraySize(vectors) - i), static_cast<chip::FabricIndex>(1));
+    }
+
+    // Fill storage.
+    {
+        chip::SimpleSessionResumptionStorage sessionStorage;
+        sessionStorage.Init(&storage);
+        for (auto & vector : vectors)
+        {
+            NL_TEST_ASSERT(inSuite,
+                           sessionStorage.Save(vector.node, vector.resumptionId, sharedSecret, chip::CATValues{}) == CHIP_NO_ERROR);
+        }
+        for (auto & vector : vectors)
+        {
+            chip::ScopedNodeId outNode;
+            NL_TEST_ASSERT(inSuite, sessionStorage.FindNodeByResumptionId(vector.resumptionId, outNode) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, outNode == vector.node);
+        }
+    }
+
+    // A new instance loads the index from storage once; after that, lookups only read the state of the node found.
+    storage.mReads = 0;
+    chip::SimpleSessionResumptionStorage sessionStorage;
+    sessionStorage.Init(&storage);
+    chip::ScopedNodeId outNode;
+    chip::SessionResumptionStorage::ResumptionIdStorage outResumptionId;
+    chip::Crypto::P256ECDHDerivedSecret outSharedSecret;
+    chip::CATValues outCats;
+    NL_TEST_ASSERT(inSuite, sessionStorage.FindNodeByResumptionId(vectors[0].resumptionId, outNode) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, outNode == vectors[0].node);
+    NL_TEST_ASSERT(inSuite, storage.mReads == 1 + ArraySize(vectors));
+
+    storage.mReads = 0;
+    for (auto & vector : vectors)
+    {
+        NL_TEST_ASSERT(inSuite, sessionStorage.FindNodeByResumptionId(vector.resumptionId, outNode) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, outNode == vector.node);
+    }
+    NL_TEST_ASSERT(inSuite, storage.mReads == 0);
+
+    // Unknown nodes and resumption IDs are not looked up in storage.
+    chip::SessionResumptionStorage::ResumptionIdStorage unknownResumptionId = vectors[0].resumptionId;
+    unknownResumptionId[0]                                                  = 0;
+    NL_TEST_ASSERT(inSuite, sessionStorage.FindNodeByResumptionId(unknownResumptionId, outNode) == CHIP_ERROR_KEY_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite,
+                   sessionStorage.FindByScopedNodeId(chip::ScopedNodeId(1, 2), outResumptionId, outSharedSecret, outCats) ==
+                       CHIP_ERROR_KEY_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite, storage.mReads == 0);
+
+    NL_TEST_ASSERT(inSuite,
+                   sessionStorage.FindByResumptionId(vectors[1].resumptionId, outNode, outSharedSecret, outCats) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, outNode == vectors[1].node);
+    NL_TEST_ASSERT(inSuite, storage.mReads == 1);
+
+    // Saving a new resumption ID for a stored node neither reads storage nor rewrites the index.
+    storage.mReads       = 0;
+    storage.mIndexWrites = 0;
+    NL_TEST_ASSERT(inSuite,
+                   sessionStorage.Save(vectors[1].node, unknownResumptionId, sharedSecret, chip::CATValues{}) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.mReads == 0);
+    NL_TEST_ASSERT(inSuite, storage.mIndexWrites == 0);
+    NL_TEST_ASSERT(inSuite, sessionStorage.FindNodeByResumptionId(unknownResumptionId, outNode) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, outNode == vectors[1].node);
+    NL_TEST_ASSERT(inSuite, sessionStorage.FindNodeByResumptionId(vectors[1].resumptionId, outNode) == CHIP_ERROR_KEY_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite,
+                   !storage.HasKey(chip::SimpleSessionResumptionStorage::GetStorageKey(vectors[1].resumptionId).KeyName()));
+
+    // Evicting a node to make room for a new one writes the index once.
+    chip::ScopedNodeId newNode(static_cast<chip::NodeId>(ArraySize(vectors) + 1), static_cast<chip::FabricIndex>(1));
+    storage.mIndexWrites = 0;
+    NL_TEST_ASSERT(inSuite,
+                   sessionStorage.Save(newNode, vectors[1].resumptionId, sharedSecret, chip::CATValues{}) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.mIndexWrites == 1);
+    NL_TEST_ASSERT(inSuite, sessionStorage.FindNodeByResumptionId(vectors[0].resumptionId, outNode) == CHIP_ERROR_KEY_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite,
+                   sessionStorage.FindByScopedNodeId(vectors[0].node, outResumptionId, outSharedSecret, outCats) ==
+                       CHIP_ERROR_KEY_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite, sessionStorage.FindNodeByResumptionId(vectors[1].resumptionId, outNode) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, outNode == newNode);
+
+    // The index written to storage matches the cached one.
+    chip::DefaultSessionResumptionStorage::SessionIndex index;
+    NL_TEST_ASSERT(inSuite, sessionStorage.LoadIndex(index) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, index.mSize == ArraySize(vectors));
+    NL_TEST_ASSERT(inSuite, index.mNodes[0] == vectors[1].node);
+    NL_TEST_ASSERT(inSuite, index.mNodes[index.mSize - 1] == newNode);
+
+    // Deleting a node drops it from both lookups.
+    NL_TEST_ASSERT(inSuite, sessionStorage.Delete(vectors[2].node) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, sessionStorage.FindNodeByResumptionId(vectors[2].resumptionId, outNode) == CHIP_ERROR_KEY_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite,
+                   sessionStorage.FindByScopedNodeId(vectors[2].node, outResumptionId, outSharedSecret, outCats) ==
+                       CHIP_ERROR_KEY_NOT_FOUND);
+    for (size_t i = 3; i < ArraySize(vectors); ++i)
+    {
+        NL_TEST_ASSERT(inSuite, sessionStorage.FindNodeByResumptionId(vectors[i].resumptionId, outNode) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, outNode == vectors[i].node);
+        NL_TEST_ASSERT(inSuite,
+                       sessionStorage.FindByScopedNodeId(vectors[i].node, outResumptionId, outSharedSecret, outCats) ==
+                           CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, outResumptionId == vectors[i].resumptionId);
+    }
+}
+
 // Test Suite
 
 /**
@@ -441,6 +589,7 @@ static const nlTest sTests[] =
     NL_TEST_DEF("TestInPlaceSave", TestInPlaceSave),
     NL_TEST_DEF("TestDelete", TestDelete),
     NL_TEST_DEF("TestDeleteAll", TestDeleteAll),
+    NL_TEST_DEF("TestIndexCache", TestIndexCache),
 
     NL_TEST_SENTINEL()
 };
@@ -0,0 +1,300 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements chip-case-responder-benchmark, which measures how fast a CASE responder
+ *      finds the local operational identity that the destination identifier of a Sigma1 designates,
+ *      on a node commissioned into many fabrics.
+ *
+ *      Each Sigma1 is matched through the CASEDestinationIdTable that CASEServer uses, and through
+ *      the scan of every fabric and IPK that CASESession did before, which loads the IPK key set
+ *      and root public key of each fabric and computes every candidate destination identifier.
+ *
+ */
+
+#include <credentials/FabricTable.h>
+#include <credentials/GroupDataProviderImpl.h>
+#include <credentials/PersistentStorageOpCertStore.h>
+#include <credentials/TestOnlyLocalCertificateAuthority.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/tests/BenchmarkSupport.h>
+#include <protocols/secure_channel/CASEDestinationId.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Benchmark;
+using namespace chip::Credentials;
+
+namespace {
+
+#define TOOL_NAME "chip-case-responder-benchmark"
+
+constexpr NodeId kLocalNodeIdBase = 0xDEDEDEDE00010000;
+
+struct BenchmarkOptions
+{
+    uint32_t fabricCount    = CHIP_CONFIG_MAX_FABRICS;
+    uint32_t ipkCount       = GroupDataProvider::KeySet::kEpochKeysMax;
+    uint32_t handshakeCount = 10000;
+} gOptions;
+
+const char * const gCmdOptionHelp =
+    "   --fabrics <count>\n"
+    "       Number of fabrics the responder is commissioned into, at most CHIP_CONFIG_MAX_FABRICS.\n"
+    "       Defaults to CHIP_CONFIG_MAX_FABRICS.\n"
+    "\n"
+    "   --ipks <count>\n"
+    "       Number of IPK epoch keys of each fabric, from 1 to 3. Defaults to 3.\n"
+    "\n"
+    "   --handshakes <count>\n"
+    "       Number of Sigma1 messages matched for each measurement. Defaults to 10000.\n"
+    "\n";
+
+struct Sigma1
+{
+    uint8_t initiatorRandom[kSigmaParamRandomNumberSize];
+    uint8_t destinationId[Crypto::kSHA256_Hash_Length];
+};
+
+// The state of the responder: a fabric table and group data provider, with an IPK key set per fabric.
+struct Responder
+{
+    TestPersistentStorageDelegate storage;
+    PersistentStorageOpCertStore opCertStore;
+    Crypto::DefaultSessionKeystore sessionKeystore;
+    GroupDataProviderImpl groupDataProvider;
+    FabricTable fabricTable;
+
+    ~Responder()
+    {
+        fabricTable.Shutdown();
+        groupDataProvider.Finish();
+        opCertStore.Finish();
+    }
+};
+
+// Time @a match over the sequence of Sigma1 messages, and print the time per Sigma1.
+template <typename Match>
+void Measure(const char * label, const std::vector<Sigma1> & messages, Match && match)
+{
+    Timing timing     = TimeEach(messages, match);
+    double perMessage = timing.MicrosecondsPerOperation();
+    printf("  %-24s %8.2f us/Sigma1 %10.0f Sigma1/s (%u of %u found)\n", label, perMessage,
+           perMessage > 0 ? 1e6 / perMessage : 0.0, static_cast<unsigned>(timing.successCount),
+           static_cast<unsigned>(timing.operationCount));
+}
+
+CHIP_ERROR InitResponder(Responder & responder)
+{
+    ReturnErrorOnFailure(responder.opCertStore.Init(&responder.storage));
+
+    FabricTable::InitParams initParams;
+    initParams.storage     = &responder.storage;
+    initParams.opCertStore = &responder.opCertStore;
+    ReturnErrorOnFailure(responder.fabricTable.Init(initParams));
+
+    responder.groupDataProvider.SetStorageDelegate(&responder.storage);
+    responder.groupDataProvider.SetSessionKeystore(&responder.sessionKeystore);
+    ReturnErrorOnFailure(responder.groupDataProvider.Init());
+
+    TestOnlyLocalCertificateAuthority certificateAuthority;
+    ReturnErrorOnFailure(certificateAuthority.Init().GetStatus());
+
+    for (uint32_t i = 0; i < gOptions.fabricCount; i++)
+    {
+        Crypto::P256Keypair opKey;
+        Crypto::P256SerializedKeypair opKeySerialized;
+        ReturnErrorOnFailure(opKey.Initialize(Crypto::ECPKeyTarget::ECDSA));
+        ReturnErrorOnFailure(opKey.Serialize(opKeySerialized));
+
+        ReturnErrorOnFailure(certificateAuthority.SetIncludeIcac(false)
+                                 .GenerateNocChain(static_cast<FabricId>(i + 1), kLocalNodeIdBase + i, opKey.Pubkey())
+                                 .GetStatus());
+
+        FabricIndex fabricIndex;
+        ReturnErrorOnFailure(responder.fabricTable.AddNewFabricForTest(
+            certificateAuthority.GetRcac(), ByteSpan{}, certificateAuthority.GetNoc(),
+            ByteSpan(opKeySerialized.ConstBytes(), opKeySerialized.Length()), &fabricIndex));
+
+        using SecurityPolicy = GroupDataProvider::SecurityPolicy;
+        GroupDataProvider::KeySet ipkKeySet(GroupDataProvider::kIdentityProtectionKeySetId, SecurityPolicy::kTrustFirst,
+                                            static_cast<uint8_t>(gOptions.ipkCount));
+        for (uint32_t keyIdx = 0; keyIdx < gOptions.ipkCount; keyIdx++)
+        {
+            auto & epochKey     = ipkKeySet.epoch_keys[keyIdx];
+            epochKey.start_time = keyIdx * 1000;
+            ReturnErrorOnFailure(Crypto::DRBG_get_bytes(epochKey.key, sizeof(epochKey.key)));
+        }
+
+        const FabricInfo * fabricInfo = responder.fabricTable.FindFabricWithIndex(fabricIndex);
+        VerifyOrReturnError(fabricInfo != nullptr, CHIP_ERROR_INTERNAL);
+        uint8_t compressedFabricId[sizeof(uint64_t)];
+        MutableByteSpan compressedFabricIdSpan(compressedFabricId);
+        ReturnErrorOnFailure(fabricInfo->GetCompressedFabricIdBytes(compressedFabricIdSpan));
+        ReturnErrorOnFailure(responder.groupDataProvider.SetKeySet(fabricIndex, compressedFabricIdSpan, ipkKeySet));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+// Sigma1 messages for the identities the responder has on @a fabricIndexes, cycling through them,
+// each with a fresh initiator random and one of the IPK epoch keys of the fabric.
+CHIP_ERROR MakeSigma1Messages(Responder & responder, const std::vector<FabricIndex> & fabricIndexes, std::vector<Sigma1> & messages)
+{
+    uint32_t random = 0x2545F491;
+    messages.resize(gOptions.handshakeCount);
+    for (uint32_t i = 0; i < gOptions.handshakeCount; i++)
+    {
+        Sigma1 & message              = messages[i];
+        FabricIndex fabricIndex       = fabricIndexes[i % fabricIndexes.size()];
+        const FabricInfo * fabricInfo = responder.fabricTable.FindFabricWithIndex(fabricIndex);
+        VerifyOrReturnError(fabricInfo != nullptr, CHIP_ERROR_INTERNAL);
+
+        for (size_t offset = 0; offset < sizeof(message.initiatorRandom); offset += sizeof(random))
+        {
+            NextRandom(random);
+            memcpy(&message.initiatorRandom[offset], &random, sizeof(random));
+        }
+
+        Crypto::P256PublicKey rootPubKey;
+        ReturnErrorOnFailure(responder.fabricTable.FetchRootPubkey(fabricIndex, rootPubKey));
+        GroupDataProvider::KeySet ipkKeySet;
+        ReturnErrorOnFailure(responder.groupDataProvider.GetIpkKeySet(fabricIndex, ipkKeySet));
+
+        ByteSpan ipk(ipkKeySet.epoch_keys[NextRandom(random) % ipkKeySet.num_keys_used].key);
+        MutableByteSpan destinationId(message.destinationId);
+        ReturnErrorOnFailure(GenerateCaseDestinationId(ipk, ByteSpan(message.initiatorRandom),
+                                                       ByteSpan(rootPubKey.ConstBytes(), rootPubKey.Length()),
+                                                       fabricInfo->GetFabricId(), fabricInfo->GetNodeId(), destinationId));
+    }
+    return CHIP_NO_ERROR;
+}
+
+// What CASESession::FindLocalNodeFromDestinationId does without a destination identifier table.
+bool ScanFabrics(Responder & responder, const Sigma1 & message)
+{
+    for (const FabricInfo & fabricInfo : responder.fabricTable)
+    {
+        Crypto::P256PublicKey rootPubKey;
+        VerifyOrReturnValue(responder.fabricTable.FetchRootPubkey(fabricInfo.GetFabricIndex(), rootPubKey) == CHIP_NO_ERROR, false);
+
+        GroupDataProvider::KeySet ipkKeySet;
+        if (responder.groupDataProvider.GetIpkKeySet(fabricInfo.GetFabricIndex(), ipkKeySet) != CHIP_NO_ERROR ||
+            ipkKeySet.num_keys_used == 0 || ipkKeySet.num_keys_used > GroupDataProvider::KeySet::kEpochKeysMax)
+        {
+            continue;
+        }
+
+        for (size_t keyIdx = 0; keyIdx < ipkKeySet.num_keys_used; ++keyIdx)
+        {
+            uint8_t candidateDestinationId[Crypto::kSHA256_Hash_Length];
+            MutableByteSpan candidateDestinationIdSpan(candidateDestinationId);
+            CHIP_ERROR err =
+                GenerateCaseDestinationId(ByteSpan(ipkKeySet.epoch_keys[keyIdx].key), ByteSpan(message.initiatorRandom),
+                                          ByteSpan(rootPubKey.ConstBytes(), rootPubKey.Length()), fabricInfo.GetFabricId(),
+                                          fabricInfo.GetNodeId(), candidateDestinationIdSpan);
+            if (err == CHIP_NO_ERROR && candidateDestinationIdSpan.data_equal(ByteSpan(message.destinationId)))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+CHIP_ERROR RunDestinationIdMatching()
+{
+    Responder responder;
+    ReturnErrorOnFailure(InitResponder(responder));
+
+    CASEDestinationIdTable table;
+    ReturnErrorOnFailure(table.Init(&responder.fabricTable, &responder.groupDataProvider));
+
+    std::vector<FabricIndex> fabricIndexes;
+    for (const FabricInfo & fabricInfo : responder.fabricTable)
+    {
+        fabricIndexes.push_back(fabricInfo.GetFabricIndex());
+    }
+
+    printf("Fabrics: %u, %u IPK epoch keys each\n", static_cast<unsigned>(fabricIndexes.size()),
+           static_cast<unsigned>(gOptions.ipkCount));
+
+    auto matchWithTable = [&](const Sigma1 & message) {
+        FabricIndex fabricIndex;
+        NodeId nodeId;
+        uint8_t ipk[kIPKSize];
+        MutableByteSpan ipkSpan(ipk);
+        return table.FindLocalNode(ByteSpan(message.destinationId), ByteSpan(message.initiatorRandom), fabricIndex, nodeId,
+                                   ipkSpan) == CHIP_NO_ERROR;
+    };
+    auto matchWithScan = [&](const Sigma1 & message) { return ScanFabrics(responder, message); };
+
+    // Initiators from every fabric in turn: the table still tries candidates one by one.
+    std::vector<Sigma1> messages;
+    ReturnErrorOnFailure(MakeSigma1Messages(responder, fabricIndexes, messages));
+    printf(" Sigma1 for every fabric in turn\n");
+    Measure("table", messages, matchWithTable);
+    Measure("scan", messages, matchWithScan);
+
+    // Initiators from the last fabric, e.g. a controller reconnecting to many devices.
+    ReturnErrorOnFailure(MakeSigma1Messages(responder, { fabricIndexes.back() }, messages));
+    printf(" Sigma1 for the last fabric\n");
+    Measure("table", messages, matchWithTable);
+    Measure("scan", messages, matchWithScan);
+
+    table.Shutdown();
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    CommandLine commandLine(TOOL_NAME, "Measure how fast a CASE responder matches the destination identifier of Sigma1 messages.\n",
+                            {
+                                Option::Count("fabrics", gOptions.fabricCount, 1, CHIP_CONFIG_MAX_FABRICS),
+                                Option::Count("ipks", gOptions.ipkCount, 1, GroupDataProvider::KeySet::kEpochKeysMax),
+                                Option::Count("handshakes", gOptions.handshakeCount),
+                            },
+                            gCmdOptionHelp);
+
+    CHIP_ERROR err = Platform::MemoryInit();
+    SuccessOrExit(err);
+
+    if (!commandLine.Parse(argc, argv))
+    {
+        Platform::MemoryShutdown();
+        return EXIT_FAILURE;
+    }
+
+    err = RunDestinationIdMatching();
+    SuccessOrExit(err);
+
+exit:
+    Platform::MemoryShutdown();
+    return commandLine.ExitStatus(err);
+}
@@ -358,6 +358,78 @@
 #define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE 15
 #endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_LOCK_FREE
+ *
+ *  @brief
+ *      For pool allocated packet buffers (CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE > 0), use several pools of different
+ *      buffer sizes, each with a lock-free free list and a small cache of free buffers in each thread (1), instead of a
+ *      single pool of maximum size buffers guarded by a mutex (0).
+ *
+ *      The CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE maximum size buffers are complemented by the small and medium size
+ *      classes below, and a request is served by the smallest size class that fits it and has a free buffer.
+ *
+ *      This requires lock-free 64-bit atomics and thread_local storage, and is meant for platforms where several threads
+ *      allocate packet buffers.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_LOCK_FREE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_LOCK_FREE 0
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_LOCK_FREE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY
+ *
+ *  @brief
+ *      With CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_LOCK_FREE, the capacity, including reserved space, of the smallest packet
+ *      buffers. These are meant for acknowledgements and status responses.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY 128
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE
+ *
+ *  @brief
+ *      With CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_LOCK_FREE, the number of small packet buffers.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_CAPACITY
+ *
+ *  @brief
+ *      With CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_LOCK_FREE, the capacity, including reserved space, of medium size packet
+ *      buffers.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_CAPACITY
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_CAPACITY 512
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_CAPACITY */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE
+ *
+ *  @brief
+ *      With CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_LOCK_FREE, the number of medium size packet buffers.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE
+ *
+ *  @brief
+ *      With CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_LOCK_FREE, the number of free packet buffers of each size class that a
+ *      thread keeps for its own allocations before returning them to the shared free list. Buffers cached by one thread
+ *      are not available to others, so the pool sizes should allow for them. Zero disables the caches.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE 4
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_LWIP_PBUF_RAM
  *
@@ -652,6 +724,43 @@ struct LwIPEvent;
 #endif
 #endif // CHIP_SYSTEM_CONFIG_USE_POSIX_PIPE
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_USE_EPOLL
+ *
+ *  @brief
+ *      Use the epoll based System::Layer (LayerImplEpoll) as LayerImpl.
+ *
+ *  Set by the build when chip_system_config_event_loop is "Epoll". Only available on Linux.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_USE_EPOLL
+#define CHIP_SYSTEM_CONFIG_USE_EPOLL 0
+#endif // CHIP_SYSTEM_CONFIG_USE_EPOLL
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_EPOLL_EDGE_TRIGGERED
+ *
+ *  @brief
+ *      Register sockets with epoll edge-triggered rather than level-triggered.
+ *
+ *  Edge-triggered registration saves the kernel from reporting the same ready socket over and over, at the
+ *  price of the epoll System::Layer polling each socket after its callback to find out whether I/O is still pending.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_EPOLL_EDGE_TRIGGERED
+#define CHIP_SYSTEM_CONFIG_EPOLL_EDGE_TRIGGERED 0
+#endif // CHIP_SYSTEM_CONFIG_EPOLL_EDGE_TRIGGERED
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS
+ *
+ *  @brief
+ *      Maximum number of events the epoll System::Layer handles per event loop iteration.
+ *
+ *  Further ready sockets are reported by the next epoll_wait().
+ */
+#ifndef CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS
+#define CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS 32
+#endif // CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_USE_ZEPHYR_SOCKET_EXTENSIONS
  *
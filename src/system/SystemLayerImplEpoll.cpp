@@ -0,0 +1,608 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements Layer using epoll(7) and a timerfd.
+ */
+
+#include <lib/support/CodeUtils.h>
+#include <platform/LockTracker.h>
+#include <system/SystemFaultInjection.h>
+#include <system/SystemLayer.h>
+#include <system/SystemLayerImplEpoll.h>
+
+#include <algorithm>
+#include <errno.h>
+#include <poll.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+// Choose an approximation of PTHREAD_NULL if pthread.h doesn't define one.
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+#define PTHREAD_NULL 0
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+
+namespace chip {
+namespace System {
+
+namespace {
+
+// epoll_event data identifying the timerfd. Socket watches use their pool index and file descriptor instead, so that
+// events reported for a watch that was stopped (and maybe reused) by an earlier callback can be told apart.
+constexpr uint64_t kTimerFdKey = UINT64_MAX;
+
+uint64_t SocketWatchKey(size_t index, int fd)
+{
+    return (static_cast<uint64_t>(index) << 32) | static_cast<uint32_t>(fd);
+}
+
+#if CHIP_SYSTEM_CONFIG_EPOLL_EDGE_TRIGGERED
+constexpr uint32_t kEpollTriggerMode = EPOLLET;
+#else
+constexpr uint32_t kEpollTriggerMode = 0;
+#endif // CHIP_SYSTEM_CONFIG_EPOLL_EDGE_TRIGGERED
+
+} // anonymous namespace
+
+CHIP_ERROR LayerImplEpoll::Init()
+{
+    VerifyOrReturnError(mLayerState.SetInitializing(), CHIP_ERROR_INCORRECT_STATE);
+
+    RegisterPOSIXErrorFormatter();
+
+    for (auto & w : mSocketWatchPool)
+    {
+        w.Clear();
+        w.mNextReady   = nullptr;
+        w.mInReadyList = false;
+    }
+    mReadyList = nullptr;
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleEventsThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    struct epoll_event timerEvent;
+
+    mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrReturnError(mEpollFd >= 0, CHIP_ERROR_POSIX(errno));
+
+    mTimerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    VerifyOrExit(mTimerFd >= 0, err = CHIP_ERROR_POSIX(errno));
+    mTimerFdAwakenTime = Clock::kZero;
+
+    timerEvent.events   = EPOLLIN;
+    timerEvent.data.u64 = kTimerFdKey;
+    VerifyOrExit(epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mTimerFd, &timerEvent) == 0, err = CHIP_ERROR_POSIX(errno));
+
+    // Create an event to allow an arbitrary thread to wake the thread in the event loop.
+    SuccessOrExit(err = mWakeEvent.Open(*this));
+
+    VerifyOrReturnError(mLayerState.SetInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    return CHIP_NO_ERROR;
+
+exit:
+    if (mTimerFd >= 0)
+    {
+        close(mTimerFd);
+        mTimerFd = -1;
+    }
+    close(mEpollFd);
+    mEpollFd = -1;
+    return err;
+}
+
+void LayerImplEpoll::Shutdown()
+{
+    VerifyOrReturn(mLayerState.SetShuttingDown());
+
+    mTimerList.Clear();
+    mTimerPool.ReleaseAll();
+
+    mWakeEvent.Close(*this);
+
+    mReadyList = nullptr;
+    VerifyOrDie(close(mTimerFd) == 0);
+    VerifyOrDie(close(mEpollFd) == 0);
+    mTimerFd = -1;
+    mEpollFd = -1;
+
+    mLayerState.ResetFromShuttingDown(); // Return to uninitialized state to permit re-initialization.
+}
+
+void LayerImplEpoll::Signal()
+{
+    /*
+     * Wake up the I/O thread by writing to the wake event.
+     *
+     * If this is being called from within an I/O event callback, then the wake event can be skipped, since the I/O
+     * thread is already awake.
+     */
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    if (pthread_equal(mHandleEventsThread, pthread_self()))
+    {
+        return;
+    }
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    CHIP_ERROR status = mWakeEvent.Notify();
+    if (status != CHIP_NO_ERROR)
+    {
+        ChipLogError(chipSystemLayer, "System wake event notify failed: %" CHIP_ERROR_FORMAT, status.Format());
+    }
+}
+
+CHIP_ERROR LayerImplEpoll::StartTimer(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    CHIP_SYSTEM_FAULT_INJECT(FaultInjection::kFault_TimeoutImmediate, delay = System::Clock::kZero);
+
+    CancelTimer(onComplete, appState);
+
+    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp() + delay, onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        // The new timer is the earliest, so the time until the next event has probably changed.
+        Signal();
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::ExtendTimerTo(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturnError(delay.count() > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    assertChipStackLockedByCurrentThread();
+
+    Clock::Timeout remainingTime = mTimerList.GetRemainingTime(onComplete, appState);
+    if (remainingTime.count() < delay.count())
+    {
+        if (remainingTime == Clock::kZero)
+        {
+            // If remaining time is Clock::kZero, it might possible that our timer is in
+            // the mExpiredTimers list and about to be fired. Remove it from that list, since we are extending it.
+            mExpiredTimers.Remove(onComplete, appState);
+        }
+        return StartTimer(delay, onComplete, appState);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+bool LayerImplEpoll::IsTimerActive(TimerCompleteCallback onComplete, void * appState)
+{
+    bool timerIsActive = (mTimerList.GetRemainingTime(onComplete, appState) > Clock::kZero);
+
+    if (!timerIsActive)
+    {
+        // check if the timer is in the mExpiredTimers list about to be fired.
+        timerIsActive = (mExpiredTimers.Find(onComplete, appState) != nullptr);
+    }
+
+    return timerIsActive;
+}
+
+Clock::Timeout LayerImplEpoll::GetRemainingTime(TimerCompleteCallback onComplete, void * appState)
+{
+    return mTimerList.GetRemainingTime(onComplete, appState);
+}
+
+void LayerImplEpoll::CancelTimer(TimerCompleteCallback onComplete, void * appState)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturn(mLayerState.IsInitialized());
+
+    TimerList::Node * timer = mTimerList.Remove(onComplete, appState);
+    if (timer == nullptr)
+    {
+        // The timer was not in our "will fire in the future" list, but it might
+        // be in the "we're about to fire these" chunk we already grabbed from
+        // that list.  Check for it there too, and if found there we still want
+        // to cancel it.
+        timer = mExpiredTimers.Remove(onComplete, appState);
+    }
+    VerifyOrReturn(timer != nullptr);
+
+    mTimerPool.Release(timer);
+    Signal();
+}
+
+CHIP_ERROR LayerImplEpoll::ScheduleWork(TimerCompleteCallback onComplete, void * appState)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    // Like LayerImplSelect, use an expires-ASAP timer that does not cancel existing timers with the same callback and
+    // appState, so that ScheduleWork invocations don't stomp on each other.
+    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        // The new timer is the earliest, so the time until the next event has probably changed.
+        Signal();
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::StartWatchingSocket(int fd, SocketWatchToken * tokenOut)
+{
+    // Find a free slot.
+    SocketWatch * watch = nullptr;
+    for (auto & w : mSocketWatchPool)
+    {
+        if (w.mFD == fd)
+        {
+            // Duplicate registration is an error.
+            return CHIP_ERROR_INVALID_ARGUMENT;
+        }
+        if ((w.mFD == kInvalidFd) && (watch == nullptr))
+        {
+            watch = &w;
+        }
+    }
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_ENDPOINT_POOL_FULL);
+
+    // The socket is only registered with epoll once a callback on pending I/O is requested.
+    watch->mFD = fd;
+
+    *tokenOut = reinterpret_cast<SocketWatchToken>(watch);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mCallback     = callback;
+    watch->mCallbackData = data;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Set(SocketEventFlags::kRead);
+    return UpdateEpollRegistration(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Set(SocketEventFlags::kWrite);
+    return UpdateEpollRegistration(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Clear(SocketEventFlags::kRead);
+    return UpdateEpollRegistration(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Clear(SocketEventFlags::kWrite);
+    return UpdateEpollRegistration(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::StopWatchingSocket(SocketWatchToken * tokenInOut)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(*tokenInOut);
+    *tokenInOut         = InvalidSocketWatchToken();
+
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(watch->mFD >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    if (watch->mRegisteredEvents != 0)
+    {
+        // Failures are not interesting here: the socket may already have been closed, which unregisters it.
+        (void) epoll_ctl(mEpollFd, EPOLL_CTL_DEL, watch->mFD, nullptr);
+    }
+
+    // Unlike select(), epoll does not need to be woken up to forget about the socket. A watch still on the ready list
+    // is skipped, and unlinked, by the next HandleEvents().
+    watch->Clear();
+
+    return CHIP_NO_ERROR;
+}
+
+/**
+ *  Compute the socket events to report to a watch, given the events returned by epoll.
+ *
+ *  Like select(), which reports errors and hang-ups as the socket being readable or writable, this maps EPOLLERR and
+ *  EPOLLHUP to the I/O the watch is waiting for, so that the callback can find out about the condition.
+ *
+ *  @param[in]    epollEvents   The events returned by epoll for the socket.
+ *
+ *  @param[in]    pendingIO     The events the watch requested callbacks for.
+ */
+SocketEvents LayerImplEpoll::SocketEventsFromEpoll(uint32_t epollEvents, SocketEvents pendingIO)
+{
+    SocketEvents res;
+
+    if (epollEvents & (EPOLLERR | EPOLLHUP))
+    {
+        return pendingIO;
+    }
+    if (epollEvents & EPOLLIN)
+    {
+        res.Set(SocketEventFlags::kRead);
+    }
+    if (epollEvents & EPOLLOUT)
+    {
+        res.Set(SocketEventFlags::kWrite);
+    }
+
+    return res & pendingIO;
+}
+
+CHIP_ERROR LayerImplEpoll::UpdateEpollRegistration(SocketWatch & watch)
+{
+    VerifyOrReturnError(watch.mFD >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    uint32_t events = (watch.mPendingIO.Has(SocketEventFlags::kRead) ? EPOLLIN : 0u) |
+        (watch.mPendingIO.Has(SocketEventFlags::kWrite) ? EPOLLOUT : 0u);
+    if (events != 0)
+    {
+        events |= kEpollTriggerMode;
+    }
+    VerifyOrReturnError(events != watch.mRegisteredEvents, CHIP_NO_ERROR);
+
+    // Sockets nobody waits on are taken out of epoll altogether, since errors and hang-ups are always reported.
+    int op = EPOLL_CTL_MOD;
+    if (watch.mRegisteredEvents == 0)
+    {
+        op = EPOLL_CTL_ADD;
+    }
+    else if (events == 0)
+    {
+        op = EPOLL_CTL_DEL;
+    }
+
+    struct epoll_event event;
+    event.events   = events;
+    event.data.u64 = SocketWatchKey(static_cast<size_t>(&watch - mSocketWatchPool), watch.mFD);
+    VerifyOrReturnError(epoll_ctl(mEpollFd, op, watch.mFD, &event) == 0, CHIP_ERROR_POSIX(errno));
+
+    watch.mRegisteredEvents = events;
+    return CHIP_NO_ERROR;
+}
+
+void LayerImplEpoll::PrepareEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    mEpollTimeout = -1;
+
+#if CHIP_SYSTEM_CONFIG_EPOLL_EDGE_TRIGGERED
+    if (mReadyList != nullptr)
+    {
+        // Some sockets may still have pending I/O the kernel will not report again.
+        mEpollTimeout = 0;
+        return;
+    }
+#endif // CHIP_SYSTEM_CONFIG_EPOLL_EDGE_TRIGGERED
+
+    TimerList::Node * timer = mTimerList.Earliest();
+    if (timer == nullptr)
+    {
+        // A timerfd that is still armed for a cancelled timer merely causes a spurious wake-up.
+        return;
+    }
+
+    const Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+    if (timer->AwakenTime() <= currentTime)
+    {
+        mEpollTimeout = 0;
+        return;
+    }
+
+    ArmTimerFd(timer->AwakenTime(), currentTime);
+}
+
+void LayerImplEpoll::ArmTimerFd(Clock::Timestamp awakenTime, Clock::Timestamp currentTime)
+{
+    VerifyOrReturn(awakenTime != mTimerFdAwakenTime);
+
+    const Clock::Milliseconds64 sleepTime = awakenTime - currentTime;
+    struct itimerspec spec                = {};
+    spec.it_value.tv_sec                  = static_cast<time_t>(sleepTime.count() / 1000);
+    spec.it_value.tv_nsec                 = static_cast<long>((sleepTime.count() % 1000) * 1000000);
+
+    if (timerfd_settime(mTimerFd, 0, &spec, nullptr) != 0)
+    {
+        ChipLogError(chipSystemLayer, "timerfd_settime failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+        // Fall back on the (millisecond granularity) timeout of epoll_wait().
+        mTimerFdAwakenTime = Clock::kZero;
+        mEpollTimeout      = static_cast<int>(std::min<uint64_t>(sleepTime.count(), INT32_MAX));
+        return;
+    }
+    mTimerFdAwakenTime = awakenTime;
+}
+
+void LayerImplEpoll::WaitForEvents()
+{
+    mEpollResult = epoll_wait(mEpollFd, mEpollEvents, CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS, mEpollTimeout);
+}
+
+void LayerImplEpoll::HandleEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    if (!IsEpollResultValid())
+    {
+        if (errno != EINTR)
+        {
+            ChipLogError(DeviceLayer, "epoll_wait failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+        }
+        return;
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleEventsThread = pthread_self();
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    // Obtain the list of currently expired timers. Any new timers added by timer callback are NOT handled on this pass,
+    // since that could result in infinite handling of new timers blocking any other progress.
+    VerifyOrDieWithMsg(mExpiredTimers.Empty(), DeviceLayer, "Re-entry into HandleEvents from a timer callback?");
+    mExpiredTimers          = mTimerList.ExtractEarlier(Clock::Timeout(1) + SystemClock().GetMonotonicTimestamp());
+    TimerList::Node * timer = nullptr;
+    while ((timer = mExpiredTimers.PopEarliest()) != nullptr)
+    {
+        mTimerPool.Invoke(timer);
+    }
+
+    for (int i = 0; i < mEpollResult; i++)
+    {
+        const uint64_t key = mEpollEvents[i].data.u64;
+        if (key == kTimerFdKey)
+        {
+            // The timer list was processed above, only acknowledge the expiration.
+            uint64_t expirations;
+            (void) read(mTimerFd, &expirations, sizeof(expirations));
+            mTimerFdAwakenTime = Clock::kZero;
+            continue;
+        }
+
+        // Skip events for watches that an earlier callback stopped.
+        const size_t index = static_cast<size_t>(key >> 32);
+        const int fd       = static_cast<int>(key & UINT32_MAX);
+        if (index >= ArraySize(mSocketWatchPool) || mSocketWatchPool[index].mFD != fd)
+        {
+            continue;
+        }
+
+        SocketWatch & w     = mSocketWatchPool[index];
+        SocketEvents events = SocketEventsFromEpoll(mEpollEvents[i].events, w.mPendingIO);
+#if CHIP_SYSTEM_CONFIG_EPOLL_EDGE_TRIGGERED
+        if (events.HasAny())
+        {
+            w.mReadyIO.Set(events);
+            AddToReadyList(w);
+        }
+#else
+        if (events.HasAny() && w.mCallback != nullptr)
+        {
+            w.mCallback(events, w.mCallbackData);
+        }
+#endif // CHIP_SYSTEM_CONFIG_EPOLL_EDGE_TRIGGERED
+    }
+
+#if CHIP_SYSTEM_CONFIG_EPOLL_EDGE_TRIGGERED
+    HandleReadySocketWatches();
+#endif // CHIP_SYSTEM_CONFIG_EPOLL_EDGE_TRIGGERED
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleEventsThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+}
+
+void LayerImplEpoll::AddToReadyList(SocketWatch & watch)
+{
+    VerifyOrReturn(!watch.mInReadyList);
+    watch.mNextReady   = mReadyList;
+    watch.mInReadyList = true;
+    mReadyList         = &watch;
+}
+
+/**
+ *  Invoke the callbacks of the sockets on the ready list.
+ *
+ *  With edge-triggered notifications the kernel only reports a socket again once new data arrives, but callbacks
+ *  typically consume a single datagram or buffer. So after each callback the socket is polled, and it stays on the
+ *  ready list, making the next epoll_wait() return immediately, for as long as it has I/O pending.
+ */
+void LayerImplEpoll::HandleReadySocketWatches()
+{
+    SocketWatch * list = mReadyList;
+    mReadyList         = nullptr;
+
+    while (list != nullptr)
+    {
+        SocketWatch & w = *list;
+        list            = w.mNextReady;
+        w.mNextReady    = nullptr;
+        w.mInReadyList  = false;
+
+        SocketEvents events = w.mReadyIO & w.mPendingIO;
+        w.mReadyIO.ClearAll();
+        if (w.mFD == kInvalidFd || !events.HasAny())
+        {
+            continue;
+        }
+
+        if (w.mCallback != nullptr)
+        {
+            w.mCallback(events, w.mCallbackData);
+        }
+
+        // The callback may have stopped watching the socket, or stopped waiting for the events.
+        if (w.mFD == kInvalidFd || !w.mPendingIO.HasAny())
+        {
+            continue;
+        }
+
+        struct pollfd pfd;
+        pfd.fd     = w.mFD;
+        pfd.events = static_cast<short>((w.mPendingIO.Has(SocketEventFlags::kRead) ? POLLIN : 0) |
+                                        (w.mPendingIO.Has(SocketEventFlags::kWrite) ? POLLOUT : 0));
+        if (poll(&pfd, 1, 0) == 1)
+        {
+            uint32_t stillReady = ((pfd.revents & POLLIN) ? EPOLLIN : 0u) | ((pfd.revents & POLLOUT) ? EPOLLOUT : 0u) |
+                ((pfd.revents & POLLERR) ? EPOLLERR : 0u) | ((pfd.revents & POLLHUP) ? EPOLLHUP : 0u);
+            w.mReadyIO = SocketEventsFromEpoll(stillReady, w.mPendingIO);
+            if (w.mReadyIO.HasAny())
+            {
+                AddToReadyList(w);
+            }
+        }
+    }
+}
+
+void LayerImplEpoll::SocketWatch::Clear()
+{
+    // The ready list links are left alone, since the watch may be cleared while the list is being walked.
+    mFD = kInvalidFd;
+    mPendingIO.ClearAll();
+    mReadyIO.ClearAll();
+    mRegisteredEvents = 0;
+    mCallback         = nullptr;
+    mCallbackData     = 0;
+}
+
+} // namespace System
+} // namespace chip
@@ -0,0 +1,157 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares an implementation of System::Layer using epoll(7) and a timerfd.
+ */
+
+#pragma once
+
+#include "system/SystemConfig.h"
+
+#if CHIP_SYSTEM_CONFIG_USE_LIBEV || CHIP_SYSTEM_CONFIG_USE_DISPATCH
+#error "The epoll based System::Layer does not support CHIP_SYSTEM_CONFIG_USE_LIBEV or CHIP_SYSTEM_CONFIG_USE_DISPATCH"
+#endif
+
+#include <sys/epoll.h>
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#include <atomic>
+#include <pthread.h>
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+#include <lib/support/ObjectLifeCycle.h>
+#include <system/SystemLayer.h>
+#include <system/SystemTimer.h>
+#include <system/WakeEvent.h>
+
+namespace chip {
+namespace System {
+
+/**
+ * System::Layer event loop built on epoll.
+ *
+ * Unlike LayerImplSelect, the watched sockets stay registered with the kernel between loop iterations, so that
+ * preparing and handling events costs in proportion to the sockets that are ready rather than to all the watched
+ * ones, and file descriptors are not limited by FD_SETSIZE. Timers are kept in the same TimerList as the select
+ * loop; the earliest one arms a timerfd, which gives epoll_wait() sub-millisecond wake-ups.
+ *
+ * With CHIP_SYSTEM_CONFIG_EPOLL_EDGE_TRIGGERED, sockets are registered edge-triggered and the layer keeps its own
+ * list of sockets that are still ready after their callback ran, since SocketWatch callbacks are not required to
+ * drain their socket.
+ */
+class LayerImplEpoll : public LayerSocketsLoop
+{
+public:
+    LayerImplEpoll() = default;
+    ~LayerImplEpoll() override { VerifyOrDie(mLayerState.Destroy()); }
+
+    // Layer overrides.
+    CHIP_ERROR Init() override;
+    void Shutdown() override;
+    bool IsInitialized() const override { return mLayerState.IsInitialized(); }
+    CHIP_ERROR StartTimer(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState) override;
+    CHIP_ERROR ExtendTimerTo(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState) override;
+    bool IsTimerActive(TimerCompleteCallback onComplete, void * appState) override;
+    Clock::Timeout GetRemainingTime(TimerCompleteCallback onComplete, void * appState) override;
+    void CancelTimer(TimerCompleteCallback onComplete, void * appState) override;
+    CHIP_ERROR ScheduleWork(TimerCompleteCallback onComplete, void * appState) override;
+
+    // LayerSocket overrides.
+    CHIP_ERROR StartWatchingSocket(int fd, SocketWatchToken * tokenOut) override;
+    CHIP_ERROR SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data) override;
+    CHIP_ERROR RequestCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR RequestCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR StopWatchingSocket(SocketWatchToken * tokenInOut) override;
+    SocketWatchToken InvalidSocketWatchToken() override { return reinterpret_cast<SocketWatchToken>(nullptr); }
+
+    // LayerSocketLoop overrides.
+    void Signal() override;
+    void EventLoopBegins() override {}
+    void PrepareEvents() override;
+    void WaitForEvents() override;
+    void HandleEvents() override;
+    void EventLoopEnds() override {}
+
+    // Expose the result of WaitForEvents() for non-blocking socket implementations.
+    bool IsEpollResultValid() const { return mEpollResult >= 0; }
+
+protected:
+    static constexpr int kSocketWatchMax = (INET_CONFIG_ENABLE_TCP_ENDPOINT ? INET_CONFIG_NUM_TCP_ENDPOINTS : 0) +
+        (INET_CONFIG_ENABLE_UDP_ENDPOINT ? INET_CONFIG_NUM_UDP_ENDPOINTS : 0);
+
+    struct SocketWatch
+    {
+        void Clear();
+        int mFD;
+        SocketEvents mPendingIO;
+        SocketWatchCallback mCallback;
+        intptr_t mCallbackData;
+
+        // Events the kernel was last told about, to skip redundant epoll_ctl() calls.
+        uint32_t mRegisteredEvents;
+
+        // Edge-triggered mode only: events reported but not yet handed to the callback, and the link in the ready list.
+        SocketEvents mReadyIO;
+        SocketWatch * mNextReady;
+        bool mInReadyList;
+    };
+
+    static SocketEvents SocketEventsFromEpoll(uint32_t epollEvents, SocketEvents pendingIO);
+    CHIP_ERROR UpdateEpollRegistration(SocketWatch & watch);
+    void HandleReadySocketWatches();
+    void AddToReadyList(SocketWatch & watch);
+    void ArmTimerFd(Clock::Timestamp awakenTime, Clock::Timestamp currentTime);
+
+    SocketWatch mSocketWatchPool[kSocketWatchMax];
+    // Edge-triggered mode only: sockets which may still have pending I/O.
+    SocketWatch * mReadyList = nullptr;
+
+    TimerPool<TimerList::Node> mTimerPool;
+    TimerList mTimerList;
+    // List of expired timers being processed right now.  Stored in a member so
+    // we can cancel them.
+    TimerList mExpiredTimers;
+
+    int mEpollFd = -1;
+    int mTimerFd = -1;
+    // Awaken time the timerfd is armed for, or Clock::kZero if it is disarmed.
+    Clock::Timestamp mTimerFdAwakenTime = Clock::kZero;
+    // Timeout for the next epoll_wait(), in milliseconds.
+    int mEpollTimeout = -1;
+
+    // Events returned by epoll_wait(), carried between WaitForEvents() and HandleEvents().
+    struct epoll_event mEpollEvents[CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS];
+    int mEpollResult = 0;
+
+    ObjectLifeCycle mLayerState;
+    WakeEvent mWakeEvent;
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    std::atomic<pthread_t> mHandleEventsThread;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+};
+
+#if CHIP_SYSTEM_CONFIG_USE_EPOLL
+using LayerImpl = LayerImplEpoll;
+#endif // CHIP_SYSTEM_CONFIG_USE_EPOLL
+
+} // namespace System
+} // namespace chip
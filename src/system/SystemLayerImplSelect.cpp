@@ -243,13 +243,7 @@ bool LayerImplSelect::IsTimerActive(TimerCompleteCallback onComplete, void * app
     if (!timerIsActive)
     {
         // check if the timer is in the mExpiredTimers list about to be fired.
-        for (TimerList::Node * timer = mExpiredTimers.Earliest(); timer != nullptr; timer = timer->mNextTimer)
-        {
-            if (timer->GetCallback().GetOnComplete() == onComplete && timer->GetCallback().GetAppState() == appState)
-            {
-                return true;
-            }
-        }
+        timerIsActive = (mExpiredTimers.Find(onComplete, appState) != nullptr);
     }
 
     return timerIsActive;
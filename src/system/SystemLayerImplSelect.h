@@ -164,7 +164,9 @@ protected:
 #endif
 };
 
+#if !CHIP_SYSTEM_CONFIG_USE_EPOLL
 using LayerImpl = LayerImplSelect;
+#endif // !CHIP_SYSTEM_CONFIG_USE_EPOLL
 
 } // namespace System
 } // namespace chip
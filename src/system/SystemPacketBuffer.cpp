@@ -68,6 +68,131 @@ namespace System {
 
 PacketBuffer::BufferPoolElement PacketBuffer::sBufferPool[CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE];
 
+#if CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
+
+static_assert(CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE > 0 && CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE > 0,
+              "Each PacketBuffer size class needs at least one buffer");
+
+PacketBuffer::SizedPoolElement<CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY>
+    PacketBuffer::sSmallBufferPool[CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE];
+PacketBuffer::SizedPoolElement<CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_CAPACITY>
+    PacketBuffer::sMediumBufferPool[CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE];
+
+namespace {
+std::atomic<uint32_t> sSmallBufferLinks[CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE];
+std::atomic<uint32_t> sMediumBufferLinks[CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE];
+std::atomic<uint32_t> sBufferLinks[CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE];
+} // namespace
+
+// clang-format off
+PacketBufferSizeClass PacketBuffer::sSizeClasses[PacketBuffer::kNumSizeClasses] = {
+    { 0, sSmallBufferPool[0].Block, sSmallBufferLinks, sizeof(sSmallBufferPool[0]),
+      CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE, CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY },
+    { 1, sMediumBufferPool[0].Block, sMediumBufferLinks, sizeof(sMediumBufferPool[0]),
+      CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE, CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_CAPACITY },
+    { 2, sBufferPool[0].Block, sBufferLinks, sizeof(sBufferPool[0]),
+      CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE, PacketBuffer::kMaxSizeWithoutReserve },
+};
+// clang-format on
+
+PacketBuffer * PacketBuffer::AllocateFromSizeClass(size_t aAllocSize, size_t aMaxCapacity)
+{
+    // Take the smallest buffer that fits, falling back to larger size classes when a size class is exhausted.
+    for (auto & sizeClass : sSizeClasses)
+    {
+        if (sizeClass.Capacity() < aAllocSize)
+        {
+            continue;
+        }
+        if (sizeClass.Capacity() > aMaxCapacity)
+        {
+            break;
+        }
+        void * block = sizeClass.Allocate();
+        if (block != nullptr)
+        {
+            PacketBuffer * lPacket = static_cast<PacketBuffer *>(static_cast<pbuf *>(block));
+            lPacket->alloc_size    = sizeClass.Capacity();
+            return lPacket;
+        }
+    }
+    return nullptr;
+}
+
+void PacketBuffer::ReleaseToSizeClass(PacketBuffer * aPacket)
+{
+    for (auto & sizeClass : sSizeClasses)
+    {
+        if (sizeClass.Contains(aPacket))
+        {
+            sizeClass.Release(aPacket);
+            return;
+        }
+    }
+    VerifyOrDieWithMsg(false, chipSystemLayer, "packet buffer not from a pool");
+}
+
+void PacketBufferHandle::InternalRightSize()
+{
+    // Require a single buffer with no other references.
+    if ((mBuffer == nullptr) || mBuffer->HasChainedBuffer() || (mBuffer->ref != 1))
+    {
+        return;
+    }
+
+    // Move to a buffer of a smaller size class, if one fits and is free.
+    const uint8_t * const start   = mBuffer->ReserveStart();
+    const uint8_t * const payload = mBuffer->Start();
+    const uint16_t usedSize       = static_cast<uint16_t>(payload - start + mBuffer->len);
+    PacketBuffer * newBuffer      = PacketBuffer::AllocateFromSizeClass(usedSize, mBuffer->alloc_size - 1u);
+    if (newBuffer == nullptr)
+    {
+        return;
+    }
+
+    uint8_t * const newStart = newBuffer->ReserveStart();
+    newBuffer->next          = nullptr;
+    newBuffer->payload       = newStart + (payload - start);
+    newBuffer->tot_len       = mBuffer->tot_len;
+    newBuffer->len           = mBuffer->len;
+    newBuffer->ref           = 1;
+    memcpy(newStart, start, usedSize);
+
+    PacketBuffer::Free(mBuffer);
+    mBuffer = newBuffer;
+}
+
+namespace Stats {
+
+void UpdatePacketBufferPoolCounts()
+{
+    static_assert(kSystemLayer_NumMediumPacketBufs == kSystemLayer_NumSmallPacketBufs + 1 &&
+                      kSystemLayer_NumLargePacketBufs == kSystemLayer_NumSmallPacketBufs + 2,
+                  "Packet buffer size class statistics must be consecutive");
+    static_assert(PacketBuffer::kNumSizeClasses == 3, "Unexpected number of packet buffer size classes");
+
+    auto toCount = [](uint32_t value) { return static_cast<count_t>(std::min<uint32_t>(value, CHIP_SYS_STATS_COUNT_MAX)); };
+
+    uint32_t total = 0;
+    for (size_t i = 0; i < ArraySize(PacketBuffer::sSizeClasses); i++)
+    {
+        const PacketBufferSizeClass & sizeClass                 = PacketBuffer::sSizeClasses[i];
+        GetResourcesInUse()[kSystemLayer_NumSmallPacketBufs + i] = toCount(sizeClass.InUse());
+        GetHighWatermarks()[kSystemLayer_NumSmallPacketBufs + i] = toCount(sizeClass.HighWatermark());
+        total += sizeClass.InUse();
+    }
+
+    GetResourcesInUse()[kSystemLayer_NumPacketBufs] = toCount(total);
+    if (GetHighWatermarks()[kSystemLayer_NumPacketBufs] < toCount(total))
+    {
+        GetHighWatermarks()[kSystemLayer_NumPacketBufs] = toCount(total);
+    }
+}
+
+} // namespace Stats
+
+#else // CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
+
 PacketBuffer * PacketBuffer::sFreeList = PacketBuffer::BuildFreeList();
 
 #if !CHIP_SYSTEM_CONFIG_NO_LOCKING
@@ -104,6 +229,8 @@ PacketBuffer * PacketBuffer::BuildFreeList()
     return static_cast<PacketBuffer *>(lHead);
 }
 
+#endif // CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
+
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
 //
 // Heap allocation for PacketBuffer objects.
@@ -461,6 +588,10 @@ void PacketBuffer::AddRef()
 {
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
     pbuf_ref(this);
+#elif CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
+    decltype(this->ref) previous = __atomic_fetch_add(&this->ref, 1, __ATOMIC_RELAXED);
+    VerifyOrDieWithMsg(previous < std::numeric_limits<decltype(this->ref)>::max(), chipSystemLayer,
+                       "packet buffer refcount overflow");
 #else  // !CHIP_SYSTEM_CONFIG_USE_LWIP
     LOCK_BUF_POOL();
     VerifyOrDieWithMsg(this->ref < std::numeric_limits<decltype(this->ref)>::max(), chipSystemLayer,
@@ -501,6 +632,11 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
 
     SYSTEM_STATS_UPDATE_LWIP_PBUF_COUNTS();
 
+#elif CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
+
+    static_cast<void>(lBlockSize);
+    lPacket = PacketBuffer::AllocateFromSizeClass(lAllocSize, PacketBuffer::kMaxSizeWithoutReserve);
+
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
 
     static_cast<void>(lBlockSize);
@@ -586,6 +722,24 @@ void PacketBuffer::Free(PacketBuffer * aPacket)
         SYSTEM_STATS_UPDATE_LWIP_PBUF_COUNTS();
     }
 
+#elif CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
+
+    while (aPacket != nullptr)
+    {
+        PacketBuffer * lNextPacket = aPacket->ChainedBuffer();
+
+        decltype(aPacket->ref) previous = __atomic_fetch_sub(&aPacket->ref, 1, __ATOMIC_ACQ_REL);
+        VerifyOrDieWithMsg(previous > 0, chipSystemLayer, "SystemPacketBuffer::Free: aPacket->ref = 0");
+        if (previous != 1)
+        {
+            break;
+        }
+
+        aPacket->Clear();
+        ReleaseToSizeClass(aPacket);
+        aPacket = lNextPacket;
+    }
+
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP || CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
 
     LOCK_BUF_POOL();
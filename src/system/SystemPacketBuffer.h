@@ -34,6 +34,8 @@
 #include <lib/support/DLLUtil.h>
 #include <system/SystemAlignSize.h>
 #include <system/SystemError.h>
+#include <system/SystemPacketBufferPool.h>
+#include <system/SystemStats.h>
 
 #include <stddef.h>
 #include <utility>
@@ -59,7 +61,7 @@ struct pbuf
     uint16_t tot_len;
     uint16_t len;
     uint16_t ref;
-#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP || CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
     uint16_t alloc_size;
 #endif
 };
@@ -85,7 +87,9 @@ struct pbuf
  *
  *      New objects of PacketBuffer class are initialized at the beginning of an allocation of memory obtained from the underlying
  *      environment, e.g. from LwIP pbuf target pools, from the standard C library heap, from an internal buffer pool. In the
- *      simple pool case, the size of the data buffer is PacketBuffer::kBlockSize.
+ *      simple pool case, the size of the data buffer is PacketBuffer::kBlockSize. With
+ *      CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_LOCK_FREE, the internal pool has several size classes, and a buffer is taken from
+ *      the smallest one that fits the request.
  *
  *      PacketBuffer objects may be chained to accommodate larger payloads.  Chaining, however, is not transparent, and users of the
  *      class must explicitly decide to support chaining.  Examples of classes written with chaining support are as follows:
@@ -150,10 +154,10 @@ public:
      */
     uint16_t AllocSize() const
     {
-#if CHIP_SYSTEM_PACKETBUFFER_FROM_LWIP_STANDARD_POOL || CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
-        return kMaxSizeWithoutReserve;
-#elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP || CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
         return this->alloc_size;
+#elif CHIP_SYSTEM_PACKETBUFFER_FROM_LWIP_STANDARD_POOL || CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
+        return kMaxSizeWithoutReserve;
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_LWIP_CUSTOM_POOL
         // Temporary workaround for custom pbufs by assuming size to be PBUF_POOL_BUFSIZE
         if (this->flags & PBUF_FLAG_IS_CUSTOM)
@@ -365,8 +369,27 @@ private:
         uint8_t Block[PacketBuffer::kBlockSize];
     } BufferPoolElement;
     static BufferPoolElement sBufferPool[CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE];
+#if CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
+    template <uint16_t kCapacity>
+    union SizedPoolElement
+    {
+        pbuf Header;
+        uint8_t Block[PacketBuffer::kStructureSize + kCapacity];
+    };
+    static SizedPoolElement<CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY>
+        sSmallBufferPool[CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE];
+    static SizedPoolElement<CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_CAPACITY>
+        sMediumBufferPool[CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE];
+    // Size classes in increasing order of capacity; the last one is sBufferPool.
+    static constexpr size_t kNumSizeClasses = 3;
+    static PacketBufferSizeClass sSizeClasses[kNumSizeClasses];
+    static PacketBuffer * AllocateFromSizeClass(size_t aAllocSize, size_t aMaxCapacity);
+    static void ReleaseToSizeClass(PacketBuffer * aPacket);
+    friend void Stats::UpdatePacketBufferPoolCounts();
+#else
     static PacketBuffer * sFreeList;
     static PacketBuffer * BuildFreeList();
+#endif // CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
 #endif // CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL || defined(DOXYGEN)
 
 #if CHIP_SYSTEM_PACKETBUFFER_HAS_CHECK
@@ -53,6 +53,17 @@
 #define CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL 0
 #endif
 
+/**
+ * CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
+ *
+ * True if packet buffers are allocated in the SDK from size-classed pools with lock-free free lists.
+ */
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL && CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_LOCK_FREE
+#define CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL 1
+#else
+#define CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL 0
+#endif
+
 /**
  * CHIP_SYSTEM_PACKETBUFFER_FROM_LWIP_POOL
  *
@@ -104,7 +115,8 @@
  *
  * True if RightSize() has a nontrivial implementation.
  */
-#if CHIP_SYSTEM_PACKETBUFFER_FROM_LWIP_CUSTOM_POOL || CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_LWIP_CUSTOM_POOL || CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP ||                                   \
+    CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
 #define CHIP_SYSTEM_PACKETBUFFER_HAS_RIGHTSIZE 1
 #else
 #define CHIP_SYSTEM_PACKETBUFFER_HAS_RIGHTSIZE 0
@@ -132,6 +144,12 @@
 #error "Inconsistent PacketBuffer LwIP pool configuration"
 #endif
 
+#if CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL &&                                                                                     \
+    !(CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY < CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_CAPACITY &&                          \
+      CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_CAPACITY < CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX)
+#error "PacketBuffer size classes must be smaller than CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX, in increasing order"
+#endif
+
 #if (CHIP_SYSTEM_PACKETBUFFER_FROM_LWIP_POOL + CHIP_SYSTEM_CONFIG_PACKETBUFFER_LWIP_PBUF_RAM) > 1
 #error "Inconsistent PacketBuffer LwIP pbuf_type configuration"
 #endif
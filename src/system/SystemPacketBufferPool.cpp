@@ -0,0 +1,146 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the free lists behind CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_LOCK_FREE.
+ */
+
+#include <system/SystemPacketBufferPool.h>
+
+#if CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
+
+#include <lib/support/CodeUtils.h>
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_LOCK_FREE needs 64-bit atomics");
+
+namespace chip {
+namespace System {
+
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE > 0
+
+struct PacketBufferThreadCache
+{
+    ~PacketBufferThreadCache()
+    {
+        for (uint8_t id = 0; id < PacketBufferSizeClass::kMaxSizeClasses; id++)
+        {
+            while (mCount[id] > 0)
+            {
+                mSizeClass[id]->Push(mBlocks[id][--mCount[id]]);
+            }
+        }
+    }
+
+    PacketBufferSizeClass * mSizeClass[PacketBufferSizeClass::kMaxSizeClasses] = {};
+    uint32_t mCount[PacketBufferSizeClass::kMaxSizeClasses]                    = {};
+    uint32_t mBlocks[PacketBufferSizeClass::kMaxSizeClasses][CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE];
+};
+
+namespace {
+thread_local PacketBufferThreadCache sThreadCache;
+} // namespace
+
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE > 0
+
+void * PacketBufferSizeClass::Allocate()
+{
+    VerifyOrDie(mId < kMaxSizeClasses);
+
+    uint32_t index = 0;
+    bool found     = false;
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE > 0
+    PacketBufferThreadCache & cache = sThreadCache;
+    if (cache.mCount[mId] > 0)
+    {
+        index = cache.mBlocks[mId][--cache.mCount[mId]];
+        found = true;
+    }
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE > 0
+    VerifyOrReturnValue(found || Pop(index), nullptr);
+
+    uint32_t inUse         = mInUse.fetch_add(1, std::memory_order_relaxed) + 1;
+    uint32_t highWatermark = mHighWatermark.load(std::memory_order_relaxed);
+    while (highWatermark < inUse && !mHighWatermark.compare_exchange_weak(highWatermark, inUse, std::memory_order_relaxed))
+    {
+    }
+
+    return Block(index);
+}
+
+void PacketBufferSizeClass::Release(void * block)
+{
+    VerifyOrDie(Contains(block));
+    uint32_t index = IndexOf(block);
+
+    mInUse.fetch_sub(1, std::memory_order_relaxed);
+
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE > 0
+    PacketBufferThreadCache & cache = sThreadCache;
+    if (cache.mCount[mId] < CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE)
+    {
+        cache.mSizeClass[mId]                   = this;
+        cache.mBlocks[mId][cache.mCount[mId]++] = index;
+        return;
+    }
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE > 0
+
+    Push(index);
+}
+
+bool PacketBufferSizeClass::Pop(uint32_t & index)
+{
+    uint64_t head = mHead.load(std::memory_order_acquire);
+    while ((head & kIndexMask) != 0)
+    {
+        uint32_t top  = static_cast<uint32_t>(head & kIndexMask) - 1;
+        uint64_t next = ((head & ~kIndexMask) + kCountOffset) | mLinks[top].load(std::memory_order_relaxed);
+        if (mHead.compare_exchange_weak(head, next, std::memory_order_acquire, std::memory_order_acquire))
+        {
+            index = top;
+            return true;
+        }
+    }
+
+    uint32_t neverAllocated = mNeverAllocated.load(std::memory_order_relaxed);
+    while (neverAllocated < mBlockCount)
+    {
+        if (mNeverAllocated.compare_exchange_weak(neverAllocated, neverAllocated + 1, std::memory_order_relaxed))
+        {
+            index = neverAllocated;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void PacketBufferSizeClass::Push(uint32_t index)
+{
+    uint64_t head = mHead.load(std::memory_order_relaxed);
+    uint64_t next;
+    do
+    {
+        mLinks[index].store(static_cast<uint32_t>(head & kIndexMask), std::memory_order_relaxed);
+        next = ((head & ~kIndexMask) + kCountOffset) | (index + 1);
+    } while (!mHead.compare_exchange_weak(head, next, std::memory_order_release, std::memory_order_relaxed));
+}
+
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
@@ -0,0 +1,119 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares the free lists behind CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_LOCK_FREE.
+ *      It is not part of the public PacketBuffer interface.
+ */
+
+#pragma once
+
+#include <system/SystemPacketBufferInternal.h>
+
+#if CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace System {
+
+/**
+ * A fixed set of equally sized memory blocks, handed out by a lock-free free list.
+ *
+ * Free blocks are kept on a stack of block indices whose head carries a modification count, so that a thread which is
+ * preempted in the middle of a pop cannot corrupt the stack when the same block is freed and reused meanwhile. Blocks
+ * that have never been allocated are handed out in order before the stack is used, so that the free list needs no
+ * initialization and the pool can be constant-initialized.
+ *
+ * In addition, each thread keeps up to CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE free blocks of each size
+ * class, so that a thread which repeatedly frees and allocates buffers does not touch the shared stack at all. A thread's
+ * cached blocks are returned to the shared stack when the thread exits.
+ */
+class PacketBufferSizeClass
+{
+public:
+    static constexpr uint8_t kMaxSizeClasses = 4;
+
+    constexpr PacketBufferSizeClass(uint8_t id, uint8_t * blocks, std::atomic<uint32_t> * links, size_t blockSize,
+                                    uint32_t blockCount, uint16_t capacity) :
+        mBlocks(blocks), mLinks(links), mBlockSize(blockSize), mBlockCount(blockCount), mCapacity(capacity), mId(id)
+    {}
+
+    /**
+     * Take a free block, or return nullptr if there is none.
+     */
+    void * Allocate();
+
+    /**
+     * Return a block obtained from Allocate().
+     */
+    void Release(void * block);
+
+    /**
+     * Test whether @a block belongs to this size class.
+     */
+    bool Contains(const void * block) const
+    {
+        const uint8_t * address = static_cast<const uint8_t *>(block);
+        return mBlocks <= address && address < mBlocks + mBlockSize * mBlockCount;
+    }
+
+    /**
+     * The capacity of each buffer of this size class, not including the PacketBuffer structure.
+     */
+    uint16_t Capacity() const { return mCapacity; }
+
+    uint32_t BlockCount() const { return mBlockCount; }
+    uint32_t InUse() const { return mInUse.load(std::memory_order_relaxed); }
+    uint32_t HighWatermark() const { return mHighWatermark.load(std::memory_order_relaxed); }
+
+private:
+    friend struct PacketBufferThreadCache;
+
+    // The stack head packs the index of the top block plus one (so that zero means empty) in its low 32 bits, and a
+    // modification count in its high 32 bits.
+    static constexpr uint64_t kIndexMask   = 0xFFFFFFFFu;
+    static constexpr uint64_t kCountOffset = uint64_t(1) << 32;
+
+    bool Pop(uint32_t & index);
+    void Push(uint32_t index);
+    void * Block(uint32_t index) const { return mBlocks + mBlockSize * index; }
+    uint32_t IndexOf(const void * block) const
+    {
+        return static_cast<uint32_t>((static_cast<const uint8_t *>(block) - mBlocks) / mBlockSize);
+    }
+
+    uint8_t * const mBlocks;
+    std::atomic<uint32_t> * const mLinks;
+    const size_t mBlockSize;
+    const uint32_t mBlockCount;
+    const uint16_t mCapacity;
+    const uint8_t mId;
+
+    std::atomic<uint64_t> mHead{ 0 };
+    std::atomic<uint32_t> mNeverAllocated{ 0 };
+    std::atomic<uint32_t> mInUse{ 0 };
+    std::atomic<uint32_t> mHighWatermark{ 0 };
+};
+
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
@@ -44,6 +44,11 @@ static const Label sStatsStrings[chip::System::Stats::kNumEntries] = {
 #undef LWIP_PBUF_MEMPOOL
 #else
     "Packet Buffers",
+#endif
+#if CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
+    "Small packet buffers",
+    "Medium packet buffers",
+    "Large packet buffers",
 #endif
     "Timers",
 #if INET_CONFIG_NUM_TCP_ENDPOINTS
@@ -77,6 +82,8 @@ count_t * GetHighWatermarks()
 
 void UpdateSnapshot(Snapshot & aSnapshot)
 {
+    SYSTEM_STATS_UPDATE_PACKETBUFFER_POOL_COUNTS();
+
     memcpy(&aSnapshot.mResourcesInUse, &sResourcesInUse, sizeof(aSnapshot.mResourcesInUse));
     memcpy(&aSnapshot.mHighWatermarks, &sHighWatermarks, sizeof(aSnapshot.mHighWatermarks));
 
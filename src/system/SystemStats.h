@@ -27,6 +27,7 @@
 // Include configuration headers
 #include <inet/InetConfig.h>
 #include <lib/core/CHIPConfig.h>
+#include <system/SystemPacketBufferInternal.h>
 
 // Include dependent headers
 #include <lib/support/DLLUtil.h>
@@ -53,6 +54,11 @@ enum
 #undef LWIP_PBUF_MEMPOOL
 #else
     kSystemLayer_NumPacketBufs,
+#endif
+#if CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
+    kSystemLayer_NumSmallPacketBufs,
+    kSystemLayer_NumMediumPacketBufs,
+    kSystemLayer_NumLargePacketBufs,
 #endif
     kSystemLayer_NumTimers,
 #if INET_CONFIG_NUM_TCP_ENDPOINTS
@@ -89,6 +95,11 @@ count_t * GetHighWatermarks();
 void UpdateLwipPbufCounts(void);
 #endif
 
+#if CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
+// The lock-free packet buffer pool keeps its own atomic counts; this copies them into the statistics.
+void UpdatePacketBufferPoolCounts();
+#endif
+
 typedef const char * Label;
 const Label * GetStrings();
 
@@ -146,6 +157,16 @@ const Label * GetStrings();
 #define SYSTEM_STATS_UPDATE_LWIP_PBUF_COUNTS()
 #endif // CHIP_SYSTEM_CONFIG_USE_LWIP && LWIP_STATS && MEMP_STATS
 
+#if CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
+#define SYSTEM_STATS_UPDATE_PACKETBUFFER_POOL_COUNTS()                                                                             \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        chip::System::Stats::UpdatePacketBufferPoolCounts();                                                                       \
+    } while (0)
+#else // CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
+#define SYSTEM_STATS_UPDATE_PACKETBUFFER_POOL_COUNTS()
+#endif // CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
+
 // Additional macros for testing.
 #define SYSTEM_STATS_TEST_IN_USE(entry, expected) (chip::System::Stats::GetResourcesInUse()[entry] == (expected))
 #define SYSTEM_STATS_TEST_HIGH_WATER_MARK(entry, expected) (chip::System::Stats::GetHighWatermarks()[entry] == (expected))
@@ -167,6 +188,8 @@ const Label * GetStrings();
 
 #define SYSTEM_STATS_UPDATE_LWIP_PBUF_COUNTS()
 
+#define SYSTEM_STATS_UPDATE_PACKETBUFFER_POOL_COUNTS()
+
 #define SYSTEM_STATS_TEST_IN_USE(entry, expected) (true)
 #define SYSTEM_STATS_TEST_HIGH_WATER_MARK(entry, expected) (true)
 #define SYSTEM_STATS_RESET_HIGH_WATER_MARK_FOR_TESTING(entry)
@@ -33,149 +33,243 @@
 #include <system/SystemFaultInjection.h>
 #include <system/SystemLayer.h>
 
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 
 namespace chip {
 namespace System {
 
-TimerList::Node * TimerList::Add(TimerList::Node * add)
+namespace {
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+// Lists index their timers once they hold more than kMinIndexedTimers, and grow the index to keep the average bucket
+// length at two or less.
+constexpr size_t kMinIndexedTimers = 16;
+constexpr size_t kInitialIndexSize = 16;
+
+size_t HashTimer(TimerCompleteCallback onComplete, void * appState)
 {
-    VerifyOrDie(add != mEarliestTimer);
-    if (mEarliestTimer == nullptr || (add->AwakenTime() < mEarliestTimer->AwakenTime()))
-    {
-        add->mNextTimer = mEarliestTimer;
-        mEarliestTimer  = add;
-    }
-    else
+    uintptr_t hash = reinterpret_cast<uintptr_t>(appState) ^ (reinterpret_cast<uintptr_t>(onComplete) >> 2);
+    hash ^= hash >> 16;
+    hash *= 0x45d9f3b;
+    hash ^= hash >> 16;
+    return static_cast<size_t>(hash);
+}
+
+size_t HashTimer(const TimerList::Node * timer)
+{
+    return HashTimer(timer->GetCallback().GetOnComplete(), timer->GetCallback().GetAppState());
+}
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+} // namespace
+
+TimerList & TimerList::operator=(TimerList && other)
+{
+    if (this != &other)
     {
-        TimerList::Node * lTimer = mEarliestTimer;
-        while (lTimer->mNextTimer)
-        {
-            VerifyOrDie(lTimer->mNextTimer != add);
-            if (add->AwakenTime() < lTimer->mNextTimer->AwakenTime())
-            {
-                // found the insert location.
-                break;
-            }
-            lTimer = lTimer->mNextTimer;
-        }
-        add->mNextTimer    = lTimer->mNextTimer;
-        lTimer->mNextTimer = add;
+        ReleaseIndex();
+        mHeap         = std::move(other.mHeap);
+        mNextSequence = other.mNextSequence;
+        mCount        = other.mCount;
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        mIndex           = other.mIndex;
+        mIndexSize       = other.mIndexSize;
+        other.mIndex     = nullptr;
+        other.mIndexSize = 0;
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        other.mHeap.Clear();
+        other.mCount = 0;
     }
-    return mEarliestTimer;
+    return *this;
 }
 
-TimerList::Node * TimerList::Remove(TimerList::Node * remove)
+bool TimerList::IsEarlier(const Node * a, const Node * b)
 {
-    if (mEarliestTimer != nullptr && remove != nullptr)
+    if (a->AwakenTime() != b->AwakenTime())
     {
-        if (remove == mEarliestTimer)
-        {
-            mEarliestTimer = remove->mNextTimer;
-        }
-        else
-        {
-            TimerList::Node * lTimer = mEarliestTimer;
+        return a->AwakenTime() < b->AwakenTime();
+    }
+    // Sequence numbers may wrap; only their difference is meaningful.
+    return static_cast<int32_t>(a->mSequence - b->mSequence) < 0;
+}
 
-            while (lTimer->mNextTimer)
-            {
-                if (remove == lTimer->mNextTimer)
-                {
-                    lTimer->mNextTimer = remove->mNextTimer;
-                    break;
-                }
+TimerList::Node * TimerList::Add(TimerList::Node * add)
+{
+    VerifyOrDie(add != mHeap.Top());
+    add->mSequence = mNextSequence++;
 
-                lTimer = lTimer->mNextTimer;
-            }
-        }
+    mHeap.Push(*add);
+    mCount++;
+    IndexAdd(add);
+    return mHeap.Top();
+}
 
-        remove->mNextTimer = nullptr;
+TimerList::Node * TimerList::Remove(TimerList::Node * remove)
+{
+    if (remove != nullptr && mHeap.Contains(*remove))
+    {
+        mHeap.Remove(*remove);
+        mCount--;
+        IndexRemove(remove);
     }
-    return mEarliestTimer;
+    return mHeap.Top();
 }
 
 TimerList::Node * TimerList::Remove(TimerCompleteCallback aOnComplete, void * aAppState)
 {
-    TimerList::Node * previous = nullptr;
-    for (TimerList::Node * timer = mEarliestTimer; timer != nullptr; timer = timer->mNextTimer)
-    {
-        if (timer->GetCallback().GetOnComplete() == aOnComplete && timer->GetCallback().GetAppState() == aAppState)
-        {
-            if (previous == nullptr)
-            {
-                mEarliestTimer = timer->mNextTimer;
-            }
-            else
-            {
-                previous->mNextTimer = timer->mNextTimer;
-            }
-            timer->mNextTimer = nullptr;
-            return timer;
-        }
-        previous = timer;
-    }
-    return nullptr;
+    TimerList::Node * timer = Find(aOnComplete, aAppState);
+    (void) Remove(timer);
+    return timer;
 }
 
 TimerList::Node * TimerList::PopEarliest()
 {
-    if (mEarliestTimer == nullptr)
+    TimerList::Node * earliest = mHeap.Pop();
+    if (earliest == nullptr)
     {
         return nullptr;
     }
-    TimerList::Node * earliest = mEarliestTimer;
-    mEarliestTimer             = mEarliestTimer->mNextTimer;
-    earliest->mNextTimer       = nullptr;
+    mCount--;
+    IndexRemove(earliest);
     return earliest;
 }
 
 TimerList::Node * TimerList::PopIfEarlier(Clock::Timestamp t)
 {
-    if ((mEarliestTimer == nullptr) || !(mEarliestTimer->AwakenTime() < t))
+    if (mHeap.Empty() || !(mHeap.Top()->AwakenTime() < t))
     {
         return nullptr;
     }
-    TimerList::Node * earliest = mEarliestTimer;
-    mEarliestTimer             = mEarliestTimer->mNextTimer;
-    earliest->mNextTimer       = nullptr;
-    return earliest;
+    return PopEarliest();
 }
 
-TimerList TimerList::ExtractEarlier(Clock::Timestamp t)
+TimerList::Node * TimerList::Find(TimerCompleteCallback aOnComplete, void * aAppState) const
 {
-    TimerList out;
+    TimerList::Node * found = nullptr;
 
-    if ((mEarliestTimer != nullptr) && (mEarliestTimer->AwakenTime() < t))
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    if (mIndex != nullptr)
     {
-        out.mEarliestTimer    = mEarliestTimer;
-        TimerList::Node * end = mEarliestTimer;
-        while ((end->mNextTimer != nullptr) && (end->mNextTimer->AwakenTime() < t))
+        Node * bucket = mIndex[HashTimer(aOnComplete, aAppState) & (mIndexSize - 1)];
+        for (Node * timer = bucket; timer != nullptr; timer = timer->mNextInBucket)
         {
-            end = end->mNextTimer;
+            if (Matches(timer, aOnComplete, aAppState) && (found == nullptr || IsEarlier(timer, found)))
+            {
+                found = timer;
+            }
+        }
+        return found;
+    }
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+    for (Node * timer = mHeap.Top(); timer != nullptr; timer = mHeap.Next(timer))
+    {
+        if (Matches(timer, aOnComplete, aAppState) && (found == nullptr || IsEarlier(timer, found)))
+        {
+            found = timer;
         }
-        mEarliestTimer  = end->mNextTimer;
-        end->mNextTimer = nullptr;
+    }
+    return found;
+}
+
+TimerList TimerList::ExtractEarlier(Clock::Timestamp t)
+{
+    TimerList out;
+
+    TimerList::Node * timer;
+    while ((timer = PopIfEarlier(t)) != nullptr)
+    {
+        (void) out.Add(timer);
     }
 
     return out;
 }
 
+void TimerList::Clear()
+{
+    mHeap.Clear();
+    mCount = 0;
+    ReleaseIndex();
+}
+
 Clock::Timeout TimerList::GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState)
 {
-    for (TimerList::Node * timer = mEarliestTimer; timer != nullptr; timer = timer->mNextTimer)
+    TimerList::Node * timer = Find(aOnComplete, aAppState);
+    if (timer != nullptr)
     {
-        if (timer->GetCallback().GetOnComplete() == aOnComplete && timer->GetCallback().GetAppState() == aAppState)
+        Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+
+        if (currentTime < timer->AwakenTime())
         {
-            Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+            return Clock::Timeout(timer->AwakenTime() - currentTime);
+        }
+    }
+    return Clock::kZero;
+}
 
-            if (currentTime < timer->AwakenTime())
+void TimerList::IndexAdd(Node * timer)
+{
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    if ((mIndex == nullptr) ? (mCount > kMinIndexedTimers) : (mCount > 2 * mIndexSize))
+    {
+        // Rebuild the index at a larger size; this covers the new timer, which is already in the heap. If allocation
+        // fails, keep the current index (or none), which only costs lookup time.
+        size_t size = (mIndex == nullptr) ? kInitialIndexSize : 2 * mIndexSize;
+        auto index  = static_cast<Node **>(Platform::MemoryCalloc(size, sizeof(Node *)));
+        if (index != nullptr)
+        {
+            for (Node * node = mHeap.Top(); node != nullptr; node = mHeap.Next(node))
             {
-                return Clock::Timeout(timer->AwakenTime() - currentTime);
+                Node *& bucket      = index[HashTimer(node) & (size - 1)];
+                node->mNextInBucket = bucket;
+                bucket              = node;
             }
-            return Clock::kZero;
+            ReleaseIndex();
+            mIndex     = index;
+            mIndexSize = size;
+            return;
         }
     }
-    return Clock::kZero;
+
+    VerifyOrReturn(mIndex != nullptr);
+    Node *& bucket       = mIndex[HashTimer(timer) & (mIndexSize - 1)];
+    timer->mNextInBucket = bucket;
+    bucket               = timer;
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+}
+
+void TimerList::IndexRemove(Node * timer)
+{
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    VerifyOrReturn(mIndex != nullptr);
+    for (Node ** link = &mIndex[HashTimer(timer) & (mIndexSize - 1)]; *link != nullptr; link = &(*link)->mNextInBucket)
+    {
+        if (*link == timer)
+        {
+            *link = timer->mNextInBucket;
+            break;
+        }
+    }
+    timer->mNextInBucket = nullptr;
+
+    if (mCount == 0)
+    {
+        ReleaseIndex();
+    }
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+}
+
+void TimerList::ReleaseIndex()
+{
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    if (mIndex != nullptr)
+    {
+        Platform::MemoryFree(mIndex);
+        mIndex     = nullptr;
+        mIndexSize = 0;
+    }
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 }
 
 } // namespace System
@@ -29,6 +29,7 @@
 
 // Include dependent headers
 #include <lib/support/DLLUtil.h>
+#include <lib/support/IntrusivePairingHeap.h>
 #include <lib/support/Pool.h>
 
 #include <system/SystemClock.h>
@@ -36,6 +37,8 @@
 #include <system/SystemLayer.h>
 #include <system/SystemStats.h>
 
+#include <utility>
+
 #if CHIP_SYSTEM_CONFIG_USE_DISPATCH
 #include <dispatch/dispatch.h>
 #endif
@@ -105,21 +108,39 @@ private:
 };
 
 /**
- * List of `Timer`s ordered by expiration time.
+ * Collection of `Timer`s ordered by expiration time.
+ *
+ * Timers are kept in a pairing heap, so that adding a timer takes constant time and removing one takes logarithmic
+ * amortized time, however many timers are pending. Timers with the same expiration time are ordered by when they were
+ * added. When the timer pool can grow (CHIP_SYSTEM_CONFIG_POOL_USE_HEAP), larger lists also keep a hash index of their
+ * timers by callback and application state, so that finding a timer to cancel does not visit every timer.
  */
 class TimerList
 {
 public:
-    class Node : public TimerData
+    class Node : public TimerData, public IntrusivePairingHeapNode<Node>
     {
     public:
         Node(Layer & systemLayer, System::Clock::Timestamp awakenTime, TimerCompleteCallback onComplete, void * appState) :
-            TimerData(systemLayer, awakenTime, onComplete, appState), mNextTimer(nullptr)
+            TimerData(systemLayer, awakenTime, onComplete, appState)
         {}
-        Node * mNextTimer;
+
+    private:
+        friend class TimerList;
+
+        // Order in which the timer was added to its list, to break ties between equal expiration times.
+        uint32_t mSequence = 0;
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        Node * mNextInBucket = nullptr;
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
     };
 
-    TimerList() : mEarliestTimer(nullptr) {}
+    TimerList() = default;
+    ~TimerList() { ReleaseIndex(); }
+
+    TimerList(TimerList && other) { *this = std::move(other); }
+    TimerList & operator=(TimerList && other);
 
     /**
      * Add a timer to the list
@@ -130,7 +151,8 @@ public:
     Node * Add(Node * timer);
 
     /**
-     * Remove the given timer from the list, if present. It is not an error for the timer not to be present.
+     * Remove the given timer from the list, if present. It is not an error for the timer not to be present, but it must
+     * not be in a different list.
      *
      * @return  The new earliest timer in the list, or nullptr if the list is empty.
      */
@@ -162,12 +184,19 @@ public:
      *
      * @return  The earliest timer, or nullptr if there are no timers.
      */
-    Node * Earliest() const { return mEarliestTimer; }
+    Node * Earliest() const { return mHeap.Top(); }
+
+    /**
+     * Find the first timer with the given properties, if present.
+     *
+     * @return  The matching timer, or nullptr if the list contains no matching timer.
+     */
+    Node * Find(TimerCompleteCallback onComplete, void * appState) const;
 
     /**
      * Test whether there are any timers.
      */
-    bool Empty() const { return mEarliestTimer == nullptr; }
+    bool Empty() const { return mHeap.Empty(); }
 
     /**
      * Remove and return all timers that expire before the given time @a t.
@@ -177,7 +206,7 @@ public:
     /**
      * Remove all timers.
      */
-    void Clear() { mEarliestTimer = nullptr; }
+    void Clear();
 
     /**
      * Find the timer with the given properties, if present, and return its remaining time
@@ -187,7 +216,33 @@ public:
     Clock::Timeout GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState);
 
 private:
-    Node * mEarliestTimer;
+    static bool IsEarlier(const Node * a, const Node * b);
+    static bool Matches(const Node * timer, TimerCompleteCallback onComplete, void * appState)
+    {
+        return timer->GetCallback().GetOnComplete() == onComplete && timer->GetCallback().GetAppState() == appState;
+    }
+    struct EarlierThan
+    {
+        bool operator()(const Node * a, const Node * b) const { return IsEarlier(a, b); }
+    };
+
+    void IndexAdd(Node * timer);
+    void IndexRemove(Node * timer);
+    void ReleaseIndex();
+
+    IntrusivePairingHeap<Node, EarlierThan> mHeap;
+    uint32_t mNextSequence = 0;
+    size_t mCount          = 0;
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    // Hash index by callback and application state, allocated once the list is large enough to benefit from it.
+    Node ** mIndex    = nullptr;
+    size_t mIndexSize = 0;
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+    // Not defined
+    TimerList(const TimerList &)             = delete;
+    TimerList & operator=(const TimerList &) = delete;
 };
 
 /**
@@ -0,0 +1,369 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This is a unit test suite for <tt>chip::System::LayerImplEpoll</tt>, which also compares the
+ *      event loop latency of the epoll and select based System::Layer implementations.
+ *
+ */
+
+#include <system/SystemConfig.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <nlunit-test.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayerImplEpoll.h>
+#include <system/SystemLayerImplSelect.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace chip;
+using namespace chip::System;
+
+namespace {
+
+// Number of idle sockets watched next to the active one by the latency benchmark.
+constexpr int kBenchmarkIdleSockets   = 48;
+constexpr int kBenchmarkRoundTrips    = 2000;
+constexpr int kMaxLoopIterations      = 100;
+constexpr uint32_t kTimerDelaysMs[]   = { 30, 10, 20 };
+constexpr uint8_t kBytesPerPipeRead   = 1;
+constexpr uint8_t kBytesWrittenAtOnce = 3;
+
+class Pipe
+{
+public:
+    Pipe()
+    {
+        int fds[2];
+        if (pipe(fds) == 0)
+        {
+            mReadFD  = fds[0];
+            mWriteFD = fds[1];
+            fcntl(mReadFD, F_SETFL, fcntl(mReadFD, F_GETFL, 0) | O_NONBLOCK);
+        }
+    }
+    ~Pipe()
+    {
+        close(mReadFD);
+        close(mWriteFD);
+    }
+
+    bool IsValid() const { return mReadFD >= 0; }
+    void Write(uint8_t count = 1)
+    {
+        uint8_t bytes[UINT8_MAX] = {};
+        VerifyOrDie(write(mWriteFD, bytes, count) == count);
+    }
+
+    int mReadFD  = -1;
+    int mWriteFD = -1;
+};
+
+// A socket consumer that, like the inet endpoints, reads a bounded amount of data per callback.
+struct PipeReader
+{
+    static void OnPendingIO(SocketEvents events, intptr_t data)
+    {
+        PipeReader * reader = reinterpret_cast<PipeReader *>(data);
+        reader->mCallbacks++;
+        if (events.Has(SocketEventFlags::kRead))
+        {
+            uint8_t byte[kBytesPerPipeRead];
+            if (read(reader->mPipe->mReadFD, byte, sizeof(byte)) > 0)
+            {
+                reader->mBytesRead++;
+            }
+        }
+        if (reader->mOnPendingIO)
+        {
+            reader->mOnPendingIO(*reader);
+        }
+    }
+
+    CHIP_ERROR Watch(LayerSockets & layer, Pipe & pipe)
+    {
+        mPipe = &pipe;
+        ReturnErrorOnFailure(layer.StartWatchingSocket(pipe.mReadFD, &mToken));
+        ReturnErrorOnFailure(layer.SetCallback(mToken, OnPendingIO, reinterpret_cast<intptr_t>(this)));
+        return layer.RequestCallbackOnPendingRead(mToken);
+    }
+
+    Pipe * mPipe           = nullptr;
+    SocketWatchToken mToken = 0;
+    int mCallbacks          = 0;
+    int mBytesRead          = 0;
+    void (*mOnPendingIO)(PipeReader & reader) = nullptr;
+    void * mContext                           = nullptr;
+};
+
+void RunOnce(LayerSocketsLoop & layer)
+{
+    layer.PrepareEvents();
+    layer.WaitForEvents();
+    layer.HandleEvents();
+}
+
+template <typename Predicate>
+void RunUntil(LayerSocketsLoop & layer, Predicate && done)
+{
+    for (int i = 0; i < kMaxLoopIterations && !done(); i++)
+    {
+        RunOnce(layer);
+    }
+}
+
+void TestTimers(nlTestSuite * inSuite, void * inContext)
+{
+    static int sFired[ArraySize(kTimerDelaysMs)];
+    static size_t sFiredCount;
+
+    LayerImplEpoll layer;
+    NL_TEST_ASSERT(inSuite, layer.Init() == CHIP_NO_ERROR);
+
+    auto onTimer = [](Layer *, void * appState) { sFired[sFiredCount++] = static_cast<int>(reinterpret_cast<intptr_t>(appState)); };
+
+    sFiredCount = 0;
+    for (size_t i = 0; i < ArraySize(kTimerDelaysMs); i++)
+    {
+        NL_TEST_ASSERT(inSuite,
+                       layer.StartTimer(Clock::Milliseconds32(kTimerDelaysMs[i]), onTimer,
+                                        reinterpret_cast<void *>(static_cast<intptr_t>(i))) == CHIP_NO_ERROR);
+    }
+
+    // A cancelled timer leaves the timerfd armed for it, which must only cause a spurious wake-up.
+    TimerCompleteCallback cancelled = [](Layer *, void *) { sFiredCount = 100; };
+    NL_TEST_ASSERT(inSuite, layer.StartTimer(Clock::Milliseconds32(1), cancelled, nullptr) == CHIP_NO_ERROR);
+    layer.CancelTimer(cancelled, nullptr);
+
+    Clock::Timestamp start = SystemClock().GetMonotonicTimestamp();
+    RunUntil(layer, [] { return sFiredCount >= ArraySize(kTimerDelaysMs); });
+    Clock::Timestamp elapsed = SystemClock().GetMonotonicTimestamp() - start;
+
+    NL_TEST_ASSERT(inSuite, sFiredCount == ArraySize(kTimerDelaysMs));
+    NL_TEST_ASSERT(inSuite, sFired[0] == 1 && sFired[1] == 2 && sFired[2] == 0);
+    NL_TEST_ASSERT(inSuite, elapsed >= Clock::Milliseconds64(kTimerDelaysMs[0]));
+
+    layer.Shutdown();
+}
+
+void TestScheduleWork(nlTestSuite * inSuite, void * inContext)
+{
+    static int sCalls;
+
+    LayerImplEpoll layer;
+    NL_TEST_ASSERT(inSuite, layer.Init() == CHIP_NO_ERROR);
+
+    sCalls                        = 0;
+    TimerCompleteCallback onWork = [](Layer *, void *) { sCalls++; };
+    NL_TEST_ASSERT(inSuite, layer.ScheduleWork(onWork, nullptr) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, layer.ScheduleWork(onWork, nullptr) == CHIP_NO_ERROR);
+    RunOnce(layer);
+    NL_TEST_ASSERT(inSuite, sCalls == 2);
+
+    layer.Shutdown();
+}
+
+void TestSocketWatch(nlTestSuite * inSuite, void * inContext)
+{
+    LayerImplEpoll layer;
+    NL_TEST_ASSERT(inSuite, layer.Init() == CHIP_NO_ERROR);
+
+    Pipe pipe;
+    PipeReader reader;
+    NL_TEST_ASSERT(inSuite, pipe.IsValid());
+    NL_TEST_ASSERT(inSuite, reader.Watch(layer, pipe) == CHIP_NO_ERROR);
+
+    // Watching the same socket twice is an error.
+    SocketWatchToken duplicate;
+    NL_TEST_ASSERT(inSuite, layer.StartWatchingSocket(pipe.mReadFD, &duplicate) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    pipe.Write();
+    RunUntil(layer, [&] { return reader.mBytesRead == 1; });
+    NL_TEST_ASSERT(inSuite, reader.mBytesRead == 1);
+
+    // No more callbacks once the socket was drained, or once read callbacks are no longer requested.
+    int callbacks = reader.mCallbacks;
+    NL_TEST_ASSERT(inSuite, layer.ScheduleWork([](Layer *, void *) {}, nullptr) == CHIP_NO_ERROR);
+    RunOnce(layer);
+    NL_TEST_ASSERT(inSuite, reader.mCallbacks == callbacks);
+
+    NL_TEST_ASSERT(inSuite, layer.ClearCallbackOnPendingRead(reader.mToken) == CHIP_NO_ERROR);
+    pipe.Write();
+    NL_TEST_ASSERT(inSuite, layer.ScheduleWork([](Layer *, void *) {}, nullptr) == CHIP_NO_ERROR);
+    RunOnce(layer);
+    NL_TEST_ASSERT(inSuite, reader.mCallbacks == callbacks);
+
+    NL_TEST_ASSERT(inSuite, layer.RequestCallbackOnPendingRead(reader.mToken) == CHIP_NO_ERROR);
+    RunUntil(layer, [&] { return reader.mBytesRead == 2; });
+    NL_TEST_ASSERT(inSuite, reader.mBytesRead == 2);
+
+    NL_TEST_ASSERT(inSuite, layer.StopWatchingSocket(&reader.mToken) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.mToken == layer.InvalidSocketWatchToken());
+
+    layer.Shutdown();
+}
+
+void TestPartialReads(nlTestSuite * inSuite, void * inContext)
+{
+    LayerImplEpoll layer;
+    NL_TEST_ASSERT(inSuite, layer.Init() == CHIP_NO_ERROR);
+
+    // The reader consumes one byte per callback; the remaining ones must still be reported, edge-triggered or not.
+    Pipe pipe;
+    PipeReader reader;
+    NL_TEST_ASSERT(inSuite, reader.Watch(layer, pipe) == CHIP_NO_ERROR);
+
+    pipe.Write(kBytesWrittenAtOnce);
+    RunUntil(layer, [&] { return reader.mBytesRead == kBytesWrittenAtOnce; });
+    NL_TEST_ASSERT(inSuite, reader.mBytesRead == kBytesWrittenAtOnce);
+
+    NL_TEST_ASSERT(inSuite, layer.StopWatchingSocket(&reader.mToken) == CHIP_NO_ERROR);
+    layer.Shutdown();
+}
+
+void TestStopWatchingFromCallback(nlTestSuite * inSuite, void * inContext)
+{
+    LayerImplEpoll layer;
+    NL_TEST_ASSERT(inSuite, layer.Init() == CHIP_NO_ERROR);
+
+    // Both pipes become ready in the same iteration; whichever callback runs first stops watching the other pipe,
+    // whose pending event must then be dropped.
+    static LayerImplEpoll * sLayer;
+    sLayer = &layer;
+
+    Pipe pipes[2];
+    PipeReader readers[2];
+    for (size_t i = 0; i < ArraySize(readers); i++)
+    {
+        NL_TEST_ASSERT(inSuite, readers[i].Watch(layer, pipes[i]) == CHIP_NO_ERROR);
+        readers[i].mContext     = &readers[(i + 1) % ArraySize(readers)];
+        readers[i].mOnPendingIO = [](PipeReader & reader) {
+            PipeReader & other = *static_cast<PipeReader *>(reader.mContext);
+            if (other.mToken != sLayer->InvalidSocketWatchToken())
+            {
+                VerifyOrDie(sLayer->StopWatchingSocket(&other.mToken) == CHIP_NO_ERROR);
+            }
+        };
+    }
+
+    pipes[0].Write();
+    pipes[1].Write();
+    RunUntil(layer, [&] { return readers[0].mCallbacks + readers[1].mCallbacks > 0; });
+    NL_TEST_ASSERT(inSuite, readers[0].mCallbacks + readers[1].mCallbacks == 1);
+
+    for (auto & reader : readers)
+    {
+        if (reader.mToken != layer.InvalidSocketWatchToken())
+        {
+            NL_TEST_ASSERT(inSuite, layer.StopWatchingSocket(&reader.mToken) == CHIP_NO_ERROR);
+        }
+    }
+    layer.Shutdown();
+}
+
+/**
+ * Measure the time a System::Layer implementation takes to dispatch a socket event through one event loop
+ * iteration, while watching kBenchmarkIdleSockets other sockets that stay idle.
+ */
+template <typename LayerType>
+uint64_t MeasureRoundTripNanoseconds(nlTestSuite * inSuite)
+{
+    LayerType layer;
+    NL_TEST_ASSERT(inSuite, layer.Init() == CHIP_NO_ERROR);
+
+    Pipe idlePipes[kBenchmarkIdleSockets];
+    PipeReader idleReaders[kBenchmarkIdleSockets];
+    for (int i = 0; i < kBenchmarkIdleSockets; i++)
+    {
+        NL_TEST_ASSERT(inSuite, idleReaders[i].Watch(layer, idlePipes[i]) == CHIP_NO_ERROR);
+    }
+
+    Pipe pipe;
+    PipeReader reader;
+    NL_TEST_ASSERT(inSuite, reader.Watch(layer, pipe) == CHIP_NO_ERROR);
+
+    Clock::Microseconds64 start = SystemClock().GetMonotonicMicroseconds64();
+    for (int i = 0; i < kBenchmarkRoundTrips; i++)
+    {
+        pipe.Write();
+        RunOnce(layer);
+    }
+    Clock::Microseconds64 elapsed = SystemClock().GetMonotonicMicroseconds64() - start;
+    NL_TEST_ASSERT(inSuite, reader.mBytesRead == kBenchmarkRoundTrips);
+
+    for (auto & idleReader : idleReaders)
+    {
+        NL_TEST_ASSERT(inSuite, layer.StopWatchingSocket(&idleReader.mToken) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, layer.StopWatchingSocket(&reader.mToken) == CHIP_NO_ERROR);
+    layer.Shutdown();
+
+    return static_cast<uint64_t>(elapsed.count()) * 1000 / kBenchmarkRoundTrips;
+}
+
+void TestEventLoopLatencyBenchmark(nlTestSuite * inSuite, void * inContext)
+{
+    uint64_t selectLatency = MeasureRoundTripNanoseconds<LayerImplSelect>(inSuite);
+    uint64_t epollLatency  = MeasureRoundTripNanoseconds<LayerImplEpoll>(inSuite);
+
+    // Timings are reported rather than asserted on, since they depend on the host.
+    ChipLogProgress(chipSystemLayer, "Event loop round trip with %d idle sockets: select %u ns, epoll %u ns",
+                    kBenchmarkIdleSockets, static_cast<unsigned>(selectLatency), static_cast<unsigned>(epollLatency));
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("LayerImplEpoll::TestTimers",                   TestTimers),
+    NL_TEST_DEF("LayerImplEpoll::TestScheduleWork",             TestScheduleWork),
+    NL_TEST_DEF("LayerImplEpoll::TestSocketWatch",              TestSocketWatch),
+    NL_TEST_DEF("LayerImplEpoll::TestPartialReads",             TestPartialReads),
+    NL_TEST_DEF("LayerImplEpoll::TestStopWatchingFromCallback", TestStopWatchingFromCallback),
+    NL_TEST_DEF("LayerImplEpoll::TestEventLoopLatencyBenchmark", TestEventLoopLatencyBenchmark),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+int TestSetup(void * aContext)
+{
+    return (chip::Platform::MemoryInit() == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+int TestTeardown(void * aContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+} // namespace
+
+int TestSystemLayerEpoll()
+{
+    nlTestSuite theSuite = { "chip-system-layer-epoll", &sTests[0], TestSetup, TestTeardown };
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestSystemLayerEpoll)
@@ -37,6 +37,11 @@
 #include <platform/CHIPDeviceLayer.h>
 #include <system/SystemPacketBuffer.h>
 
+#if CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
+#include <atomic>
+#include <thread>
+#endif // CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
+
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
 #include <lwip/init.h>
 #include <lwip/tcpip.h>
@@ -130,6 +135,10 @@ public:
     static void CheckHandleCloneData(nlTestSuite * inSuite, void * inContext);
     static void CheckPacketBufferWriter(nlTestSuite * inSuite, void * inContext);
     static void CheckBuildFreeList(nlTestSuite * inSuite, void * inContext);
+#if CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
+    static void CheckSizeClasses(nlTestSuite * inSuite, void * inContext);
+    static void CheckConcurrentNewFree(nlTestSuite * inSuite, void * inContext);
+#endif // CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
 
     static void PrintHandle(const char * tag, const PacketBuffer * buffer)
     {
@@ -1962,6 +1971,131 @@ void PacketBufferTest::CheckPacketBufferWriter(nlTestSuite * inSuite, void * inC
     NL_TEST_ASSERT(inSuite, memcmp(yayBuffer->Start(), kPayload, sizeof kPayload) == 0);
 }
 
+#if CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
+
+void PacketBufferTest::CheckSizeClasses(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr uint16_t kSmall  = CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY;
+    constexpr uint16_t kMedium = CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_CAPACITY;
+
+    // A buffer comes from the smallest size class that fits.
+    NL_TEST_ASSERT(inSuite, PacketBufferHandle::New(kSmall, 0)->AllocSize() == kSmall);
+    NL_TEST_ASSERT(inSuite, PacketBufferHandle::New(kSmall - 10, 10)->AllocSize() == kSmall);
+    NL_TEST_ASSERT(inSuite, PacketBufferHandle::New(kSmall + 1, 0)->AllocSize() == kMedium);
+    NL_TEST_ASSERT(inSuite, PacketBufferHandle::New(kMedium + 1, 0)->AllocSize() == PacketBuffer::kMaxSizeWithoutReserve);
+
+    // RightSize() moves a buffer into the smallest size class that fits its contents.
+    static const char kPayload[] = "Joy!";
+    PacketBufferHandle handle    = PacketBufferHandle::NewWithData(kPayload, sizeof kPayload, kMedium);
+    NL_TEST_ASSERT(inSuite, handle->AllocSize() == PacketBuffer::kMaxSizeWithoutReserve);
+    handle.RightSize();
+    NL_TEST_ASSERT(inSuite, handle->AllocSize() == kSmall);
+    NL_TEST_ASSERT(inSuite, memcmp(handle->Start(), kPayload, sizeof kPayload) == 0);
+    handle = nullptr;
+
+    // When a size class is exhausted, allocations fall back to larger ones, so that every buffer can be used.
+    uint32_t expected = 0;
+    for (const auto & sizeClass : PacketBuffer::sSizeClasses)
+    {
+        NL_TEST_ASSERT(inSuite, sizeClass.InUse() == 0);
+        expected += sizeClass.BlockCount();
+    }
+
+    std::vector<PacketBufferHandle> allocate_all_the_things;
+    for (;;)
+    {
+        PacketBufferHandle buffer = PacketBufferHandle::New(1, 0);
+        if (buffer.IsNull())
+        {
+            break;
+        }
+        allocate_all_the_things.push_back(std::move(buffer));
+    }
+    NL_TEST_ASSERT(inSuite, allocate_all_the_things.size() == expected);
+    NL_TEST_ASSERT(inSuite, allocate_all_the_things.back()->AllocSize() == PacketBuffer::kMaxSizeWithoutReserve);
+
+    SYSTEM_STATS_UPDATE_PACKETBUFFER_POOL_COUNTS();
+    NL_TEST_ASSERT(inSuite,
+                   SYSTEM_STATS_TEST_IN_USE(chip::System::Stats::kSystemLayer_NumSmallPacketBufs,
+                                            std::min(CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE, CHIP_SYS_STATS_COUNT_MAX)));
+
+    allocate_all_the_things.clear();
+    for (const auto & sizeClass : PacketBuffer::sSizeClasses)
+    {
+        NL_TEST_ASSERT(inSuite, sizeClass.InUse() == 0);
+        NL_TEST_ASSERT(inSuite, sizeClass.HighWatermark() == sizeClass.BlockCount());
+    }
+}
+
+void PacketBufferTest::CheckConcurrentNewFree(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr int kThreads    = 4;
+    constexpr int kIterations = 10000;
+
+    std::atomic<int> failures{ 0 };
+    auto worker = [&failures](int seed) {
+        const uint8_t marker = static_cast<uint8_t>(seed);
+        PacketBufferHandle held;
+        for (int i = 0; i < kIterations; i++)
+        {
+            const size_t size         = 1 + static_cast<size_t>((i * 7919 + seed) % PacketBuffer::kMaxSizeWithoutReserve);
+            PacketBufferHandle buffer = PacketBufferHandle::New(size, 0);
+            if (buffer.IsNull())
+            {
+                // All buffers may be in use, or cached by other threads.
+                continue;
+            }
+            memset(buffer->Start(), marker, size);
+            buffer->SetDataLength(static_cast<uint16_t>(size));
+            std::this_thread::yield();
+            for (size_t j = 0; j < size; j++)
+            {
+                if (buffer->Start()[j] != marker)
+                {
+                    failures++;
+                    break;
+                }
+            }
+            // Keep every other buffer for one more iteration, so that buffers are freed in a different order than allocated.
+            if ((i & 1) == 0)
+            {
+                held = std::move(buffer);
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kThreads; i++)
+    {
+        threads.emplace_back(worker, i + 1);
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    NL_TEST_ASSERT(inSuite, failures == 0);
+    for (const auto & sizeClass : PacketBuffer::sSizeClasses)
+    {
+        NL_TEST_ASSERT(inSuite, sizeClass.InUse() == 0);
+    }
+
+    // The exiting threads returned their cached buffers, so that all of them are available again.
+    std::vector<PacketBufferHandle> allocate_all_the_things;
+    for (PacketBufferHandle buffer = PacketBufferHandle::New(1, 0); !buffer.IsNull(); buffer = PacketBufferHandle::New(1, 0))
+    {
+        allocate_all_the_things.push_back(std::move(buffer));
+    }
+    uint32_t expected = 0;
+    for (const auto & sizeClass : PacketBuffer::sSizeClasses)
+    {
+        expected += sizeClass.BlockCount();
+    }
+    NL_TEST_ASSERT(inSuite, allocate_all_the_things.size() == expected);
+}
+
+#endif // CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
+
 /**
  *   Test Suite. It lists all the test functions.
  */
@@ -2002,6 +2136,10 @@ const nlTest sTests[] =
     NL_TEST_DEF("PacketBuffer::HandleRightSize",        PacketBufferTest::CheckHandleRightSize),
     NL_TEST_DEF("PacketBuffer::HandleCloneData",        PacketBufferTest::CheckHandleCloneData),
     NL_TEST_DEF("PacketBuffer::PacketBufferWriter",     PacketBufferTest::CheckPacketBufferWriter),
+#if CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
+    NL_TEST_DEF("PacketBuffer::SizeClasses",            PacketBufferTest::CheckSizeClasses),
+    NL_TEST_DEF("PacketBuffer::ConcurrentNewFree",      PacketBufferTest::CheckConcurrentNewFree),
+#endif // CHIP_SYSTEM_PACKETBUFFER_LOCK_FREE_POOL
 
     NL_TEST_SENTINEL()
 };
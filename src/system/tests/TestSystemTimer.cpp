@@ -26,7 +26,9 @@
 #include <system/SystemConfig.h>
 
 #include <lib/core/ErrorStr.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedBuffer.h>
 #include <lib/support/UnitTestContext.h>
 #include <lib/support/UnitTestRegistration.h>
 #include <nlunit-test.h>
@@ -706,6 +708,171 @@ static void IsTimerActiveTest(nlTestSuite * inSuite, void * aContext)
     Clock::Internal::SetSystemClockForTesting(savedClock);
 }
 
+namespace TimerListTest {
+
+using Timer = TimerList::Node;
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+constexpr size_t kStressTimers     = 10000;
+constexpr size_t kStressIterations = 100000;
+#else
+constexpr size_t kStressTimers     = CHIP_SYSTEM_CONFIG_NUM_TIMERS;
+constexpr size_t kStressIterations = 1000;
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+void OnTimer(Layer * layer, void * state) {}
+
+void * AppStateFor(size_t index)
+{
+    return reinterpret_cast<void *>(static_cast<uintptr_t>(index + 1));
+}
+
+size_t IndexOf(const Timer * timer)
+{
+    return static_cast<size_t>(reinterpret_cast<uintptr_t>(timer->GetCallback().GetAppState())) - 1;
+}
+
+uint32_t NextRandom(uint32_t & state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+bool AllocateTimers(Layer & layer, chip::Platform::ScopedMemoryBuffer<Timer *> & timers, size_t count, uint32_t & random,
+                    uint32_t spreadMs)
+{
+    VerifyOrReturnValue(timers.Calloc(count), false);
+    for (size_t i = 0; i < count; i++)
+    {
+        Clock::Timestamp awakenTime(NextRandom(random) % spreadMs);
+        timers[i] = chip::Platform::New<Timer>(layer, awakenTime, OnTimer, AppStateFor(i));
+        VerifyOrReturnValue(timers[i] != nullptr, false);
+    }
+    return true;
+}
+
+void ReleaseTimers(chip::Platform::ScopedMemoryBuffer<Timer *> & timers, size_t count)
+{
+    for (size_t i = 0; i < count && timers.Get() != nullptr; i++)
+    {
+        chip::Platform::Delete(timers[i]);
+    }
+    timers.Free();
+}
+
+// Pops every timer from the list, checking that they come out by expiration time and, if @a tiesInIndexOrder, that
+// timers with equal expiration times come out in index order. Returns the number of timers popped.
+size_t DrainInOrder(nlTestSuite * suite, TimerList & list, bool tiesInIndexOrder)
+{
+    size_t count    = 0;
+    Timer * last    = nullptr;
+    Timer * current = nullptr;
+    while ((current = list.PopEarliest()) != nullptr)
+    {
+        if (last != nullptr)
+        {
+            NL_TEST_ASSERT(suite, !(current->AwakenTime() < last->AwakenTime()));
+            NL_TEST_ASSERT(suite,
+                           !tiesInIndexOrder || current->AwakenTime() != last->AwakenTime() || IndexOf(last) < IndexOf(current));
+        }
+        last = current;
+        count++;
+    }
+    NL_TEST_ASSERT(suite, list.Empty());
+    return count;
+}
+
+// Check TimerList ordering and removal against many timers, including timers with equal expiration times.
+void CheckOrder(nlTestSuite * inSuite, void * aContext)
+{
+    TestContext & testContext = *static_cast<TestContext *>(aContext);
+    nlTestSuite * const suite = testContext.mTestSuite;
+
+    constexpr size_t kTimers = 200;
+    uint32_t random          = 0x2545F491;
+    chip::Platform::ScopedMemoryBuffer<Timer *> timers;
+    NL_TEST_ASSERT(suite, AllocateTimers(*testContext.mLayer, timers, kTimers, random, 50));
+    VerifyOrReturn(timers.Get() != nullptr && timers[kTimers - 1] != nullptr, ReleaseTimers(timers, kTimers));
+
+    TimerList list;
+    for (size_t i = 0; i < kTimers; i++)
+    {
+        list.Add(timers[i]);
+    }
+
+    size_t removed = 0;
+    for (size_t i = 0; i < kTimers; i += 3)
+    {
+        NL_TEST_ASSERT(suite, list.Find(OnTimer, AppStateFor(i)) == timers[i]);
+        NL_TEST_ASSERT(suite, list.Remove(OnTimer, AppStateFor(i)) == timers[i]);
+        NL_TEST_ASSERT(suite, list.Find(OnTimer, AppStateFor(i)) == nullptr);
+        NL_TEST_ASSERT(suite, list.Remove(OnTimer, AppStateFor(i)) == nullptr);
+        removed++;
+    }
+    for (size_t i = 1; i < kTimers; i += 3)
+    {
+        list.Remove(timers[i]);
+        NL_TEST_ASSERT(suite, list.Find(OnTimer, AppStateFor(i)) == nullptr);
+        removed++;
+    }
+
+    // Timers extracted together keep their order, including between equal expiration times.
+    TimerList early = list.ExtractEarlier(Clock::Timestamp(25));
+    NL_TEST_ASSERT(suite, early.Earliest() == nullptr || early.Earliest()->AwakenTime() < Clock::Timestamp(25));
+    NL_TEST_ASSERT(suite, list.Earliest() == nullptr || !(list.Earliest()->AwakenTime() < Clock::Timestamp(25)));
+    size_t drained = DrainInOrder(suite, early, true);
+    drained += DrainInOrder(suite, list, true);
+    NL_TEST_ASSERT(suite, drained == kTimers - removed);
+
+    ReleaseTimers(timers, kTimers);
+}
+
+// Measure how quickly timers are cancelled and re-armed while many timers are pending. The timings are logged rather
+// than asserted on, since they depend on the host.
+void CheckStress(nlTestSuite * inSuite, void * aContext)
+{
+    TestContext & testContext = *static_cast<TestContext *>(aContext);
+    nlTestSuite * const suite = testContext.mTestSuite;
+
+    uint32_t random = 0x9E3779B9;
+    chip::Platform::ScopedMemoryBuffer<Timer *> timers;
+    NL_TEST_ASSERT(suite, AllocateTimers(*testContext.mLayer, timers, kStressTimers, random, 60 * 60 * 1000));
+    VerifyOrReturn(timers.Get() != nullptr && timers[kStressTimers - 1] != nullptr, ReleaseTimers(timers, kStressTimers));
+
+    TimerList list;
+    uint64_t start = SystemClock().GetMonotonicMicroseconds64().count();
+    for (size_t i = 0; i < kStressTimers; i++)
+    {
+        list.Add(timers[i]);
+    }
+    uint64_t armed = SystemClock().GetMonotonicMicroseconds64().count();
+
+    bool ok = true;
+    for (size_t i = 0; i < kStressIterations; i++)
+    {
+        // Cancel and re-arm a timer the way Layer::StartTimer() does.
+        size_t index = NextRandom(random) % kStressTimers;
+        ok           = ok && (list.Remove(OnTimer, AppStateFor(index)) == timers[index]);
+        list.Add(timers[index]);
+    }
+    uint64_t cycled = SystemClock().GetMonotonicMicroseconds64().count();
+    NL_TEST_ASSERT(suite, ok);
+
+    NL_TEST_ASSERT(suite, DrainInOrder(suite, list, false) == kStressTimers);
+    uint64_t drained = SystemClock().GetMonotonicMicroseconds64().count();
+
+    ChipLogProgress(Test, "TimerList with %u timers: armed in %u us, %u cancel/re-arm pairs in %u us, drained in %u us",
+                    static_cast<unsigned>(kStressTimers), static_cast<unsigned>(armed - start),
+                    static_cast<unsigned>(kStressIterations), static_cast<unsigned>(cycled - armed),
+                    static_cast<unsigned>(drained - cycled));
+
+    ReleaseTimers(timers, kStressTimers);
+}
+
+} // namespace TimerListTest
+
 // Test Suite
 
 /**
@@ -722,6 +889,8 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Timer::TestCancelTimer",          CancelTimerTest::Test),
     NL_TEST_DEF("Timer::ExtendTimerTo",            ExtendTimerToTest),
     NL_TEST_DEF("Timer::TestIsTimerActive",        IsTimerActiveTest),
+    NL_TEST_DEF("Timer::TestTimerListOrder",       TimerListTest::CheckOrder),
+    NL_TEST_DEF("Timer::TestTimerListStress",      TimerListTest::CheckStress),
     NL_TEST_SENTINEL()
 };
 // clang-format on
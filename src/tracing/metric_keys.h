@@ -31,5 +31,21 @@ typedef const char * MetricKey;
  */
 constexpr MetricKey kMetricWiFiRSSI = "wifi_rssi";
 
+// Reliable messaging: messages sent with MRP, their retransmissions, messages given up on after the last
+// retransmission, and the time in milliseconds from sending a message to receiving its acknowledgment.
+constexpr MetricKey kMetricMRPSend       = "mrp_send";
+constexpr MetricKey kMetricMRPRetransmit = "mrp_retransmit";
+constexpr MetricKey kMetricMRPGiveUp     = "mrp_give_up";
+constexpr MetricKey kMetricMRPAckLatency = "mrp_ack_latency_ms";
+
+// Subscription resumption: subscriptions queued for resumption, the delay in milliseconds between queueing a subscription
+// and starting its resumption, the time in milliseconds taken to establish (or fail to establish) the session for a
+// resumption, and the time in milliseconds taken to work through all queued subscriptions.
+constexpr MetricKey kMetricSubscriptionResumptionQueued    = "subscription_resumption_queued";
+constexpr MetricKey kMetricSubscriptionResumptionStart     = "subscription_resumption_start_delay_ms";
+constexpr MetricKey kMetricSubscriptionResumptionConnected = "subscription_resumption_connected_ms";
+constexpr MetricKey kMetricSubscriptionResumptionFailed    = "subscription_resumption_failed_ms";
+constexpr MetricKey kMetricSubscriptionResumptionDone      = "subscription_resumption_done_ms";
+
 } // namespace Tracing
 } // namespace chip
@@ -175,6 +175,9 @@ private:
     bool mKeyAvailable;
     Crypto::Aes128KeyHandle mEncryptionKey;
     Crypto::Aes128KeyHandle mDecryptionKey;
+    // Cipher state for the session keys, set up on first use so the key schedule is not rebuilt for every message.
+    mutable Crypto::AesCcm128Context mEncryptionCipher;
+    mutable Crypto::AesCcm128Context mDecryptionCipher;
     Crypto::AttestationChallenge mAttestationChallenge;
     Crypto::SessionKeystore * mKeystore       = nullptr;
     Crypto::SymmetricKeyContext * mKeyContext = nullptr;
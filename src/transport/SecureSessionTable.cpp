@@ -54,7 +54,10 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSessionForTest(Secure
 
     SecureSession * result = mEntries.CreateObject(*this, secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs,
                                                    peerSessionId, fabricIndex, config);
-    return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
+    VerifyOrReturnValue(result != nullptr, Optional<SessionHandle>::Missing());
+
+    AddToIndexes(result);
+    return MakeOptional<SessionHandle>(*result);
 }
 
 Optional<SessionHandle> SecureSessionTable::CreateNewSecureSession(SecureSession::Type secureSessionType,
@@ -82,6 +85,7 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSession(SecureSession
 
     VerifyOrReturnValue(allocated != nullptr, Optional<SessionHandle>::Missing());
 
+    AddToIndexes(allocated);
     rv             = MakeOptional<SessionHandle>(*allocated);
     mNextSessionId = sessionId.Value() == kMaxSessionID ? static_cast<uint16_t>(kUnsecuredSessionId + 1)
                                                         : static_cast<uint16_t>(sessionId.Value() + 1);
@@ -337,67 +341,84 @@ void SecureSessionTable::DefaultEvictionPolicy(EvictionPolicyContext & evictionC
     });
 }
 
+void SecureSessionTable::ReleaseSession(SecureSession * session)
+{
+    SecureSession ** link = &mLocalSessionIdIndex[LocalSessionIdBucket(session->GetLocalSessionId())];
+    while (*link != session)
+    {
+        VerifyOrDie(*link != nullptr);
+        link = &(*link)->mNextByLocalSessionId;
+    }
+    *link = session->mNextByLocalSessionId;
+
+    UnlinkFromPeerIndex(session, session->GetPeer());
+    mEntries.ReleaseObject(session);
+}
+
+void SecureSessionTable::PeerChanged(SecureSession * session, const ScopedNodeId & previousPeer)
+{
+    UnlinkFromPeerIndex(session, previousPeer);
+
+    SecureSession *& head = mPeerIndex[PeerBucket(session->GetPeer())];
+    session->mNextByPeer  = head;
+    head                  = session;
+}
+
+void SecureSessionTable::AddToIndexes(SecureSession * session)
+{
+    // Append, so that if several sessions share a local session ID, lookups find the oldest one, as a scan of the table
+    // would.
+    SecureSession ** link = &mLocalSessionIdIndex[LocalSessionIdBucket(session->GetLocalSessionId())];
+    while (*link != nullptr)
+    {
+        link = &(*link)->mNextByLocalSessionId;
+    }
+    session->mNextByLocalSessionId = nullptr;
+    *link                          = session;
+
+    SecureSession *& peerHead = mPeerIndex[PeerBucket(session->GetPeer())];
+    session->mNextByPeer      = peerHead;
+    peerHead                  = session;
+}
+
+void SecureSessionTable::UnlinkFromPeerIndex(SecureSession * session, const ScopedNodeId & peer)
+{
+    SecureSession ** link = &mPeerIndex[PeerBucket(peer)];
+    while (*link != session)
+    {
+        VerifyOrDie(*link != nullptr);
+        link = &(*link)->mNextByPeer;
+    }
+    *link                = session->mNextByPeer;
+    session->mNextByPeer = nullptr;
+}
+
+SecureSession * SecureSessionTable::FindByLocalSessionId(uint16_t localSessionId) const
+{
+    SecureSession * session = mLocalSessionIdIndex[LocalSessionIdBucket(localSessionId)];
+    while (session != nullptr && session->GetLocalSessionId() != localSessionId)
+    {
+        session = session->mNextByLocalSessionId;
+    }
+    return session;
+}
+
 Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t localSessionId)
 {
-    SecureSession * result = nullptr;
-    mEntries.ForEachActiveObject([&](auto session) {
-        if (session->GetLocalSessionId() == localSessionId)
-        {
-            result = session;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
+    SecureSession * result = FindByLocalSessionId(localSessionId);
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
 Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
 {
-    uint16_t candidate_base = 0;
-    uint64_t candidate_mask = 0;
-    for (uint32_t i = 0; i <= kMaxSessionID; i += 64)
-    {
-        // candidate_base is the base session ID we are searching from.
-        // We have a 64-bit mask anchored at this ID and iterate over the
-        // whole session table, setting bits in the mask for in-use IDs.
-        // If we can iterate through the entire session table and have
-        // any bits clear in the mask, we have available session IDs.
-        candidate_base = static_cast<uint16_t>(i + mNextSessionId);
-        candidate_mask = 0;
-        {
-            uint16_t shift = static_cast<uint16_t>(kUnsecuredSessionId - candidate_base);
-            if (shift <= 63)
-            {
-                candidate_mask |= (1ULL << shift); // kUnsecuredSessionId is never available
-            }
-        }
-        mEntries.ForEachActiveObject([&](auto session) {
-            uint16_t shift = static_cast<uint16_t>(session->GetLocalSessionId() - candidate_base);
-            if (shift <= 63)
-            {
-                candidate_mask |= (1ULL << shift);
-            }
-            if (candidate_mask == UINT64_MAX)
-            {
-                return Loop::Break; // No bits clear means this bucket is full.
-            }
-            return Loop::Continue;
-        });
-        if (candidate_mask != UINT64_MAX)
-        {
-            break; // Any bit clear means we have an available ID in this bucket.
-        }
-    }
-    if (candidate_mask != UINT64_MAX)
+    for (uint32_t i = 0; i <= kMaxSessionID; i++)
     {
-        uint16_t offset = 0;
-        while (candidate_mask & 1)
+        uint16_t candidate = static_cast<uint16_t>(i + mNextSessionId);
+        // kUnsecuredSessionId is never available
+        if (candidate != kUnsecuredSessionId && FindByLocalSessionId(candidate) == nullptr)
         {
-            candidate_mask >>= 1;
-            ++offset;
+            return MakeOptional<uint16_t>(candidate);
         }
-        uint16_t available = static_cast<uint16_t>(candidate_base + offset);
-        return MakeOptional<uint16_t>(available);
     }
 
     return NullOptional;
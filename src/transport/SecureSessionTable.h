@@ -76,7 +76,7 @@ public:
     CHECK_RETURN_VALUE
     Optional<SessionHandle> CreateNewSecureSession(SecureSession::Type secureSessionType, ScopedNodeId sessionEvictionHint);
 
-    void ReleaseSession(SecureSession * session) { mEntries.ReleaseObject(session); }
+    void ReleaseSession(SecureSession * session);
 
     template <typename Function>
     Loop ForEachSession(Function && function)
@@ -84,6 +84,39 @@ public:
         return mEntries.ForEachActiveObject(std::forward<Function>(function));
     }
 
+    /**
+     * Call the provided function on each session whose peer is @a peer, looking the sessions up in the peer index
+     * rather than scanning the table.
+     *
+     * The function may release sessions, including the one it is called with.
+     */
+    template <typename Function>
+    Loop ForEachSessionWithPeer(const ScopedNodeId & peer, Function && function)
+    {
+        SecureSession * session = mPeerIndex[PeerBucket(peer)];
+        while (session != nullptr)
+        {
+            if (session->GetPeer() != peer)
+            {
+                session = session->mNextByPeer;
+                continue;
+            }
+
+            // Hold the session, so that its link to the next one is still valid once the function returns.
+            SessionHandle ref(*session);
+            VerifyOrReturnValue(function(session) == Loop::Continue, Loop::Break);
+            session = session->mNextByPeer;
+        }
+        return Loop::Finish;
+    }
+
+    /**
+     * Move @a session to its new place in the peer index after its peer has changed from @a previousPeer.
+     *
+     * This is an internal API, meant to be called by SecureSession.
+     */
+    void PeerChanged(SecureSession * session, const ScopedNodeId & previousPeer);
+
     /**
      * Get a secure session given its session ID.
      *
@@ -100,17 +133,15 @@ public:
     void NewerSessionAvailable(SecureSession * session)
     {
         VerifyOrDie(session->GetSecureSessionType() == SecureSession::Type::kCASE);
-        mEntries.ForEachActiveObject([&](SecureSession * oldSession) {
+        ForEachSessionWithPeer(session->GetPeer(), [&](SecureSession * oldSession) {
             if (session == oldSession)
                 return Loop::Continue;
 
-            SessionHandle ref(*oldSession);
-
             // This will give all SessionHolders pointing to oldSession a chance to switch to the provided session
             //
             // See documentation for SessionDelegate::GetNewSessionHandlingPolicy about how session auto-shifting works, and how
             // to disable it for a specific SessionHolder in a specific scenario.
-            if (oldSession->GetSecureSessionType() == SecureSession::Type::kCASE && oldSession->GetPeer() == session->GetPeer() &&
+            if (oldSession->GetSecureSessionType() == SecureSession::Type::kCASE &&
                 oldSession->GetPeerCATs() == session->GetPeerCATs())
             {
                 oldSession->NewerSessionAvailable(SessionHandle(*session));
@@ -243,21 +274,36 @@ private:
     /**
      * Find an available session ID that is unused in the secure session table.
      *
-     * The search algorithm iterates over the session ID space in the outer loop
-     * and the session table in the inner loop to locate an available session ID
-     * from the starting mNextSessionId clue.
-     *
-     * The outer-loop considers 64 session IDs in each iteration to give a
-     * runtime complexity of O(CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE^2/64).  Speed up could be
-     * achieved with a sorted session table or additional storage.
+     * The search looks up session IDs in the local session ID index, starting
+     * from the mNextSessionId clue, until it finds one that is not in use.
+     * Since at most CHIP_CONFIG_SECURE_SESSION_POOL_SIZE IDs can be in use, this
+     * takes at most that many lookups.
      *
      * @return an unused session ID if any is found, else NullOptional
      */
     CHECK_RETURN_VALUE
     Optional<uint16_t> FindUnusedSessionId();
 
+    /**
+     * Sessions are kept in two hash indexes, on local session ID and on peer, so that the lookups done for every
+     * received message do not scan the whole table. Each bucket is a list linked through the sessions themselves.
+     */
+    static constexpr size_t kIndexBucketCount = SessionIndexBucketCount(CHIP_CONFIG_SECURE_SESSION_POOL_SIZE);
+
+    static size_t LocalSessionIdBucket(uint16_t localSessionId) { return localSessionId & (kIndexBucketCount - 1); }
+    static size_t PeerBucket(const ScopedNodeId & peer)
+    {
+        return SessionIndexBucket(peer.GetNodeId(), peer.GetFabricIndex(), kIndexBucketCount);
+    }
+
+    SecureSession * FindByLocalSessionId(uint16_t localSessionId) const;
+    void AddToIndexes(SecureSession * session);
+    void UnlinkFromPeerIndex(SecureSession * session, const ScopedNodeId & peer);
+
     bool mRunningEvictionLogic = false;
     ObjectPool<SecureSession, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE> mEntries;
+    SecureSession * mLocalSessionIdIndex[kIndexBucketCount] = {};
+    SecureSession * mPeerIndex[kIndexBucketCount]           = {};
 
     size_t GetMaxSessionTableSize() const
     {
@@ -157,6 +157,29 @@ class UnauthenticatedSession;
 class IncomingGroupSession;
 class OutgoingGroupSession;
 
+/**
+ * Number of buckets in the hash indexes a session table keeps for a pool of @a poolSize sessions: the smallest power of
+ * two that is at least half the pool size.
+ */
+constexpr size_t SessionIndexBucketCount(size_t poolSize)
+{
+    size_t count = 1;
+    while (count * 2 < poolSize)
+    {
+        count *= 2;
+    }
+    return count;
+}
+
+/**
+ * Bucket of a node in a session index of @a bucketCount buckets, which must be a power of two.
+ */
+inline size_t SessionIndexBucket(NodeId nodeId, FabricIndex fabricIndex, size_t bucketCount)
+{
+    uint64_t key = (nodeId ^ (static_cast<uint64_t>(fabricIndex) << 56)) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(key >> 32) & (bucketCount - 1);
+}
+
 class Session
 {
 public:
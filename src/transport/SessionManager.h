@@ -189,12 +189,8 @@ public:
     template <typename Function>
     void ForEachMatchingSession(const ScopedNodeId & node, Function && function)
     {
-        mSecureSessions.ForEachSession([&](auto * session) {
-            if (session->GetPeer() == node)
-            {
-                function(session);
-            }
-
+        mSecureSessions.ForEachSessionWithPeer(node, [&](auto * session) {
+            function(session);
             return Loop::Continue;
         });
     }
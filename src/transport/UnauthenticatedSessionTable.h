@@ -185,11 +185,16 @@ public:
     {}
 
 private:
+    friend class UnauthenticatedSessionTable<kMaxSessionCount>;
+
 #if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
     virtual void ReleaseSelfToPool();
 
     UnauthenticatedSessionTable<kMaxSessionCount> & mSessionTable;
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+    // Link in the UnauthenticatedSessionTable hash index on ephemeral initiator node ID.
+    UnauthenticatedSessionPoolEntry * mNextInBucket = nullptr;
 };
 
 } // namespace detail
@@ -281,6 +286,7 @@ private:
         auto entryToUse = mEntries.CreateObject(sessionRole, ephemeralInitiatorNodeID, config, *this);
         if (entryToUse != nullptr)
         {
+            AddToIndex(entryToUse);
             entry = entryToUse;
             return CHIP_NO_ERROR;
         }
@@ -293,7 +299,7 @@ private:
         VerifyOrReturnError(entryToUse != nullptr, CHIP_ERROR_NO_MEMORY);
 
         // Drop the least recent entry to allow for a new alloc.
-        mEntries.ReleaseObject(entryToUse);
+        ReleaseEntry(entryToUse);
         entryToUse = mEntries.CreateObject(sessionRole, ephemeralInitiatorNodeID, config, *this);
 
         if (entryToUse == nullptr)
@@ -302,6 +308,7 @@ private:
             return CHIP_ERROR_INTERNAL;
         }
 
+        AddToIndex(entryToUse);
         entry = entryToUse;
         return CHIP_NO_ERROR;
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
@@ -310,16 +317,13 @@ private:
     CHECK_RETURN_VALUE UnauthenticatedSession * FindEntry(UnauthenticatedSession::SessionRole sessionRole,
                                                           NodeId ephemeralInitiatorNodeID)
     {
-        UnauthenticatedSession * result = nullptr;
-        mEntries.ForEachActiveObject([&](UnauthenticatedSession * entry) {
-            if (entry->GetSessionRole() == sessionRole && entry->GetEphemeralInitiatorNodeID() == ephemeralInitiatorNodeID)
-            {
-                result = entry;
-                return Loop::Break;
-            }
-            return Loop::Continue;
-        });
-        return result;
+        EntryType * entry = mIndex[IndexBucket(ephemeralInitiatorNodeID)];
+        while (entry != nullptr &&
+               (entry->GetSessionRole() != sessionRole || entry->GetEphemeralInitiatorNodeID() != ephemeralInitiatorNodeID))
+        {
+            entry = entry->mNextInBucket;
+        }
+        return entry;
     }
 
     EntryType * FindLeastRecentUsedEntry()
@@ -339,9 +343,39 @@ private:
         return result;
     }
 
-    void ReleaseEntry(EntryType * entry) { mEntries.ReleaseObject(entry); }
+    void ReleaseEntry(EntryType * entry)
+    {
+        EntryType ** link = &mIndex[IndexBucket(entry->GetEphemeralInitiatorNodeID())];
+        while (*link != entry)
+        {
+            VerifyOrDie(*link != nullptr);
+            link = &(*link)->mNextInBucket;
+        }
+        *link = entry->mNextInBucket;
+
+        mEntries.ReleaseObject(entry);
+    }
+
+    /**
+     * Entries are kept in a hash index on ephemeral initiator node ID, so that the lookup done for every received
+     * unauthenticated message does not scan the whole table. Each bucket is a list linked through the entries themselves.
+     */
+    static constexpr size_t kIndexBucketCount = SessionIndexBucketCount(kMaxSessionCount);
+
+    static size_t IndexBucket(NodeId ephemeralInitiatorNodeID)
+    {
+        return SessionIndexBucket(ephemeralInitiatorNodeID, kUndefinedFabricIndex, kIndexBucketCount);
+    }
+
+    void AddToIndex(EntryType * entry)
+    {
+        EntryType *& head    = mIndex[IndexBucket(entry->GetEphemeralInitiatorNodeID())];
+        entry->mNextInBucket = head;
+        head                 = entry;
+    }
 
     ObjectPool<EntryType, kMaxSessionCount> mEntries;
+    EntryType * mIndex[kIndexBucketCount] = {};
 };
 
 #if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
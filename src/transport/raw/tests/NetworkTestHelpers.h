@@ -67,6 +67,9 @@ public:
     // Called by the loopback transport when it drops one of a configurable number of messages (mDroppedMessageCount) after a
     // configurable allowed number of messages (mNumMessagesToAllowBeforeDropping)
     virtual void OnMessageDropped() {}
+
+    // Called by the loopback transport for every message it hands over for delivery, e.g. to account for traffic.
+    virtual void OnMessageSent(const Transport::PeerAddress & address, const System::PacketBufferHandle & msgBuf) {}
 };
 
 class LoopbackTransport : public Transport::Base
@@ -135,6 +138,11 @@ public:
             return CHIP_NO_ERROR;
         }
 
+        if (mDelegate != nullptr)
+        {
+            mDelegate->OnMessageSent(address, msgBuf);
+        }
+
         System::PacketBufferHandle receivedMessage = msgBuf.CloneData();
         mPendingMessageQueue.push(PendingMessageItem(address, std::move(receivedMessage)));
         return mSystemLayer->ScheduleWork(OnMessageReceived, this);
@@ -132,6 +132,67 @@ void TestFindByKeyId(nlTestSuite * inSuite, void * inContext)
     System::Clock::Internal::SetSystemClockForTesting(realClock);
 }
 
+void TestFindByPeer(nlTestSuite * inSuite, void * inContext)
+{
+    SecureSessionTable connections;
+    System::Clock::Internal::MockClock clock;
+    System::Clock::ClockBase * realClock = &System::SystemClock();
+    System::Clock::Internal::SetSystemClockForTesting(&clock);
+
+    auto countSessionsWithPeer = [&connections](const ScopedNodeId & peer) {
+        int count = 0;
+        connections.ForEachSessionWithPeer(peer, [&](auto * session) {
+            count++;
+            return Loop::Continue;
+        });
+        return count;
+    };
+
+    const ScopedNodeId peer1(kCasePeer1NodeId, kFabricIndex);
+    const ScopedNodeId peer2(kCasePeer2NodeId, kFabricIndex);
+
+    auto session1 = connections.CreateNewSecureSessionForTest(SecureSession::Type::kCASE, 2, kLocalNodeId, kCasePeer1NodeId,
+                                                              kPeer1CATs, 1, kFabricIndex, GetDefaultMRPConfig());
+    auto session2 = connections.CreateNewSecureSessionForTest(SecureSession::Type::kCASE, 4, kLocalNodeId, kCasePeer1NodeId,
+                                                              kPeer1CATs, 3, kFabricIndex, GetDefaultMRPConfig());
+    auto session3 = connections.CreateNewSecureSessionForTest(SecureSession::Type::kCASE, 6, kLocalNodeId, kCasePeer2NodeId,
+                                                              kPeer2CATs, 5, kFabricIndex, GetDefaultMRPConfig());
+    NL_TEST_ASSERT(inSuite, session1.HasValue() && session2.HasValue() && session3.HasValue());
+
+    NL_TEST_ASSERT(inSuite, countSessionsWithPeer(peer1) == 2);
+    NL_TEST_ASSERT(inSuite, countSessionsWithPeer(peer2) == 1);
+    NL_TEST_ASSERT(inSuite, countSessionsWithPeer(ScopedNodeId(kCasePeer1NodeId, kFabricIndex + 1)) == 0);
+
+    // Evicting sessions from within the iteration, including the one being visited, must not disturb it.
+    session1.ClearValue();
+    session2.ClearValue();
+    int visited = 0;
+    connections.ForEachSessionWithPeer(peer1, [&](auto * session) {
+        visited++;
+        session->MarkForEviction();
+        return Loop::Continue;
+    });
+    NL_TEST_ASSERT(inSuite, visited == 2);
+    NL_TEST_ASSERT(inSuite, countSessionsWithPeer(peer1) == 0);
+    NL_TEST_ASSERT(inSuite, !connections.FindSecureSessionByLocalKey(2).HasValue());
+    NL_TEST_ASSERT(inSuite, !connections.FindSecureSessionByLocalKey(4).HasValue());
+    NL_TEST_ASSERT(inSuite, connections.FindSecureSessionByLocalKey(6).HasValue());
+
+    // A PASE session that adopts a fabric moves to its new peer.
+    auto paseSession = connections.CreateNewSecureSession(SecureSession::Type::kPASE, ScopedNodeId());
+    NL_TEST_ASSERT(inSuite, paseSession.HasValue());
+    const NodeId pasePeerNodeId = NodeIdFromPAKEKeyId(kDefaultCommissioningPasscodeId);
+    paseSession.Value()->AsSecureSession()->Activate(ScopedNodeId(), ScopedNodeId(pasePeerNodeId, kUndefinedFabricIndex),
+                                                     CATValues{}, 7, ReliableMessageProtocolConfig(GetDefaultMRPConfig()));
+    NL_TEST_ASSERT(inSuite, countSessionsWithPeer(ScopedNodeId(pasePeerNodeId, kUndefinedFabricIndex)) == 1);
+
+    NL_TEST_ASSERT(inSuite, paseSession.Value()->AsSecureSession()->AdoptFabricIndex(kFabricIndex) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, countSessionsWithPeer(ScopedNodeId(pasePeerNodeId, kUndefinedFabricIndex)) == 0);
+    NL_TEST_ASSERT(inSuite, countSessionsWithPeer(ScopedNodeId(pasePeerNodeId, kFabricIndex)) == 1);
+
+    System::Clock::Internal::SetSystemClockForTesting(realClock);
+}
+
 struct ExpiredCallInfo
 {
     int callCount                   = 0;
@@ -158,6 +219,7 @@ static const nlTest sTests[] =
 {
     NL_TEST_DEF("BasicFunctionality", TestBasicFunctionality),
     NL_TEST_DEF("FindByKeyId", TestFindByKeyId),
+    NL_TEST_DEF("FindByPeer", TestFindByPeer),
     NL_TEST_SENTINEL()
 };
 // clang-format on
@@ -0,0 +1,229 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements chip-session-dispatch-benchmark, which measures the session lookups
+ *      SessionManager does for every received message, and for every message sent to a node, in
+ *      session tables holding many sessions.
+ *
+ *      Each lookup through the hash indexes of the tables is timed against the equivalent scan of
+ *      the whole table, which is what the lookups cost before the tables were indexed.
+ *
+ *      The secure session table holds at most CHIP_CONFIG_SECURE_SESSION_POOL_SIZE sessions unless
+ *      pools are allocated from the heap, and its indexes are sized for that many sessions: build
+ *      with the pool size of the configuration to measure (e.g. 1000, as config/ios does).
+ *
+ */
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/tests/BenchmarkSupport.h>
+#include <transport/SecureSessionTable.h>
+#include <transport/UnauthenticatedSessionTable.h>
+
+#include <algorithm>
+#include <inttypes.h>
+#include <memory>
+#include <stdio.h>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Benchmark;
+using namespace chip::Transport;
+
+namespace {
+
+#define TOOL_NAME "chip-session-dispatch-benchmark"
+
+constexpr size_t kMaxUnauthenticatedSessions = 1024;
+constexpr NodeId kLocalNodeId                = 0xC439A991071292DB;
+constexpr FabricIndex kFabricCount           = 4;
+
+struct BenchmarkOptions
+{
+    uint32_t sessionCount    = 1000;
+    uint32_t sessionsPerPeer = 1;
+    uint32_t lookupCount     = 1000000;
+} gOptions;
+
+const char * const gCmdOptionHelp =
+    "   --sessions <count>\n"
+    "       Number of sessions in each table. Defaults to 1000.\n"
+    "\n"
+    "   --sessions-per-peer <count>\n"
+    "       Number of secure sessions to each peer node. Defaults to 1.\n"
+    "\n"
+    "   --lookups <count>\n"
+    "       Number of lookups timed for each measurement. Defaults to 1000000.\n"
+    "\n";
+
+ScopedNodeId PeerFor(uint32_t index)
+{
+    uint32_t peer = index / gOptions.sessionsPerPeer;
+    return ScopedNodeId(static_cast<NodeId>(0x1000 + peer), static_cast<FabricIndex>(peer % kFabricCount + 1));
+}
+
+// Time @a lookup over the sequence of keys, and print the time per lookup.
+template <typename Key, typename Lookup>
+void Measure(const char * label, const std::vector<Key> & keys, Lookup && lookup)
+{
+    Timing timing = TimeEach(keys, lookup);
+    printf("  %-36s %8.1f ns/lookup (%u of %u found)\n", label, timing.MicrosecondsPerOperation() * 1000,
+           static_cast<unsigned>(timing.successCount), static_cast<unsigned>(timing.operationCount));
+}
+
+CHIP_ERROR RunSecureSessionLookups()
+{
+    SecureSessionTable table;
+    uint32_t sessionCount = 0;
+
+    // Sessions created for tests stay in the table until it is destroyed.
+    for (; sessionCount < gOptions.sessionCount; sessionCount++)
+    {
+        ScopedNodeId peer  = PeerFor(sessionCount);
+        uint16_t sessionId = static_cast<uint16_t>(sessionCount + 1);
+
+        auto session = table.CreateNewSecureSessionForTest(SecureSession::Type::kCASE, sessionId, kLocalNodeId, peer.GetNodeId(),
+                                                           CATValues{}, sessionId, peer.GetFabricIndex(), GetDefaultMRPConfig());
+        if (!session.HasValue())
+        {
+            break;
+        }
+    }
+    VerifyOrReturnError(sessionCount > 0, CHIP_ERROR_NO_MEMORY);
+
+    printf("Secure sessions: %u, %u per peer\n", static_cast<unsigned>(sessionCount),
+           static_cast<unsigned>(gOptions.sessionsPerPeer));
+
+    uint32_t random = 0x2545F491;
+    std::vector<uint16_t> localSessionIds;
+    std::vector<ScopedNodeId> peers;
+    localSessionIds.reserve(gOptions.lookupCount);
+    peers.reserve(gOptions.lookupCount);
+    for (uint32_t i = 0; i < gOptions.lookupCount; i++)
+    {
+        uint32_t index = NextRandom(random) % sessionCount;
+        localSessionIds.push_back(static_cast<uint16_t>(index + 1));
+        peers.push_back(PeerFor(index));
+    }
+
+    // SessionManager::SecureUnicastMessageDispatch
+    Measure("local session id, index", localSessionIds,
+            [&](uint16_t localSessionId) { return table.FindSecureSessionByLocalKey(localSessionId).HasValue(); });
+    Measure("local session id, scan", localSessionIds, [&](uint16_t localSessionId) {
+        SecureSession * result = nullptr;
+        table.ForEachSession([&](auto * session) {
+            if (session->GetLocalSessionId() == localSessionId)
+            {
+                result = session;
+                return Loop::Break;
+            }
+            return Loop::Continue;
+        });
+        return result != nullptr && MakeOptional<SessionHandle>(*result).HasValue();
+    });
+
+    // SessionManager::FindSecureSessionForNode
+    auto selectMostRecent = [](SecureSession *& found, SecureSession * session) {
+        if (session->IsActiveSession() && (found == nullptr || found->GetLastActivityTime() < session->GetLastActivityTime()))
+        {
+            found = session;
+        }
+        return Loop::Continue;
+    };
+    Measure("peer, index", peers, [&](const ScopedNodeId & peer) {
+        SecureSession * found = nullptr;
+        table.ForEachSessionWithPeer(peer, [&](auto * session) { return selectMostRecent(found, session); });
+        return found != nullptr;
+    });
+    Measure("peer, scan", peers, [&](const ScopedNodeId & peer) {
+        SecureSession * found = nullptr;
+        table.ForEachSession([&](auto * session) {
+            return session->GetPeer() == peer ? selectMostRecent(found, session) : Loop::Continue;
+        });
+        return found != nullptr;
+    });
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR RunUnauthenticatedSessionLookups()
+{
+    auto table = std::make_unique<UnauthenticatedSessionTable<kMaxUnauthenticatedSessions>>();
+    std::vector<std::unique_ptr<SessionHolder>> sessions;
+    uint32_t sessionCount = std::min<uint32_t>(gOptions.sessionCount, kMaxUnauthenticatedSessions);
+    sessions.reserve(sessionCount);
+
+    // Hold on to the sessions, which are otherwise released (with heap pools) or reused (without).
+    for (uint32_t i = 0; i < sessionCount; i++)
+    {
+        auto session = table->FindOrAllocateResponder(static_cast<NodeId>(0x2000 + i), GetDefaultMRPConfig());
+        VerifyOrReturnError(session.HasValue(), CHIP_ERROR_NO_MEMORY);
+        sessions.push_back(std::make_unique<SessionHolder>());
+        sessions.back()->Grab(session.Value());
+    }
+
+    printf("Unauthenticated sessions: %u\n", static_cast<unsigned>(sessionCount));
+
+    uint32_t random = 0x2545F491;
+    std::vector<NodeId> ephemeralInitiatorNodeIds;
+    ephemeralInitiatorNodeIds.reserve(gOptions.lookupCount);
+    for (uint32_t i = 0; i < gOptions.lookupCount; i++)
+    {
+        ephemeralInitiatorNodeIds.push_back(static_cast<NodeId>(0x2000 + NextRandom(random) % sessionCount));
+    }
+
+    // SessionManager::UnauthenticatedMessageDispatch
+    Measure("ephemeral initiator node id, index", ephemeralInitiatorNodeIds, [&](NodeId ephemeralInitiatorNodeId) {
+        return table->FindOrAllocateResponder(ephemeralInitiatorNodeId, GetDefaultMRPConfig()).HasValue();
+    });
+
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    CommandLine commandLine(TOOL_NAME, "Measure the per-message session lookups of SessionManager in large session tables.\n",
+                            {
+                                Option::Count("sessions", gOptions.sessionCount, 1, kMaxSessionID - 1),
+                                Option::Count("sessions-per-peer", gOptions.sessionsPerPeer),
+                                Option::Count("lookups", gOptions.lookupCount),
+                            },
+                            gCmdOptionHelp);
+
+    CHIP_ERROR err = Platform::MemoryInit();
+    SuccessOrExit(err);
+
+    if (!commandLine.Parse(argc, argv))
+    {
+        Platform::MemoryShutdown();
+        return EXIT_FAILURE;
+    }
+
+    err = RunSecureSessionLookups();
+    SuccessOrExit(err);
+    err = RunUnauthenticatedSessionLookups();
+    SuccessOrExit(err);
+
+exit:
+    Platform::MemoryShutdown();
+    return commandLine.ExitStatus(err);
+}